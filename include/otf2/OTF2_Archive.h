@@ -462,6 +462,136 @@ OTF2_Archive_SetLockingCallbacks( OTF2_Archive*                archive,
                                   void*                        lockingData );
 
 
+/** @brief Set the parallel callbacks for the archive.
+ *
+ *  With these callbacks the remaining local event, definition, and snapshot
+ *  writers are finalized concurrently in @eref{OTF2_Archive_Close},
+ *  @eref{OTF2_Archive_CloseEvtFiles}, and @eref{OTF2_Archive_CloseDefFiles},
+ *  if also locking callbacks are set. The flush and memory callbacks of the
+ *  archive are then called concurrently. The written files are the same as
+ *  without the callbacks. Writers of archives using the
+ *  @eref{OTF2_SUBSTRATE_SION} substrate are always finalized one after
+ *  another.
+ *
+ *  In reading mode, @eref{OTF2_Archive_UnifyLocalDefinitions} and
+ *  @eref{OTF2_Archive_LoadLocalDefinitions} read the local definitions of
+ *  the locations concurrently, if also locking callbacks are set.
+ *
+ *  Can be called any time, but only once.
+ *
+ *  @param archive            Archive handle.
+ *  @param parallelCallbacks  Struct holding the parallel callback functions.
+ *  @param parallelData       Data passed to the parallel callbacks in the
+ *                            @p userData argument.
+ *
+ *  @since Version 2.0
+ *
+ *  @retbegin
+ *    @retcode{OTF2_SUCCESS, if successful}
+ *    @retcode{OTF2_ERROR_INVALID_ARGUMENT,
+ *             in case of NULL pointers for @a archive or @a parallelCallbacks\,
+ *             or mandatory callbacks in @a parallelCallbacks are missing}
+ *    @retcode{OTF2_ERROR_INVALID_CALL,
+ *             in case there were parallel callbacks already set}
+ *  @retend
+ */
+OTF2_ErrorCode
+OTF2_Archive_SetParallelCallbacks( OTF2_Archive*                 archive,
+                                   const OTF2_ParallelCallbacks* parallelCallbacks,
+                                   void*                         parallelData );
+
+
+/** @brief Use the clock of OTF2 for the timestamps of the archive.
+ *
+ *  OTF2 reads the time stamp counter of the CPU, if it is invariant, and
+ *  @p clock_gettime( @p CLOCK_MONOTONIC_RAW ) else. The resolution of the
+ *  clock is calibrated by this call. Timestamps are taken with
+ *  @eref{OTF2_Archive_GetTime}.
+ *
+ *  The clocks of all processes are synchronized with the clock of the root
+ *  process by this call and by @eref{OTF2_Archive_CloseEvtFiles}. The offset
+ *  is measured with round trips of a barrier and a broadcast of the root
+ *  clock, its error is at most half of the shortest of these round trips.
+ *  OTF2 then writes:
+ *  - The ClockProperties definition, when the global definition writer is
+ *    closed after @eref{OTF2_Archive_CloseEvtFiles}. Otherwise the values
+ *    can be queried with @eref{OTF2_Archive_GetClockProperties}.
+ *  - The ClockOffset definitions of a location, when its definition writer
+ *    is closed after @eref{OTF2_Archive_CloseEvtFiles}, if the process runs
+ *    on another host than the root process.
+ *  - The time of the BufferFlush events, if no post flush callback is set.
+ *
+ *  Don't write ClockProperties and ClockOffset definitions yourself.
+ *
+ *  This function is a collective operation and can only be called once
+ *  after the collective callbacks are set.
+ *
+ *  @param archive  Archive handle.
+ *
+ *  @since Version 2.0
+ *
+ *  @retbegin
+ *    @retcode{OTF2_SUCCESS, if successful}
+ *    @retcode{OTF2_ERROR_INVALID_ARGUMENT,
+ *             in case of a NULL pointer for @a archive}
+ *    @retcode{OTF2_ERROR_INVALID_CALL,
+ *             in case the archive is not in writing mode\, no collective
+ *             callbacks are set\, or the clock is already used}
+ *    @retcode{OTF2_ERROR_COLLECTIVE_CALLBACK,
+ *             if the synchronization failed}
+ *  @retend
+ */
+OTF2_ErrorCode
+OTF2_Archive_SetBuiltinClock( OTF2_Archive* archive );
+
+
+/** @brief Read the clock of OTF2.
+ *
+ *  Can be called concurrently by all threads.
+ *
+ *  @param archive  Archive handle.
+ *
+ *  @since Version 2.0
+ *
+ *  @return The current local time in ticks of the clock, or @p 0 if
+ *          @eref{OTF2_Archive_SetBuiltinClock} was not called.
+ */
+OTF2_TimeStamp
+OTF2_Archive_GetTime( OTF2_Archive* archive );
+
+
+/** @brief Get the values for the ClockProperties definition of the clock of
+ *  OTF2.
+ *
+ *  The values are those of the root process, which writes the global
+ *  definitions. Before @eref{OTF2_Archive_CloseEvtFiles}, the trace length
+ *  reaches up to now.
+ *
+ *  @param archive              Archive handle.
+ *  @param[out] timerResolution Ticks per second.
+ *  @param[out] globalOffset    Time of the synchronization in
+ *                              @eref{OTF2_Archive_SetBuiltinClock}.
+ *  @param[out] traceLength     Time from @a globalOffset to the
+ *                              synchronization in
+ *                              @eref{OTF2_Archive_CloseEvtFiles}.
+ *
+ *  @since Version 2.0
+ *
+ *  @retbegin
+ *    @retcode{OTF2_SUCCESS, if successful}
+ *    @retcode{OTF2_ERROR_INVALID_ARGUMENT,
+ *             in case of NULL pointers}
+ *    @retcode{OTF2_ERROR_INVALID_CALL,
+ *             if @eref{OTF2_Archive_SetBuiltinClock} was not called}
+ *  @retend
+ */
+OTF2_ErrorCode
+OTF2_Archive_GetClockProperties( OTF2_Archive* archive,
+                                 uint64_t*     timerResolution,
+                                 uint64_t*     globalOffset,
+                                 uint64_t*     traceLength );
+
+
 /** @brief Set the @a hint in the @a archive to the given @a value.
  *
  *  Hints can only be set once and only before OTF2 itself uses the hint
@@ -493,6 +623,36 @@ OTF2_Archive_SetHint( OTF2_Archive* archive,
                       void*         value );
 
 
+/** @brief Filter regions from being recorded by the event writers of the
+ *         archive.
+ *
+ *  Enter and Leave events of filtered regions are dropped by all event
+ *  writers of the archive, before they use any buffer space. The filter
+ *  can be changed at any time, the event writers see the change without
+ *  locking. The Leave event of a region is dropped, if and only if its Enter
+ *  event was dropped. The number of dropped calls per region is available
+ *  with @eref{OTF2_EvtWriter_GetSuppressedCalls}.
+ *
+ *  @note This call is only allowed when the archive was opened with mode
+ *        @eref{OTF2_FILEMODE_WRITE}.
+ *
+ *  @param archive          Archive handle.
+ *  @param numberOfRegions  Number of regions in @a regions.
+ *  @param regions          The regions to change.
+ *  @param filtered         @eref{OTF2_TRUE} to filter the regions,
+ *                          @eref{OTF2_FALSE} to record them again.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_Archive_SetRegionFilter( OTF2_Archive*         archive,
+                              uint32_t              numberOfRegions,
+                              const OTF2_RegionRef* regions,
+                              OTF2_Boolean          filtered );
+
+
 /** @brief Add or remove a trace file property to this archive.
  *
  *  Removing a trace file property is done by passing "" in the @p value parameter.
@@ -1157,6 +1317,9 @@ OTF2_Archive_OpenEvtFiles( OTF2_Archive* archive );
  *
  *  This function is a collective operation.
  *
+ *  In writing mode, all event writers which are still open are closed first,
+ *  see @eref{OTF2_Archive_SetParallelCallbacks}.
+ *
  *  @param archive          Archive handle.
  *
  *  @since Version 1.3
@@ -1187,6 +1350,9 @@ OTF2_Archive_OpenDefFiles( OTF2_Archive* archive );
  *
  *  This function is a collective operation.
  *
+ *  In writing mode, all local definition writers which are still open are
+ *  closed first, see @eref{OTF2_Archive_SetParallelCallbacks}.
+ *
  *  @param archive          Archive handle.
  *
  *  @since Version 1.3
@@ -1243,6 +1409,138 @@ OTF2_Archive_SelectLocation( OTF2_Archive*    archive,
                              OTF2_LocationRef location );
 
 
+/** @brief Called by @eref{OTF2_Archive_UnifyLocalDefinitions} with the
+ *  mapping table of a location.
+ *
+ *  @param userData     Value from parameter @a userData passed to
+ *                      @eref{OTF2_Archive_UnifyLocalDefinitions}.
+ *  @param location     The location.
+ *  @param mappingType  The definition class of the mapping.
+ *  @param idMap        Maps the local identifiers of the location to the
+ *                      global identifiers. Valid only during the call, it
+ *                      can be passed to @eref{OTF2_DefWriter_WriteMappingTable}.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_CALLBACK_SUCCESS} or @eref{OTF2_CALLBACK_ERROR}.
+ */
+typedef OTF2_CallbackCode
+( *OTF2_UnifiedMappingTableCallback )( void*             userData,
+                                       OTF2_LocationRef  location,
+                                       OTF2_MappingType  mappingType,
+                                       const OTF2_IdMap* idMap );
+
+
+/** @brief Unify the local definitions of locations into global definitions.
+ *
+ *  Reads the @eref{String}, @eref{Region}, @eref{Group}, @eref{Comm},
+ *  @eref{SourceCodeLocation}, @eref{CallingContext}, @eref{Attribute},
+ *  @eref{Parameter}, @eref{RmaWin}, @eref{InterruptGenerator},
+ *  @eref{MetricMember}, @eref{MetricClass}, and @eref{MetricInstance}
+ *  definitions of the given locations, merges equal definitions of all
+ *  locations into one global definition, and writes these to
+ *  @a globalDefWriter, which usually belongs to another archive in writing
+ *  mode. The unified definitions of a class get the global identifiers
+ *  starting from @p 0 in the order of @a locations and, per location, of
+ *  the local identifiers, metric classes and instances share theirs. A
+ *  parent, like the parent @eref{Comm} or the class of a metric instance,
+ *  gets its identifier before the definitions referencing it.
+ *  Local @eref{MappingTable}, @eref{ClockOffset}, and @eref{EventTimeRange}
+ *  definitions are ignored. Local definitions of any other class keep their
+ *  identifiers, which must be global already. They are written after the
+ *  unified definitions, equal ones of all locations only once.
+ *
+ *  References to unified definitions must be defined before in the local
+ *  definitions of the same location. Other references, like the members of
+ *  groups of locations, are taken as they are.
+ *
+ *  Afterwards, @a mappingTableCallback is called for every location in the
+ *  order of @a locations and every definition class with a mapping type,
+ *  whose local identifiers do not map to the same global identifiers.
+ *
+ *  The locations must be selected with @eref{OTF2_Archive_SelectLocation}
+ *  and the local definition files must be opened with
+ *  @eref{OTF2_Archive_OpenDefFiles}. With parallel and locking callbacks
+ *  set, the locations are read concurrently and the equal definitions are
+ *  found with locks only on a small part of the known definitions. The
+ *  global identifiers are assigned after all locations were read and do not
+ *  depend on the order in which the threads find the definitions.
+ *
+ *  @param archive               Archive handle, in reading mode.
+ *  @param numberOfLocations     Number of locations.
+ *  @param locations             The locations to unify.
+ *  @param globalDefWriter       Writer for the global definitions.
+ *  @param mappingTableCallback  Called with the mapping tables, may be NULL.
+ *  @param userData              Passed to @a mappingTableCallback.
+ *  @param[out] numberOfStrings  Number of unified @eref{String} definitions,
+ *                               i.e., the first free global identifier for
+ *                               additional strings, may be NULL.
+ *
+ *  @since Version 2.0
+ *
+ *  @retbegin
+ *    @retcode{OTF2_SUCCESS, if successful}
+ *    @retcode{OTF2_ERROR_INVALID_ARGUMENT,
+ *             in case of NULL pointers for @a archive\, @a locations\, or
+ *             @a globalDefWriter}
+ *    @retcode{OTF2_ERROR_INVALID_CALL,
+ *             if the archive is not in reading mode}
+ *    @retcode{OTF2_ERROR_INTEGRITY_FAULT,
+ *             in case of references to unknown local definitions\, or
+ *             different local definitions with the same identifier\, which
+ *             keep their identifiers}
+ *    @retcode{OTF2_ERROR_INTERRUPTED_BY_CALLBACK,
+ *             if @a mappingTableCallback returned an error}
+ *  @retend
+ */
+OTF2_ErrorCode
+OTF2_Archive_UnifyLocalDefinitions( OTF2_Archive*                    archive,
+                                    uint32_t                         numberOfLocations,
+                                    const OTF2_LocationRef*          locations,
+                                    OTF2_GlobalDefWriter*            globalDefWriter,
+                                    OTF2_UnifiedMappingTableCallback mappingTableCallback,
+                                    void*                            userData,
+                                    uint64_t*                        numberOfStrings );
+
+
+/** @brief Load the local definitions of all selected locations.
+ *
+ *  Reads the local definitions of every location selected with
+ *  @eref{OTF2_Archive_SelectLocation}, so that their mapping tables, clock
+ *  offsets, and event time ranges are applied by the event readers
+ *  afterwards. This replaces reading the local definitions of each location
+ *  with @eref{OTF2_Archive_GetDefReader} and
+ *  @eref{OTF2_DefReader_ReadDefinitions} without callbacks. Locations
+ *  without a local definition file are skipped. A duplicate mapping table of
+ *  a location is ignored, the first one stays in effect.
+ *
+ *  The local definition files must be opened with
+ *  @eref{OTF2_Archive_OpenDefFiles} and the local definitions of the
+ *  locations must not have been read before. With parallel and locking
+ *  callbacks set, the locations are read concurrently, no other call to the
+ *  archive must be done in the meantime.
+ *
+ *  @param archive          Archive handle, in reading mode.
+ *  @param skipDefinitions  Read only the mapping tables, clock offsets, and
+ *                          event time ranges, and skip all other records
+ *                          without decoding them.
+ *
+ *  @since Version 2.0
+ *
+ *  @retbegin
+ *    @retcode{OTF2_SUCCESS, if successful}
+ *    @retcode{OTF2_ERROR_INVALID_ARGUMENT,
+ *             if @a archive is NULL}
+ *    @retcode{OTF2_ERROR_INVALID_CALL,
+ *             if the archive is not in reading mode}
+ *    @retelse{the error code of the first failed location}
+ *  @retend
+ */
+OTF2_ErrorCode
+OTF2_Archive_LoadLocalDefinitions( OTF2_Archive* archive,
+                                   bool          skipDefinitions );
+
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
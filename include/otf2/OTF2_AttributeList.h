@@ -144,6 +144,29 @@ OTF2_AttributeList_AddAttribute( OTF2_AttributeList* attributeList,
                                  OTF2_AttributeValue attributeValue );
 
 
+/** @brief Add several attributes to an attribute list.
+ *
+ *  Adds the attributes in the given order. If one of the attributes already
+ *  exists, none of them is added and an error is returned.
+ *
+ *  @param attributeList      Attribute list handle.
+ *  @param numberOfAttributes Number of attributes to add.
+ *  @param attributes         References to the attribute definitions.
+ *  @param types              Types of the attributes.
+ *  @param attributeValues    Values of the attributes.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_AttributeList_AddAttributes( OTF2_AttributeList*        attributeList,
+                                  uint32_t                   numberOfAttributes,
+                                  const OTF2_AttributeRef*   attributes,
+                                  const OTF2_Type*           types,
+                                  const OTF2_AttributeValue* attributeValues );
+
+
 
 /** @brief Add an OTF2_TYPE_UINT8 attribute to an attribute list.
  *
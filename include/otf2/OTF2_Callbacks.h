@@ -638,6 +638,101 @@ typedef struct OTF2_LockingCallbacks
 } OTF2_LockingCallbacks;
 
 
+/**
+ * @}
+ */
+
+
+/**
+ *  @defgroup callbacks_parallel Finalizing writers in parallel
+ *
+ *  OTF2 itself does not create any threads.  When an @eref{OTF2_Archive}
+ *  finalizes many writers at once, i.e., in @eref{OTF2_Archive_Close},
+ *  @eref{OTF2_Archive_CloseEvtFiles}, and @eref{OTF2_Archive_CloseDefFiles},
+ *  the writers are independent of each other and can be flushed, compressed,
+ *  and written into their files concurrently.  Likewise, a reading
+ *  @eref{OTF2_Archive} reads the local definitions of many locations
+ *  concurrently in @eref{OTF2_Archive_UnifyLocalDefinitions} and
+ *  @eref{OTF2_Archive_LoadLocalDefinitions}.  By registering
+ *  the following callbacks, OTF2 hands these tasks to threads of the caller.
+ *
+ *  The tasks are only handed out, if also the locking callbacks are set,
+ *  see @ref callbacks_locking. The flush and memory callbacks of the archive
+ *  are called concurrently from these threads, thus they need to be
+ *  thread-safe.
+ *
+ *  OTF2 provides an implementation for Pthread, see the header file
+ *  @eref{otf2/OTF2_Pthread_Locks.h}.
+ *
+ *  If the callback returns !@eref{OTF2_CALLBACK_SUCCESS}, than OTF2 runs the
+ *  tasks, which were not run by the callback, by itself.
+ * @{
+ */
+
+
+/** @brief A task to be run by @eref{OTF2_Parallel_Run}.
+ *
+ *  @param taskData   Value from parameter @a taskData passed to
+ *                    @eref{OTF2_Parallel_Run}.
+ *  @param taskIndex  Index of the task, between 0 and @a numberOfTasks - 1.
+ *
+ *  @since Version 2.0
+ */
+typedef void
+( *OTF2_Parallel_Task )( void*    taskData,
+                         uint32_t taskIndex );
+
+
+/** @brief Runs a number of independent tasks, possibly concurrently.
+ *
+ *  The callback must call @a task exactly once for every index between 0
+ *  and @a numberOfTasks - 1, in any order and from any thread, and return
+ *  only after all calls finished.
+ *
+ *  @param userData       Value from parameter @a userData passed to
+ *                        @eref{OTF2_Archive_SetParallelCallbacks}.
+ *  @param numberOfTasks  Number of tasks.
+ *  @param task           The task function.
+ *  @param taskData       Data to pass to @a task.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_CALLBACK_SUCCESS} or @eref{OTF2_CALLBACK_ERROR}.
+ */
+typedef OTF2_CallbackCode
+( *OTF2_Parallel_Run )( void*              userData,
+                        uint32_t           numberOfTasks,
+                        OTF2_Parallel_Task task,
+                        void*              taskData );
+
+
+/** @brief Signals the end of life of the @eref{OTF2_Archive} object to the
+ *  parallel callbacks.
+ *
+ *  No further calls to the callbacks will be done after this call.
+ *
+ *  This callback is optional.
+ *
+ *  @param userData  Value from parameter @a userData passed to
+ *                   @eref{OTF2_Archive_SetParallelCallbacks}.
+ *
+ *  @since Version 2.0
+ */
+typedef void
+( *OTF2_Parallel_Release )( void* userData );
+
+
+/** @brief Struct which holds all parallel callbacks.
+ *
+ *  @since Version 2.0
+ */
+typedef struct OTF2_ParallelCallbacks
+{
+    OTF2_Parallel_Release otf2_release;
+    OTF2_Parallel_Run     otf2_run;
+} OTF2_ParallelCallbacks;
+
+
 /**
  * @}
  */
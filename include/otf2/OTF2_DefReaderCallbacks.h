@@ -208,6 +208,52 @@ OTF2_DefReaderCallbacks_SetClockOffsetCallback(
     OTF2_DefReaderCallback_ClockOffset clockOffsetCallback );
 
 
+/** @brief Function pointer definition for the callback which is triggered by
+ *         a @eref{EventTimeRange} definition record.
+ *
+ *  The range of the event timestamps of this location. Readers use it to
+ *  order locations without opening their event files. The timestamps
+ *  are not clock corrected. At most one such definition per location
+ *  is allowed. The library writes it when the local definition writer
+ *  is closed after the event writer of the location, unless the
+ *  writer already got one.
+ *  
+ *  @param userData       User data as set by
+ *                        @eref{OTF2_Reader_RegisterDefCallbacks} or
+ *                        @eref{OTF2_DefReader_SetCallbacks}.
+ *  @param firstTimestamp Timestamp of the first event of this location.
+ *  @param lastTimestamp  Timestamp of the last event of this location.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_CALLBACK_SUCCESS} or @eref{OTF2_CALLBACK_INTERRUPT}.
+ */
+typedef OTF2_CallbackCode
+( *OTF2_DefReaderCallback_EventTimeRange )( void* userData ,
+OTF2_TimeStamp firstTimestamp,
+OTF2_TimeStamp lastTimestamp );
+
+
+/** @brief Registers the callback for the @eref{EventTimeRange} definition.
+ *  
+ *  @param defReaderCallbacks     Struct for all callbacks.
+ *  @param eventTimeRangeCallback Function which should be called for all
+ *                                @eref{EventTimeRange} definitions.
+ *
+ *  @since Version 2.0
+ *
+ *  @retbegin
+ *    @retcode{OTF2_SUCCESS, if successful}
+ *    @retcode{OTF2_ERROR_INVALID_ARGUMENT,
+ *             for an invalid @p defReaderCallbacks argument}
+ *  @retend
+ */
+OTF2_ErrorCode
+OTF2_DefReaderCallbacks_SetEventTimeRangeCallback(
+    OTF2_DefReaderCallbacks*            defReaderCallbacks,
+    OTF2_DefReaderCallback_EventTimeRange eventTimeRangeCallback );
+
+
 /** @brief Function pointer definition for the callback which is triggered by
  *         a @eref{String} definition record.
  *
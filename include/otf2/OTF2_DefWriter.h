@@ -120,6 +120,29 @@ int64_t offset,
 double standardDeviation );
 
 
+/** @brief Writes a EventTimeRange definition record into the DefWriter.
+ *
+ *  The range of the event timestamps of this location. Readers use it to
+ *  order locations without opening their event files. The timestamps
+ *  are not clock corrected. At most one such definition per location
+ *  is allowed. The library writes it when the local definition writer
+ *  is closed after the event writer of the location, unless the
+ *  writer already got one.
+ *  
+ *  @param writer         Writer object.
+ *  @param firstTimestamp Timestamp of the first event of this location.
+ *  @param lastTimestamp  Timestamp of the last event of this location.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_DefWriter_WriteEventTimeRange( OTF2_DefWriter* writer ,
+OTF2_TimeStamp firstTimestamp,
+OTF2_TimeStamp lastTimestamp );
+
+
 /** @brief Writes a String definition record into the DefWriter.
  *
  *  The string definition.
@@ -298,6 +298,7 @@ enum OTF2_Compression_enum
  * - @eref{OTF2_Reader_ReadLocalEventsBackward}
  * - @eref{OTF2_Reader_ReadGlobalEvents}
  * - @eref{OTF2_Reader_ReadAllGlobalEvents}
+ * - @eref{OTF2_Reader_ReadGlobalEventsBackward}
  * - @eref{OTF2_Reader_ReadLocalDefinitions}
  * - @eref{OTF2_Reader_ReadAllLocalDefinitions}
  * - @eref{OTF2_Reader_ReadGlobalDefinitions}
@@ -374,7 +375,209 @@ enum OTF2_Hint_enum
      *
      *  The hint will be locked when opening any of the per-location data files.
      */
-    OTF2_HINT_GLOBAL_READER = 0
+    OTF2_HINT_GLOBAL_READER = 0,
+
+    /** Limit the number of files which are kept open concurrently by the
+     *  POSIX file substrate while reading.
+     *
+     *  If more files are needed, the least recently used ones are closed
+     *  and transparently re-opened on their next access. Independent of this
+     *  hint, files are also recycled when the operating system refuses to
+     *  open further files.
+     *
+     *  Datatype @p uint32_t with default value @p 0, which means no
+     *  limit.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_READ}.
+     *
+     *  The hint will be locked when opening any of the per-location data files.
+     */
+    OTF2_HINT_MAX_OPEN_FILES = 1,
+
+    /** Limit the memory in bytes used for the event chunks of all local
+     *  event readers operated by the global event reader.
+     *
+     *  If the limit is exceeded, the chunks of the local event readers
+     *  which were used least recently are released and re-read from the
+     *  file when the location is needed again. At least one chunk per
+     *  location in the merge is kept resident at any time. Compressed
+     *  archives are not affected by this hint.
+     *
+     *  Datatype @p uint64_t with default value @p 0, which means no
+     *  limit.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_READ}.
+     *
+     *  The hint will be locked when the global event reader is created.
+     */
+    OTF2_HINT_MAX_CHUNK_MEMORY = 2,
+
+    /** Store an index of every n-th event in each event chunk.
+     *
+     *  The index is placed at the end of the chunk and lets readers position
+     *  inside a chunk without decoding all preceding events. This speeds up
+     *  seeking and backward reading. Readers not knowing the index ignore it.
+     *  Archives with compression don't store the index.
+     *
+     *  Datatype @p uint32_t with default value @p 0, which means no
+     *  index is written.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_WRITE}.
+     *
+     *  The hint will be locked when the first event writer is created.
+     */
+    OTF2_HINT_EVENT_INDEX_INTERVAL = 3,
+
+    /** Omit the region of leave events which match the innermost entered
+     *  region.
+     *
+     *  The event writer keeps a stack of the entered regions per location.
+     *  A @eref{OTF2_EvtWriter_Leave} for the region on top of this stack is
+     *  stored without its region, as long as the matching enter is in the
+     *  same chunk and the same index segment (see
+     *  @eref{OTF2_HINT_EVENT_INDEX_INTERVAL}). Readers reconstruct the region
+     *  and deliver the leave event unchanged. Readers of OTF2 versions before
+     *  2.0 can't read such archives.
+     *
+     *  Datatype @eref{OTF2_Boolean} with default value @eref{OTF2_FALSE}.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_WRITE}.
+     *
+     *  The hint will be locked when the first event writer is created.
+     */
+    OTF2_HINT_IMPLICIT_LEAVE = 4,
+
+    /** Store the attribute IDs and types of recurring attribute lists only
+     *  once per chunk.
+     *
+     *  The first attribute list with a new sequence of attribute IDs and
+     *  types in a chunk defines this shape, later lists with the same shape
+     *  reference it and store only their values. Readers expand the lists
+     *  transparently. Readers of OTF2 versions before 2.0 can't read such
+     *  archives.
+     *
+     *  Datatype @eref{OTF2_Boolean} with default value @eref{OTF2_FALSE}.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_WRITE}.
+     *
+     *  The hint will be locked when the first event writer is created.
+     */
+    OTF2_HINT_ATTRIBUTE_LIST_SHAPES = 5,
+
+    /** Store metric samples as differences to the previous sample.
+     *
+     *  The first sample of a metric in a chunk and in each index segment
+     *  (see @eref{OTF2_HINT_EVENT_INDEX_INTERVAL}) is stored completely.
+     *  Later samples with the same number and types of values omit the
+     *  types and store integer values as differences and floating point
+     *  values as the bitwise exclusive or with the previous sample.
+     *  Readers reconstruct the exact values. Readers of OTF2 versions
+     *  before 2.0 can't read such archives.
+     *
+     *  Datatype @eref{OTF2_Boolean} with default value @eref{OTF2_FALSE}.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_WRITE}.
+     *
+     *  The hint will be locked when the first event writer is created.
+     */
+    OTF2_HINT_METRIC_DELTAS = 6,
+
+    /** Store calling context samples as differences to the previous sample.
+     *
+     *  The first sample in a chunk and in each index segment (see
+     *  @eref{OTF2_HINT_EVENT_INDEX_INTERVAL}) is stored completely. Later
+     *  samples store the difference of the calling context reference to the
+     *  previous one, the unwind distance and the interrupt generator only
+     *  if they changed. Readers reconstruct the exact values. Readers of
+     *  OTF2 versions before 2.0 can't read such archives.
+     *
+     *  Datatype @eref{OTF2_Boolean} with default value @eref{OTF2_FALSE}.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_WRITE}.
+     *
+     *  The hint will be locked when the first event writer is created.
+     */
+    OTF2_HINT_CALLING_CONTEXT_DELTAS = 7,
+
+    /** Select how the memory for the chunks of the event, local definition,
+     *  and snapshot writers is allocated.
+     *
+     *  See @eref{OTF2_ChunkAllocation_enum} for the possible values. Page
+     *  backed chunks are not bound to a NUMA node explicitly, the pages are
+     *  placed by the first touch policy of the system on the node of the
+     *  thread which first writes into them. This is the thread using the
+     *  writer, except for the first page of the first chunk, which gets the
+     *  file header when the writer is created. Thus writers should be
+     *  created by the threads using them. Each chunk is a separate mapping,
+     *  thus this is meant for large chunk sizes. The hint has no effect if
+     *  memory callbacks are set (see @eref{OTF2_Archive_SetMemoryCallbacks})
+     *  and platforms without page mappings use the heap.
+     *
+     *  Datatype @eref{OTF2_ChunkAllocation} with default value
+     *  @eref{OTF2_CHUNK_ALLOCATION_HEAP}.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_WRITE}.
+     *
+     *  The hint will be locked when the first of these writers is created.
+     */
+    OTF2_HINT_CHUNK_ALLOCATION = 8,
+
+    /** Let each event writer choose the size of its chunks between this
+     *  minimum and the event chunk size of the archive.
+     *
+     *  A writer starts with the minimum size and doubles the size of its next
+     *  chunk, as long as the rate of the written data, measured by the
+     *  timestamps, did not drop to less than half of that of the previous
+     *  chunk. Otherwise the size is halved. The size is also halved, if the
+     *  remaining memory of the writer does not suffice for the chunk, thus
+     *  writers with few events occupy less memory and the memory is used up
+     *  before the writer is flushed. Each chunk records its size in its
+     *  header. Readers of OTF2 versions before 2.0 can't read such archives.
+     *  The hint has no effect for compressed archives and if memory callbacks
+     *  are set (see @eref{OTF2_Archive_SetMemoryCallbacks}).
+     *
+     *  Datatype @p uint64_t with default value @p 0, which means all chunks
+     *  have the event chunk size of the archive. Other values must be in the
+     *  range of @eref{OTF2_CHUNK_SIZE_MIN} and @eref{OTF2_CHUNK_SIZE_MAX}.
+     *
+     *  This is for an @eref{OTF2_Archive} only valid if the file mode equals to
+     *  @eref{OTF2_FILEMODE_WRITE}.
+     *
+     *  The hint will be locked when the first event writer is created.
+     */
+    OTF2_HINT_ADAPTIVE_CHUNK_SIZE = 9
+};
+
+
+/** @brief Wrapper for enum @eref{OTF2_ChunkAllocation_enum}. */
+typedef uint8_t OTF2_ChunkAllocation;
+
+/**
+ * @brief Defines how the memory of the writer chunks is allocated.
+ *
+ * @since Version 2.0
+ */
+enum OTF2_ChunkAllocation_enum
+{
+    /** Allocate the chunks from the heap. Chunks may reuse memory released
+     *  by other writers and thus by other threads. */
+    OTF2_CHUNK_ALLOCATION_HEAP        = 0,
+    /** Map fresh pages for each chunk and release them when the chunk is
+     *  freed. */
+    OTF2_CHUNK_ALLOCATION_LOCAL_PAGES = 1,
+    /** Like @eref{OTF2_CHUNK_ALLOCATION_LOCAL_PAGES}, but back the chunks
+     *  with huge pages. Explicitly reserved huge pages are used if available,
+     *  else transparent huge pages are requested. The chunks occupy whole
+     *  huge pages. */
+    OTF2_CHUNK_ALLOCATION_HUGE_PAGES  = 2
 };
 
 
@@ -123,6 +123,78 @@ OTF2_GlobalEvtReader_ReadEvents( OTF2_GlobalEvtReader* reader,
                                  uint64_t*             recordsRead );
 
 
+/** @brief Reads the given number of records backwards from the global event
+ *         reader.
+ *
+ *  The events are delivered in the reverse order of
+ *  @eref{OTF2_GlobalEvtReader_ReadEvents}, starting with the event before the
+ *  last delivered one. Reading forward and backward can be mixed, the
+ *  position between the events stays. Use @eref{OTF2_GlobalEvtReader_SeekTime}
+ *  with @eref{OTF2_UNDEFINED_TIMESTAMP} to read backward from the end of the
+ *  trace.
+ *
+ *  Not supported for compressed event files.
+ *
+ *  @param reader           The records of this reader will be read when the function is issued.
+ *  @param recordsToRead    This variable tells the reader how much records it has to read.
+ *  @param[out] recordsRead This is a pointer to variable where the amount of actually read
+ *                          records is returned. This may differ to the given recordsToRead if
+ *                          the begin of the trace was reached.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_GlobalEvtReader_ReadEventsBackward( OTF2_GlobalEvtReader* reader,
+                                         uint64_t              recordsToRead,
+                                         uint64_t*             recordsRead );
+
+
+/** @brief Seeks the global event reader to the given time.
+ *
+ *  The next delivered event is the first event with a timestamp at or after
+ *  @a time, when reading backward it is the last event before @a time.
+ *  Seeking backwards is possible, too. Each location is positioned
+ *  only when its events are needed, by a binary search over the chunks of
+ *  its event file. Locations which are known to have no events after
+ *  @a time are not opened at all.
+ *
+ *  Compressed event files can't be positioned, they are read from the start
+ *  and thus seeking is only supported before the first event was read.
+ *
+ *  @param reader  Global event reader handle.
+ *  @param time    The timestamp to seek to, in the corrected time of the
+ *                 trace.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_GlobalEvtReader_SeekTime( OTF2_GlobalEvtReader* reader,
+                               OTF2_TimeStamp        time );
+
+
+/** @brief Sets the end of the time window to read.
+ *
+ *  Events with a timestamp after @a time are not delivered anymore, the
+ *  reader behaves as if the trace ends there. The bound is inclusive and
+ *  applies to forward reading only.
+ *  Use @eref{OTF2_UNDEFINED_TIMESTAMP} to remove the bound again.
+ *
+ *  @param reader  Global event reader handle.
+ *  @param time    The last timestamp to deliver.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_GlobalEvtReader_SetEndTime( OTF2_GlobalEvtReader* reader,
+                                 OTF2_TimeStamp        time );
+
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
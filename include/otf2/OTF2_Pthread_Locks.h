@@ -66,6 +66,44 @@ OTF2_Pthread_Reader_SetLockingCallbacks( OTF2_Reader*               reader,
                                          const pthread_mutexattr_t* mutexAttribute );
 
 
+/** @brief Register callbacks to finalize the writers of a OTF2 archive with
+ *  multiple Pthreads.
+ *
+ *  The threads are created for each batch of writers and joined afterwards.
+ *  The archive needs also locking callbacks.
+ *
+ *  @param archive          The archive handle.
+ *  @param numberOfThreads  Maximum number of threads working on the writers,
+ *                          including the calling thread.
+ *
+ *  @since Version 2.0
+ *
+ *  @return Success or error code.
+ */
+static OTF2_ErrorCode
+OTF2_Pthread_Archive_SetParallelCallbacks( OTF2_Archive* archive,
+                                           uint32_t      numberOfThreads );
+
+
+/** @brief Register callbacks to read the local definitions of a OTF2 reader
+ *  with multiple Pthreads in @eref{OTF2_Reader_UnifyLocalDefinitions} and
+ *  @eref{OTF2_Reader_LoadLocalDefinitions}.
+ *
+ *  The reader needs also locking callbacks.
+ *
+ *  @param reader           The reader handle.
+ *  @param numberOfThreads  Maximum number of threads working on the
+ *                          locations, including the calling thread.
+ *
+ *  @since Version 2.0
+ *
+ *  @return Success or error code.
+ */
+static OTF2_ErrorCode
+OTF2_Pthread_Reader_SetParallelCallbacks( OTF2_Reader* reader,
+                                          uint32_t     numberOfThreads );
+
+
 /**
  * @cond IMPLEMENTATION_OF_THE_CALLBACKS__PLEASE_IGNORE
  */
@@ -207,6 +245,8 @@ OTF2_Pthread_Archive_SetLockingCallbacks( OTF2_Archive*              archive,
     OTF2_Pthread_UserData* user_data = NULL;
 
     ( void )OTF2_Pthread_Reader_SetLockingCallbacks;
+    ( void )OTF2_Pthread_Archive_SetParallelCallbacks;
+    ( void )OTF2_Pthread_Reader_SetParallelCallbacks;
 
     if ( !archive )
     {
@@ -240,6 +280,8 @@ OTF2_Pthread_Reader_SetLockingCallbacks( OTF2_Reader*               reader,
     OTF2_Pthread_UserData* user_data = NULL;
 
     ( void )OTF2_Pthread_Archive_SetLockingCallbacks;
+    ( void )OTF2_Pthread_Archive_SetParallelCallbacks;
+    ( void )OTF2_Pthread_Reader_SetParallelCallbacks;
 
     if ( !reader )
     {
@@ -265,6 +307,208 @@ OTF2_Pthread_Reader_SetLockingCallbacks( OTF2_Reader*               reader,
 }
 
 
+/** @brief User data structure, which will be used by the Pthread parallel
+ *  callbacks.
+ */
+typedef struct OTF2_Pthread_ParallelData
+{
+    uint32_t number_of_threads;
+} OTF2_Pthread_ParallelData;
+
+
+/** @brief State of one call to the parallel run callback, shared by the
+ *  threads.
+ */
+typedef struct otf2_pthread_parallel_run_state
+{
+    pthread_mutex_t    mutex;
+    uint32_t           next_task;
+    uint32_t           number_of_tasks;
+    OTF2_Parallel_Task task;
+    void*              task_data;
+} otf2_pthread_parallel_run_state;
+
+
+static void*
+otf2_pthread_parallel_worker( void* arg )
+{
+    otf2_pthread_parallel_run_state* state = ( otf2_pthread_parallel_run_state* )arg;
+    uint32_t                         task_index;
+
+    while ( 1 )
+    {
+        pthread_mutex_lock( &state->mutex );
+        task_index = state->next_task;
+        if ( task_index < state->number_of_tasks )
+        {
+            state->next_task++;
+        }
+        pthread_mutex_unlock( &state->mutex );
+
+        if ( task_index >= state->number_of_tasks )
+        {
+            break;
+        }
+
+        state->task( state->task_data, task_index );
+    }
+
+    return NULL;
+}
+
+
+static void
+otf2_pthread_parallel_release( void* userData )
+{
+    free( userData );
+}
+
+
+static OTF2_CallbackCode
+otf2_pthread_parallel_run( void*              userData,
+                           uint32_t           numberOfTasks,
+                           OTF2_Parallel_Task task,
+                           void*              taskData )
+{
+    OTF2_Pthread_ParallelData*      user_data = ( OTF2_Pthread_ParallelData* )userData;
+    otf2_pthread_parallel_run_state state;
+    pthread_t*                      threads;
+    uint32_t                        number_of_threads;
+    uint32_t                        created;
+    uint32_t                        task_index;
+
+    number_of_threads = user_data->number_of_threads;
+    if ( number_of_threads > numberOfTasks )
+    {
+        number_of_threads = numberOfTasks;
+    }
+    if ( number_of_threads < 2 )
+    {
+        /* No other thread would help, run the tasks right here. */
+        for ( task_index = 0; task_index < numberOfTasks; task_index++ )
+        {
+            task( taskData, task_index );
+        }
+        return OTF2_CALLBACK_SUCCESS;
+    }
+
+    threads = ( pthread_t* )calloc( number_of_threads - 1, sizeof( *threads ) );
+    if ( !threads )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    if ( 0 != pthread_mutex_init( &state.mutex, NULL ) )
+    {
+        free( threads );
+        return OTF2_CALLBACK_ERROR;
+    }
+    state.next_task       = 0;
+    state.number_of_tasks = numberOfTasks;
+    state.task            = task;
+    state.task_data       = taskData;
+
+    /* If not all threads could be created, the others do more tasks. */
+    for ( created = 0; created < number_of_threads - 1; created++ )
+    {
+        if ( 0 != pthread_create( &threads[ created ], NULL,
+                                  otf2_pthread_parallel_worker, &state ) )
+        {
+            break;
+        }
+    }
+
+    otf2_pthread_parallel_worker( &state );
+
+    while ( created > 0 )
+    {
+        pthread_join( threads[ --created ], NULL );
+    }
+
+    pthread_mutex_destroy( &state.mutex );
+    free( threads );
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static const OTF2_ParallelCallbacks otf2_pthread_parallel_callbacks =
+{
+    otf2_pthread_parallel_release,
+    otf2_pthread_parallel_run
+};
+
+
+static OTF2_ErrorCode
+OTF2_Pthread_Archive_SetParallelCallbacks( OTF2_Archive* archive,
+                                           uint32_t      numberOfThreads )
+{
+    OTF2_ErrorCode             ret;
+    OTF2_Pthread_ParallelData* user_data = NULL;
+
+    ( void )OTF2_Pthread_Archive_SetLockingCallbacks;
+    ( void )OTF2_Pthread_Reader_SetLockingCallbacks;
+    ( void )OTF2_Pthread_Reader_SetParallelCallbacks;
+
+    if ( !archive || numberOfThreads == 0 )
+    {
+        return OTF2_ERROR_INVALID_ARGUMENT;
+    }
+
+    user_data = ( OTF2_Pthread_ParallelData* )calloc( 1, sizeof( *user_data ) );
+    if ( !user_data )
+    {
+        return OTF2_ERROR_MEM_ALLOC_FAILED;
+    }
+
+    user_data->number_of_threads = numberOfThreads;
+
+    ret = OTF2_Archive_SetParallelCallbacks( archive,
+                                             &otf2_pthread_parallel_callbacks,
+                                             user_data );
+    if ( OTF2_SUCCESS != ret )
+    {
+        free( user_data );
+    }
+    return ret;
+}
+
+
+static OTF2_ErrorCode
+OTF2_Pthread_Reader_SetParallelCallbacks( OTF2_Reader* reader,
+                                          uint32_t     numberOfThreads )
+{
+    OTF2_ErrorCode             ret;
+    OTF2_Pthread_ParallelData* user_data = NULL;
+
+    ( void )OTF2_Pthread_Archive_SetLockingCallbacks;
+    ( void )OTF2_Pthread_Reader_SetLockingCallbacks;
+    ( void )OTF2_Pthread_Archive_SetParallelCallbacks;
+
+    if ( !reader || numberOfThreads == 0 )
+    {
+        return OTF2_ERROR_INVALID_ARGUMENT;
+    }
+
+    user_data = ( OTF2_Pthread_ParallelData* )calloc( 1, sizeof( *user_data ) );
+    if ( !user_data )
+    {
+        return OTF2_ERROR_MEM_ALLOC_FAILED;
+    }
+
+    user_data->number_of_threads = numberOfThreads;
+
+    ret = OTF2_Reader_SetParallelCallbacks( reader,
+                                            &otf2_pthread_parallel_callbacks,
+                                            user_data );
+    if ( OTF2_SUCCESS != ret )
+    {
+        free( user_data );
+    }
+    return ret;
+}
+
+
 /**
  * @endcond
  */
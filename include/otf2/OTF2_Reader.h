@@ -311,6 +311,32 @@ OTF2_Reader_SetLockingCallbacks( OTF2_Reader*                 reader,
                                  void*                        lockingData );
 
 
+/** @brief Set the parallel callbacks for the reader.
+ *
+ *  See @eref{OTF2_Archive_SetParallelCallbacks}.
+ *
+ *  @param reader             Reader handle.
+ *  @param parallelCallbacks  Struct holding the parallel callback functions.
+ *  @param parallelData       Data passed to the parallel callbacks in the
+ *                            @p userData argument.
+ *
+ *  @since Version 2.0
+ *
+ *  @retbegin
+ *    @retcode{OTF2_SUCCESS, if successful}
+ *    @retcode{OTF2_ERROR_INVALID_ARGUMENT,
+ *             in case of NULL pointers for @a reader or @a parallelCallbacks\,
+ *             or mandatory callbacks in @a parallelCallbacks are missing}
+ *    @retcode{OTF2_ERROR_INVALID_CALL,
+ *             in case there were parallel callbacks already set}
+ *  @retend
+ */
+OTF2_ErrorCode
+OTF2_Reader_SetParallelCallbacks( OTF2_Reader*                  reader,
+                                  const OTF2_ParallelCallbacks* parallelCallbacks,
+                                  void*                         parallelData );
+
+
 /** @brief Register event reader callbacks.
  *
  *  @param reader           OTF2_Reader handle.
@@ -535,6 +561,24 @@ OTF2_Reader_ReadAllGlobalEvents( OTF2_Reader*          reader,
                                  uint64_t*             eventsRead );
 
 
+/** @brief Read a given number of events via a global event reader backwards.
+ *
+ *  @param reader           Reader handle.
+ *  @param evtReader        Global event reader handle.
+ *  @param eventsToRead     Number events to be read.
+ *  @param[out] eventsRead  Return pointer to the number of events actually read.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_Reader_ReadGlobalEventsBackward( OTF2_Reader*          reader,
+                                      OTF2_GlobalEvtReader* evtReader,
+                                      uint64_t              eventsToRead,
+                                      uint64_t*             eventsRead );
+
+
 /** @brief Read a given number of definitions via a local definition reader.
  *
  *  @param reader               Reader handle.
@@ -1273,6 +1317,55 @@ OTF2_Reader_SelectLocation( OTF2_Reader*     reader,
                             OTF2_LocationRef location );
 
 
+/** @brief Unify the local definitions of locations into global definitions.
+ *
+ *  See @eref{OTF2_Archive_UnifyLocalDefinitions}.
+ *
+ *  @param reader                Reader handle.
+ *  @param numberOfLocations     Number of locations.
+ *  @param locations             The locations to unify, selected with
+ *                               @eref{OTF2_Reader_SelectLocation}.
+ *  @param globalDefWriter       Writer for the global definitions.
+ *  @param mappingTableCallback  Called with the mapping tables, may be NULL.
+ *  @param userData              Passed to @a mappingTableCallback.
+ *  @param[out] numberOfStrings  Number of unified @eref{String} definitions,
+ *                               may be NULL.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_Reader_UnifyLocalDefinitions( OTF2_Reader*                     reader,
+                                   uint32_t                         numberOfLocations,
+                                   const OTF2_LocationRef*          locations,
+                                   OTF2_GlobalDefWriter*            globalDefWriter,
+                                   OTF2_UnifiedMappingTableCallback mappingTableCallback,
+                                   void*                            userData,
+                                   uint64_t*                        numberOfStrings );
+
+
+/** @brief Load the local definitions of all selected locations.
+ *
+ *  See @eref{OTF2_Archive_LoadLocalDefinitions}. Use this instead of reading
+ *  the local definitions of each location with
+ *  @eref{OTF2_Reader_ReadAllLocalDefinitions}, when no local definition
+ *  callbacks are needed. Parallel callbacks set with
+ *  @eref{OTF2_Reader_SetParallelCallbacks} read the locations concurrently.
+ *
+ *  @param reader           Reader handle.
+ *  @param skipDefinitions  Read only the mapping tables, clock offsets, and
+ *                          event time ranges.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_Reader_LoadLocalDefinitions( OTF2_Reader* reader,
+                                  bool         skipDefinitions );
+
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
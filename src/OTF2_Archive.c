@@ -57,6 +57,7 @@
 #include "otf2_file_types.h"
 #include "otf2_reader.h"
 #include "otf2_archive.h"
+#include "otf2_unify.h"
 
 #include "otf2_collectives.h"
 #include "otf2_collectives_serial.h"
@@ -551,6 +552,105 @@ OTF2_Archive_SetLockingCallbacks( OTF2_Archive*                archive,
 }
 
 
+OTF2_ErrorCode
+OTF2_Archive_SetParallelCallbacks( OTF2_Archive*                 archive,
+                                   const OTF2_ParallelCallbacks* parallelCallbacks,
+                                   void*                         parallelData )
+{
+    if ( !archive )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for archive parameter!" );
+    }
+
+    if ( !parallelCallbacks )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for parallelCallbacks parameter!" );
+    }
+
+    if ( !parallelCallbacks->otf2_run )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Missing callbacks in parallel callback structure." );
+    }
+
+    return otf2_archive_set_parallel_callbacks( archive,
+                                                parallelCallbacks,
+                                                parallelData );
+}
+
+
+OTF2_ErrorCode
+OTF2_Archive_SetBuiltinClock( OTF2_Archive* archive )
+{
+    if ( !archive )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for archive parameter!" );
+    }
+
+    if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                            "The clock is only available in writing mode!" );
+    }
+
+    if ( !archive->collective_callbacks )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                            "Archive has no collective callbacks set!" );
+    }
+
+    return otf2_archive_set_builtin_clock( archive );
+}
+
+
+OTF2_TimeStamp
+OTF2_Archive_GetTime( OTF2_Archive* archive )
+{
+    if ( !archive || !archive->clock.enabled )
+    {
+        return 0;
+    }
+
+    return otf2_archive_get_time( archive );
+}
+
+
+OTF2_ErrorCode
+OTF2_Archive_GetClockProperties( OTF2_Archive* archive,
+                                 uint64_t*     timerResolution,
+                                 uint64_t*     globalOffset,
+                                 uint64_t*     traceLength )
+{
+    if ( !archive )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for archive parameter!" );
+    }
+
+    if ( !timerResolution || !globalOffset || !traceLength )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid arguments for clock properties!" );
+    }
+
+    if ( !archive->clock.enabled )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                            "The clock of OTF2 is not used!" );
+    }
+
+    otf2_archive_get_clock_properties( archive,
+                                       timerResolution,
+                                       globalOffset,
+                                       traceLength );
+
+    return OTF2_SUCCESS;
+}
+
+
 OTF2_ErrorCode
 OTF2_Archive_SetHint( OTF2_Archive* archive,
                       OTF2_Hint     hint,
@@ -574,6 +674,38 @@ OTF2_Archive_SetHint( OTF2_Archive* archive,
 }
 
 
+OTF2_ErrorCode
+OTF2_Archive_SetRegionFilter( OTF2_Archive*         archive,
+                              uint32_t              numberOfRegions,
+                              const OTF2_RegionRef* regions,
+                              OTF2_Boolean          filtered )
+{
+    /* Validate arguments. */
+    if ( !archive )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for archive parameter!" );
+    }
+    if ( numberOfRegions > 0 && !regions )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for regions parameter!" );
+    }
+    if ( filtered != OTF2_TRUE && filtered != OTF2_FALSE )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for filtered parameter!" );
+    }
+    if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                            "Region filter is only allowed in writing mode!" );
+    }
+
+    return otf2_archive_set_region_filter( archive, numberOfRegions, regions, filtered );
+}
+
+
 OTF2_ErrorCode
 OTF2_Archive_SetProperty( OTF2_Archive* archive,
                           const char*   name,
@@ -2272,3 +2404,68 @@ OTF2_Archive_SelectLocation( OTF2_Archive* archive, OTF2_LocationRef location )
 
     return otf2_archive_select_location( archive, location );
 }
+
+
+OTF2_ErrorCode
+OTF2_Archive_UnifyLocalDefinitions( OTF2_Archive*                    archive,
+                                    uint32_t                         numberOfLocations,
+                                    const OTF2_LocationRef*          locations,
+                                    OTF2_GlobalDefWriter*            globalDefWriter,
+                                    OTF2_UnifiedMappingTableCallback mappingTableCallback,
+                                    void*                            userData,
+                                    uint64_t*                        numberOfStrings )
+{
+    /* Validate arguments. */
+    if ( !archive )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid archive handle!" );
+    }
+
+    if ( numberOfLocations > 0 && !locations )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for locations parameter!" );
+    }
+
+    if ( !globalDefWriter )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid argument for globalDefWriter parameter!" );
+    }
+
+    if ( archive->file_mode != OTF2_FILEMODE_READ )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                            "Call only allowed in read mode." );
+    }
+
+    return otf2_archive_unify_local_definitions( archive,
+                                                 numberOfLocations,
+                                                 locations,
+                                                 globalDefWriter,
+                                                 mappingTableCallback,
+                                                 userData,
+                                                 numberOfStrings );
+}
+
+
+OTF2_ErrorCode
+OTF2_Archive_LoadLocalDefinitions( OTF2_Archive* archive,
+                                   bool          skipDefinitions )
+{
+    /* Validate arguments. */
+    if ( !archive )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid archive handle!" );
+    }
+
+    if ( archive->file_mode != OTF2_FILEMODE_READ )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                            "Call only allowed in read mode." );
+    }
+
+    return otf2_archive_load_local_definitions( archive, skipDefinitions );
+}
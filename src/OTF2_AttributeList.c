@@ -71,10 +71,14 @@
 #define OTF2_ATTRIBUTE_LIST_MAX ( uint32_t )1024
 
 
-static inline otf2_attribute**
+static inline otf2_attribute*
 otf2_attribute_list_find_id( const OTF2_AttributeList* attributeList,
                              OTF2_AttributeRef         attribute );
 
+static OTF2_ErrorCode
+otf2_attribute_list_reserve( OTF2_AttributeList* attributeList,
+                             uint32_t            numberOfAttributes );
+
 void
 otf2_attribute_list_init( OTF2_AttributeList* attributeList )
 {
@@ -83,10 +87,10 @@ otf2_attribute_list_init( OTF2_AttributeList* attributeList )
         return;
     }
 
-    attributeList->capacity = 0;
-    attributeList->head     = NULL;
-    attributeList->tail     = &attributeList->head;
-    attributeList->free     = NULL;
+    attributeList->capacity       = 0;
+    attributeList->allocated      = OTF2_ATTRIBUTE_LIST_INLINE_ENTRIES;
+    attributeList->entries        = attributeList->inline_entries;
+    attributeList->pending_buffer = NULL;
 }
 
 
@@ -115,21 +119,11 @@ otf2_attribute_list_clear( OTF2_AttributeList* attributeList )
         return;
     }
 
-    otf2_attribute* entry = attributeList->head;
-    while ( entry )
-    {
-        otf2_attribute* next = entry->next;
-        free( entry );
-        entry = next;
-    }
-
-    entry = attributeList->free;
-    while ( entry )
+    if ( attributeList->entries != attributeList->inline_entries )
     {
-        otf2_attribute* next = entry->next;
-        free( entry );
-        entry = next;
+        free( attributeList->entries );
     }
+    otf2_attribute_list_init( attributeList );
 }
 
 
@@ -162,10 +156,10 @@ OTF2_AttributeList_AddAttribute( OTF2_AttributeList* attributeList,
                             "This is no valid attribute list!" );
     }
 
-    if ( attributeList->capacity >= OTF2_ATTRIBUTE_LIST_MAX )
+    OTF2_ErrorCode status = otf2_attribute_list_decode( attributeList );
+    if ( status != OTF2_SUCCESS )
     {
-        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
-                            "There is no space left in the attribute list!" );
+        return status;
     }
 
     if ( otf2_attribute_list_find_id( attributeList, attribute ) )
@@ -174,30 +168,68 @@ OTF2_AttributeList_AddAttribute( OTF2_AttributeList* attributeList,
                             "The passed attribute ID already exists!" );
     }
 
-    otf2_attribute* new_entry;
-    if ( attributeList->free )
+    status = otf2_attribute_list_reserve( attributeList, 1 );
+    if ( status != OTF2_SUCCESS )
     {
-        new_entry           = attributeList->free;
-        attributeList->free = new_entry->next;
-    }
-    else
-    {
-        new_entry = calloc( 1, sizeof( *new_entry ) );
-        if ( new_entry == NULL )
-        {
-            return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
-                                "Could not allocate memory for new attribute!" );
-        }
+        return status;
     }
 
+    otf2_attribute* new_entry = &attributeList->entries[ attributeList->capacity++ ];
     new_entry->type_id      = type;
     new_entry->attribute_id = attribute;
     new_entry->value        = attributeValue;
-    new_entry->next         = NULL;
 
-    attributeList->capacity++;
-    *attributeList->tail = new_entry;
-    attributeList->tail  = &new_entry->next;
+    return OTF2_SUCCESS;
+}
+
+
+OTF2_ErrorCode
+OTF2_AttributeList_AddAttributes( OTF2_AttributeList*        attributeList,
+                                  uint32_t                   numberOfAttributes,
+                                  const OTF2_AttributeRef*   attributes,
+                                  const OTF2_Type*           types,
+                                  const OTF2_AttributeValue* attributeValues )
+{
+    /* Validate arguments. */
+    if ( attributeList == NULL )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "This is no valid attribute list!" );
+    }
+    if ( numberOfAttributes > 0 && ( !attributes || !types || !attributeValues ) )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid attribute arrays!" );
+    }
+
+    OTF2_ErrorCode status = otf2_attribute_list_decode( attributeList );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    status = otf2_attribute_list_reserve( attributeList, numberOfAttributes );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    uint32_t old_capacity = attributeList->capacity;
+    for ( uint32_t i = 0; i < numberOfAttributes; i++ )
+    {
+        if ( otf2_attribute_list_find_id( attributeList, attributes[ i ] ) )
+        {
+            /* Drop the already added ones again. */
+            attributeList->capacity = old_capacity;
+            return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                                "The passed attribute ID already exists!" );
+        }
+
+        otf2_attribute* new_entry = &attributeList->entries[ attributeList->capacity++ ];
+        new_entry->type_id      = types[ i ];
+        new_entry->attribute_id = attributes[ i ];
+        new_entry->value        = attributeValues[ i ];
+    }
 
     return OTF2_SUCCESS;
 }
@@ -214,8 +246,14 @@ OTF2_AttributeList_RemoveAttribute( OTF2_AttributeList* attributeList,
                             "This is no valid attribute list!" );
     }
 
+    OTF2_ErrorCode status = otf2_attribute_list_decode( attributeList );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
     /* Check if requested attribute is in the list. */
-    otf2_attribute** entry
+    otf2_attribute* entry
         = otf2_attribute_list_find_id( attributeList, attribute );
     if ( !entry )
     {
@@ -223,17 +261,9 @@ OTF2_AttributeList_RemoveAttribute( OTF2_AttributeList* attributeList,
                             "The passed attribute ID does not exists!" );
     }
 
-    otf2_attribute* remove_entry = *entry;
-    *entry = ( *entry )->next;
-    if ( remove_entry->next == NULL )
-    {
-        /* adjust tail, if the removed one was the last */
-        attributeList->tail = entry;
-    }
-
-    /* keep the removed one in the free list */
-    remove_entry->next  = attributeList->free;
-    attributeList->free = remove_entry;
+    /* keep the order of the remaining ones */
+    otf2_attribute* end = attributeList->entries + attributeList->capacity;
+    memmove( entry, entry + 1, ( end - entry - 1 ) * sizeof( *entry ) );
     attributeList->capacity--;
 
     return OTF2_SUCCESS;
@@ -258,7 +288,8 @@ bool
 OTF2_AttributeList_TestAttributeByID( const OTF2_AttributeList* attributeList,
                                       OTF2_AttributeRef         attribute )
 {
-    if ( attributeList == NULL )
+    if ( attributeList == NULL
+         || otf2_attribute_list_decode( attributeList ) != OTF2_SUCCESS )
     {
         return false;
     }
@@ -280,16 +311,22 @@ OTF2_AttributeList_GetAttributeByID( const OTF2_AttributeList* attributeList,
                             "This is no valid attribute list!" );
     }
 
-    otf2_attribute** entry = otf2_attribute_list_find_id( attributeList,
-                                                          attribute );
+    OTF2_ErrorCode status = otf2_attribute_list_decode( attributeList );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    const otf2_attribute* entry = otf2_attribute_list_find_id( attributeList,
+                                                               attribute );
     if ( !entry )
     {
         return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
                             "The passed attribute ID does not exist!" );
     }
 
-    *type           = ( *entry )->type_id;
-    *attributeValue = ( *entry )->value;
+    *type           = entry->type_id;
+    *attributeValue = entry->value;
 
     return OTF2_SUCCESS;
 }
@@ -309,18 +346,19 @@ OTF2_AttributeList_GetAttributeByIndex( const OTF2_AttributeList* attributeList,
                             "This is no valid attribute list!" );
     }
 
+    OTF2_ErrorCode status = otf2_attribute_list_decode( attributeList );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
     if ( index >= attributeList->capacity )
     {
         return UTILS_ERROR( OTF2_ERROR_INDEX_OUT_OF_BOUNDS,
                             "The passed index is out of range!" );
     }
 
-    otf2_attribute* entry = attributeList->head;
-
-    for ( uint32_t i = 0; i < index; i++ )
-    {
-        entry = entry->next;
-    }
+    const otf2_attribute* entry = &attributeList->entries[ index ];
 
     *attribute      = entry->attribute_id;
     *type           = entry->type_id;
@@ -343,26 +381,26 @@ OTF2_AttributeList_PopAttribute( OTF2_AttributeList*  attributeList,
                             "This is no valid attribute list!" );
     }
 
+    OTF2_ErrorCode status = otf2_attribute_list_decode( attributeList );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
     if ( attributeList->capacity == 0 )
     {
         return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
                             "Attribute list is empty!" );
     }
 
-    otf2_attribute* entry = attributeList->head;
+    otf2_attribute* entry = attributeList->entries;
 
     *attribute      = entry->attribute_id;
     *type           = entry->type_id;
     *attributeValue = entry->value;
 
-    attributeList->head = entry->next;
-    if ( attributeList->head == NULL )
-    {
-        attributeList->tail = &attributeList->head;
-    }
-    entry->next         = attributeList->free;
-    attributeList->free = entry;
     attributeList->capacity--;
+    memmove( entry, entry + 1, attributeList->capacity * sizeof( *entry ) );
 
     return OTF2_SUCCESS;
 }
@@ -379,41 +417,99 @@ OTF2_AttributeList_GetNumberOfElements( const OTF2_AttributeList* attributeList
         return 0;
     }
 
+    if ( otf2_attribute_list_decode( attributeList ) != OTF2_SUCCESS )
+    {
+        return 0;
+    }
+
     return attributeList->capacity;
 }
 
 
 /** @brief Test the existence of an attribute ID in the list.
- *
- *  Returns the first entry in the attribute list and removes it from the list.
  *
  *  @param attributeList    Attribute list handle.
- *  @param attribute        Pointer to the returned ID of the attribute.
+ *  @param attribute        The ID of the attribute.
  *
- *  @return                 Returns a non-zero value if the ID exists in the
- *                          list, zero otherwise.
+ *  @return                 Returns the element with this ID, NULL if the ID
+ *                          does not exist in the list.
  */
-otf2_attribute**
+otf2_attribute*
 otf2_attribute_list_find_id( const OTF2_AttributeList* attributeList,
                              OTF2_AttributeRef         attribute )
 {
     UTILS_ASSERT( attributeList );
 
-    otf2_attribute** entry = ( otf2_attribute** )&attributeList->head;
-
-    while ( *entry )
+    for ( uint32_t i = 0; i < attributeList->capacity; i++ )
     {
-        if ( ( *entry )->attribute_id == attribute )
+        if ( attributeList->entries[ i ].attribute_id == attribute )
         {
-            return entry;
+            return &attributeList->entries[ i ];
         }
-        entry = &( *entry )->next;
     }
 
     return NULL;
 }
 
 
+/** @brief Make room for additional elements in the list.
+ *
+ *  @param attributeList        Attribute list handle.
+ *  @param numberOfAttributes   Number of elements to be added.
+ *
+ *  @return                     Returns OTF2_SUCCESS if successful, an error
+ *                              code if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_attribute_list_reserve( OTF2_AttributeList* attributeList,
+                             uint32_t            numberOfAttributes )
+{
+    if ( numberOfAttributes > OTF2_ATTRIBUTE_LIST_MAX - attributeList->capacity )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "There is no space left in the attribute list!" );
+    }
+
+    uint32_t needed = attributeList->capacity + numberOfAttributes;
+    if ( needed <= attributeList->allocated )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    uint32_t allocated = 2 * attributeList->allocated;
+    while ( allocated < needed )
+    {
+        allocated *= 2;
+    }
+
+    otf2_attribute* entries;
+    if ( attributeList->entries == attributeList->inline_entries )
+    {
+        entries = malloc( allocated * sizeof( *entries ) );
+        if ( entries )
+        {
+            memcpy( entries, attributeList->inline_entries,
+                    attributeList->capacity * sizeof( *entries ) );
+        }
+    }
+    else
+    {
+        entries = realloc( attributeList->entries,
+                           allocated * sizeof( *entries ) );
+    }
+    if ( !entries )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Could not allocate memory for new attributes!" );
+    }
+
+    attributeList->entries   = entries;
+    attributeList->allocated = allocated;
+
+    return OTF2_SUCCESS;
+}
+
+
 OTF2_ErrorCode
 otf2_attribute_list_read_from_buffer( OTF2_AttributeList*  attributeList,
                                       OTF2_Buffer*         buffer,
@@ -455,6 +551,13 @@ otf2_attribute_list_read_from_buffer( OTF2_AttributeList*  attributeList,
                             "Record length and number of attributes in list are not consistent." );
     }
 
+    status = otf2_attribute_list_reserve( attributeList, number_of_attributes );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status,
+                            "Could not add attributes to attribute list." );
+    }
+
     for ( uint32_t i = 0; i < number_of_attributes; i++ )
     {
         uint32_t            attribute_id;
@@ -486,16 +589,18 @@ otf2_attribute_list_read_from_buffer( OTF2_AttributeList*  attributeList,
                                 "Could not read attribute value." );
         }
 
-        /* Store the new value in the attribute list. */
-        status = OTF2_AttributeList_AddAttribute( attributeList,
-                                                  attribute_id,
-                                                  type,
-                                                  value );
-        if ( OTF2_SUCCESS != status )
+        /* Store the new value in the attribute list, the room was reserved
+         * already. */
+        if ( otf2_attribute_list_find_id( attributeList, attribute_id ) )
         {
-            return UTILS_ERROR( status,
-                                "Could not add attribute to attribute list." );
+            return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                                "Could not add attribute to attribute list. "
+                                "The attribute ID already exists!" );
         }
+        otf2_attribute* new_entry = &attributeList->entries[ attributeList->capacity++ ];
+        new_entry->type_id      = type;
+        new_entry->attribute_id = attribute_id;
+        new_entry->value        = value;
     }
 
     /*
@@ -511,6 +616,86 @@ otf2_attribute_list_read_from_buffer( OTF2_AttributeList*  attributeList,
 }
 
 
+OTF2_ErrorCode
+otf2_attribute_list_defer_from_buffer( OTF2_AttributeList*  attributeList,
+                                       OTF2_Buffer*         buffer,
+                                       OTF2_MappingCallback mappingCb,
+                                       void*                mappingData )
+{
+    UTILS_ASSERT( attributeList );
+    UTILS_ASSERT( buffer );
+
+    /* Only one record can be noted, multiple lists for one event are
+     * merged. */
+    OTF2_ErrorCode status = otf2_attribute_list_decode( attributeList );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
+    uint8_t* record_pos;
+    OTF2_Buffer_GetPosition( buffer, &record_pos );
+
+    /* Get record length and test memory availability */
+    uint64_t record_data_length;
+    status = OTF2_Buffer_GuaranteeRecord( buffer, &record_data_length );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status,
+                            "Could not read attribute list. "
+                            "Not enough memory in buffer." );
+    }
+    uint8_t* record_start_pos;
+    OTF2_Buffer_GetPosition( buffer, &record_start_pos );
+
+    status = OTF2_Buffer_SetPosition( buffer, record_start_pos + record_data_length );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status, "Could not read attribute list." );
+    }
+
+    attributeList->pending_buffer       = buffer;
+    attributeList->pending_position     = record_pos;
+    attributeList->pending_mapping_cb   = mappingCb;
+    attributeList->pending_mapping_data = mappingData;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @internal
+ *  @brief Decode the attribute list record noted by
+ *  otf2_attribute_list_defer_from_buffer.
+ *
+ *  The position of the buffer is not changed.
+ */
+OTF2_ErrorCode
+otf2_attribute_list_decode_pending( OTF2_AttributeList* attributeList )
+{
+    OTF2_Buffer* buffer = attributeList->pending_buffer;
+    attributeList->pending_buffer = NULL;
+
+    uint8_t* read_pos;
+    OTF2_Buffer_GetPosition( buffer, &read_pos );
+    OTF2_ErrorCode status = OTF2_Buffer_SetPosition( buffer,
+                                                     attributeList->pending_position );
+    if ( OTF2_SUCCESS == status )
+    {
+        status = otf2_attribute_list_read_from_buffer( attributeList,
+                                                       buffer,
+                                                       attributeList->pending_mapping_cb,
+                                                       attributeList->pending_mapping_data );
+        OTF2_Buffer_SetPosition( buffer, read_pos );
+    }
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status, "Could not decode attribute list." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
 OTF2_ErrorCode
 otf2_attribute_list_write_to_buffer( OTF2_AttributeList* attributeList,
                                      OTF2_Buffer*        buffer )
@@ -533,7 +718,8 @@ otf2_attribute_list_write_to_buffer( OTF2_AttributeList* attributeList,
     /* Store how many items are in the list to the trace */
     OTF2_Buffer_WriteUint32( buffer, attributeList->capacity );
 
-    for ( otf2_attribute* attr = attributeList->head; attr; attr = attr->next )
+    otf2_attribute* end = attributeList->entries + attributeList->capacity;
+    for ( otf2_attribute* attr = attributeList->entries; attr < end; attr++ )
     {
         /* Write attribute id to the trace */
         OTF2_Buffer_WriteUint32( buffer, attr->attribute_id );
@@ -553,5 +739,339 @@ otf2_attribute_list_write_to_buffer( OTF2_AttributeList* attributeList,
 }
 
 
+/** @brief Read the shape index and, for a defining list, the shape itself.
+ *
+ *  @param buffer       Buffer positioned after the record length.
+ *  @param recordType   Type of the attribute list record.
+ *  @param shapes       The shapes of the current chunk, a defined shape is
+ *                      added.
+ *  @param[out] index   The shape index of the list.
+ *
+ *  @return             Returns OTF2_SUCCESS if successful, an error code if
+ *                      an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_attribute_list_read_shape( OTF2_Buffer*                buffer,
+                                uint8_t                     recordType,
+                                otf2_attribute_list_shapes* shapes,
+                                uint8_t*                    index )
+{
+    OTF2_Buffer_ReadUint8( buffer, index );
+    if ( *index >= OTF2_ATTRIBUTE_LIST_SHAPES_MAX )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Invalid attribute list shape index: %u", *index );
+    }
+
+    if ( recordType != OTF2_BUFFER_ATTRIBUTE_LIST_DEFINE )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    otf2_attribute_list_shape* shape = &shapes->shapes[ *index ];
+    OTF2_ErrorCode             status;
+    uint32_t                   number_of_attributes;
+    status = OTF2_Buffer_ReadUint32( buffer, &number_of_attributes );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status,
+                            "Could not read number of attributes in list. "
+                            "Invalid compression size." );
+    }
+    if ( number_of_attributes == 0 ||
+         number_of_attributes > OTF2_ATTRIBUTE_LIST_SHAPE_MAX_SIZE )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Invalid size of attribute list shape: %u",
+                            number_of_attributes );
+    }
+
+    for ( uint32_t i = 0; i < number_of_attributes; i++ )
+    {
+        status = OTF2_Buffer_ReadUint32( buffer, &shape->attributes[ i ] );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status,
+                                "Could not read attribute from list. "
+                                "Invalid compression size." );
+        }
+        OTF2_Buffer_ReadUint8( buffer, &shape->types[ i ] );
+
+        for ( uint32_t j = 0; j < i; j++ )
+        {
+            if ( shape->attributes[ j ] == shape->attributes[ i ] )
+            {
+                return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                                    "Duplicate attribute in attribute list shape." );
+            }
+        }
+    }
+    shape->number_of_attributes = number_of_attributes;
+    shapes->known              |= UINT32_C( 1 ) << *index;
+
+    return OTF2_SUCCESS;
+}
+
+
+OTF2_ErrorCode
+otf2_attribute_list_read_shaped_from_buffer( OTF2_AttributeList*         attributeList,
+                                             OTF2_Buffer*                buffer,
+                                             uint8_t                     recordType,
+                                             otf2_attribute_list_shapes* shapes,
+                                             OTF2_MappingCallback        mappingCb,
+                                             void*                       mappingData )
+{
+    UTILS_ASSERT( attributeList );
+    UTILS_ASSERT( buffer );
+    UTILS_ASSERT( shapes );
+
+    OTF2_ErrorCode status = otf2_attribute_list_decode( attributeList );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
+    uint8_t* record_length_pos;
+    OTF2_Buffer_GetPosition( buffer, &record_length_pos );
+
+    /* Get record length and test memory availability */
+    uint64_t record_data_length;
+    status = OTF2_Buffer_GuaranteeRecord( buffer, &record_data_length );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status,
+                            "Could not read attribute list. "
+                            "Not enough memory in buffer." );
+    }
+    uint8_t* record_start_pos;
+    OTF2_Buffer_GetPosition( buffer, &record_start_pos );
+
+    uint8_t index;
+    status = otf2_attribute_list_read_shape( buffer, recordType, shapes, &index );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+    if ( !( shapes->known & ( UINT32_C( 1 ) << index ) ) )
+    {
+        /* The definition of the shape was not seen yet. */
+        OTF2_Buffer_SetPosition( buffer, record_length_pos );
+        return OTF2_ERROR_INVALID_DATA;
+    }
+    const otf2_attribute_list_shape* shape = &shapes->shapes[ index ];
+
+    status = otf2_attribute_list_reserve( attributeList,
+                                          shape->number_of_attributes );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status,
+                            "Could not add attributes to attribute list." );
+    }
+
+    for ( uint32_t i = 0; i < shape->number_of_attributes; i++ )
+    {
+        OTF2_AttributeRef   attribute_id = mappingCb( mappingData,
+                                                      OTF2_MAPPING_ATTRIBUTE,
+                                                      shape->attributes[ i ] );
+        OTF2_AttributeValue value;
+        status = otf2_attribute_value_read_from_buffer( &value,
+                                                        buffer,
+                                                        shape->types[ i ],
+                                                        mappingCb,
+                                                        mappingData );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status,
+                                "Could not read attribute value." );
+        }
+
+        if ( otf2_attribute_list_find_id( attributeList, attribute_id ) )
+        {
+            return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                                "Could not add attribute to attribute list. "
+                                "The attribute ID already exists!" );
+        }
+        otf2_attribute* new_entry = &attributeList->entries[ attributeList->capacity++ ];
+        new_entry->type_id      = shape->types[ i ];
+        new_entry->attribute_id = attribute_id;
+        new_entry->value        = value;
+    }
+
+    /*
+     * Always jump to the announced end of the record.
+     */
+    status = OTF2_Buffer_SetPosition( buffer, record_start_pos + record_data_length );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status, "Could not read attribute list." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+OTF2_ErrorCode
+otf2_attribute_list_register_shape_from_buffer( OTF2_Buffer*                buffer,
+                                                otf2_attribute_list_shapes* shapes )
+{
+    UTILS_ASSERT( buffer );
+    UTILS_ASSERT( shapes );
+
+    OTF2_ErrorCode status;
+
+    uint64_t record_data_length;
+    status = OTF2_Buffer_GuaranteeRecord( buffer, &record_data_length );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status,
+                            "Could not read attribute list. "
+                            "Not enough memory in buffer." );
+    }
+    uint8_t* record_start_pos;
+    OTF2_Buffer_GetPosition( buffer, &record_start_pos );
+
+    /* The values follow the shape and are not needed. */
+    uint8_t index;
+    status = otf2_attribute_list_read_shape( buffer,
+                                             OTF2_BUFFER_ATTRIBUTE_LIST_DEFINE,
+                                             shapes,
+                                             &index );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
+    status = OTF2_Buffer_SetPosition( buffer, record_start_pos + record_data_length );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status, "Could not read attribute list." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Find a known shape matching an attribute list.
+ *
+ *  @return The index of the shape, OTF2_ATTRIBUTE_LIST_SHAPES_MAX if there
+ *          is none.
+ */
+static inline uint32_t
+otf2_attribute_list_find_shape( const otf2_attribute_list_shapes* shapes,
+                                const OTF2_AttributeList*         attributeList )
+{
+    /* Start with the last used shape, lists tend to repeat. */
+    uint32_t known = shapes->known;
+    uint32_t index = shapes->last;
+    while ( known )
+    {
+        if ( known & ( UINT32_C( 1 ) << index ) )
+        {
+            known &= ~( UINT32_C( 1 ) << index );
+
+            const otf2_attribute_list_shape* shape = &shapes->shapes[ index ];
+            if ( shape->number_of_attributes == attributeList->capacity )
+            {
+                uint32_t i = 0;
+                while ( i < shape->number_of_attributes &&
+                        shape->attributes[ i ] == attributeList->entries[ i ].attribute_id &&
+                        shape->types[ i ] == attributeList->entries[ i ].type_id )
+                {
+                    i++;
+                }
+                if ( i == shape->number_of_attributes )
+                {
+                    return index;
+                }
+            }
+        }
+        index = ( index + 1 ) % OTF2_ATTRIBUTE_LIST_SHAPES_MAX;
+    }
+
+    return OTF2_ATTRIBUTE_LIST_SHAPES_MAX;
+}
+
+
+OTF2_ErrorCode
+otf2_attribute_list_write_shaped_to_buffer( OTF2_AttributeList*         attributeList,
+                                            OTF2_Buffer*                buffer,
+                                            otf2_attribute_list_shapes* shapes )
+{
+    /* Write no attribute list to the buffer, if there is no one. */
+    if ( attributeList == NULL || attributeList->capacity == 0 )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    UTILS_ASSERT( buffer );
+    UTILS_ASSERT( shapes );
+
+    if ( attributeList->capacity > OTF2_ATTRIBUTE_LIST_SHAPE_MAX_SIZE )
+    {
+        return otf2_attribute_list_write_to_buffer( attributeList, buffer );
+    }
+
+    if ( shapes->chunk != buffer->chunk_serial )
+    {
+        otf2_attribute_list_shapes_reset( shapes, buffer->chunk_serial );
+    }
+
+    uint32_t index = otf2_attribute_list_find_shape( shapes, attributeList );
+    bool     define = ( index == OTF2_ATTRIBUTE_LIST_SHAPES_MAX );
+    if ( define )
+    {
+        if ( shapes->number_of_shapes == OTF2_ATTRIBUTE_LIST_SHAPES_MAX )
+        {
+            return otf2_attribute_list_write_to_buffer( attributeList, buffer );
+        }
+        index = shapes->number_of_shapes++;
+    }
+    shapes->last = index;
+
+    otf2_attribute_list_shape* shape = &shapes->shapes[ index ];
+    otf2_attribute*            end   = attributeList->entries + attributeList->capacity;
+
+    OTF2_Buffer_WriteUint8( buffer, define
+                            ? OTF2_BUFFER_ATTRIBUTE_LIST_DEFINE
+                            : OTF2_BUFFER_ATTRIBUTE_LIST_REFERENCE );
+
+    /* The shape index takes the place of the number of elements, if the
+     * shape is only referenced. */
+    uint32_t data_size_of_attr_list = otf2_attribute_list_get_data_size( attributeList ) + 1;
+    OTF2_Buffer_WriteInitialRecordLength( buffer, data_size_of_attr_list );
+
+    OTF2_Buffer_WriteUint8( buffer, index );
+
+    if ( define )
+    {
+        OTF2_Buffer_WriteUint32( buffer, attributeList->capacity );
+
+        uint32_t i = 0;
+        for ( otf2_attribute* attr = attributeList->entries; attr < end; attr++, i++ )
+        {
+            OTF2_Buffer_WriteUint32( buffer, attr->attribute_id );
+            OTF2_Buffer_WriteUint8( buffer, attr->type_id );
+
+            shape->attributes[ i ] = attr->attribute_id;
+            shape->types[ i ]      = attr->type_id;
+        }
+        shape->number_of_attributes = attributeList->capacity;
+        shapes->known              |= UINT32_C( 1 ) << index;
+    }
+
+    for ( otf2_attribute* attr = attributeList->entries; attr < end; attr++ )
+    {
+        otf2_attribute_value_write_to_buffer( &attr->value,
+                                              attr->type_id,
+                                              buffer );
+    }
+
+    otf2_attribute_list_remove_all_attributes( attributeList );
+
+    /* Write real record length */
+    return OTF2_Buffer_WriteFinalRecordLength( buffer, data_size_of_attr_list );
+}
+
+
 /* Include generated convenient helper functions */
 #include "otf2_attribute_list_inc.c"
@@ -104,6 +104,10 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#if HAVE( PLATFORM_LINUX )
+#include <sys/mman.h>
+#endif
+
 #include <otf2/otf2.h>
 
 #include <UTILS_Error.h>
@@ -150,23 +154,35 @@
  */
 #define OTF2_CHUNK_HEADER_LAST_EVENT ( uint64_t )10
 
+/** @brief Size of a chunk header which also records the size of the chunk.
+ *
+ *  Please note: This macro directly depends on the implementation of
+ *  otf2_buffer_write_header, too.
+ */
+#define OTF2_SIZED_CHUNK_HEADER_SIZE ( uint64_t )26
+
+/** @brief Position of the chunk size within a sized chunk header. */
+#define OTF2_CHUNK_HEADER_CHUNK_SIZE ( uint64_t )18
+
 
 /** @brief Defines the maximum size that can be allocated by the internal
  *  allocator. */
 #define OTF2_ALLOCATE_SIZE_MAX ( uint64_t )( 1024 * 1024 * 128 )
 
-#ifdef WORDS_BIGENDIAN
-#define OTF2_HOST_ENDIANNESS OTF2_BIG_ENDIAN
-#else
-#define OTF2_HOST_ENDIANNESS OTF2_LITTLE_ENDIAN
-#endif
-
-
 /* ___ Prototypes for internal functions. ___________________________________ */
 
 static inline void
 otf2_buffer_write_header( OTF2_Buffer* bufferHandle );
 
+static inline void
+otf2_buffer_init_chunk_index( OTF2_Buffer* bufferHandle );
+
+static inline void
+otf2_buffer_write_index_trailer( OTF2_Buffer* bufferHandle );
+
+static void
+otf2_buffer_read_check_chunk_index( OTF2_Buffer* bufferHandle );
+
 static inline OTF2_ErrorCode
 otf2_buffer_read_chunk( OTF2_Buffer*  bufferHandle,
                         OTF2_FilePart filePart );
@@ -175,7 +191,14 @@ static inline OTF2_ErrorCode
 otf2_buffer_read_header( OTF2_Buffer* bufferHandle );
 
 static OTF2_ErrorCode
-otf2_buffer_clear_rewind_list( OTF2_Buffer* bufferHandle );
+otf2_buffer_clear_rewind_stack( OTF2_Buffer* bufferHandle );
+
+static otf2_rewind_point*
+otf2_buffer_find_rewind_point( OTF2_Buffer* bufferHandle,
+                               uint32_t     id );
+
+static OTF2_ErrorCode
+otf2_buffer_read_drop_other_chunks( OTF2_Buffer* bufferHandle );
 
 static OTF2_ErrorCode
 otf2_buffer_get_file_handle( OTF2_Buffer* bufferHandle );
@@ -189,8 +212,28 @@ otf2_buffer_load_events( OTF2_Buffer* bufferHandle );
 static OTF2_ErrorCode
 otf2_buffer_load_head_n_time( OTF2_Buffer* bufferHandle );
 
+static OTF2_ErrorCode
+otf2_buffer_load_chunk( OTF2_Buffer* bufferHandle );
+
+static OTF2_ErrorCode
+otf2_buffer_seek_chunk( OTF2_Buffer* bufferHandle,
+                        uint64_t     chunkNumber );
+
+static OTF2_ErrorCode
+otf2_buffer_get_number_of_chunks( OTF2_Buffer* bufferHandle,
+                                  uint64_t*    numberOfChunks );
+
+static void
+otf2_buffer_adapt_chunk_size( OTF2_Buffer*   bufferHandle,
+                              OTF2_TimeStamp time );
+
+static uint64_t
+otf2_buffer_fit_chunk_size( OTF2_Buffer* bufferHandle,
+                            uint64_t     recordLength );
+
 static inline void*
-otf2_buffer_memory_allocate( OTF2_Buffer* buffer );
+otf2_buffer_memory_allocate( OTF2_Buffer* buffer,
+                             uint64_t     size );
 
 void
 otf2_buffer_memory_free( OTF2_Buffer* buffer,
@@ -327,8 +370,9 @@ OTF2_Buffer_New( OTF2_Archive*    archive,
     buffer_handle->file_type   = fileType;
     buffer_handle->location_id = location;
 
-    buffer_handle->time      = 0;
-    buffer_handle->time_pos  = NULL;
+    buffer_handle->time       = 0;
+    buffer_handle->first_time = OTF2_UNDEFINED_TIMESTAMP;
+    buffer_handle->time_pos   = NULL;
     buffer_handle->finalized = false;
 
     /* Set default endianness mode to that of the host,
@@ -337,6 +381,70 @@ OTF2_Buffer_New( OTF2_Archive*    archive,
 
     buffer_handle->file = NULL;
 
+    /* Event chunks may carry an index of the event positions. */
+    if ( archive
+         && archive->file_mode == OTF2_FILEMODE_WRITE
+         && bufferMode == OTF2_BUFFER_WRITE
+         && chunkMode == OTF2_BUFFER_CHUNKED
+         && fileType == OTF2_FILETYPE_EVENTS
+         && archive->compression == OTF2_COMPRESSION_NONE )
+    {
+        /* Caller holds the archive lock. */
+        otf2_archive_query_hint( archive,
+                                 OTF2_HINT_EVENT_INDEX_INTERVAL,
+                                 &buffer_handle->index_interval );
+    }
+
+    /* Chunks of the local writers may be backed by pages of their own.
+     * These occupy no memory before they are written, thus they need not
+     * grow. */
+    buffer_handle->chunk_pages = OTF2_CHUNK_ALLOCATION_HEAP;
+    if ( archive
+         && archive->file_mode == OTF2_FILEMODE_WRITE
+         && bufferMode == OTF2_BUFFER_WRITE
+         && chunkMode == OTF2_BUFFER_CHUNKED
+         && ( fileType == OTF2_FILETYPE_EVENTS
+              || fileType == OTF2_FILETYPE_LOCAL_DEFS
+              || fileType == OTF2_FILETYPE_SNAPSHOTS ) )
+    {
+        /* Caller holds the archive lock. */
+        otf2_archive_query_hint( archive,
+                                 OTF2_HINT_CHUNK_ALLOCATION,
+                                 &buffer_handle->chunk_pages );
+#if !HAVE( PLATFORM_LINUX )
+        buffer_handle->chunk_pages = OTF2_CHUNK_ALLOCATION_HEAP;
+#endif
+        if ( archive->allocator_callbacks )
+        {
+            buffer_handle->chunk_pages = OTF2_CHUNK_ALLOCATION_HEAP;
+        }
+    }
+
+    /* Event chunks may adapt their size to the write rate. The memory
+     * callbacks provide only chunks of the archive's chunk size. */
+    buffer_handle->chunk_time = OTF2_UNDEFINED_TIMESTAMP;
+    if ( archive
+         && archive->file_mode == OTF2_FILEMODE_WRITE
+         && bufferMode == OTF2_BUFFER_WRITE
+         && chunkMode == OTF2_BUFFER_CHUNKED
+         && fileType == OTF2_FILETYPE_EVENTS
+         && archive->compression == OTF2_COMPRESSION_NONE )
+    {
+        /* Caller holds the archive lock. */
+        otf2_archive_query_hint( archive,
+                                 OTF2_HINT_ADAPTIVE_CHUNK_SIZE,
+                                 &buffer_handle->chunk_size_min );
+        if ( archive->allocator_callbacks
+             || buffer_handle->chunk_size_min >= chunkSize )
+        {
+            buffer_handle->chunk_size_min = 0;
+        }
+    }
+    buffer_handle->sized_chunks    = buffer_handle->chunk_size_min != 0;
+    buffer_handle->next_chunk_size = buffer_handle->sized_chunks
+                                     ? buffer_handle->chunk_size_min
+                                     : chunkSize;
+
     /* Allocate memory for a chunk handle and validate. */
     chunk = ( otf2_chunk* )calloc( 1, sizeof( otf2_chunk ) );
     if ( NULL == chunk )
@@ -351,9 +459,11 @@ OTF2_Buffer_New( OTF2_Archive*    archive,
      * In reading mode un-chunked buffers are allocated in
      * otf2_buffer_read_chunk(). */
     chunk->begin = NULL;
+    chunk->size  = buffer_handle->next_chunk_size;
     if ( bufferMode == OTF2_BUFFER_WRITE || chunkMode == OTF2_BUFFER_CHUNKED )
     {
-        chunk->begin = ( uint8_t* )otf2_buffer_memory_allocate( buffer_handle );
+        chunk->begin = ( uint8_t* )otf2_buffer_memory_allocate( buffer_handle,
+                                                                 chunk->size );
         if ( NULL == chunk->begin )
         {
             UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
@@ -363,7 +473,7 @@ OTF2_Buffer_New( OTF2_Archive*    archive,
             return NULL;
         }
 
-        chunk->end = chunk->begin + chunkSize;
+        chunk->end = chunk->begin + chunk->size;
     }
     chunk->chunk_num   = 1;
     chunk->first_event = 0;
@@ -373,12 +483,15 @@ OTF2_Buffer_New( OTF2_Archive*    archive,
 
     buffer_handle->chunk      = chunk;
     buffer_handle->chunk_list = chunk;
+    otf2_buffer_init_chunk_index( buffer_handle );
 
     buffer_handle->write_pos = buffer_handle->chunk->begin;
     buffer_handle->read_pos  = NULL;
 
-    /* Initialize pointer to the rewind list */
-    buffer_handle->rewindlist = NULL;
+    /* Initialize the rewind stack, it is allocated with the first rewind point */
+    buffer_handle->rewind_points           = NULL;
+    buffer_handle->number_of_rewind_points = 0;
+    buffer_handle->rewind_points_capacity  = 0;
 
     /* Initialize pointer to the old_chunk_list */
     buffer_handle->old_chunk_list = NULL;
@@ -453,6 +566,8 @@ OTF2_Buffer_Delete( OTF2_Buffer* bufferHandle )
     otf2_buffer_memory_free( bufferHandle, true );
     otf2_buffer_free_all_chunks( bufferHandle );
 
+    free( bufferHandle->rewind_points );
+    free( bufferHandle->chunk_offsets );
     free( bufferHandle );
 
     if ( status_flush != OTF2_SUCCESS || status_file != OTF2_SUCCESS )
@@ -648,18 +763,25 @@ OTF2_Buffer_SetLocationID( OTF2_Buffer*     bufferHandle,
  *
  *  @param bufferHandle     Initialized OTF2_Buffer instance.
  *  @param time             Current timestamp.
+ *  @param recordLength     Size of the requested record in bytes, including
+ *                          its timestamp.
  *
  *  @return                 Returns OTF2_SUCCESS if successful, an error code
  *                          if an error occurs.
  */
 OTF2_ErrorCode
 OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
-                             OTF2_TimeStamp time )
+                             OTF2_TimeStamp time,
+                             uint64_t       recordLength )
 {
     UTILS_ASSERT( bufferHandle );
 
     OTF2_ErrorCode status;
 
+    /* Choose the size of the new chunk by the write rate of this one. */
+    otf2_buffer_adapt_chunk_size( bufferHandle, time );
+    uint64_t chunk_size = otf2_buffer_fit_chunk_size( bufferHandle, recordLength );
+
     /* Write number of the last event in the chunk header. */
     memcpy( bufferHandle->chunk->begin + OTF2_CHUNK_HEADER_LAST_EVENT,
             &( bufferHandle->chunk->first_event ), 8 );
@@ -667,12 +789,14 @@ OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
     /* Set all remaining bytes in the chunk to OTF2_BUFFER_END_OF_CHUNK. */
     memset( bufferHandle->write_pos, ( char )OTF2_BUFFER_END_OF_CHUNK,
             bufferHandle->chunk->end - bufferHandle->write_pos );
+    otf2_buffer_write_index_trailer( bufferHandle );
 
-    /* Use an old chunk if available */
+    /* Use an old chunk if available and large enough, the chunks of a buffer
+     * differ in size only if they adapt. */
     otf2_chunk* new_chunk = bufferHandle->old_chunk_list;
 
     /* Update old_chunk_list */
-    if ( new_chunk )
+    if ( new_chunk && new_chunk->size >= chunk_size )
     {
         bufferHandle->old_chunk_list = new_chunk->next;
     }
@@ -687,14 +811,15 @@ OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
                                 "Could not allocate memory for internal handle!" );
         }
 
-        new_chunk->begin = otf2_buffer_memory_allocate( bufferHandle );
+        new_chunk->begin = otf2_buffer_memory_allocate( bufferHandle, chunk_size );
+        new_chunk->size  = chunk_size;
     }
 
 
     if ( NULL != new_chunk->begin )
     {
         /* Initialize new chunk handle data. */
-        new_chunk->end         = new_chunk->begin + bufferHandle->chunk_size;
+        new_chunk->end         = new_chunk->begin + new_chunk->size;
         new_chunk->chunk_num   = bufferHandle->chunk->chunk_num + 1;
         new_chunk->first_event = bufferHandle->chunk->first_event;
         new_chunk->last_event  = 0;
@@ -705,6 +830,7 @@ OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
         bufferHandle->chunk->next = new_chunk;
         bufferHandle->chunk       = new_chunk;
         bufferHandle->write_pos   = bufferHandle->chunk->begin;
+        otf2_buffer_init_chunk_index( bufferHandle );
 
         /* Write chunk header. */
         otf2_buffer_write_header( bufferHandle );
@@ -732,15 +858,17 @@ OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
                                 "Buffer flush failed!" );
         }
 
-        /* Initialize new chunk handle data. */
-        new_chunk->begin = otf2_buffer_memory_allocate( bufferHandle );
+        /* Initialize new chunk handle data. The whole memory is available
+         * again. */
+        new_chunk->size  = otf2_buffer_fit_chunk_size( bufferHandle, recordLength );
+        new_chunk->begin = otf2_buffer_memory_allocate( bufferHandle, new_chunk->size );
         if ( NULL == new_chunk->begin )
         {
             free( new_chunk );
             return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
                                 "Failed to allocate memory for chunk!" );
         }
-        new_chunk->end         = new_chunk->begin + bufferHandle->chunk_size;
+        new_chunk->end         = new_chunk->begin + new_chunk->size;
         new_chunk->chunk_num   = 1;
         new_chunk->first_event = first_event;
         new_chunk->last_event  = 0;
@@ -751,6 +879,7 @@ OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
         bufferHandle->chunk      = new_chunk;
         bufferHandle->chunk_list = new_chunk;
         bufferHandle->write_pos  = bufferHandle->chunk->begin;
+        otf2_buffer_init_chunk_index( bufferHandle );
 
         /* Write chunk header. */
         otf2_buffer_write_header( bufferHandle );
@@ -763,13 +892,23 @@ OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
             bufferHandle->time = time;
 
             if ( bufferHandle->file_type == OTF2_FILETYPE_EVENTS &&
-                 bufferHandle->archive->flush_callbacks->otf2_post_flush != NULL )
+                 ( bufferHandle->archive->flush_callbacks->otf2_post_flush != NULL ||
+                   bufferHandle->archive->clock.enabled ) )
             {
-                /* Get a timestamp from the user and write flush record. */
-                OTF2_TimeStamp flush_time = bufferHandle->archive->flush_callbacks
-                                            ->otf2_post_flush( bufferHandle->archive->flush_data,
-                                                               bufferHandle->file_type,
-                                                               bufferHandle->location_id );
+                /* Get a timestamp from the user, or from the built-in
+                 * clock, and write flush record. */
+                OTF2_TimeStamp flush_time;
+                if ( bufferHandle->archive->flush_callbacks->otf2_post_flush != NULL )
+                {
+                    flush_time = bufferHandle->archive->flush_callbacks
+                                 ->otf2_post_flush( bufferHandle->archive->flush_data,
+                                                    bufferHandle->file_type,
+                                                    bufferHandle->location_id );
+                }
+                else
+                {
+                    flush_time = otf2_archive_get_time( bufferHandle->archive );
+                }
 
                 /* Write event type */
                 OTF2_Buffer_WriteUint8( bufferHandle, OTF2_EVENT_BUFFER_FLUSH );
@@ -791,10 +930,12 @@ OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
 /** @brief Write chunk header.
  *
  *  Writes the chunk header with the number of the first event in the current
- *  chunk and reserves space for the number of the last event.
+ *  chunk and reserves space for the number of the last event. If the chunks
+ *  differ in size, the size of the chunk follows.
  *
- *  Please note: The macros OTF2_CHUNK_HEADER_SIZE and
- *  OTF2_CHUNK_HEADER_LAST_EVENT directly depend on the implementation of this
+ *  Please note: The macros OTF2_CHUNK_HEADER_SIZE,
+ *  OTF2_CHUNK_HEADER_LAST_EVENT, OTF2_SIZED_CHUNK_HEADER_SIZE, and
+ *  OTF2_CHUNK_HEADER_CHUNK_SIZE directly depend on the implementation of this
  *  function. So if you make any changes to this function you have to addapt
  *  these macros accordingly.
  *
@@ -805,7 +946,10 @@ otf2_buffer_write_header( OTF2_Buffer* bufferHandle )
 {
     UTILS_ASSERT( bufferHandle );
 
-    OTF2_Buffer_WriteUint8( bufferHandle, OTF2_BUFFER_CHUNK_HEADER );
+    OTF2_Buffer_WriteUint8( bufferHandle,
+                            bufferHandle->sized_chunks
+                            ? OTF2_BUFFER_SIZED_CHUNK_HEADER
+                            : OTF2_BUFFER_CHUNK_HEADER );
     OTF2_Buffer_WriteUint8( bufferHandle, OTF2_HOST_ENDIANNESS );
 
     /* In chunked mode we write also the first and last event number */
@@ -814,6 +958,309 @@ otf2_buffer_write_header( OTF2_Buffer* bufferHandle )
         OTF2_Buffer_WriteUint64Full( bufferHandle, bufferHandle->chunk->first_event + 1 );
         OTF2_Buffer_WriteUint64Full( bufferHandle, 0 );
     }
+
+    if ( bufferHandle->sized_chunks )
+    {
+        OTF2_Buffer_WriteUint64Full( bufferHandle, bufferHandle->chunk->size );
+    }
+}
+
+
+/** @brief Get the size of the chunk headers of a buffer.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *
+ *  @return                 Returns the size in bytes.
+ */
+static inline uint64_t
+otf2_buffer_header_size( const OTF2_Buffer* bufferHandle )
+{
+    return bufferHandle->sized_chunks
+           ? OTF2_SIZED_CHUNK_HEADER_SIZE
+           : OTF2_CHUNK_HEADER_SIZE;
+}
+
+
+/** @brief Adapt the size of the next chunk to the write rate.
+ *
+ *  The write rate of the current chunk is the number of bytes written into
+ *  it per time unit of its timestamps. The next chunk gets twice the size of
+ *  the current one, unless the rate dropped to less than half of that of the
+ *  previous chunk. Then it gets half of the size. The size stays within the
+ *  bounds of the buffer.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param time             Timestamp of the first record of the next chunk.
+ */
+static void
+otf2_buffer_adapt_chunk_size( OTF2_Buffer*   bufferHandle,
+                              OTF2_TimeStamp time )
+{
+    if ( !bufferHandle->sized_chunks )
+    {
+        return;
+    }
+
+    otf2_chunk*    chunk = bufferHandle->chunk;
+    OTF2_TimeStamp begin = bufferHandle->chunk_time;
+    if ( begin == OTF2_UNDEFINED_TIMESTAMP )
+    {
+        begin = bufferHandle->first_time;
+    }
+    uint64_t duration = 1;
+    if ( begin != OTF2_UNDEFINED_TIMESTAMP && time > begin )
+    {
+        duration = time - begin;
+    }
+    double rate = ( double )( bufferHandle->write_pos - chunk->begin ) / duration;
+
+    if ( bufferHandle->chunk_rate == 0 || 2 * rate >= bufferHandle->chunk_rate )
+    {
+        bufferHandle->next_chunk_size = 2 * chunk->size;
+        if ( bufferHandle->next_chunk_size > bufferHandle->chunk_size )
+        {
+            bufferHandle->next_chunk_size = bufferHandle->chunk_size;
+        }
+    }
+    else
+    {
+        bufferHandle->next_chunk_size = chunk->size / 2;
+        if ( bufferHandle->next_chunk_size < bufferHandle->chunk_size_min )
+        {
+            bufferHandle->next_chunk_size = bufferHandle->chunk_size_min;
+        }
+    }
+
+    bufferHandle->chunk_rate = rate;
+    bufferHandle->chunk_time = time;
+}
+
+
+/** @brief Fit the size of the next chunk to the remaining memory.
+ *
+ *  The size is halved while the remaining memory of the buffer does not
+ *  suffice, but it stays above the minimum and large enough for the
+ *  requested record.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param recordLength     Size of the requested record in bytes.
+ *
+ *  @return                 Returns the size of the next chunk in bytes.
+ */
+static uint64_t
+otf2_buffer_fit_chunk_size( OTF2_Buffer* bufferHandle,
+                            uint64_t     recordLength )
+{
+    uint64_t size = bufferHandle->next_chunk_size;
+    if ( !bufferHandle->sized_chunks )
+    {
+        return size;
+    }
+
+    /* The record must fit behind the header, in front of the event index and
+     * the OTF2_BUFFER_END_OF_CHUNK byte. */
+    uint64_t needed = OTF2_SIZED_CHUNK_HEADER_SIZE + recordLength + 1;
+    if ( bufferHandle->index_interval )
+    {
+        needed += OTF2_CHUNK_INDEX_TRAILER_SIZE + 1;
+    }
+    uint64_t min = bufferHandle->chunk_size_min;
+    while ( min < needed && min < bufferHandle->chunk_size )
+    {
+        min *= 2;
+        if ( min > bufferHandle->chunk_size )
+        {
+            min = bufferHandle->chunk_size;
+        }
+    }
+    if ( size < min )
+    {
+        size = min;
+    }
+
+    while ( size > bufferHandle->memory && size / 2 >= min )
+    {
+        size /= 2;
+    }
+
+    return size;
+}
+
+
+/** @brief Write a timestamp and request memory for the following record.
+ *
+ *  The out-of-line part of OTF2_Buffer_WriteTimeStamp, used when the record
+ *  may not fit into the current chunk, an event index entry is due, or the
+ *  timestamp needs to be checked.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param time             Time the event took place.
+ *  @param recordLength     Size of requested record in bytes.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_buffer_write_timestamp( OTF2_Buffer*         bufferHandle,
+                             const OTF2_TimeStamp time,
+                             uint64_t             recordLength )
+{
+    OTF2_ErrorCode status = OTF2_SUCCESS;
+
+    /* Check the time order early, because we may write
+       timestamps in OTF2_Buffer_RecordRequest, too */
+    if ( time < bufferHandle->time )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Passed timestamp is smaller than last written one! (%" PRIu64 " < %" PRIu64 ")",
+                            time, bufferHandle->time );
+    }
+
+    /* The inline path is only taken after a non-zero timestamp was
+     * written, thus the first event of the buffer always passes here. */
+    if ( bufferHandle->first_time == OTF2_UNDEFINED_TIMESTAMP )
+    {
+        bufferHandle->first_time = time;
+    }
+
+    /* Reserve space for an event index entry and its timestamp, if one is
+     * due for this event. */
+    uint64_t index_size = 0;
+    if ( bufferHandle->chunk->first_event == bufferHandle->chunk->index_next )
+    {
+        index_size = OTF2_CHUNK_INDEX_ENTRY_SIZE + OTF2_BUFFER_TIMESTAMP_SIZE;
+    }
+
+    /* Handle chunking and buffer overflow. */
+    status = OTF2_Buffer_RecordRequest( bufferHandle, time, recordLength + index_size );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status,
+                            "Chunk handling failed!" );
+    }
+
+    /* An indexed event starts always with its own timestamp record. */
+    bool indexed = false;
+    if ( bufferHandle->chunk->first_event == bufferHandle->chunk->index_next )
+    {
+        indexed = OTF2_Buffer_WriteIndexEntry( bufferHandle, recordLength );
+    }
+
+    /* Check if actual timestamp is newer than the last written one. If so write
+     * it to the buffer otherwise return.
+     * Enable to write a timestamp zero at the beginning of the buffer. */
+    if ( ( time > bufferHandle->time ) ||
+         ( time == 0 && time == bufferHandle->time ) ||
+         indexed )
+    {
+        OTF2_Buffer_WriteUint8( bufferHandle, OTF2_BUFFER_TIMESTAMP );
+        OTF2_Buffer_WriteUint64Full( bufferHandle, time );
+
+        bufferHandle->time = time;
+    }
+
+
+    /* Increment number of events. In writing mode only one counter is
+       necessary. So only 'first_event' is incremented. */
+    bufferHandle->chunk->first_event++;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Prepare the event index of a fresh chunk in writing mode.
+ *
+ *  Moves the end of the usable memory in front of the index trailer, the
+ *  index entries are added in front of it by OTF2_Buffer_WriteIndexEntry.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ */
+static inline void
+otf2_buffer_init_chunk_index( OTF2_Buffer* bufferHandle )
+{
+    otf2_chunk* chunk = bufferHandle->chunk;
+
+    chunk->index_entries = 0;
+    chunk->index_next    = UINT64_MAX;
+    bufferHandle->segment++;
+    bufferHandle->chunk_serial++;
+
+    if ( bufferHandle->index_interval == 0 )
+    {
+        return;
+    }
+
+    /* One byte separates the records from the index, so that a final
+     * OTF2_BUFFER_END_OF_BUFFER never overwrites an entry. */
+    chunk->end = chunk->begin + chunk->size
+                 - OTF2_CHUNK_INDEX_TRAILER_SIZE - 1;
+    chunk->index_next = chunk->first_event + bufferHandle->index_interval;
+}
+
+
+/** @brief Write the event index trailer of the current chunk.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ */
+static inline void
+otf2_buffer_write_index_trailer( OTF2_Buffer* bufferHandle )
+{
+    if ( bufferHandle->index_interval == 0 )
+    {
+        return;
+    }
+
+    otf2_chunk* chunk   = bufferHandle->chunk;
+    uint8_t*    trailer = chunk->begin + chunk->size
+                          - OTF2_CHUNK_INDEX_TRAILER_SIZE;
+
+    if ( bufferHandle->write_pos <= chunk->end )
+    {
+        *chunk->end = OTF2_BUFFER_END_OF_CHUNK;
+    }
+    memcpy( trailer, &chunk->index_entries, sizeof( uint32_t ) );
+    memcpy( trailer + sizeof( uint32_t ), &bufferHandle->index_interval, sizeof( uint32_t ) );
+    trailer[ 2 * sizeof( uint32_t ) ] = OTF2_BUFFER_CHUNK_INDEX;
+}
+
+
+/** @brief Add an event index entry for the next event.
+ *
+ *  Must be called before the timestamp of the indexed event is written, the
+ *  entry points to this timestamp record.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param recordLength     Size of the event record in bytes.
+ *
+ *  @return                 Returns true if the entry was written. Than the
+ *                          event needs its own timestamp record.
+ */
+bool
+OTF2_Buffer_WriteIndexEntry( OTF2_Buffer* bufferHandle,
+                             uint64_t     recordLength )
+{
+    UTILS_ASSERT( bufferHandle );
+
+    otf2_chunk* chunk = bufferHandle->chunk;
+
+    uint64_t free_memory = chunk->end - bufferHandle->write_pos;
+    if ( OTF2_CHUNK_INDEX_ENTRY_SIZE + OTF2_BUFFER_TIMESTAMP_SIZE + recordLength
+         >= free_memory )
+    {
+        /* Chunk is nearly full, stop indexing it. */
+        chunk->index_next = UINT64_MAX;
+        return false;
+    }
+
+    uint32_t offset = bufferHandle->write_pos - chunk->begin;
+    chunk->end -= OTF2_CHUNK_INDEX_ENTRY_SIZE;
+    memcpy( chunk->end + 1, &offset, sizeof( offset ) );
+
+    chunk->index_entries++;
+    chunk->index_next += bufferHandle->index_interval;
+    bufferHandle->segment++;
+
+    return true;
 }
 
 
@@ -868,8 +1315,8 @@ OTF2_Buffer_FlushBuffer( OTF2_Buffer* bufferHandle )
         flush = OTF2_NO_FLUSH;
     }
 
-    /* Remove all previous stored rewind points from rewind list. */
-    otf2_buffer_clear_rewind_list( bufferHandle );
+    /* Remove all previous stored rewind points from rewind stack. */
+    otf2_buffer_clear_rewind_stack( bufferHandle );
 
     /* Get flush information from pre flush callback. */
     if ( bufferHandle->archive->flush_callbacks
@@ -920,8 +1367,12 @@ OTF2_Buffer_FlushBuffer( OTF2_Buffer* bufferHandle )
                 &( bufferHandle->chunk->first_event ), 8 );
 
         /* Set all remaining bytes in the chunk to OTF2_BUFFER_END_OF_CHUNK. */
-        memset( bufferHandle->write_pos, ( char )OTF2_BUFFER_END_OF_CHUNK,
-                bufferHandle->chunk->end - bufferHandle->write_pos );
+        if ( bufferHandle->write_pos < bufferHandle->chunk->end )
+        {
+            memset( bufferHandle->write_pos, ( char )OTF2_BUFFER_END_OF_CHUNK,
+                    bufferHandle->chunk->end - bufferHandle->write_pos );
+        }
+        otf2_buffer_write_index_trailer( bufferHandle );
 
 
         /* Flush the buffer by looping over all chunks. */
@@ -934,16 +1385,27 @@ OTF2_Buffer_FlushBuffer( OTF2_Buffer* bufferHandle )
              * used part to file. */
             if ( bufferHandle->finalized && chunk->next == NULL )
             {
+                uint64_t length = bufferHandle->write_pos - chunk->begin;
+                if ( bufferHandle->index_interval )
+                {
+                    /* Move the event index right behind the used part, the
+                     * reader finds it at the end of the file. */
+                    uint64_t index_size = chunk->index_entries * OTF2_CHUNK_INDEX_ENTRY_SIZE
+                                          + OTF2_CHUNK_INDEX_TRAILER_SIZE;
+                    memmove( bufferHandle->write_pos,
+                             chunk->begin + chunk->size - index_size,
+                             index_size );
+                    length += index_size;
+                }
                 status = OTF2_File_Write( bufferHandle->file,
                                           chunk->begin,
-                                          bufferHandle->write_pos
-                                          - bufferHandle->chunk->begin );
+                                          length );
             }
             else
             {
                 status = OTF2_File_Write( bufferHandle->file,
                                           chunk->begin,
-                                          bufferHandle->chunk_size );
+                                          chunk->size );
             }
 
             chunk = chunk->next;
@@ -1033,30 +1495,6 @@ OTF2_Buffer_ReadTimeStamp( OTF2_Buffer*    bufferHandle,
  *  @{
  */
 
-void
-OTF2_Buffer_ReadUint8( OTF2_Buffer* bufferHandle,
-                       uint8_t*     returnValue )
-{
-    UTILS_ASSERT( bufferHandle );
-    UTILS_ASSERT( returnValue );
-
-    memcpy( returnValue, bufferHandle->read_pos, 1 );
-    bufferHandle->read_pos++;
-}
-
-
-void
-OTF2_Buffer_ReadInt8( OTF2_Buffer* bufferHandle,
-                      int8_t*      returnValue )
-{
-    UTILS_ASSERT( bufferHandle );
-    UTILS_ASSERT( returnValue );
-
-    memcpy( returnValue, bufferHandle->read_pos, 1 );
-    bufferHandle->read_pos++;
-}
-
-
 void
 OTF2_Buffer_ReadUint16( OTF2_Buffer* bufferHandle,
                         uint16_t*    returnValue )
@@ -1093,8 +1531,8 @@ OTF2_Buffer_ReadInt16( OTF2_Buffer* bufferHandle,
 
 
 OTF2_ErrorCode
-OTF2_Buffer_ReadUint32( OTF2_Buffer* bufferHandle,
-                        uint32_t*    returnValue )
+otf2_buffer_read_uint32_foreign( OTF2_Buffer* bufferHandle,
+                                 uint32_t*    returnValue )
 {
     UTILS_ASSERT( bufferHandle );
     UTILS_ASSERT( returnValue );
@@ -1142,30 +1580,6 @@ OTF2_Buffer_ReadUint32( OTF2_Buffer* bufferHandle,
 }
 
 
-OTF2_ErrorCode
-OTF2_Buffer_ReadInt32( OTF2_Buffer* bufferHandle,
-                       int32_t*     returnValue )
-{
-    UTILS_ASSERT( bufferHandle );
-    UTILS_ASSERT( returnValue );
-
-    union
-    {
-        uint32_t u32;
-        int32_t  s32;
-    } u;
-
-    OTF2_ErrorCode status = OTF2_Buffer_ReadUint32( bufferHandle, &u.u32 );
-    if ( status != OTF2_SUCCESS )
-    {
-        return status;
-    }
-    *returnValue = u.s32;
-
-    return OTF2_SUCCESS;
-}
-
-
 void
 OTF2_Buffer_ReadUint32Full( OTF2_Buffer* bufferHandle,
                             uint32_t*    returnValue )
@@ -1202,8 +1616,8 @@ OTF2_Buffer_ReadInt32Full( OTF2_Buffer* bufferHandle,
 
 
 OTF2_ErrorCode
-OTF2_Buffer_ReadUint64( OTF2_Buffer* bufferHandle,
-                        uint64_t*    returnValue )
+otf2_buffer_read_uint64_foreign( OTF2_Buffer* bufferHandle,
+                                 uint64_t*    returnValue )
 {
     UTILS_ASSERT( bufferHandle );
     UTILS_ASSERT( returnValue );
@@ -1251,77 +1665,26 @@ OTF2_Buffer_ReadUint64( OTF2_Buffer* bufferHandle,
 }
 
 
-OTF2_ErrorCode
-OTF2_Buffer_ReadInt64( OTF2_Buffer* bufferHandle,
-                       int64_t*     returnValue )
+void
+otf2_buffer_read_uint64_full_foreign( OTF2_Buffer* bufferHandle,
+                                      uint64_t*    returnValue )
 {
     UTILS_ASSERT( bufferHandle );
     UTILS_ASSERT( returnValue );
 
-    union
-    {
-        uint64_t u64;
-        int64_t  s64;
-    } u;
+    memcpy( returnValue, bufferHandle->read_pos, 8 );
+    bufferHandle->read_pos += 8;
 
-    OTF2_ErrorCode status = OTF2_Buffer_ReadUint64( bufferHandle, &u.u64 );
-    if ( status != OTF2_SUCCESS )
+    if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
     {
-        return status;
+        *returnValue = otf2_swap64( *returnValue );
     }
-    *returnValue = u.s64;
-
-    return OTF2_SUCCESS;
 }
 
 
 void
-OTF2_Buffer_ReadUint64Full( OTF2_Buffer* bufferHandle,
-                            uint64_t*    returnValue )
-{
-    UTILS_ASSERT( bufferHandle );
-    UTILS_ASSERT( returnValue );
-
-    memcpy( returnValue, bufferHandle->read_pos, 8 );
-    bufferHandle->read_pos += 8;
-
-    if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
-    {
-        *returnValue = otf2_swap64( *returnValue );
-    }
-}
-
-
-OTF2_ErrorCode
-OTF2_Buffer_ReadMetricValue( OTF2_Buffer*      bufferHandle,
-                             OTF2_MetricValue* returnValue )
-{
-    UTILS_ASSERT( returnValue );
-    return OTF2_Buffer_ReadUint64( bufferHandle, &returnValue->unsigned_int );
-}
-
-
-void
-OTF2_Buffer_ReadInt64Full( OTF2_Buffer* bufferHandle,
-                           int64_t*     returnValue )
-{
-    UTILS_ASSERT( bufferHandle );
-    UTILS_ASSERT( returnValue );
-
-    union
-    {
-        uint64_t u64;
-        int64_t  s64;
-    } u;
-
-    OTF2_Buffer_ReadUint64Full( bufferHandle, &u.u64 );
-    *returnValue = u.s64;
-}
-
-
-void
-OTF2_Buffer_ReadFloat( OTF2_Buffer* bufferHandle,
-                       float*       returnValue )
+OTF2_Buffer_ReadFloat( OTF2_Buffer* bufferHandle,
+                       float*       returnValue )
 {
     UTILS_ASSERT( bufferHandle );
     UTILS_ASSERT( returnValue );
@@ -1337,24 +1700,6 @@ OTF2_Buffer_ReadFloat( OTF2_Buffer* bufferHandle,
 }
 
 
-void
-OTF2_Buffer_ReadDouble( OTF2_Buffer* bufferHandle,
-                        double*      returnValue )
-{
-    UTILS_ASSERT( bufferHandle );
-    UTILS_ASSERT( returnValue );
-
-    union
-    {
-        uint64_t u64;
-        double   d;
-    } u;
-
-    OTF2_Buffer_ReadUint64Full( bufferHandle, &u.u64 );
-    *returnValue = u.d;
-}
-
-
 OTF2_ErrorCode
 OTF2_Buffer_ReadString( OTF2_Buffer* bufferHandle,
                         const char** returnValue )
@@ -1611,6 +1956,7 @@ OTF2_Buffer_ReadGetPreviousChunk( OTF2_Buffer* bufferHandle )
             new_chunk->begin = ( uint8_t* )malloc( bufferHandle->chunk_size );
             if ( NULL == new_chunk->begin )
             {
+                free( new_chunk );
                 return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
                                     "Could not allocate memory for chunk!" );
             }
@@ -1624,9 +1970,10 @@ OTF2_Buffer_ReadGetPreviousChunk( OTF2_Buffer* bufferHandle )
         new_chunk->prev        = NULL;
         new_chunk->next        = bufferHandle->chunk;
 
-        /* Pack chunk in the list of chunks. */
+        /* Pack chunk in the list of chunks, it is the new head. */
         bufferHandle->chunk->prev = new_chunk;
         bufferHandle->chunk       = new_chunk;
+        bufferHandle->chunk_list  = new_chunk;
 
         status = otf2_buffer_read_chunk( bufferHandle, OTF2_FILEPART_PREV );
         if ( status != OTF2_SUCCESS )
@@ -1696,30 +2043,22 @@ OTF2_Buffer_ReadSeekChunk( OTF2_Buffer* bufferHandle,
     if ( !chunk_found )
     {
         /* free next and previous chunk */
-        chunk = bufferHandle->chunk;
-        if ( chunk->prev )
-        {
-            free( chunk->prev->begin );
-            chunk->prev = NULL;
-        }
-        if ( chunk->next )
+        status = otf2_buffer_read_drop_other_chunks( bufferHandle );
+        if ( status != OTF2_SUCCESS )
         {
-            free( chunk->next->begin );
-            chunk->next = NULL;
+            return status;
         }
 
         /* binary search */
-        uint64_t file_size, number_of_chunks;
+        uint64_t number_of_chunks;
 
-        status = OTF2_File_GetSizeUnchunked( bufferHandle->file, &file_size );
+        status = otf2_buffer_get_number_of_chunks( bufferHandle, &number_of_chunks );
         if ( status != OTF2_SUCCESS )
         {
             return UTILS_ERROR( status,
-                                "Couldn't get decompressed file size!" );
+                                "Couldn't get number of chunks!" );
         }
 
-        number_of_chunks = file_size / bufferHandle->chunk_size + 1;
-
         uint64_t lower_bound = 1, upper_bound = number_of_chunks, center;
         uint64_t firstEvent, lastEvent;
 
@@ -1728,7 +2067,7 @@ OTF2_Buffer_ReadSeekChunk( OTF2_Buffer* bufferHandle,
             center = ( lower_bound + upper_bound ) / 2;
 
             /* jump to chunk 'center' in file */
-            status = OTF2_File_SeekChunk( bufferHandle->file, center, bufferHandle->chunk_size );
+            status = otf2_buffer_seek_chunk( bufferHandle, center );
             if ( status != OTF2_SUCCESS )
             {
                 return UTILS_ERROR( status,
@@ -1789,6 +2128,9 @@ OTF2_Buffer_ReadSeekChunk( OTF2_Buffer* bufferHandle,
             return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT, "Requested position doesn't exist!" );
         }
 
+        /* update chunk number */
+        bufferHandle->chunk->chunk_num = center;
+
         /* load chunk events without header */
         status = otf2_buffer_load_events( bufferHandle );
         if ( status != OTF2_SUCCESS )
@@ -1796,9 +2138,6 @@ OTF2_Buffer_ReadSeekChunk( OTF2_Buffer* bufferHandle,
             return UTILS_ERROR( status,
                                 "Failed to load events!" );
         }
-
-        /* update chunk number */
-        bufferHandle->chunk->chunk_num = center;
     }
 
     /* set buffer read position to begin of events */
@@ -1822,11 +2161,15 @@ OTF2_Buffer_ReadSeekChunk( OTF2_Buffer* bufferHandle,
 
 /** @brief Seek to latest chunk starting with a timestamp <= than a given time.
  *
- *  This is used to find the best matching snapshot to a given time in a binary fashion.
+ *  This is used to find the best matching snapshot or event to a given time in
+ *  a binary fashion. If all chunks start later than @a req_time, the buffer is
+ *  positioned at the first chunk.
  *
  *  @param bufferHandle     Initialized OTF2_Buffer instance.
  *
  *  @param req_time         Time we are looking for.
+ *  @param found            Set to false, if all chunks start later than
+ *                          @a req_time.
  *
  *  @return                 Returns OTF2_SUCCESS if successful, an error code
  *                          if an error occurs.
@@ -1847,29 +2190,21 @@ OTF2_Buffer_ReadSeekChunkTime( OTF2_Buffer* bufferHandle,
                             "This call is not allowed in writing mode!" );
     }
     /* free next and previous chunk */
-    otf2_chunk* chunk = bufferHandle->chunk;
-    if ( chunk->prev )
-    {
-        free( chunk->prev->begin );
-        chunk->prev = NULL;
-    }
-    if ( chunk->next )
+    status = otf2_buffer_read_drop_other_chunks( bufferHandle );
+    if ( status != OTF2_SUCCESS )
     {
-        free( chunk->next->begin );
-        chunk->next = NULL;
+        return status;
     }
     /* binary search .. */
-    uint64_t file_size, number_of_chunks;
+    uint64_t number_of_chunks;
 
-    status = OTF2_File_GetSizeUnchunked( bufferHandle->file, &file_size );
+    status = otf2_buffer_get_number_of_chunks( bufferHandle, &number_of_chunks );
     if ( status != OTF2_SUCCESS )
     {
         return UTILS_ERROR( status,
-                            "Couldn't get decompressed file size!" );
+                            "Couldn't get number of chunks!" );
     }
 
-    number_of_chunks = file_size / bufferHandle->chunk_size + 1;
-
     uint64_t       lower_bound = 1, upper_bound = number_of_chunks, center;
     OTF2_TimeStamp time1;
     *found = false;
@@ -1879,7 +2214,7 @@ OTF2_Buffer_ReadSeekChunkTime( OTF2_Buffer* bufferHandle,
         center = ( lower_bound + upper_bound + 1 ) / 2;
 
         /* jump to chunk 'center' in file */
-        status = OTF2_File_SeekChunk( bufferHandle->file, center, bufferHandle->chunk_size );
+        status = otf2_buffer_seek_chunk( bufferHandle, center );
         if ( status != OTF2_SUCCESS )
         {
             return UTILS_ERROR( status,
@@ -1932,17 +2267,21 @@ OTF2_Buffer_ReadSeekChunkTime( OTF2_Buffer* bufferHandle,
 
     if ( !*found )              // all chunks start later than req_time
     {
-        return OTF2_SUCCESS;
+        /* position at the first chunk */
+        center = 1;
     }
 
     /* jump to chunk 'center' in file */
-    status = OTF2_File_SeekChunk( bufferHandle->file, center, bufferHandle->chunk_size );
+    status = otf2_buffer_seek_chunk( bufferHandle, center );
     if ( status != OTF2_SUCCESS )
     {
         return UTILS_ERROR( status,
                             "Failed seeking chunk!" );
     }
 
+    /* update chunk number */
+    bufferHandle->chunk->chunk_num = center;
+
     /* load the whole chunk */
     status = otf2_buffer_read_chunk( bufferHandle, OTF2_FILEPART_NEXT );
     if ( status != OTF2_SUCCESS )
@@ -1965,9 +2304,6 @@ OTF2_Buffer_ReadSeekChunkTime( OTF2_Buffer* bufferHandle,
                             "Failed to read chunk header!" );
     }
 
-    /* update chunk number */
-    bufferHandle->chunk->chunk_num = center;
-
     /* set buffer read position to begin of events */
     uint8_t* new_position;
     status = OTF2_Buffer_GetBeginOfChunk( bufferHandle, &new_position );
@@ -1987,6 +2323,195 @@ OTF2_Buffer_ReadSeekChunkTime( OTF2_Buffer* bufferHandle,
     return OTF2_SUCCESS;
 }
 
+/** @brief Release the memory of all loaded chunks.
+ *
+ *  Only the bookkeeping of the current chunk and the read position inside it
+ *  is kept, so that OTF2_Buffer_ReadReloadChunk() can restore the state by
+ *  reading the chunk again from the file. This is only possible for
+ *  uncompressed, chunked buffers in reading mode.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_Buffer_ReadReleaseChunks( OTF2_Buffer* bufferHandle )
+{
+    UTILS_ASSERT( bufferHandle );
+
+    if ( bufferHandle->buffer_mode != OTF2_BUFFER_READ ||
+         bufferHandle->chunk_mode != OTF2_BUFFER_CHUNKED )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                            "This call is only allowed for chunked buffers in reading mode!" );
+    }
+    if ( bufferHandle->file == NULL ||
+         bufferHandle->archive->compression == OTF2_COMPRESSION_ZLIB )
+    {
+        return UTILS_ERROR( OTF2_ERROR_FILE_INTERACTION,
+                            "Operation not supported for compressed trace files!" );
+    }
+
+    if ( bufferHandle->chunks_released )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    OTF2_ErrorCode status = otf2_buffer_read_drop_other_chunks( bufferHandle );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    otf2_chunk* chunk = bufferHandle->chunk;
+    bufferHandle->released_read_offset = bufferHandle->read_pos - chunk->begin;
+    bufferHandle->chunks_released      = true;
+
+    free( chunk->begin );
+    chunk->begin = NULL;
+    chunk->end   = NULL;
+
+    bufferHandle->read_pos = NULL;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Re-read the current chunk after OTF2_Buffer_ReadReleaseChunks().
+ *
+ *  Restores the read position. Does nothing if the chunk was not released.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_Buffer_ReadReloadChunk( OTF2_Buffer* bufferHandle )
+{
+    UTILS_ASSERT( bufferHandle );
+
+    if ( !bufferHandle->chunks_released )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    otf2_chunk* chunk = bufferHandle->chunk;
+
+    chunk->begin = ( uint8_t* )malloc( bufferHandle->chunk_size );
+    if ( NULL == chunk->begin )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Could not allocate memory for chunk!" );
+    }
+    chunk->end = chunk->begin + bufferHandle->chunk_size;
+
+    OTF2_ErrorCode status = otf2_buffer_seek_chunk( bufferHandle,
+                                                    chunk->chunk_num );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status, "Failed seeking chunk!" );
+    }
+
+    status = otf2_buffer_load_chunk( bufferHandle );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status, "Could not read from file." );
+    }
+
+    bufferHandle->read_pos        = chunk->begin + bufferHandle->released_read_offset;
+    bufferHandle->chunks_released = false;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Get the number of bytes currently used by loaded chunks.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *
+ *  @return                 The resident size in bytes.
+ */
+uint64_t
+OTF2_Buffer_GetResidentSize( OTF2_Buffer* bufferHandle )
+{
+    UTILS_ASSERT( bufferHandle );
+
+    uint64_t    size  = 0;
+    otf2_chunk* chunk = bufferHandle->chunk;
+    if ( !chunk )
+    {
+        return 0;
+    }
+
+    for ( otf2_chunk* it = chunk; it; it = it->prev )
+    {
+        if ( it->begin )
+        {
+            size += bufferHandle->chunk_size;
+        }
+    }
+    for ( otf2_chunk* it = chunk->next; it; it = it->next )
+    {
+        if ( it->begin )
+        {
+            size += bufferHandle->chunk_size;
+        }
+    }
+
+    return size;
+}
+
+
+/** @brief Free all loaded chunks in reading mode, except the current one.
+ *
+ *  If the memory of the current chunk was released with
+ *  OTF2_Buffer_ReadReleaseChunks(), new memory is allocated for it, its
+ *  content needs to be read by the caller.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_buffer_read_drop_other_chunks( OTF2_Buffer* bufferHandle )
+{
+    otf2_chunk* chunk = bufferHandle->chunk;
+    while ( chunk->prev )
+    {
+        otf2_chunk* prev = chunk->prev;
+        chunk->prev = prev->prev;
+        free( prev->begin );
+        free( prev );
+    }
+    while ( chunk->next )
+    {
+        otf2_chunk* next = chunk->next;
+        chunk->next = next->next;
+        free( next->begin );
+        free( next );
+    }
+    bufferHandle->chunk_list = chunk;
+
+    if ( bufferHandle->chunks_released )
+    {
+        chunk->begin = ( uint8_t* )malloc( bufferHandle->chunk_size );
+        if ( NULL == chunk->begin )
+        {
+            return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                                "Could not allocate memory for chunk!" );
+        }
+        chunk->end                    = chunk->begin + bufferHandle->chunk_size;
+        bufferHandle->read_pos        = chunk->begin;
+        bufferHandle->chunks_released = false;
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
 OTF2_ErrorCode
 otf2_buffer_get_file_handle( OTF2_Buffer* bufferHandle )
 {
@@ -2059,14 +2584,25 @@ otf2_buffer_read_chunk( OTF2_Buffer*  bufferHandle,
         bufferHandle->read_pos   = bufferHandle->chunk->begin;
     }
 
-    /* If the previous chunk in the file is requested, jump to chunk sizes
-     * backwards. */
+    /* If the previous chunk in the file is requested, jump to its position.
+     * The chunk number was already set by the caller. */
     if ( filePart == OTF2_FILEPART_PREV &&
          bufferHandle->chunk_mode == OTF2_BUFFER_CHUNKED )
     {
-        status = OTF2_File_SeekPrevChunk( bufferHandle->file,
-                                          bufferHandle->chunk->chunk_num,
-                                          bufferHandle->chunk_size );
+        status = otf2_buffer_seek_chunk( bufferHandle,
+                                         bufferHandle->chunk->chunk_num );
+        if ( status != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( status,
+                                "Failed seeking chunk!" );
+        }
+    }
+
+    /* Uncompressed chunks are read according to their size. */
+    if ( bufferHandle->chunk_mode == OTF2_BUFFER_CHUNKED &&
+         bufferHandle->archive->compression == OTF2_COMPRESSION_NONE )
+    {
+        return otf2_buffer_load_chunk( bufferHandle );
     }
 
     status = OTF2_File_Read( bufferHandle->file, bufferHandle->chunk->begin,
@@ -2096,7 +2632,9 @@ otf2_buffer_load_header( OTF2_Buffer* bufferHandle )
         }
     }
 
-    status = OTF2_File_Read( bufferHandle->file, bufferHandle->chunk->begin, OTF2_CHUNK_HEADER_SIZE );
+    status = OTF2_File_Read( bufferHandle->file,
+                             bufferHandle->chunk->begin,
+                             otf2_buffer_header_size( bufferHandle ) );
     if ( status != OTF2_SUCCESS )
     {
         return UTILS_ERROR( status,
@@ -2123,7 +2661,8 @@ otf2_buffer_load_events( OTF2_Buffer* bufferHandle )
 
     status = OTF2_File_Read( bufferHandle->file,
                              chunk_begin,
-                             bufferHandle->chunk_size - OTF2_CHUNK_HEADER_SIZE );
+                             bufferHandle->chunk->size
+                             - otf2_buffer_header_size( bufferHandle ) );
 
     if ( status != OTF2_SUCCESS )
     {
@@ -2152,88 +2691,412 @@ otf2_buffer_load_head_n_time( OTF2_Buffer* bufferHandle )
 
     return OTF2_File_Read( bufferHandle->file,
                            bufferHandle->chunk->begin,
-                           OTF2_CHUNK_HEADER_SIZE + sizeof( OTF2_TimeStamp ) );
+                           otf2_buffer_header_size( bufferHandle )
+                           + sizeof( OTF2_TimeStamp ) );
 }
 
 
-/** @brief Read chunk header.
- *
- *  Reads the chunk header with the number of the first and last event in the
- *  current chunk.
+/** @brief Decode the size of a chunk from its sized chunk header.
  *
  *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param header           The chunk header.
+ *  @param size             Pointer to the returned size in bytes.
  *
  *  @return                 Returns OTF2_SUCCESS if successful, an error code
  *                          if an error occurs.
  */
-static inline OTF2_ErrorCode
-otf2_buffer_read_header( OTF2_Buffer* bufferHandle )
+static OTF2_ErrorCode
+otf2_buffer_decode_chunk_size( const OTF2_Buffer* bufferHandle,
+                               const uint8_t*     header,
+                               uint64_t*          size )
 {
-    UTILS_ASSERT( bufferHandle );
-
-    uint8_t event_type = 0;
-
-    OTF2_Buffer_ReadUint8( bufferHandle, &event_type );
-
-    if ( event_type != OTF2_BUFFER_CHUNK_HEADER )
+    uint64_t chunk_size;
+    memcpy( &chunk_size, header + OTF2_CHUNK_HEADER_CHUNK_SIZE, sizeof( chunk_size ) );
+    if ( header[ 1 ] != OTF2_HOST_ENDIANNESS )
     {
-        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
-                            "This is no chunk header!" );
+        chunk_size = otf2_swap64( chunk_size );
     }
 
-    uint8_t endianness_mode;
-    OTF2_Buffer_ReadUint8( bufferHandle, &endianness_mode );
-
-    /* Set buffers read routine to the correct endianness mode, before
-       reading in the chunk header part */
-
-    if ( endianness_mode != OTF2_BIG_ENDIAN &&
-         endianness_mode != OTF2_LITTLE_ENDIAN )
+    if ( chunk_size <= OTF2_SIZED_CHUNK_HEADER_SIZE ||
+         chunk_size > bufferHandle->chunk_size )
     {
-        /* invalid endianness byte */
         return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
-                            "Invalid endianness byte %hhx",
-                            endianness_mode );
-    }
-
-    bufferHandle->endianness_mode = endianness_mode;
-
-    if ( bufferHandle->chunk_mode == OTF2_BUFFER_CHUNKED )
-    {
-        OTF2_Buffer_ReadUint64Full( bufferHandle,
-                                    &( bufferHandle->chunk->first_event ) );
-        OTF2_Buffer_ReadUint64Full( bufferHandle,
-                                    &( bufferHandle->chunk->last_event ) );
+                            "Invalid chunk size: %" PRIu64, chunk_size );
     }
 
+    *size = chunk_size;
     return OTF2_SUCCESS;
 }
 
 
-/** @brief Get position.
+/** @brief Record the file offset of a sized chunk.
  *
- *  Checks the mode of interaction with the buffer and stores either the actual
- *  write or read position in the given pointer.
+ *  Only the offset of the chunk following the known ones is recorded.
  *
  *  @param bufferHandle     Initialized OTF2_Buffer instance.
- *  @param position         Pointer the returned position.
+ *  @param chunkNumber      Number of the chunk.
+ *  @param offset           Offset of the chunk in the file.
  *
  *  @return                 Returns OTF2_SUCCESS if successful, an error code
  *                          if an error occurs.
  */
-void
-OTF2_Buffer_GetPosition( OTF2_Buffer* bufferHandle,
-                         uint8_t**    position )
+static OTF2_ErrorCode
+otf2_buffer_add_chunk_offset( OTF2_Buffer* bufferHandle,
+                              uint64_t     chunkNumber,
+                              uint64_t     offset )
 {
-    UTILS_ASSERT( bufferHandle );
-
-    if ( bufferHandle->buffer_mode == OTF2_BUFFER_WRITE )
+    if ( chunkNumber != ( uint64_t )bufferHandle->number_of_chunk_offsets + 1 )
     {
-        *position = bufferHandle->write_pos;
+        return OTF2_SUCCESS;
     }
-    else
+
+    /* There is no chunk behind the end of the file. */
+    if ( bufferHandle->file_size == 0 )
     {
-        *position = bufferHandle->read_pos;
+        OTF2_ErrorCode status = OTF2_File_GetSizeUnchunked( bufferHandle->file,
+                                                            &bufferHandle->file_size );
+        if ( status != OTF2_SUCCESS )
+        {
+            bufferHandle->file_size = 0;
+            return UTILS_ERROR( status, "Couldn't get file size!" );
+        }
+    }
+    if ( offset >= bufferHandle->file_size )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    if ( bufferHandle->number_of_chunk_offsets == bufferHandle->chunk_offsets_capacity )
+    {
+        uint32_t  capacity = bufferHandle->chunk_offsets_capacity
+                             ? 2 * bufferHandle->chunk_offsets_capacity
+                             : 64;
+        uint64_t* offsets = realloc( bufferHandle->chunk_offsets,
+                                     capacity * sizeof( *offsets ) );
+        if ( NULL == offsets )
+        {
+            return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                                "Could not allocate memory for chunk offsets!" );
+        }
+        bufferHandle->chunk_offsets          = offsets;
+        bufferHandle->chunk_offsets_capacity = capacity;
+    }
+
+    bufferHandle->chunk_offsets[ bufferHandle->number_of_chunk_offsets++ ] = offset;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Find the file offsets of sized chunks.
+ *
+ *  Reads the headers of the chunks following the known ones, until the
+ *  offset of chunk @a chunkNumber is known or the end of the file is reached.
+ *  This moves the file position.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param chunkNumber      Number of the last chunk of interest.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_buffer_scan_chunk_offsets( OTF2_Buffer* bufferHandle,
+                                uint64_t     chunkNumber )
+{
+    OTF2_ErrorCode status = otf2_buffer_add_chunk_offset( bufferHandle, 1, 0 );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    while ( bufferHandle->number_of_chunk_offsets > 0 &&
+            bufferHandle->number_of_chunk_offsets < chunkNumber )
+    {
+        uint32_t last   = bufferHandle->number_of_chunk_offsets;
+        uint64_t offset = bufferHandle->chunk_offsets[ last - 1 ];
+        uint8_t  header[ OTF2_SIZED_CHUNK_HEADER_SIZE ];
+        uint64_t size;
+
+        status = OTF2_File_Seek( bufferHandle->file, offset );
+        if ( status != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( status, "Failed seeking chunk!" );
+        }
+        status = OTF2_File_Read( bufferHandle->file, header, sizeof( header ) );
+        if ( status != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( status, "Could not read from file!" );
+        }
+        if ( header[ 0 ] != OTF2_BUFFER_SIZED_CHUNK_HEADER )
+        {
+            return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                                "This is no sized chunk header!" );
+        }
+        status = otf2_buffer_decode_chunk_size( bufferHandle, header, &size );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+
+        status = otf2_buffer_add_chunk_offset( bufferHandle, last + 1, offset + size );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+        if ( bufferHandle->number_of_chunk_offsets == last )
+        {
+            /* This is the last chunk of the file. */
+            break;
+        }
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Seek to a chunk in reading mode.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param chunkNumber      Number of the chunk, the first is one.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_buffer_seek_chunk( OTF2_Buffer* bufferHandle,
+                        uint64_t     chunkNumber )
+{
+    if ( !bufferHandle->sized_chunks )
+    {
+        return OTF2_File_SeekChunk( bufferHandle->file,
+                                    chunkNumber,
+                                    bufferHandle->chunk_size );
+    }
+
+    OTF2_ErrorCode status = otf2_buffer_scan_chunk_offsets( bufferHandle,
+                                                            chunkNumber );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+    if ( chunkNumber == 0 || chunkNumber > bufferHandle->number_of_chunk_offsets )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "There is no chunk %" PRIu64 " in the file!",
+                            chunkNumber );
+    }
+
+    return OTF2_File_Seek( bufferHandle->file,
+                           bufferHandle->chunk_offsets[ chunkNumber - 1 ] );
+}
+
+
+/** @brief Get the number of chunks in the file in reading mode.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param numberOfChunks   Pointer to the returned number of chunks.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_buffer_get_number_of_chunks( OTF2_Buffer* bufferHandle,
+                                  uint64_t*    numberOfChunks )
+{
+    OTF2_ErrorCode status;
+
+    if ( bufferHandle->sized_chunks )
+    {
+        status = otf2_buffer_scan_chunk_offsets( bufferHandle, UINT32_MAX );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+        *numberOfChunks = bufferHandle->number_of_chunk_offsets;
+        return OTF2_SUCCESS;
+    }
+
+    uint64_t file_size;
+    status = OTF2_File_GetSizeUnchunked( bufferHandle->file, &file_size );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status,
+                            "Couldn't get decompressed file size!" );
+    }
+
+    *numberOfChunks = ( file_size + bufferHandle->chunk_size - 1 ) / bufferHandle->chunk_size;
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Read the chunk at the current file position into the current chunk.
+ *
+ *  The header is read first, the size of a sized chunk determines how much is
+ *  read afterwards. Thus the file is positioned at the next chunk. The last
+ *  chunk of a file may be shorter.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_buffer_load_chunk( OTF2_Buffer* bufferHandle )
+{
+    otf2_chunk*    chunk  = bufferHandle->chunk;
+    OTF2_ErrorCode status = OTF2_File_Read( bufferHandle->file,
+                                            chunk->begin,
+                                            OTF2_CHUNK_HEADER_SIZE );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status, "Could not read from file." );
+    }
+
+    uint64_t header_size = OTF2_CHUNK_HEADER_SIZE;
+    uint64_t size        = bufferHandle->chunk_size;
+    if ( chunk->begin[ 0 ] == OTF2_BUFFER_SIZED_CHUNK_HEADER )
+    {
+        header_size = OTF2_SIZED_CHUNK_HEADER_SIZE;
+        status      = OTF2_File_Read( bufferHandle->file,
+                                      chunk->begin + OTF2_CHUNK_HEADER_SIZE,
+                                      OTF2_SIZED_CHUNK_HEADER_SIZE - OTF2_CHUNK_HEADER_SIZE );
+        if ( status != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( status, "Could not read from file." );
+        }
+        status = otf2_buffer_decode_chunk_size( bufferHandle, chunk->begin, &size );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+
+        /* Remember where the next chunk starts. */
+        if ( chunk->chunk_num == 1 )
+        {
+            status = otf2_buffer_add_chunk_offset( bufferHandle, 1, 0 );
+        }
+        if ( status == OTF2_SUCCESS &&
+             chunk->chunk_num <= bufferHandle->number_of_chunk_offsets )
+        {
+            status = otf2_buffer_add_chunk_offset(
+                bufferHandle,
+                chunk->chunk_num + 1,
+                bufferHandle->chunk_offsets[ chunk->chunk_num - 1 ] + size );
+        }
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+    }
+
+    status = OTF2_File_Read( bufferHandle->file,
+                             chunk->begin + header_size,
+                             size - header_size );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status, "Could not read from file." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Read chunk header.
+ *
+ *  Reads the chunk header with the number of the first and last event in the
+ *  current chunk.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+static inline OTF2_ErrorCode
+otf2_buffer_read_header( OTF2_Buffer* bufferHandle )
+{
+    UTILS_ASSERT( bufferHandle );
+
+    uint8_t event_type = 0;
+
+    OTF2_Buffer_ReadUint8( bufferHandle, &event_type );
+
+    if ( event_type != OTF2_BUFFER_CHUNK_HEADER &&
+         ( event_type != OTF2_BUFFER_SIZED_CHUNK_HEADER ||
+           bufferHandle->chunk_mode != OTF2_BUFFER_CHUNKED ) )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "This is no chunk header!" );
+    }
+    bufferHandle->sized_chunks = event_type == OTF2_BUFFER_SIZED_CHUNK_HEADER;
+
+    uint8_t endianness_mode;
+    OTF2_Buffer_ReadUint8( bufferHandle, &endianness_mode );
+
+    /* Set buffers read routine to the correct endianness mode, before
+       reading in the chunk header part */
+
+    if ( endianness_mode != OTF2_BIG_ENDIAN &&
+         endianness_mode != OTF2_LITTLE_ENDIAN )
+    {
+        /* invalid endianness byte */
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "Invalid endianness byte %hhx",
+                            endianness_mode );
+    }
+
+    bufferHandle->endianness_mode = endianness_mode;
+
+    if ( bufferHandle->chunk_mode == OTF2_BUFFER_CHUNKED )
+    {
+        OTF2_Buffer_ReadUint64Full( bufferHandle,
+                                    &( bufferHandle->chunk->first_event ) );
+        OTF2_Buffer_ReadUint64Full( bufferHandle,
+                                    &( bufferHandle->chunk->last_event ) );
+    }
+
+    bufferHandle->chunk->size = bufferHandle->chunk_size;
+    if ( bufferHandle->sized_chunks )
+    {
+        OTF2_ErrorCode status =
+            otf2_buffer_decode_chunk_size( bufferHandle,
+                                           bufferHandle->read_pos - OTF2_CHUNK_HEADER_CHUNK_SIZE,
+                                           &bufferHandle->chunk->size );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+        bufferHandle->read_pos += sizeof( uint64_t );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Get position.
+ *
+ *  Checks the mode of interaction with the buffer and stores either the actual
+ *  write or read position in the given pointer.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param position         Pointer the returned position.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+void
+OTF2_Buffer_GetPosition( OTF2_Buffer* bufferHandle,
+                         uint8_t**    position )
+{
+    UTILS_ASSERT( bufferHandle );
+
+    if ( bufferHandle->buffer_mode == OTF2_BUFFER_WRITE )
+    {
+        *position = bufferHandle->write_pos;
+    }
+    else
+    {
+        *position = bufferHandle->read_pos;
     }
 }
 
@@ -2295,7 +3158,7 @@ OTF2_Buffer_GetBeginOfChunk( OTF2_Buffer* bufferHandle,
 {
     UTILS_ASSERT( bufferHandle );
 
-    *position = bufferHandle->chunk->begin + OTF2_CHUNK_HEADER_SIZE;
+    *position = bufferHandle->chunk->begin + otf2_buffer_header_size( bufferHandle );
 
     return OTF2_SUCCESS;
 }
@@ -2324,6 +3187,188 @@ OTF2_Buffer_GetNumberEvents( OTF2_Buffer* bufferHandle,
 }
 
 
+/** @brief Check the event index of the current chunk in reading mode.
+ *
+ *  The index is only trusted, if all entries point to timestamp records inside
+ *  the chunk in increasing order. Otherwise the chunk is treated as having no
+ *  index at all.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ */
+static void
+otf2_buffer_read_check_chunk_index( OTF2_Buffer* bufferHandle )
+{
+    otf2_chunk* chunk = bufferHandle->chunk;
+
+    chunk->index_chunk_num = chunk->chunk_num;
+    chunk->index_interval  = 0;
+    chunk->index_entries   = 0;
+
+    if ( bufferHandle->buffer_mode != OTF2_BUFFER_READ ||
+         bufferHandle->chunk_mode != OTF2_BUFFER_CHUNKED ||
+         bufferHandle->file == NULL ||
+         bufferHandle->archive->compression != OTF2_COMPRESSION_NONE ||
+         chunk->begin == NULL )
+    {
+        return;
+    }
+
+    if ( bufferHandle->file_size == 0 &&
+         OTF2_File_GetSizeUnchunked( bufferHandle->file,
+                                     &bufferHandle->file_size ) != OTF2_SUCCESS )
+    {
+        bufferHandle->file_size = 0;
+        return;
+    }
+
+    /* The offsets of the loaded sized chunks are known. */
+    uint64_t chunk_offset = ( uint64_t )( chunk->chunk_num - 1 ) * bufferHandle->chunk_size;
+    if ( bufferHandle->sized_chunks )
+    {
+        if ( chunk->chunk_num > bufferHandle->number_of_chunk_offsets )
+        {
+            return;
+        }
+        chunk_offset = bufferHandle->chunk_offsets[ chunk->chunk_num - 1 ];
+    }
+
+    /* The last chunk of a file is stored only up to its used part. */
+    uint64_t header_size = otf2_buffer_header_size( bufferHandle );
+    if ( bufferHandle->file_size <= chunk_offset )
+    {
+        return;
+    }
+    uint64_t length = bufferHandle->file_size - chunk_offset;
+    if ( length > chunk->size )
+    {
+        length = chunk->size;
+    }
+    if ( length < header_size + OTF2_CHUNK_INDEX_TRAILER_SIZE )
+    {
+        return;
+    }
+
+    uint64_t trailer_offset = length - OTF2_CHUNK_INDEX_TRAILER_SIZE;
+    uint8_t* trailer        = chunk->begin + trailer_offset;
+    if ( trailer[ 2 * sizeof( uint32_t ) ] != OTF2_BUFFER_CHUNK_INDEX )
+    {
+        return;
+    }
+
+    uint32_t entries;
+    uint32_t interval;
+    memcpy( &entries, trailer, sizeof( entries ) );
+    memcpy( &interval, trailer + sizeof( entries ), sizeof( interval ) );
+    if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
+    {
+        entries  = otf2_swap32( entries );
+        interval = otf2_swap32( interval );
+    }
+
+    /* The last entry points to the local event entries * interval. */
+    uint64_t number_of_events = chunk->last_event - chunk->first_event + 1;
+    if ( interval == 0 ||
+         ( uint64_t )entries * interval >= number_of_events ||
+         ( uint64_t )entries * OTF2_CHUNK_INDEX_ENTRY_SIZE
+         > trailer_offset - header_size )
+    {
+        return;
+    }
+
+    uint64_t limit    = trailer_offset - ( uint64_t )entries * OTF2_CHUNK_INDEX_ENTRY_SIZE;
+    uint64_t previous = header_size;
+    for ( uint32_t i = 0; i < entries; i++ )
+    {
+        uint32_t offset;
+        memcpy( &offset,
+                trailer - ( uint64_t )( i + 1 ) * OTF2_CHUNK_INDEX_ENTRY_SIZE,
+                sizeof( offset ) );
+        if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
+        {
+            offset = otf2_swap32( offset );
+        }
+        if ( offset <= previous ||
+             offset + OTF2_BUFFER_TIMESTAMP_SIZE > limit ||
+             chunk->begin[ offset ] != OTF2_BUFFER_TIMESTAMP )
+        {
+            return;
+        }
+        previous = offset;
+    }
+
+    chunk->index_interval = interval;
+    chunk->index_entries  = entries;
+    chunk->index_trailer  = trailer_offset;
+}
+
+
+/** @brief Get the event index of the current chunk.
+ *
+ *  Entry @p i of the index points to the local event ( @p i + 1 ) *
+ *  @p interval of the chunk, counted from 0.
+ *
+ *  @param bufferHandle          Initialized OTF2_Buffer instance.
+ *  @param[out] interval         Distance of the indexed events, 0 if the
+ *                               chunk has no index.
+ *  @param[out] numberOfEntries  Number of index entries.
+ */
+void
+OTF2_Buffer_ReadGetChunkIndex( OTF2_Buffer* bufferHandle,
+                               uint32_t*    interval,
+                               uint32_t*    numberOfEntries )
+{
+    UTILS_ASSERT( bufferHandle );
+
+    if ( bufferHandle->chunk->index_chunk_num != bufferHandle->chunk->chunk_num )
+    {
+        otf2_buffer_read_check_chunk_index( bufferHandle );
+    }
+
+    *interval        = bufferHandle->chunk->index_interval;
+    *numberOfEntries = bufferHandle->chunk->index_entries;
+}
+
+
+/** @brief Get an entry of the event index of the current chunk.
+ *
+ *  @param bufferHandle   Initialized OTF2_Buffer instance.
+ *  @param entry          Index entry, must be less than the number of entries
+ *                        from OTF2_Buffer_ReadGetChunkIndex.
+ *  @param[out] position  Position of the timestamp record of the event.
+ *  @param[out] time      Timestamp of the event.
+ */
+void
+OTF2_Buffer_ReadGetChunkIndexEntry( OTF2_Buffer*    bufferHandle,
+                                    uint32_t        entry,
+                                    uint8_t**       position,
+                                    OTF2_TimeStamp* time )
+{
+    UTILS_ASSERT( bufferHandle );
+
+    otf2_chunk* chunk = bufferHandle->chunk;
+    UTILS_ASSERT( entry < chunk->index_entries );
+
+    uint32_t offset;
+    memcpy( &offset,
+            chunk->begin + chunk->index_trailer
+            - ( uint64_t )( entry + 1 ) * OTF2_CHUNK_INDEX_ENTRY_SIZE,
+            sizeof( offset ) );
+    OTF2_TimeStamp timestamp;
+    if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
+    {
+        offset = otf2_swap32( offset );
+    }
+    memcpy( &timestamp, chunk->begin + offset + 1, sizeof( timestamp ) );
+    if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
+    {
+        timestamp = otf2_swap64( timestamp );
+    }
+
+    *position = chunk->begin + offset;
+    *time     = timestamp;
+}
+
+
 /** @brief Get position of last read timestamp.
  *
  *  The position of the last read timestamp is the valid timestamp for the
@@ -2409,8 +3454,7 @@ OTF2_Buffer_RewriteTimeStamp( OTF2_Buffer*   bufferHandle,
 
 /** @brief Clear all rewind points saved before.
  *
- *  Deallocate all saved rewind points in the rewind list and
- *  assign a NULL pointer to the rewind list.
+ *  The memory of the rewind stack is kept for the next rewind points.
  *
  *  @param bufferHandle     Initialized OTF2_Buffer instance.
  *
@@ -2418,85 +3462,93 @@ OTF2_Buffer_RewriteTimeStamp( OTF2_Buffer*   bufferHandle,
  *                          if an error occurs.
  */
 OTF2_ErrorCode
-otf2_buffer_clear_rewind_list( OTF2_Buffer* bufferHandle )
+otf2_buffer_clear_rewind_stack( OTF2_Buffer* bufferHandle )
 {
-    /* iterate over rewind points and deallocate all memory. */
-    while ( bufferHandle->rewindlist )
-    {
-        otf2_rewindlist* next = bufferHandle->rewindlist->next;
-
-        free( bufferHandle->rewindlist->buffer );
-        free( bufferHandle->rewindlist->chunk );
-        free( bufferHandle->rewindlist );
-
-        bufferHandle->rewindlist = next;
-    }
+    bufferHandle->number_of_rewind_points = 0;
 
     return OTF2_SUCCESS;
 }
 
 
-/** @brief Store a buffer state in the rewind list.
+/** @brief Find a rewind point in the rewind stack.
  *
- *  Saves the current buffer state in a double-linked list of rewind points.
- *  If the same rewind region id is already in the list, then the old
- *  rewind point will be overwritten, else a new rewind point is allocated
- *  at the end of the list.
+ *  The stack is searched from the top, as rewind points are usually
+ *  cleared in the reverse order they were stored.
  *
  *  @param bufferHandle     Initialized OTF2_Buffer instance.
  *  @param id               Identification number of the rewind region handle.
  *
+ *  @return                 The rewind point or NULL if the id is not in the
+ *                          stack.
+ */
+static otf2_rewind_point*
+otf2_buffer_find_rewind_point( OTF2_Buffer* bufferHandle,
+                               uint32_t     id )
+{
+    uint32_t i = bufferHandle->number_of_rewind_points;
+    while ( i-- > 0 )
+    {
+        if ( bufferHandle->rewind_points[ i ].id == id )
+        {
+            return &bufferHandle->rewind_points[ i ];
+        }
+    }
+
+    return NULL;
+}
+
+
+/** @brief Store a buffer state in the rewind stack.
+ *
+ *  Saves the current buffer state on top of the rewind stack.
+ *  If the same rewind region id is already in the stack, then the old
+ *  rewind point will be overwritten. The stack only grows if it is full,
+ *  thus storing and clearing rewind points does not allocate memory
+ *  otherwise.
+ *
+ *  @param bufferHandle         Initialized OTF2_Buffer instance.
+ *  @param id                   Identification number of the rewind region handle.
+ *  @param suppressedStackSize  Size of the suppressed stack of the writer,
+ *                              returned again by OTF2_Buffer_Rewind().
+ *
  *  @return                 Returns OTF2_SUCCESS if successful, an error code
  *                          if an error occurs.
  */
 OTF2_ErrorCode
 OTF2_Buffer_StoreRewindPoint( OTF2_Buffer* bufferHandle,
-                              uint32_t     id )
+                              uint32_t     id,
+                              uint32_t     suppressedStackSize )
 {
     UTILS_ASSERT( bufferHandle && bufferHandle->buffer_mode == OTF2_BUFFER_WRITE );
 
-    otf2_rewindlist* rewindlistitem = bufferHandle->rewindlist;
+    otf2_rewind_point* point = otf2_buffer_find_rewind_point( bufferHandle, id );
 
-    /* If rewind list is empty, then store buffer state as the first rewind point */
-    if ( !rewindlistitem )
+    /* If there is no previous saved rewind point, then push a new one. */
+    if ( !point )
     {
-        rewindlistitem         = ( otf2_rewindlist* )malloc( sizeof( otf2_rewindlist ) );
-        rewindlistitem->id     = id;
-        rewindlistitem->buffer = ( OTF2_Buffer* )malloc( sizeof( OTF2_Buffer ) );
-        rewindlistitem->chunk  = ( otf2_chunk* )malloc( sizeof( otf2_chunk ) );
-        rewindlistitem->prev   = NULL;
-        rewindlistitem->next   = NULL;
-
-        memcpy( rewindlistitem->buffer, bufferHandle, sizeof( OTF2_Buffer ) );
-        memcpy( rewindlistitem->chunk, bufferHandle->chunk, sizeof( otf2_chunk ) );
-
-        bufferHandle->rewindlist = rewindlistitem;
-
-        return OTF2_SUCCESS;
-    }
-
-    /* else, search for a previous saved rewind point with the same id. */
-    while ( rewindlistitem->id != id && rewindlistitem->next )
-    {
-        rewindlistitem = rewindlistitem->next;
-    }
-
-    /* If there is no previous saved rewind point, then save as a new rewind point. */
-    if ( rewindlistitem->id != id )
-    {
-        rewindlistitem->next       = ( otf2_rewindlist* )malloc( sizeof( otf2_rewindlist ) );
-        rewindlistitem->next->prev = rewindlistitem;
-        rewindlistitem->next->next = NULL;
-        rewindlistitem             = rewindlistitem->next;
+        if ( bufferHandle->number_of_rewind_points == bufferHandle->rewind_points_capacity )
+        {
+            uint32_t capacity = bufferHandle->rewind_points_capacity
+                                ? 2 * bufferHandle->rewind_points_capacity
+                                : OTF2_BUFFER_REWIND_POINTS_INITIAL;
+            otf2_rewind_point* points = realloc( bufferHandle->rewind_points,
+                                                 capacity * sizeof( *points ) );
+            if ( !points )
+            {
+                return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                                    "Could not allocate memory for rewind point!" );
+            }
+            bufferHandle->rewind_points          = points;
+            bufferHandle->rewind_points_capacity = capacity;
+        }
 
-        rewindlistitem->id     = id;
-        rewindlistitem->buffer = ( OTF2_Buffer* )malloc( sizeof( OTF2_Buffer ) );
-        rewindlistitem->chunk  = ( otf2_chunk* )malloc( sizeof( otf2_chunk ) );
+        point     = &bufferHandle->rewind_points[ bufferHandle->number_of_rewind_points++ ];
+        point->id = id;
     }
 
-    /* And copy the buffer state. */
-    memcpy( rewindlistitem->buffer, bufferHandle, sizeof( OTF2_Buffer ) );
-    memcpy( rewindlistitem->chunk, bufferHandle->chunk, sizeof( otf2_chunk ) );
+    /* And save the buffer state. */
+    OTF2_Buffer_SaveState( bufferHandle, point );
+    point->suppressed_stack_size = suppressedStackSize;
 
     return OTF2_SUCCESS;
 }
@@ -2504,8 +3556,8 @@ OTF2_Buffer_StoreRewindPoint( OTF2_Buffer* bufferHandle,
 
 /** @brief Clear one specific rewind point, which was saved before.
  *
- *  Deallocate all buffers reserved for a specific rewind point in the
- *  rewind list and remove the rewind point from the double-linked rewind list.
+ *  Removes the rewind point from the rewind stack. This is a pop, if it is
+ *  the latest rewind point.
  *
  *  @param bufferHandle     Initialized OTF2_Buffer instance.
  *  @param id               Identification number of the rewind region handle.
@@ -2519,51 +3571,18 @@ OTF2_Buffer_ClearRewindPoint( OTF2_Buffer* bufferHandle,
 {
     UTILS_ASSERT( bufferHandle && bufferHandle->buffer_mode == OTF2_BUFFER_WRITE );
 
-    otf2_rewindlist* rewindlistitem = bufferHandle->rewindlist;
-    otf2_rewindlist* prev           = NULL;
-    otf2_rewindlist* next           = NULL;
+    otf2_rewind_point* point = otf2_buffer_find_rewind_point( bufferHandle, id );
 
-    /* Search for the rewind region id in the rewind list. */
-    while ( rewindlistitem && rewindlistitem->id != id )
+    /* If the id was found in the rewind stack, then remove it. */
+    if ( point )
     {
-        rewindlistitem = rewindlistitem->next;
-    }
-
-    /* If the id was found in the rewind list, then */
-    if ( rewindlistitem )
-    {
-        /* Renew the prev and next pointers for the neighbour elements in the list,
-           to safely remove the rewind point. */
-        prev = rewindlistitem->prev;
-        next = rewindlistitem->next;
-        if ( prev )
-        {
-            prev->next = next;
-        }
-        if ( next )
-        {
-            next->prev = prev;
-        }
-
-        /* Check if deleted rewind point was the first element (and maybe the last,
-           too) in the list */
-        if ( !prev && !next )
-        {
-            bufferHandle->rewindlist = NULL;
-        }
-        else if ( !prev && next )
-        {
-            bufferHandle->rewindlist = next;
-        }
-
-        /* And, delete previous allocated memory. */
-        free( rewindlistitem->buffer );
-        free( rewindlistitem->chunk );
-        free( rewindlistitem );
+        otf2_rewind_point* end = bufferHandle->rewind_points
+                                 + --bufferHandle->number_of_rewind_points;
+        memmove( point, point + 1, ( end - point ) * sizeof( *point ) );
     }
     else
     {
-        /* else, the id is not in the list because of an previous buffer flush
+        /* else, the id is not in the stack because of an previous buffer flush
          * or a programming error. */
         UTILS_WARNING( "Rewind id not found in rewind list!" );
     }
@@ -2577,58 +3596,72 @@ OTF2_Buffer_ClearRewindPoint( OTF2_Buffer* bufferHandle,
  *  Forget all saved OTF2 events after a defined point in time. This will be
  *  done thru a rewind of the buffer state to a previous saved buffer state.
  *  If there was a buffer flush in the meantime, then there won't be a old
- *  buffer state in the rewind list.
+ *  buffer state in the rewind stack. The rewind point stays in the stack,
+ *  the rewind points stored after it are removed, as their events are gone.
  *
- *  @param bufferHandle     Initialized OTF2_Buffer instance.
- *  @param id               Identification number of the rewind region handle.
+ *  @param bufferHandle              Initialized OTF2_Buffer instance.
+ *  @param id                        Identification number of the rewind region handle.
+ *  @param[out] suppressedStackSize  Size of the suppressed stack of the
+ *                                   writer, when the rewind point was stored.
  *
  *  @return                 Returns OTF2_SUCCESS if successful, an error code
  *                          if an error occurs or the id isn't in the list.
  */
 OTF2_ErrorCode
 OTF2_Buffer_Rewind( OTF2_Buffer* bufferHandle,
-                    uint32_t     id )
+                    uint32_t     id,
+                    uint32_t*    suppressedStackSize )
 {
     UTILS_ASSERT( bufferHandle && bufferHandle->buffer_mode == OTF2_BUFFER_WRITE );
 
-    otf2_rewindlist* rewindlistitem = bufferHandle->rewindlist;
-    otf2_rewindlist* dummy          = NULL;
-    otf2_chunk*      chunk          = NULL;
-
-    /* Search for the rewind region id in the rewind list. */
-    while ( rewindlistitem && rewindlistitem->id != id )
+    otf2_rewind_point* point = otf2_buffer_find_rewind_point( bufferHandle, id );
+    if ( !point )
     {
-        rewindlistitem = rewindlistitem->next;
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Key not found in rewind list!" );
     }
 
-    /* If the id was found in the rewind list, then */
-    if ( rewindlistitem )
-    {
-        /* link all chunks, which were allocated after the rewind point
-         * with the old_chunk_list */
-        bufferHandle->chunk->next = bufferHandle->old_chunk_list;
+    OTF2_Buffer_RestoreState( bufferHandle, point );
+    *suppressedStackSize = point->suppressed_stack_size;
 
-        /* save the new start of the old_chunk_list */
-        chunk = rewindlistitem->buffer->chunk->next;
+    bufferHandle->number_of_rewind_points = point - bufferHandle->rewind_points + 1;
 
-        /* Rewind buffer state (but save the current pointer to the
-         * rewind list). */
-        dummy = bufferHandle->rewindlist;
-        memcpy( bufferHandle, rewindlistitem->buffer, sizeof( OTF2_Buffer ) );
-        memcpy( bufferHandle->chunk, rewindlistitem->chunk, sizeof( otf2_chunk ) );
-        bufferHandle->rewindlist = dummy;
+    return OTF2_SUCCESS;
+}
 
-        /* set the new start of old_chunk_list in the rewinded buffer */
-        bufferHandle->old_chunk_list = chunk;
-    }
-    else
-    {
-        /* else, an error code will be returned. */
-        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
-                            "Key not found in rewind list!" );
-    }
 
-    return OTF2_SUCCESS;
+
+/** @brief Restore a buffer state saved by OTF2_Buffer_SaveState().
+ *
+ *  All data written after the state was saved is dropped. The buffer must
+ *  not have been flushed in between.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance in writing mode.
+ *  @param state            The saved state.
+ */
+void
+OTF2_Buffer_RestoreState( OTF2_Buffer*             bufferHandle,
+                          const otf2_rewind_point* state )
+{
+    /* link all chunks, which were allocated after the saved state
+     * with the old_chunk_list */
+    otf2_chunk* chunk = state->chunk;
+    bufferHandle->chunk->next = bufferHandle->old_chunk_list;
+    if ( chunk != bufferHandle->chunk )
+    {
+        bufferHandle->old_chunk_list = chunk->next;
+    }
+    chunk->next = NULL;
+
+    bufferHandle->chunk        = chunk;
+    bufferHandle->write_pos    = state->write_pos;
+    bufferHandle->time         = state->time;
+    bufferHandle->segment      = state->segment;
+    bufferHandle->chunk_serial = state->chunk_serial;
+    chunk->end                 = state->chunk_end;
+    chunk->first_event         = state->first_event;
+    chunk->index_next          = state->index_next;
+    chunk->index_entries       = state->index_entries;
 }
 
 
@@ -2805,16 +3838,113 @@ OTF2_Buffer_Guarantee( OTF2_Buffer* bufferHandle,
 /* ___ Allocator ____________________________________________________________ */
 
 
+#if HAVE( PLATFORM_LINUX )
+
+/** @brief Size of the mapping of a page backed chunk.
+ *
+ *  @param buffer           Buffer handle.
+ *  @param size             Size of the chunk in bytes.
+ *
+ *  @return                 Returns the size in bytes.
+ */
+static uint64_t
+otf2_buffer_chunk_mapping_size( const OTF2_Buffer* buffer,
+                                uint64_t           size )
+{
+    if ( buffer->chunk_pages == OTF2_CHUNK_ALLOCATION_HUGE_PAGES )
+    {
+        return ( size + OTF2_BUFFER_HUGE_PAGE_SIZE - 1 )
+               & ~( OTF2_BUFFER_HUGE_PAGE_SIZE - 1 );
+    }
+    return size;
+}
+
+
+/** @brief Map fresh pages for a chunk.
+ *
+ *  The mapping is not bound to a NUMA node, the pages are placed on the node
+ *  of the thread which first writes into them.
+ *
+ *  @param buffer           Buffer handle.
+ *  @param chunkSize        Size of the chunk in bytes.
+ *
+ *  @return                 Returns a pointer to the mapped memory on
+ *                          success, NULL if an error occurs.
+ */
+static void*
+otf2_buffer_map_chunk( const OTF2_Buffer* buffer,
+                       uint64_t           chunkSize )
+{
+    uint64_t size = otf2_buffer_chunk_mapping_size( buffer, chunkSize );
+    void*    memory;
+
+    if ( buffer->chunk_pages == OTF2_CHUNK_ALLOCATION_HUGE_PAGES )
+    {
+#if defined( MAP_HUGETLB ) && defined( MAP_HUGE_SHIFT )
+        /* Explicit huge pages are only available if reserved. */
+        memory = mmap( NULL, size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+                       | ( 21 << MAP_HUGE_SHIFT ),
+                       -1, 0 );
+        if ( memory != MAP_FAILED )
+        {
+            return memory;
+        }
+#endif
+
+        /* Align the mapping to a huge page, so that it can be backed by
+         * transparent huge pages. */
+        uint8_t* mapping = mmap( NULL, size + OTF2_BUFFER_HUGE_PAGE_SIZE,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS,
+                                 -1, 0 );
+        if ( mapping == MAP_FAILED )
+        {
+            return NULL;
+        }
+        uint64_t head = ( OTF2_BUFFER_HUGE_PAGE_SIZE
+                          - ( uintptr_t )mapping % OTF2_BUFFER_HUGE_PAGE_SIZE )
+                        % OTF2_BUFFER_HUGE_PAGE_SIZE;
+        if ( head )
+        {
+            munmap( mapping, head );
+        }
+        munmap( mapping + head + size, OTF2_BUFFER_HUGE_PAGE_SIZE - head );
+        memory = mapping + head;
+#if defined( MADV_HUGEPAGE )
+        madvise( memory, size, MADV_HUGEPAGE );
+#endif
+        return memory;
+    }
+
+    memory = mmap( NULL, size,
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS,
+                   -1, 0 );
+    if ( memory == MAP_FAILED )
+    {
+        return NULL;
+    }
+    return memory;
+}
+
+#endif /* HAVE( PLATFORM_LINUX ) */
+
+
 
 /** @brief Internal memory allocate.
  *
  *  @param bufferHandle     Buffer handle.
+ *  @param size             Size of the chunk in bytes, always the chunk size
+ *                          of the buffer if memory callbacks are set.
  *
  *  @return                 Returns a void pointer to the allocated memory on
  *                          success, NULL if an error occurs.
  */
 void*
-otf2_buffer_memory_allocate( OTF2_Buffer* buffer )
+otf2_buffer_memory_allocate( OTF2_Buffer* buffer,
+                             uint64_t     size )
 {
     if ( buffer->archive->allocator_callbacks )
     {
@@ -2823,13 +3953,19 @@ otf2_buffer_memory_allocate( OTF2_Buffer* buffer )
                                 buffer->file_type,
                                 buffer->location_id,
                                 &buffer->allocator_buffer_data,
-                                buffer->chunk_size );
+                                size );
     }
 
-    if ( buffer->memory >= buffer->chunk_size )
+    if ( buffer->memory >= size )
     {
-        buffer->memory -= buffer->chunk_size;
-        return malloc( buffer->chunk_size );
+        buffer->memory -= size;
+#if HAVE( PLATFORM_LINUX )
+        if ( buffer->chunk_pages != OTF2_CHUNK_ALLOCATION_HEAP )
+        {
+            return otf2_buffer_map_chunk( buffer, size );
+        }
+#endif
+        return malloc( size );
     }
 
     return NULL;
@@ -2860,6 +3996,17 @@ otf2_buffer_memory_free( OTF2_Buffer* buffer,
     otf2_chunk* chunk = buffer->chunk_list;
     while ( chunk != NULL )
     {
+#if HAVE( PLATFORM_LINUX )
+        if ( buffer->chunk_pages != OTF2_CHUNK_ALLOCATION_HEAP )
+        {
+            if ( chunk->begin )
+            {
+                munmap( chunk->begin, otf2_buffer_chunk_mapping_size( buffer, chunk->size ) );
+            }
+            chunk = chunk->next;
+            continue;
+        }
+#endif
         free( chunk->begin );
         chunk = chunk->next;
     }
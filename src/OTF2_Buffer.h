@@ -94,6 +94,12 @@ enum OTF2_EndiannessMode_enum
     OTF2_LITTLE_ENDIAN = 0x42
 };
 
+#ifdef WORDS_BIGENDIAN
+#define OTF2_HOST_ENDIANNESS OTF2_BIG_ENDIAN
+#else
+#define OTF2_HOST_ENDIANNESS OTF2_LITTLE_ENDIAN
+#endif
+
 
 /** @brief Wrapper for the OTF2_InternalBufferEvents_enum
  */
@@ -112,13 +118,63 @@ enum OTF2_InternalBufferEvents_enum
     OTF2_BUFFER_END_OF_FILE   = 2,
     /** OTF2 internal event to indicate internal chunk header */
     OTF2_BUFFER_CHUNK_HEADER  = 3,
+    /** OTF2 internal marker of the event index at the end of a chunk, never
+     *  part of the record stream */
+    OTF2_BUFFER_CHUNK_INDEX   = 4,
     /** OTF2 event to indicate a timestamp event */
     OTF2_BUFFER_TIMESTAMP     = 5,
     /** OTF2 event to indicate an attribute list */
-    OTF2_ATTRIBUTE_LIST       = 6
+    OTF2_ATTRIBUTE_LIST       = 6,
+    /** OTF2 leave event without region, which leaves the innermost region
+     *  entered in the same chunk segment */
+    OTF2_BUFFER_IMPLICIT_LEAVE = 7,
+    /** OTF2 attribute list which also defines its shape for the chunk */
+    OTF2_BUFFER_ATTRIBUTE_LIST_DEFINE    = 8,
+    /** OTF2 attribute list which references a shape of the chunk and holds
+     *  only the values */
+    OTF2_BUFFER_ATTRIBUTE_LIST_REFERENCE = 9,
+
+    /* Further internal records are numbered down from 254, as the event
+     * records start at 10 and 255 is kept as an unknown record type */
+
+    /** OTF2 metric event with the differences to the previous sample of the
+     *  metric in the same chunk segment */
+    OTF2_BUFFER_METRIC_DELTA = 254,
+    /** OTF2 calling context sample with the difference to the previous
+     *  sample in the same chunk segment */
+    OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA = 253,
+    /** OTF2 internal chunk header which also records the size of the chunk,
+     *  used if the chunks of a buffer differ in size */
+    OTF2_BUFFER_SIZED_CHUNK_HEADER = 252
+};
+
+
+/** @brief Attributes stored in a OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA
+ *         record, because they differ from the previous sample. */
+enum OTF2_BufferSampleDelta_enum
+{
+    OTF2_BUFFER_SAMPLE_DELTA_UNWIND_DISTANCE     = 1,
+    OTF2_BUFFER_SAMPLE_DELTA_INTERRUPT_GENERATOR = 2
 };
 
 
+/** @brief Size of the event index trailer at the end of a chunk.
+ *
+ *  The event index is an optional table at the end of an event chunk, behind
+ *  the OTF2_BUFFER_END_OF_CHUNK record, and therefore invisible to readers
+ *  which do not know it. The trailer consists of the number of entries and
+ *  the interval as uint32_t values, followed by a OTF2_BUFFER_CHUNK_INDEX
+ *  byte as the last byte of the chunk. Entry i is the uint32_t offset of the
+ *  timestamp record of the event (i + 1) * interval, counted from 0 in the
+ *  chunk. Entries are stored backwards in front of the trailer, all values
+ *  in the endianness of the chunk.
+ */
+#define OTF2_CHUNK_INDEX_TRAILER_SIZE ( uint64_t )9
+
+/** @brief Size of one entry of the event index of a chunk. */
+#define OTF2_CHUNK_INDEX_ENTRY_SIZE ( uint64_t )4
+
+
 /** @brief Keeps all information needed for chunking.
     Please see otf2_chunks_struct for a detailed description. */
 typedef struct otf2_chunk_struct otf2_chunk;
@@ -131,35 +187,72 @@ struct otf2_chunk_struct
     uint8_t*    begin;
     /** Pointer to the end of the actual chunk. */
     uint8_t*    end;
+    /** Size of the chunk in bytes, as recorded in its header. */
+    uint64_t    size;
     /** Number of the actual chunk (Number of first is One). */
     uint32_t    chunk_num;
     /** Number of the first event in the current chunk. */
     uint64_t    first_event;
     /** Number of the last event in the current chunk. */
     uint64_t    last_event;
+    /** Writing mode: value of @a first_event at which the next event index
+     *  entry is due, UINT64_MAX if the chunk is not indexed. */
+    uint64_t    index_next;
+    /** Number of event index entries at the end of the chunk. */
+    uint32_t    index_entries;
+    /** Reading mode: interval of the event index, 0 if the chunk has none. */
+    uint32_t    index_interval;
+    /** Reading mode: chunk number the event index was validated for. */
+    uint32_t    index_chunk_num;
+    /** Reading mode: offset of the event index trailer in the chunk. */
+    uint64_t    index_trailer;
     /** Pointer to the previous chunk. */
     otf2_chunk* prev;
     /** Pointer to the next chunk. */
     otf2_chunk* next;
 };
 
-/** @brief Keeps all information needed to save rewind points.
-    Please see otf2_rewindlist_struct for a detailed description. */
-typedef struct otf2_rewindlist_struct otf2_rewindlist;
+/** @brief Size of the huge pages backing chunks with
+ *  OTF2_CHUNK_ALLOCATION_HUGE_PAGES. */
+#define OTF2_BUFFER_HUGE_PAGE_SIZE ( uint64_t )( 2 * 1024 * 1024 )
 
-/** @brief Keeps all information needed to save rewind points. */
-struct otf2_rewindlist_struct
+/** @brief Initial number of rewind points a buffer has room for. */
+#define OTF2_BUFFER_REWIND_POINTS_INITIAL 8
+
+/** @brief Keeps the buffer state of one rewind point.
+    Please see otf2_rewind_point_struct for a detailed description. */
+typedef struct otf2_rewind_point_struct otf2_rewind_point;
+
+/** @brief Keeps the buffer state of one rewind point.
+ *
+ *  Only the members of the buffer and its current chunk, which change while
+ *  writing into the same buffer, are saved.
+ */
+struct otf2_rewind_point_struct
 {
     /** Rewind region id (derived from region handle) to identify the rewind point. */
-    uint32_t         id;
-    /** Pointer to a saved copy of the OTF2_Buffer at the time of the rewind point. */
-    OTF2_Buffer*     buffer;
-    /** Pointer to a saved copy of the current otf2_chunk_struct of the OTF2_Buffer. */
-    otf2_chunk*      chunk;
-    /** Pointer to the previous rewind point. */
-    otf2_rewindlist* prev;
-    /** Pointer to the next rewind point. */
-    otf2_rewindlist* next;
+    uint32_t       id;
+    /** Number of event index entries of the chunk. */
+    uint32_t       index_entries;
+    /** The current chunk. */
+    otf2_chunk*    chunk;
+    /** Current writing position. */
+    uint8_t*       write_pos;
+    /** End of the chunk, moved by the event index entries. */
+    uint8_t*       chunk_end;
+    /** Last written timestamp. */
+    OTF2_TimeStamp time;
+    /** Event counter of the chunk. */
+    uint64_t       first_event;
+    /** Event number at which the next event index entry is due. */
+    uint64_t       index_next;
+    /** Number of the current chunk segment. */
+    uint64_t       segment;
+    /** Identifies the current chunk. */
+    uint64_t       chunk_serial;
+    /** Size of the suppressed stack of the event writer, which is not part
+     *  of the buffer state and saved only with rewind points. */
+    uint32_t       suppressed_stack_size;
 };
 
 /** @brief Keeps all necessary information about the buffer. */
@@ -190,6 +283,9 @@ struct OTF2_Buffer
 
     /** Last written timestamp. */
     OTF2_TimeStamp time;
+    /** First written timestamp, OTF2_UNDEFINED_TIMESTAMP if none was
+     *  written yet. */
+    OTF2_TimeStamp first_time;
     /** Position of last read timestamp. */
     uint8_t*       time_pos;
 
@@ -210,17 +306,66 @@ struct OTF2_Buffer
     /** Size of the memory buffer in bytes. */
     uint64_t memory;
 
+    /** Writing mode: how the internal allocator gets the memory of a
+        chunk, see OTF2_HINT_CHUNK_ALLOCATION. */
+    OTF2_ChunkAllocation chunk_pages;
+
     /** Defines if buffer is finalized i.e. writing to buffer is finished. */
     bool finalized;
 
     /** Storage for the memory system to store per buffer allocator data */
     void* allocator_buffer_data;
 
-    /** Pointer to the list of rewind points. */
-    otf2_rewindlist* rewindlist;
+    /** Stack of rewind points, the latest is on top. */
+    otf2_rewind_point* rewind_points;
+    /** Number of stored rewind points. */
+    uint32_t           number_of_rewind_points;
+    /** Number of rewind points @a rewind_points has room for. */
+    uint32_t           rewind_points_capacity;
 
     /** Pointer to the list of old chunks */
     otf2_chunk* old_chunk_list;
+
+    /** Defines if the memory of the current chunk was released in reading
+        mode, see OTF2_Buffer_ReadReleaseChunks(). */
+    bool     chunks_released;
+    /** Offset of the read position inside the released chunk. */
+    uint64_t released_read_offset;
+
+    /** Writing mode: number of events between two entries of the event
+        index of a chunk, 0 if no index is written. */
+    uint32_t index_interval;
+    /** Writing mode: number of the current chunk segment. Incremented with
+        every new chunk and every event index entry. */
+    uint64_t segment;
+    /** Writing mode: number of chunks started, identifies the current
+        chunk. */
+    uint64_t chunk_serial;
+    /** Reading mode: size of the file, 0 if not yet known. */
+    uint64_t file_size;
+
+    /** The chunks record their size in the header, thus their sizes may
+        differ. */
+    bool sized_chunks;
+    /** Writing mode: minimum size of an event chunk, if the chunk sizes
+        adapt to the write rate, see OTF2_HINT_ADAPTIVE_CHUNK_SIZE. The
+        maximum is @a chunk_size. */
+    uint64_t chunk_size_min;
+    /** Writing mode: size of the next chunk, if the chunk sizes adapt. */
+    uint64_t next_chunk_size;
+    /** Writing mode: first timestamp of the current chunk, if the chunk sizes
+        adapt. */
+    OTF2_TimeStamp chunk_time;
+    /** Writing mode: bytes per time unit written into the last completed
+        chunk, 0 if none was completed yet. */
+    double chunk_rate;
+    /** Reading mode: file offsets of the sized chunks known so far, entry i
+        is that of chunk i + 1. */
+    uint64_t* chunk_offsets;
+    /** Reading mode: number of entries in @a chunk_offsets. */
+    uint32_t number_of_chunk_offsets;
+    /** Reading mode: number of entries @a chunk_offsets has room for. */
+    uint32_t chunk_offsets_capacity;
 };
 
 
@@ -357,29 +502,40 @@ otf2_buffer_size_uint32full( uint32_t value )
 }
 
 
+/** @brief Number of significant bytes of @a value.
+ *
+ *  This is the number of bytes stored after the size byte of a compressed
+ *  value. Uses a bit scan instruction if the compiler provides one.
+ *
+ *  @param value  Non-zero value.
+ */
+static inline uint8_t
+otf2_buffer_significant_bytes( uint64_t value )
+{
+#if defined( __GNUC__ )
+    return ( 71 - __builtin_clzll( value ) ) >> 3;
+#else
+    uint8_t bytes = 1;
+    while ( value > UINT64_C( 0xff ) )
+    {
+        value >>= 8;
+        bytes++;
+    }
+    return bytes;
+#endif
+}
+
+
 static inline size_t
 otf2_buffer_size_uint32( uint32_t value )
 {
+    /* special compression for special values */
     if ( value == 0 || value == UINT32_MAX )
     {
         return 1;
     }
-    else if ( UINT32_C( 0x100 ) > value )
-    {
-        return 2;
-    }
-    else if ( UINT32_C( 0x10000 ) > value )
-    {
-        return 3;
-    }
-    else if ( UINT32_C( 0x1000000 ) > value )
-    {
-        return 4;
-    }
-    else
-    {
-        return 5;
-    }
+
+    return 1 + otf2_buffer_significant_bytes( value );
 }
 
 
@@ -395,29 +551,9 @@ otf2_buffer_size_int32( int32_t value )
     {
         return 1;
     }
-    else if ( value >= 0 )
-    {
-        if ( INT32_C( 0x100 ) > value )
-        {
-            return 2;
-        }
-        else if ( INT32_C( 0x10000 ) > value )
-        {
-            return 3;
-        }
-        else if ( INT32_C( 0x1000000 ) > value )
-        {
-            return 4;
-        }
-        else
-        {
-            return 5;
-        }
-    }
-    else
-    {
-        return 5;
-    }
+
+    /* Negative values have all 4 bytes significant. */
+    return 1 + otf2_buffer_significant_bytes( ( uint32_t )value );
 }
 
 
@@ -429,38 +565,8 @@ otf2_buffer_size_uint64( uint64_t value )
     {
         return 1;
     }
-    else if ( UINT64_C( 0x100 ) > value )
-    {
-        return 2;
-    }
-    else if ( UINT64_C( 0x10000 ) > value )
-    {
-        return 3;
-    }
-    else if ( UINT64_C( 0x1000000 ) > value )
-    {
-        return 4;
-    }
-    else if ( UINT64_C( 0x100000000 ) > value )
-    {
-        return 5;
-    }
-    else if ( UINT64_C( 0x10000000000 ) > value )
-    {
-        return 6;
-    }
-    else if ( UINT64_C( 0x1000000000000 ) > value )
-    {
-        return 7;
-    }
-    else if ( UINT64_C( 0x100000000000000 ) > value )
-    {
-        return 8;
-    }
-    else
-    {
-        return 9;
-    }
+
+    return 1 + otf2_buffer_significant_bytes( value );
 }
 
 
@@ -476,45 +582,9 @@ otf2_buffer_size_int64( int64_t value )
     {
         return 1;
     }
-    else if ( value >= 0 )
-    {
-        if ( INT64_C( 0x100 ) > value )
-        {
-            return 2;
-        }
-        else if ( INT64_C( 0x10000 ) > value )
-        {
-            return 3;
-        }
-        else if ( INT64_C( 0x1000000 ) > value )
-        {
-            return 4;
-        }
-        else if ( INT64_C( 0x100000000 ) > value )
-        {
-            return 5;
-        }
-        else if ( INT64_C( 0x10000000000 ) > value )
-        {
-            return 6;
-        }
-        else if ( INT64_C( 0x1000000000000 ) > value )
-        {
-            return 7;
-        }
-        else if ( INT64_C( 0x100000000000000 ) > value )
-        {
-            return 8;
-        }
-        else
-        {
-            return 9;
-        }
-    }
-    else
-    {
-        return 9;
-    }
+
+    /* Negative values have all 8 bytes significant. */
+    return 1 + otf2_buffer_significant_bytes( ( uint64_t )value );
 }
 
 
@@ -597,6 +667,49 @@ OTF2_Buffer_WriteUint16( OTF2_Buffer*   bufferHandle,
 }
 
 
+#if !defined( WORDS_BIGENDIAN )
+/** @brief Stores the first @a size bytes of a little endian value.
+ *
+ *  Uses a single store of the full width if the chunk has enough room. The
+ *  excess bytes are behind the write position and are overwritten by the
+ *  next value or by the end of chunk padding.
+ *
+ *  @{
+ */
+static inline void
+otf2_buffer_store_le32( OTF2_Buffer* bufferHandle,
+                        uint32_t     value,
+                        uint8_t      size )
+{
+    if ( bufferHandle->chunk->end - bufferHandle->write_pos >= 4 )
+    {
+        memcpy( bufferHandle->write_pos, &value, 4 );
+    }
+    else
+    {
+        memcpy( bufferHandle->write_pos, &value, size );
+    }
+}
+
+
+static inline void
+otf2_buffer_store_le64( OTF2_Buffer* bufferHandle,
+                        uint64_t     value,
+                        uint8_t      size )
+{
+    if ( bufferHandle->chunk->end - bufferHandle->write_pos >= 8 )
+    {
+        memcpy( bufferHandle->write_pos, &value, 8 );
+    }
+    else
+    {
+        memcpy( bufferHandle->write_pos, &value, size );
+    }
+}
+/** @} */
+#endif /* !WORDS_BIGENDIAN */
+
+
 static inline void
 OTF2_Buffer_WriteInt32( OTF2_Buffer*  bufferHandle,
                         const int32_t value )
@@ -609,7 +722,7 @@ OTF2_Buffer_WriteInt32( OTF2_Buffer*  bufferHandle,
 #ifdef WORDS_BIGENDIAN /* Store last bytes when big endian. */
     memcpy( bufferHandle->write_pos, ( const uint8_t* )&value + 4 - size, size );
 #else /* Store first bytes when little endian. */
-    memcpy( bufferHandle->write_pos, &value, size );
+    otf2_buffer_store_le32( bufferHandle, value, size );
 #endif      /* WORDS_BIGENDIAN. */
 
     bufferHandle->write_pos += size;
@@ -644,7 +757,7 @@ OTF2_Buffer_WriteUint32( OTF2_Buffer*   bufferHandle,
 #ifdef WORDS_BIGENDIAN /* Store last bytes when big endian. */
     memcpy( bufferHandle->write_pos, ( const uint8_t* )&value + 4 - size, size );
 #else /* Store first bytes when little endian. */
-    memcpy( bufferHandle->write_pos, &value, size );
+    otf2_buffer_store_le32( bufferHandle, value, size );
 #endif      /* WORDS_BIGENDIAN. */
 
     bufferHandle->write_pos += size;
@@ -672,7 +785,7 @@ OTF2_Buffer_WriteInt64( OTF2_Buffer*  bufferHandle,
 #ifdef WORDS_BIGENDIAN /* Store last bytes when big endian. */
     memcpy( bufferHandle->write_pos, ( const uint8_t* )&value + 8 - size, size );
 #else /* Store first bytes when little endian. */
-    memcpy( bufferHandle->write_pos, &value, size );
+    otf2_buffer_store_le64( bufferHandle, value, size );
 #endif      /* WORDS_BIGENDIAN. */
 
     bufferHandle->write_pos += size;
@@ -707,7 +820,7 @@ OTF2_Buffer_WriteUint64( OTF2_Buffer*   bufferHandle,
 #ifdef WORDS_BIGENDIAN /* Store last bytes when big endian. */
     memcpy( bufferHandle->write_pos, ( const uint8_t* )&value + 8 - size, size );
 #else /* Store first bytes when little endian. */
-    memcpy( bufferHandle->write_pos, &value, size );
+    otf2_buffer_store_le64( bufferHandle, value, size );
 #endif      /* WORDS_BIGENDIAN. */
 
     bufferHandle->write_pos += size;
@@ -765,7 +878,12 @@ OTF2_Buffer_WriteString( OTF2_Buffer* bufferHandle,
 
 OTF2_ErrorCode
 OTF2_Buffer_RequestNewChunk( OTF2_Buffer*   bufferHandle,
-                             OTF2_TimeStamp time );
+                             OTF2_TimeStamp time,
+                             uint64_t       recordLength );
+
+bool
+OTF2_Buffer_WriteIndexEntry( OTF2_Buffer* bufferHandle,
+                             uint64_t     recordLength );
 
 /** @brief Check if the next record fits into the current chunk.
  *
@@ -805,7 +923,7 @@ OTF2_Buffer_RecordRequest( OTF2_Buffer*   bufferHandle,
         return OTF2_SUCCESS;
     }
 
-    return OTF2_Buffer_RequestNewChunk( bufferHandle, time );
+    return OTF2_Buffer_RequestNewChunk( bufferHandle, time, size_time + recordLength );
 }
 
 /** @brief Get the free space left in the buffer in wite mode.
@@ -857,6 +975,11 @@ OTF2_Buffer_WriteMemoryRequest( OTF2_Buffer* bufferHandle,
     return OTF2_SUCCESS;
 }
 
+OTF2_ErrorCode
+otf2_buffer_write_timestamp( OTF2_Buffer*         bufferHandle,
+                             const OTF2_TimeStamp time,
+                             uint64_t             recordLength );
+
 /** @brief Write a timestamp if necessary.
  *
  *  Checks if the the passed timestamp is newer than the last written one. If so
@@ -885,43 +1008,30 @@ OTF2_Buffer_WriteTimeStamp( OTF2_Buffer*         bufferHandle,
                             const OTF2_TimeStamp time,
                             uint64_t             recordLength )
 {
-    OTF2_ErrorCode status = OTF2_SUCCESS;
-
-    /* Check the time order early, because we may write
-       timestamps in OTF2_Buffer_RecordRequest, too */
-    if ( time < bufferHandle->time )
+    otf2_chunk* chunk = bufferHandle->chunk;
+
+    /* Handle the common case inline: the record fits into the current chunk
+     * and no event index entry is due. Everything else, including the
+     * ordering errors and the first timestamp, is done out-of-line. */
+    if ( bufferHandle->time != 0 && time >= bufferHandle->time
+         && chunk->first_event != chunk->index_next
+         && OTF2_BUFFER_TIMESTAMP_SIZE + recordLength
+         < ( uint64_t )( chunk->end - bufferHandle->write_pos ) )
     {
-        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
-                            "Passed timestamp is smaller than last written one! (%" PRIu64 " < %" PRIu64 ")",
-                            time, bufferHandle->time );
-    }
+        if ( time > bufferHandle->time )
+        {
+            OTF2_Buffer_WriteUint8( bufferHandle, OTF2_BUFFER_TIMESTAMP );
+            OTF2_Buffer_WriteUint64Full( bufferHandle, time );
 
-    /* Handle chunking and buffer overflow. */
-    status = OTF2_Buffer_RecordRequest( bufferHandle, time, recordLength );
-    if ( status != OTF2_SUCCESS )
-    {
-        return UTILS_ERROR( status,
-                            "Chunk handling failed!" );
-    }
+            bufferHandle->time = time;
+        }
 
-    /* Check if actual timestamp is newer than the last written one. If so write
-     * it to the buffer otherwise return.
-     * Enable to write a timestamp zero at the beginning of the buffer. */
-    if ( ( time > bufferHandle->time ) ||
-         ( time == 0 && time == bufferHandle->time ) )
-    {
-        OTF2_Buffer_WriteUint8( bufferHandle, OTF2_BUFFER_TIMESTAMP );
-        OTF2_Buffer_WriteUint64Full( bufferHandle, time );
+        chunk->first_event++;
 
-        bufferHandle->time = time;
+        return OTF2_SUCCESS;
     }
 
-
-    /* Increment number of events. In writing mode only one counter is
-       necessary. So only 'first_event' is incremented. */
-    bufferHandle->chunk->first_event++;
-
-    return OTF2_SUCCESS;
+    return otf2_buffer_write_timestamp( bufferHandle, time, recordLength );
 }
 
 
@@ -1019,14 +1129,6 @@ OTF2_Buffer_ReadTimeStamp( OTF2_Buffer*    bufferHandle,
                            OTF2_TimeStamp* req_time );
 
 /** @{ */
-void
-OTF2_Buffer_ReadInt8( OTF2_Buffer* bufferHandle,
-                      int8_t*      returnValue );
-
-void
-OTF2_Buffer_ReadUint8( OTF2_Buffer* bufferHandle,
-                       uint8_t*     returnValue );
-
 void
 OTF2_Buffer_ReadInt16( OTF2_Buffer* bufferHandle,
                        int16_t*     returnValue );
@@ -1035,53 +1137,269 @@ void
 OTF2_Buffer_ReadUint16( OTF2_Buffer* bufferHandle,
                         uint16_t*    returnValue );
 
-OTF2_ErrorCode
-OTF2_Buffer_ReadInt32( OTF2_Buffer* bufferHandle,
-                       int32_t*     returnValue );
-
 void
 OTF2_Buffer_ReadInt32Full( OTF2_Buffer* bufferHandle,
                            int32_t*     returnValue );
 
-OTF2_ErrorCode
-OTF2_Buffer_ReadUint32( OTF2_Buffer* bufferHandle,
-                        uint32_t*    returnValue );
-
 void
 OTF2_Buffer_ReadUint32Full( OTF2_Buffer* bufferHandle,
                             uint32_t*    returnValue );
 
+void
+OTF2_Buffer_ReadFloat( OTF2_Buffer* bufferHandle,
+                       float*       returnValue );
+
 OTF2_ErrorCode
-OTF2_Buffer_ReadInt64( OTF2_Buffer* bufferHandle,
-                       int64_t*     returnValue );
+OTF2_Buffer_ReadString( OTF2_Buffer* bufferHandle,
+                        const char** returnValue );
+
+/** @} */
 
-void
-OTF2_Buffer_ReadInt64Full( OTF2_Buffer* bufferHandle,
-                           int64_t*     returnValue );
 
+/** @name Decoding of values not in host endianness.
+ *
+ *  Used by the inlined reading routines below, if the buffer was written on a
+ *  host with a different endianness.
+ *
+ *  @{
+ */
 OTF2_ErrorCode
-OTF2_Buffer_ReadUint64( OTF2_Buffer* bufferHandle,
-                        uint64_t*    returnValue );
+otf2_buffer_read_uint32_foreign( OTF2_Buffer* bufferHandle,
+                                 uint32_t*    returnValue );
+
+OTF2_ErrorCode
+otf2_buffer_read_uint64_foreign( OTF2_Buffer* bufferHandle,
+                                 uint64_t*    returnValue );
 
 void
+otf2_buffer_read_uint64_full_foreign( OTF2_Buffer* bufferHandle,
+                                      uint64_t*    returnValue );
+
+/** @} */
+
+
+/** @name Inlined reading routines for the frequent data types.
+ *
+ *  The record containing the value was already validated with
+ *  OTF2_Buffer_GuaranteeRecord or OTF2_Buffer_GuaranteeCompressed, thus the
+ *  values are decoded without further bounds checks. Only the size byte of
+ *  compressed values is checked.
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance.
+ *  @param returnValue      Pointer to the read value.
+ *
+ *  @{
+ */
+static inline void
+OTF2_Buffer_ReadUint8( OTF2_Buffer* bufferHandle,
+                       uint8_t*     returnValue )
+{
+    *returnValue = *bufferHandle->read_pos++;
+}
+
+
+static inline void
+OTF2_Buffer_ReadInt8( OTF2_Buffer* bufferHandle,
+                      int8_t*      returnValue )
+{
+    memcpy( returnValue, bufferHandle->read_pos, 1 );
+    bufferHandle->read_pos++;
+}
+
+
+#if !defined( WORDS_BIGENDIAN )
+/** @brief Loads the first @a size bytes of a little endian value.
+ *
+ *  Uses a single load of the full width and masks the excess bytes, if the
+ *  chunk has enough data left.
+ *
+ *  @{
+ */
+static inline uint32_t
+otf2_buffer_load_le32( OTF2_Buffer* bufferHandle,
+                       uint8_t      size )
+{
+    uint32_t value = 0;
+    if ( bufferHandle->chunk->end - bufferHandle->read_pos >= 4 )
+    {
+        memcpy( &value, bufferHandle->read_pos, 4 );
+        /* Two shifts, to be defined for all sizes from 0 to 4. */
+        return value & ~( UINT32_MAX << ( 4 * size ) << ( 4 * size ) );
+    }
+    memcpy( &value, bufferHandle->read_pos, size );
+    return value;
+}
+
+
+static inline uint64_t
+otf2_buffer_load_le64( OTF2_Buffer* bufferHandle,
+                       uint8_t      size )
+{
+    uint64_t value = 0;
+    if ( bufferHandle->chunk->end - bufferHandle->read_pos >= 8 )
+    {
+        memcpy( &value, bufferHandle->read_pos, 8 );
+        /* Two shifts, to be defined for all sizes from 0 to 8. */
+        return value & ~( UINT64_MAX << ( 4 * size ) << ( 4 * size ) );
+    }
+    memcpy( &value, bufferHandle->read_pos, size );
+    return value;
+}
+/** @} */
+#endif /* !WORDS_BIGENDIAN */
+
+
+static inline OTF2_ErrorCode
+OTF2_Buffer_ReadUint32( OTF2_Buffer* bufferHandle,
+                        uint32_t*    returnValue )
+{
+    if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
+    {
+        return otf2_buffer_read_uint32_foreign( bufferHandle, returnValue );
+    }
+
+    uint8_t size = *bufferHandle->read_pos++;
+    if ( size == 0xff )
+    {
+        *returnValue = UINT32_MAX;
+        return OTF2_SUCCESS;
+    }
+    if ( size > 4 )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "Invalid size in compressed length byte." );
+    }
+
+#ifdef WORDS_BIGENDIAN
+    *returnValue = 0;
+    memcpy( ( uint8_t* )returnValue + 4 - size, bufferHandle->read_pos, size );
+#else
+    *returnValue = otf2_buffer_load_le32( bufferHandle, size );
+#endif
+    bufferHandle->read_pos += size;
+
+    return OTF2_SUCCESS;
+}
+
+
+static inline OTF2_ErrorCode
+OTF2_Buffer_ReadInt32( OTF2_Buffer* bufferHandle,
+                       int32_t*     returnValue )
+{
+    union
+    {
+        uint32_t u32;
+        int32_t  s32;
+    } u;
+
+    OTF2_ErrorCode status = OTF2_Buffer_ReadUint32( bufferHandle, &u.u32 );
+    *returnValue = u.s32;
+
+    return status;
+}
+
+
+static inline OTF2_ErrorCode
+OTF2_Buffer_ReadUint64( OTF2_Buffer* bufferHandle,
+                        uint64_t*    returnValue )
+{
+    if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
+    {
+        return otf2_buffer_read_uint64_foreign( bufferHandle, returnValue );
+    }
+
+    uint8_t size = *bufferHandle->read_pos++;
+    if ( size == 0xff )
+    {
+        *returnValue = UINT64_MAX;
+        return OTF2_SUCCESS;
+    }
+    if ( size > 8 )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "Invalid size in compressed length byte." );
+    }
+
+#ifdef WORDS_BIGENDIAN
+    *returnValue = 0;
+    memcpy( ( uint8_t* )returnValue + 8 - size, bufferHandle->read_pos, size );
+#else
+    *returnValue = otf2_buffer_load_le64( bufferHandle, size );
+#endif
+    bufferHandle->read_pos += size;
+
+    return OTF2_SUCCESS;
+}
+
+
+static inline OTF2_ErrorCode
+OTF2_Buffer_ReadInt64( OTF2_Buffer* bufferHandle,
+                       int64_t*     returnValue )
+{
+    union
+    {
+        uint64_t u64;
+        int64_t  s64;
+    } u;
+
+    OTF2_ErrorCode status = OTF2_Buffer_ReadUint64( bufferHandle, &u.u64 );
+    *returnValue = u.s64;
+
+    return status;
+}
+
+
+static inline void
 OTF2_Buffer_ReadUint64Full( OTF2_Buffer* bufferHandle,
-                            uint64_t*    returnValue );
+                            uint64_t*    returnValue )
+{
+    if ( bufferHandle->endianness_mode != OTF2_HOST_ENDIANNESS )
+    {
+        otf2_buffer_read_uint64_full_foreign( bufferHandle, returnValue );
+        return;
+    }
 
-void
-OTF2_Buffer_ReadFloat( OTF2_Buffer* bufferHandle,
-                       float*       returnValue );
+    memcpy( returnValue, bufferHandle->read_pos, 8 );
+    bufferHandle->read_pos += 8;
+}
 
-void
+
+static inline void
+OTF2_Buffer_ReadInt64Full( OTF2_Buffer* bufferHandle,
+                           int64_t*     returnValue )
+{
+    union
+    {
+        uint64_t u64;
+        int64_t  s64;
+    } u;
+
+    OTF2_Buffer_ReadUint64Full( bufferHandle, &u.u64 );
+    *returnValue = u.s64;
+}
+
+
+static inline void
 OTF2_Buffer_ReadDouble( OTF2_Buffer* bufferHandle,
-                        double*      returnValue );
+                        double*      returnValue )
+{
+    union
+    {
+        uint64_t u64;
+        double   d;
+    } u;
 
-OTF2_ErrorCode
-OTF2_Buffer_ReadMetricValue( OTF2_Buffer*      bufferHandle,
-                             OTF2_MetricValue* returnValue );
+    OTF2_Buffer_ReadUint64Full( bufferHandle, &u.u64 );
+    *returnValue = u.d;
+}
 
-OTF2_ErrorCode
-OTF2_Buffer_ReadString( OTF2_Buffer* bufferHandle,
-                        const char** returnValue );
+
+static inline OTF2_ErrorCode
+OTF2_Buffer_ReadMetricValue( OTF2_Buffer*      bufferHandle,
+                             OTF2_MetricValue* returnValue )
+{
+    return OTF2_Buffer_ReadUint64( bufferHandle, &returnValue->unsigned_int );
+}
 
 /** @} */
 
@@ -1115,6 +1433,26 @@ OTF2_Buffer_ReadSeekChunkTime( OTF2_Buffer* bufferHandle,
                                uint64_t     time,
                                bool*        found );
 
+OTF2_ErrorCode
+OTF2_Buffer_ReadReleaseChunks( OTF2_Buffer* bufferHandle );
+
+OTF2_ErrorCode
+OTF2_Buffer_ReadReloadChunk( OTF2_Buffer* bufferHandle );
+
+void
+OTF2_Buffer_ReadGetChunkIndex( OTF2_Buffer* bufferHandle,
+                               uint32_t*    interval,
+                               uint32_t*    numberOfEntries );
+
+void
+OTF2_Buffer_ReadGetChunkIndexEntry( OTF2_Buffer*    bufferHandle,
+                                    uint32_t        entry,
+                                    uint8_t**       position,
+                                    OTF2_TimeStamp* time );
+
+uint64_t
+OTF2_Buffer_GetResidentSize( OTF2_Buffer* bufferHandle );
+
 void
 OTF2_Buffer_GetPosition( OTF2_Buffer* bufferHandle,
                          uint8_t**    position );
@@ -1148,12 +1486,13 @@ OTF2_Buffer_RewriteTimeStamp( OTF2_Buffer*   bufferHandle,
 
 
 
-/* ___ Routines to manage the rewind list. __________________________________ */
+/* ___ Routines to manage the rewind stack. _________________________________ */
 
 
 OTF2_ErrorCode
 OTF2_Buffer_StoreRewindPoint( OTF2_Buffer* bufferHandle,
-                              uint32_t     id );
+                              uint32_t     id,
+                              uint32_t     suppressedStackSize );
 
 OTF2_ErrorCode
 OTF2_Buffer_ClearRewindPoint( OTF2_Buffer* bufferHandle,
@@ -1161,7 +1500,34 @@ OTF2_Buffer_ClearRewindPoint( OTF2_Buffer* bufferHandle,
 
 OTF2_ErrorCode
 OTF2_Buffer_Rewind( OTF2_Buffer* bufferHandle,
-                    uint32_t     id );
+                    uint32_t     id,
+                    uint32_t*    suppressedStackSize );
+
+/** @brief Save the state of the buffer for a later
+ *  OTF2_Buffer_RestoreState().
+ *
+ *  @param bufferHandle     Initialized OTF2_Buffer instance in writing mode.
+ *  @param state            The saved state, its id is not set.
+ */
+static inline void
+OTF2_Buffer_SaveState( OTF2_Buffer*       bufferHandle,
+                       otf2_rewind_point* state )
+{
+    otf2_chunk* chunk = bufferHandle->chunk;
+    state->chunk         = chunk;
+    state->write_pos     = bufferHandle->write_pos;
+    state->chunk_end     = chunk->end;
+    state->time          = bufferHandle->time;
+    state->first_event   = chunk->first_event;
+    state->index_next    = chunk->index_next;
+    state->index_entries = chunk->index_entries;
+    state->segment       = bufferHandle->segment;
+    state->chunk_serial  = bufferHandle->chunk_serial;
+}
+
+void
+OTF2_Buffer_RestoreState( OTF2_Buffer*             bufferHandle,
+                          const otf2_rewind_point* state );
 
 
 /* ___ Routines to check buffer consistency . _______________________________ */
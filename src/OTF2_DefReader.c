@@ -80,6 +80,10 @@ static inline OTF2_ErrorCode
 otf2_def_reader_read_unknown( OTF2_DefReader* reader );
 
 
+static inline OTF2_ErrorCode
+otf2_def_reader_skip( OTF2_DefReader* reader );
+
+
 static inline void
 otf2_local_def_region_convert_pre_1_1( OTF2_LocalDefRegion* record )
 {
@@ -391,6 +395,34 @@ OTF2_DefReader_ReadDefinitions( OTF2_DefReader* reader,
 }
 
 
+/** @brief Skips a definition record without decoding it.
+ *
+ *  @param reader   Reference to the reader object
+ *
+ *  @return OTF2_SUCCESS
+ */
+static inline OTF2_ErrorCode
+otf2_def_reader_skip( OTF2_DefReader* reader )
+{
+    /* Get record length and test memory availability */
+    uint64_t       record_length;
+    OTF2_ErrorCode ret;
+    ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_length );
+    if ( OTF2_SUCCESS != ret )
+    {
+        return UTILS_ERROR( ret, "Could not read definition record." );
+    }
+
+    ret = OTF2_Buffer_Skip( reader->buffer, record_length );
+    if ( OTF2_SUCCESS != ret )
+    {
+        return UTILS_ERROR( ret, "Could not skip definition record." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
 /** @brief Reads a definition record of unknown type and triggers the callback.
  *
  *  @param reader   Reference to the reader object
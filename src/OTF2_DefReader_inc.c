@@ -182,6 +182,70 @@ static_record.standard_deviation );
 }
 
 
+/** @brief Reads a EventTimeRange record and triggers the callback.
+ *
+ *  @param reader   Reference to the reader object
+ *
+ *  @return OTF2_SUCCESS
+ */
+static inline OTF2_ErrorCode
+otf2_def_reader_read_event_time_range( OTF2_DefReader* reader )
+{
+    UTILS_ASSERT( reader );
+    UTILS_ASSERT( reader->archive );
+
+    OTF2_LocalDefEventTimeRange static_record;
+
+    OTF2_ErrorCode ret;
+    uint64_t          record_data_length;
+    /* Get record length and test memory availability */
+    ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
+    if ( OTF2_SUCCESS != ret )
+    {
+        return UTILS_ERROR( ret, "Could not read record of unknown type." );
+    }
+    uint8_t* record_end_pos;
+    OTF2_Buffer_GetPosition( reader->buffer, &record_end_pos );
+    record_end_pos += record_data_length;
+
+    OTF2_Buffer_ReadUint64Full( reader->buffer, &static_record.first_timestamp );
+    OTF2_Buffer_ReadUint64Full( reader->buffer, &static_record.last_timestamp );
+
+    /*
+     * Always jump to the announced end of the record. This way, we skip
+     * future additions of attributes to this record.
+     */
+    ret = OTF2_Buffer_SetPosition( reader->buffer, record_end_pos );
+    if ( OTF2_SUCCESS != ret )
+    {
+        return UTILS_ERROR( ret, "Could not read record of unknown type." );
+    }
+
+    ret = otf2_archive_location_set_event_time_range( reader->archive,
+                                                                   reader->location_id ,
+static_record.first_timestamp,
+static_record.last_timestamp );
+
+    OTF2_CallbackCode interrupt = OTF2_CALLBACK_SUCCESS;
+    if ( reader->reader_callbacks.event_time_range )
+    {
+        interrupt = reader->reader_callbacks.event_time_range( reader->user_data ,
+static_record.first_timestamp,
+static_record.last_timestamp );
+    }
+
+
+    if ( OTF2_SUCCESS != ret )
+    {
+        return UTILS_ERROR( ret, "Can't add EventTimeRange defintion to associated event reader." );
+    }
+
+    return OTF2_CALLBACK_SUCCESS == interrupt
+           ? OTF2_SUCCESS
+           : OTF2_ERROR_INTERRUPTED_BY_CALLBACK;
+}
+
+
 /** @brief Reads a String record and triggers the callback.
  *
  *  @param reader   Reference to the reader object
@@ -2357,85 +2421,196 @@ otf2_def_reader_read( OTF2_DefReader* reader )
         case OTF2_LOCAL_DEF_CLOCK_OFFSET:
             return otf2_def_reader_read_clock_offset( reader );
 
+        case OTF2_LOCAL_DEF_EVENT_TIME_RANGE:
+            return otf2_def_reader_read_event_time_range( reader );
+
         case OTF2_LOCAL_DEF_STRING:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_string( reader );
 
         case OTF2_LOCAL_DEF_ATTRIBUTE:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_attribute( reader );
 
         case OTF2_LOCAL_DEF_SYSTEM_TREE_NODE:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_system_tree_node( reader );
 
         case OTF2_LOCAL_DEF_LOCATION_GROUP:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_location_group( reader );
 
         case OTF2_LOCAL_DEF_LOCATION:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_location( reader );
 
         case OTF2_LOCAL_DEF_REGION:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_region( reader );
 
         case OTF2_LOCAL_DEF_CALLSITE:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_callsite( reader );
 
         case OTF2_LOCAL_DEF_CALLPATH:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_callpath( reader );
 
         case OTF2_LOCAL_DEF_GROUP:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_group( reader );
 
         case OTF2_LOCAL_DEF_METRIC_MEMBER:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_metric_member( reader );
 
         case OTF2_LOCAL_DEF_METRIC_CLASS:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_metric_class( reader );
 
         case OTF2_LOCAL_DEF_METRIC_INSTANCE:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_metric_instance( reader );
 
         case OTF2_LOCAL_DEF_COMM:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_comm( reader );
 
         case OTF2_LOCAL_DEF_PARAMETER:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_parameter( reader );
 
         case OTF2_LOCAL_DEF_RMA_WIN:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_rma_win( reader );
 
         case OTF2_LOCAL_DEF_METRIC_CLASS_RECORDER:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_metric_class_recorder( reader );
 
         case OTF2_LOCAL_DEF_SYSTEM_TREE_NODE_PROPERTY:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_system_tree_node_property( reader );
 
         case OTF2_LOCAL_DEF_SYSTEM_TREE_NODE_DOMAIN:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_system_tree_node_domain( reader );
 
         case OTF2_LOCAL_DEF_LOCATION_GROUP_PROPERTY:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_location_group_property( reader );
 
         case OTF2_LOCAL_DEF_LOCATION_PROPERTY:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_location_property( reader );
 
         case OTF2_LOCAL_DEF_CART_DIMENSION:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_cart_dimension( reader );
 
         case OTF2_LOCAL_DEF_CART_TOPOLOGY:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_cart_topology( reader );
 
         case OTF2_LOCAL_DEF_CART_COORDINATE:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_cart_coordinate( reader );
 
         case OTF2_LOCAL_DEF_SOURCE_CODE_LOCATION:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_source_code_location( reader );
 
         case OTF2_LOCAL_DEF_CALLING_CONTEXT:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_calling_context( reader );
 
         case OTF2_LOCAL_DEF_CALLING_CONTEXT_PROPERTY:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_calling_context_property( reader );
 
         case OTF2_LOCAL_DEF_INTERRUPT_GENERATOR:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
             return otf2_def_reader_read_interrupt_generator( reader );
 
         default:
@@ -2478,6 +2653,23 @@ OTF2_DefReaderCallbacks_SetClockOffsetCallback(
 }
 
 
+OTF2_ErrorCode
+OTF2_DefReaderCallbacks_SetEventTimeRangeCallback(
+    OTF2_DefReaderCallbacks*            defReaderCallbacks,
+    OTF2_DefReaderCallback_EventTimeRange eventTimeRangeCallback )
+{
+    if ( !defReaderCallbacks )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid defReaderCallbacks argument!" );
+    }
+
+    defReaderCallbacks->event_time_range = eventTimeRangeCallback;
+
+    return OTF2_SUCCESS;
+}
+
+
 OTF2_ErrorCode
 OTF2_DefReaderCallbacks_SetStringCallback(
     OTF2_DefReaderCallbacks*            defReaderCallbacks,
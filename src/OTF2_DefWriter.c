@@ -57,6 +57,7 @@
 #include "otf2_file_types.h"
 #include "otf2_reader.h"
 #include "otf2_archive.h"
+#include "otf2_archive_location.h"
 
 #include "otf2_attic_types.h"
 #include "otf2_attic.h"
@@ -227,9 +228,35 @@ otf2_def_writer_delete( OTF2_DefWriter* writerHandle )
                             "Writer deletion failed!" );
     }
 
+    /* Store the offsets of the built-in clock. */
+    OTF2_ErrorCode ret = otf2_archive_write_clock_offsets( writerHandle->archive,
+                                                           writerHandle );
+    if ( ret != OTF2_SUCCESS )
+    {
+        UTILS_ERROR( ret, "Writing the clock offsets failed!" );
+    }
+
+    /* Store the event time range recorded by the event writer. */
+    uint64_t first_timestamp;
+    uint64_t last_timestamp;
+    if ( !writerHandle->event_time_range_written
+         && otf2_archive_location_get_event_time_range( writerHandle->archive,
+                                                        writerHandle->location_id,
+                                                        &first_timestamp,
+                                                        &last_timestamp ) )
+    {
+        ret = OTF2_DefWriter_WriteEventTimeRange( writerHandle,
+                                                  first_timestamp,
+                                                  last_timestamp );
+        if ( ret != OTF2_SUCCESS )
+        {
+            UTILS_ERROR( ret, "Writing the event time range failed!" );
+        }
+    }
+
     OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_BUFFER_END_OF_FILE );
 
-    OTF2_ErrorCode ret = OTF2_Buffer_Delete( writerHandle->buffer );
+    ret = OTF2_Buffer_Delete( writerHandle->buffer );
     if ( ret != OTF2_SUCCESS )
     {
         return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
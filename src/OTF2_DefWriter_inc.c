@@ -165,6 +165,67 @@ double standardDeviation )
 }
 
 
+OTF2_ErrorCode
+OTF2_DefWriter_WriteEventTimeRange( OTF2_DefWriter* writerHandle ,
+OTF2_TimeStamp firstTimestamp,
+OTF2_TimeStamp lastTimestamp )
+{
+    if ( !writerHandle )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid writerHandle argument." );
+    }
+
+    OTF2_ErrorCode ret;
+
+    /*
+     * Maximum memory usage of pure record data (excluding type ID
+     * and record length information).
+     */
+    uint64_t record_data_length = 0;
+    /*
+     * Maximum record length is the record id byte, plus the individual sizes of the
+     * attributes.
+     */
+    uint64_t record_length = 1;
+
+    record_data_length += otf2_buffer_size_timestamp( firstTimestamp );
+    record_data_length += otf2_buffer_size_timestamp( lastTimestamp );
+    /* Finalize the upper bound of the record. */
+    record_length += record_data_length;
+
+    /*
+     * Additional byte to store real record length. Due to on-line compression
+     * real record length can differ from maximum record length.
+     */
+    record_length += 1;
+    if ( record_data_length >= UINT8_MAX )
+    {
+        record_length += 8;
+    }
+
+    ret = OTF2_Buffer_WriteMemoryRequest( writerHandle->buffer, record_length );
+    if ( OTF2_SUCCESS != ret )
+    {
+        return ret;
+    }
+
+    /* Supersedes the range recorded by the event writer. */
+    writerHandle->event_time_range_written = true;
+
+    OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_LOCAL_DEF_EVENT_TIME_RANGE );
+
+    /* Write initial record length */
+    OTF2_Buffer_WriteInitialRecordLength( writerHandle->buffer, record_data_length );
+
+    OTF2_Buffer_WriteUint64Full( writerHandle->buffer, firstTimestamp );
+    OTF2_Buffer_WriteUint64Full( writerHandle->buffer, lastTimestamp );
+
+    /* Write real record length */
+    return OTF2_Buffer_WriteFinalRecordLength( writerHandle->buffer, record_data_length );
+}
+
+
 OTF2_ErrorCode
 OTF2_DefWriter_WriteString( OTF2_DefWriter* writerHandle ,
 OTF2_StringRef self,
@@ -526,7 +526,9 @@ OTF2_EventSizeEstimator_GetSizeOfAttributeList( const OTF2_EventSizeEstimator* e
         return 0;
     }
 
-    if ( NULL == attributeList || 0 == attributeList->capacity )
+    if ( NULL == attributeList
+         || OTF2_SUCCESS != otf2_attribute_list_decode( attributeList )
+         || 0 == attributeList->capacity )
     {
         return 0;
     }
@@ -541,12 +543,14 @@ OTF2_EventSizeEstimator_GetSizeOfAttributeList( const OTF2_EventSizeEstimator* e
         size += 8;
     }
 
-    /* we continue with the number of elements in the list */
-    size += otf2_buffer_size_uint32( attributeList->capacity );
+    /* we continue with the number of elements in the list, and the index
+     * of its shape, if it is written with its shape */
+    size += otf2_buffer_size_uint32( attributeList->capacity ) + 1;
 
     /* now iterate over all entries and consider the attribute definition reference
      * estimate and for the values the respective estimates */
-    for ( const otf2_attribute* attr = attributeList->head; attr; attr = attr->next )
+    const otf2_attribute* end = attributeList->entries + attributeList->capacity;
+    for ( const otf2_attribute* attr = attributeList->entries; attr < end; attr++ )
     {
         /* The attribute reference */
         size += estimator->estimate_for_attributes;
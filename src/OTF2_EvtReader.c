@@ -91,10 +91,42 @@ otf2_evt_reader_skip_record( OTF2_EvtReader* reader );
 static inline OTF2_ErrorCode
 otf2_evt_reader_skip_compressed( OTF2_EvtReader* reader );
 
+static OTF2_ErrorCode
+otf2_evt_reader_get_implicit_region( OTF2_EvtReader* reader,
+                                     OTF2_RegionRef* region );
+
+static OTF2_ErrorCode
+otf2_evt_reader_read_shaped_attribute_list( OTF2_EvtReader* reader,
+                                            uint8_t         recordType );
+
+static OTF2_ErrorCode
+otf2_evt_reader_read_metric_delta( OTF2_EvtReader* reader,
+                                   OTF2_Metric*    record );
+
+static OTF2_ErrorCode
+otf2_evt_reader_remember_metric( OTF2_EvtReader*    reader,
+                                 const OTF2_Metric* record );
+
+static OTF2_ErrorCode
+otf2_evt_reader_skip_sample_delta( OTF2_EvtReader* reader );
+
+static OTF2_ErrorCode
+otf2_evt_reader_read_calling_context_sample_delta( OTF2_EvtReader*            reader,
+                                                   OTF2_CallingContextSample* record );
+
+static OTF2_ErrorCode
+otf2_evt_reader_remember_sample( OTF2_EvtReader* reader,
+                                 uint8_t*        recordData,
+                                 uint64_t        position );
+
 static inline uint64_t
 otf2_evt_reader_apply_clock_correction( OTF2_EvtReader* reader,
                                         uint64_t        time );
 
+static uint64_t
+otf2_evt_reader_revert_clock_correction( OTF2_EvtReader* reader,
+                                         uint64_t        time );
+
 
 /* This _must_ be done for the generated part of the OTF2 local reader */
 #include "OTF2_EvtReader_inc.c"
@@ -215,6 +247,16 @@ otf2_evt_reader_delete( OTF2_EvtReader* reader )
 
     free( reader->position_table );
     free( reader->timestamp_table );
+    free( reader->implicit_leave_table );
+    free( reader->region_stack );
+    free( reader->attribute_shapes );
+    for ( uint32_t i = 0; i < reader->number_of_metrics; i++ )
+    {
+        free( reader->metrics[ i ].type_ids );
+        free( reader->metrics[ i ].values );
+        free( reader->metrics[ i ].deltas );
+    }
+    free( reader->metrics );
 
     /* Delete the object itself */
     free( reader );
@@ -223,6 +265,16 @@ otf2_evt_reader_delete( OTF2_EvtReader* reader )
 }
 
 
+/** @internal
+ *  @brief Open the event file of the reader, if not already done.
+ *
+ *  Creating a reader does not touch the event file, this is deferred until
+ *  the events of the location are accessed for the first time.
+ *
+ *  @param reader         Reader object.
+ *
+ *  @return OTF2_ErrorCode with !=OTF2_SUCCESS if there was an error.
+ */
 OTF2_ErrorCode
 otf2_evt_reader_open_file( OTF2_EvtReader* reader )
 {
@@ -232,7 +284,181 @@ otf2_evt_reader_open_file( OTF2_EvtReader* reader )
                             "Reader object is not valid!" );
     }
 
-    return otf2_buffer_open_file( reader->buffer );
+    if ( reader->file_opened )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    OTF2_ErrorCode status = otf2_buffer_open_file( reader->buffer );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status, "Could not open event file of location %" PRIu64 "!",
+                            reader->location_id );
+    }
+    reader->file_opened = true;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @internal
+ *  @brief Get the clock corrected timestamps of the first and last event,
+ *         without accessing the event file.
+ *
+ *  This is only possible if the local definitions of the location were read
+ *  and contained an EventTimeRange definition.
+ *
+ *  @param reader         Reader object.
+ *  @param firstTime      Returned timestamp of the first event.
+ *  @param lastTime       Returned timestamp of the last event.
+ *
+ *  @return True, if the timestamps are known.
+ */
+bool
+otf2_evt_reader_get_time_range( OTF2_EvtReader* reader,
+                                OTF2_TimeStamp* firstTime,
+                                OTF2_TimeStamp* lastTime )
+{
+    UTILS_ASSERT( reader );
+    UTILS_ASSERT( firstTime );
+    UTILS_ASSERT( lastTime );
+
+    otf2_archive_location* archive_location;
+    otf2_archive_get_location( reader->archive,
+                               reader->archive_location_index,
+                               &archive_location );
+    if ( !archive_location->has_event_time_range )
+    {
+        return false;
+    }
+
+    /* Keep the current clock interval, the correction searches only forward. */
+    otf2_clock_interval* current_clock_interval = reader->current_clock_interval;
+    reader->current_clock_interval = NULL;
+
+    *firstTime = otf2_evt_reader_apply_clock_correction( reader,
+                                                         archive_location->first_timestamp );
+    *lastTime = otf2_evt_reader_apply_clock_correction( reader,
+                                                        archive_location->last_timestamp );
+
+    reader->current_clock_interval = current_clock_interval;
+
+    return true;
+}
+
+
+/** @brief Jump to an indexed event of the current chunk.
+ *
+ *  Uses the event index of the chunk to skip the events in front of the entry
+ *  @a entry. The reader must be positioned at the begin of the chunk.
+ *
+ *  @param reader  Reader object.
+ *  @param entry   Number of index entries to skip, 0 does nothing.
+ */
+static void
+otf2_evt_reader_jump( OTF2_EvtReader* reader,
+                      uint32_t        entry )
+{
+    if ( entry == 0 )
+    {
+        return;
+    }
+
+    uint32_t       interval;
+    uint32_t       entries;
+    uint8_t*       position;
+    OTF2_TimeStamp time;
+    OTF2_Buffer_ReadGetChunkIndex( reader->buffer, &interval, &entries );
+    OTF2_Buffer_ReadGetChunkIndexEntry( reader->buffer, entry - 1, &position, &time );
+    OTF2_Buffer_SetPosition( reader->buffer, position );
+
+    reader->chunk_local_event_position = ( uint64_t )entry * interval;
+    reader->global_event_position      = reader->buffer->chunk->first_event - 1
+                                         + reader->chunk_local_event_position;
+}
+
+
+/** @internal
+ *  @brief Position the reader at the start of the latest chunk, which starts
+ *         not after the given clock corrected time.
+ *
+ *  The reader is positioned at the first event, if all chunks start later.
+ *  The caller needs to skip the remaining events before @a time. For
+ *  compressed traces, which can't seek, this is only possible as long as no
+ *  event was read.
+ *
+ *  @param reader         Reader object.
+ *  @param time           Clock corrected timestamp.
+ *
+ *  @return OTF2_ErrorCode with !=OTF2_SUCCESS if there was an error.
+ */
+OTF2_ErrorCode
+otf2_evt_reader_seek_time( OTF2_EvtReader* reader,
+                           OTF2_TimeStamp  time )
+{
+    UTILS_ASSERT( reader );
+
+    OTF2_ErrorCode status = otf2_evt_reader_open_file( reader );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
+    if ( reader->archive->compression == OTF2_COMPRESSION_ZLIB )
+    {
+        if ( reader->global_event_position != 0 )
+        {
+            return UTILS_ERROR( OTF2_ERROR_FILE_INTERACTION,
+                                "Can't seek backwards in compressed trace files!" );
+        }
+        return OTF2_SUCCESS;
+    }
+
+    free( reader->position_table );
+    reader->position_table = NULL;
+    free( reader->timestamp_table );
+    reader->timestamp_table = NULL;
+
+    /* The undefined timestamp denotes the end of the trace. */
+    OTF2_TimeStamp raw_time = time == OTF2_UNDEFINED_TIMESTAMP
+                              ? time
+                              : otf2_evt_reader_revert_clock_correction( reader, time );
+    bool found;
+    status = OTF2_Buffer_ReadSeekChunkTime( reader->buffer, raw_time, &found );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status, "Can't seek to time %" PRIu64, time );
+    }
+
+    reader->global_event_position      = reader->buffer->chunk->first_event - 1;
+    reader->chunk_local_event_position = 0;
+    reader->current_clock_interval     = NULL;
+
+    /* Search the last indexed event before the time, all events in front of
+     * it are before the time, too. */
+    uint32_t interval;
+    uint32_t entries;
+    OTF2_Buffer_ReadGetChunkIndex( reader->buffer, &interval, &entries );
+    uint32_t lower = 0;
+    uint32_t upper = entries;
+    while ( lower < upper )
+    {
+        uint32_t       middle = lower + ( upper - lower ) / 2;
+        uint8_t*       position;
+        OTF2_TimeStamp entry_time;
+        OTF2_Buffer_ReadGetChunkIndexEntry( reader->buffer, middle, &position, &entry_time );
+        if ( entry_time < raw_time )
+        {
+            lower = middle + 1;
+        }
+        else
+        {
+            upper = middle;
+        }
+    }
+    otf2_evt_reader_jump( reader, lower );
+
+    return OTF2_SUCCESS;
 }
 
 
@@ -258,6 +484,34 @@ otf2_evt_reader_operated_by_global_reader( OTF2_EvtReader* reader )
 }
 
 
+/** @internal
+ *  @brief Release the chunk memory of a local event reader.
+ *
+ *  The chunk is transparently re-read by the next read call of the global
+ *  event reader. The position tables hold offsets into the chunk and stay
+ *  valid.
+ *
+ *  @param reader           Local event reader handle.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_evt_reader_release_chunks( OTF2_EvtReader* reader )
+{
+    UTILS_ASSERT( reader );
+
+    /* The attribute list of a queued event still points into the chunk. */
+    OTF2_ErrorCode status = otf2_attribute_list_decode( &reader->attribute_list );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
+    return OTF2_Buffer_ReadReleaseChunks( reader->buffer );
+}
+
+
 OTF2_ErrorCode
 OTF2_EvtReader_GetLocationID( const OTF2_EvtReader* reader,
                               OTF2_LocationRef*     location )
@@ -351,12 +605,25 @@ OTF2_EvtReader_Seek( OTF2_EvtReader* reader,
                             "No valid reader object!" );
     }
 
+    OTF2_ErrorCode status = otf2_evt_reader_open_file( reader );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
+    /* Seeking may replace the chunk the current attribute list points into. */
+    status = otf2_attribute_list_decode( &reader->attribute_list );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
     free( reader->position_table );
     reader->position_table = NULL;
     free( reader->timestamp_table );
     reader->timestamp_table = NULL;
 
-    OTF2_ErrorCode status = OTF2_Buffer_ReadSeekChunk( reader->buffer, position );
+    status = OTF2_Buffer_ReadSeekChunk( reader->buffer, position );
     if ( OTF2_SUCCESS != status )
     {
         return UTILS_ERROR( status, "Can't seek to event position %" PRIu64,
@@ -367,6 +634,16 @@ OTF2_EvtReader_Seek( OTF2_EvtReader* reader,
     reader->global_event_position      = reader->buffer->chunk->first_event - 1;
     reader->chunk_local_event_position = 0;
 
+    /* use the event index of the chunk to get close to the position */
+    uint32_t interval;
+    uint32_t entries;
+    OTF2_Buffer_ReadGetChunkIndex( reader->buffer, &interval, &entries );
+    if ( interval > 0 && position > reader->buffer->chunk->first_event )
+    {
+        uint64_t entry = ( position - reader->buffer->chunk->first_event ) / interval;
+        otf2_evt_reader_jump( reader, entry < entries ? entry : entries );
+    }
+
     /* skip to requested position */
     while ( reader->global_event_position + 1 < position )
     {
@@ -391,21 +668,32 @@ OTF2_EvtReader_Seek( OTF2_EvtReader* reader,
  *         is afterwards used to be able to step backward in an compressed
  *         buffer.
  *
+ *  If the chunk has an event index, the table covers only the events between
+ *  the two index entries around @a eventIndex.
+ *
  *  @param reader         Reader object which reads the events from its
  *                        buffer.
+ *  @param eventIndex     Chunk local event which needs to be in the table.
  *
  *  @return OTF2_ErrorCode with !=OTF2_SUCCESS if there was an error.
  */
 static OTF2_ErrorCode
-otf2_evt_reader_index( OTF2_EvtReader* reader )
+otf2_evt_reader_index( OTF2_EvtReader* reader,
+                       uint64_t        eventIndex )
 {
     OTF2_ErrorCode ret = OTF2_SUCCESS;
 
     /* Skip if there is already an index available */
-    if ( reader->position_table != NULL )
+    if ( reader->position_table != NULL &&
+         eventIndex >= reader->index_first &&
+         eventIndex < reader->index_end )
     {
         return OTF2_SUCCESS;
     }
+    free( reader->position_table );
+    reader->position_table = NULL;
+    free( reader->timestamp_table );
+    reader->timestamp_table = NULL;
 
     /* Save the current reading position. This is needed to return
      | to the current reading position after indexing has finnished.
@@ -421,17 +709,49 @@ otf2_evt_reader_index( OTF2_EvtReader* reader )
         return UTILS_ERROR( ret, "Event number retrieval failed!" );
     }
 
-    uint64_t number_of_elements = ( last_event - first_event ) + 1;
+    uint8_t* chunk_begin;
+    OTF2_Buffer_GetBeginOfChunk( reader->buffer, &chunk_begin );
+    uint8_t* begin_position = chunk_begin;
+
+    uint64_t number_of_events = ( last_event - first_event ) + 1;
+    reader->index_first = 0;
+    reader->index_end   = number_of_events;
+
+    uint32_t interval;
+    uint32_t entries;
+    OTF2_Buffer_ReadGetChunkIndex( reader->buffer, &interval, &entries );
+    if ( interval > 0 )
+    {
+        uint64_t entry = eventIndex / interval;
+        if ( entry > entries )
+        {
+            entry = entries;
+        }
+        reader->index_first = entry * interval;
+        if ( entry < entries )
+        {
+            reader->index_end = reader->index_first + interval;
+        }
+        if ( entry > 0 )
+        {
+            OTF2_TimeStamp time;
+            OTF2_Buffer_ReadGetChunkIndexEntry( reader->buffer, entry - 1,
+                                                &begin_position, &time );
+        }
+    }
+
+    /* One more for the end of the covered events. */
+    uint64_t number_of_elements = ( reader->index_end - reader->index_first ) + 1;
 
     /* Allocate an index position table */
-    reader->position_table = malloc( number_of_elements * sizeof( uint8_t* ) );
+    reader->position_table = malloc( number_of_elements * sizeof( *reader->position_table ) );
     if ( !reader->position_table )
     {
         return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
                             "Memory allocation failed!" );
     }
 
-    reader->timestamp_table = malloc( number_of_elements * sizeof( uint8_t* ) );
+    reader->timestamp_table = malloc( number_of_elements * sizeof( *reader->timestamp_table ) );
     if ( !reader->timestamp_table )
     {
         free( reader->position_table );
@@ -440,24 +760,33 @@ otf2_evt_reader_index( OTF2_EvtReader* reader )
                             "Memory allocation failed!" );
     }
 
-    /* Set the current position to the begin of the chunk and collect
-     | some information about the data which is stored in the new chunk.
+    /* Set the current position to the begin of the covered events and
+     | collect some information about the data which is stored in the chunk.
      | Skip the records (equals not performing the decompression),
      | and save their position into the table
      */
-    uint8_t* position;
-    OTF2_Buffer_GetBeginOfChunk( reader->buffer, &position );
-    OTF2_Buffer_SetPosition( reader->buffer, position );
+    OTF2_Buffer_SetPosition( reader->buffer, begin_position );
     uint64_t element_index = 0;
 
     do
     {
-        OTF2_Buffer_GetPosition( reader->buffer,
-                                 &reader->position_table[ element_index ] );
-        OTF2_Buffer_GetPositionTimeStamp( reader->buffer,
-                                          &reader->timestamp_table[ element_index ] );
+        uint8_t* position;
+        uint8_t* timestamp_position;
+        OTF2_Buffer_GetPosition( reader->buffer, &position );
+        OTF2_Buffer_GetPositionTimeStamp( reader->buffer, &timestamp_position );
+        reader->position_table[ element_index ] = position - chunk_begin;
+        /* The timestamp of the first event is read by itself. */
+        reader->timestamp_table[ element_index ] =
+            element_index > 0 ? timestamp_position - chunk_begin : 0;
         element_index++;
 
+        if ( element_index == number_of_elements &&
+             reader->index_end < number_of_events )
+        {
+            /* the next index entry starts here */
+            break;
+        }
+
         ret = otf2_evt_reader_skip( reader );
         if ( ret == OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
         {
@@ -465,7 +794,12 @@ otf2_evt_reader_index( OTF2_EvtReader* reader )
             ret = OTF2_SUCCESS;
             break;
         }
-        else
+        else if ( ret == OTF2_SUCCESS && element_index == number_of_elements )
+        {
+            /* more events than announced in the chunk header */
+            ret = OTF2_ERROR_INTEGRITY_FAULT;
+        }
+        if ( ret != OTF2_SUCCESS )
         {
             free( reader->position_table );
             reader->position_table = NULL;
@@ -493,8 +827,14 @@ OTF2_EvtReader_ReadEvents( OTF2_EvtReader* reader,
                             "No valid reader object!" );
     }
 
-    OTF2_ErrorCode ret = OTF2_SUCCESS;
-    uint64_t       read;
+    OTF2_ErrorCode ret = otf2_evt_reader_open_file( reader );
+    if ( ret != OTF2_SUCCESS )
+    {
+        *recordsRead = 0;
+        return ret;
+    }
+
+    uint64_t read;
     for ( read = 0; read < recordsToRead; read++ )
     {
         ret = otf2_evt_reader_read( reader );
@@ -526,36 +866,38 @@ OTF2_EvtReader_ReadEvents( OTF2_EvtReader* reader,
  *
  *  @param reader   Reader object which reads the events from its
  *                  buffer.
- *  @param record   Generic event handle. Please pass a NULL here,
- *                  if you use this interface directly.
- *  @param type     Return the type of the read event.
  *
- *  @return OTF2_ErrorCode with !=OTF2_SUCCESS if there was an error.
+ *  @return OTF2_ErrorCode with !=OTF2_SUCCESS if there was an error,
+ *          OTF2_ERROR_INDEX_OUT_OF_BOUNDS at the begin of the trace.
  */
-static OTF2_ErrorCode
+OTF2_ErrorCode
 otf2_evt_reader_read_backward( OTF2_EvtReader* reader )
 {
     UTILS_ASSERT( reader );
 
     OTF2_ErrorCode ret = OTF2_SUCCESS;
     uint64_t       first_event;
+    uint64_t       last_event;
 
     /* If the new position is in the previous chunk, the new chunk has to be loaded */
     if ( reader->chunk_local_event_position == 0 )
     {
+        if ( reader->buffer->chunk->chunk_num == 1 )
+        {
+            return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+        }
+
         ret = OTF2_Buffer_ReadGetPreviousChunk( reader->buffer );
         if ( ret != OTF2_SUCCESS )
         {
             return UTILS_ERROR( ret, "Can't step back!" );
         }
 
-        /* Get the correct chunk local position */
+        /* Continue after the last event of this chunk */
         OTF2_Buffer_GetNumberEvents( reader->buffer,
                                      &first_event,
-                                     &reader->chunk_local_event_position );
-
-        reader->chunk_local_event_position =
-            reader->chunk_local_event_position - first_event;
+                                     &last_event );
+        reader->chunk_local_event_position = last_event - first_event + 1;
 
         /* Clear the index tables */
         free( reader->position_table );
@@ -566,88 +908,51 @@ otf2_evt_reader_read_backward( OTF2_EvtReader* reader )
     }
 
     /* The index is needed (function skips indexing if there is already an index) */
-    ret = otf2_evt_reader_index( reader );
+    uint64_t event_index = reader->chunk_local_event_position - 1;
+    ret                  = otf2_evt_reader_index( reader, event_index );
     if ( ret != OTF2_SUCCESS )
     {
         return UTILS_ERROR( ret, "Unable to get index!" );
     }
 
-    uint8_t*       act_pos = NULL; /** @review  only used in branch, declare there */
-    OTF2_EventType record_type;
-    /* Find out if the record has a attribute list
-     | (used a codeblock to make indention possible against
-     | the code uglyfier)
-     */
+    /* Position the buffer at the previous event, the first event of a chunk
+     * and each indexed event have always their own timestamp. The read
+     * advances the positions again. */
+    uint64_t table_index = event_index - reader->index_first;
+    reader->chunk_local_event_position--;
+    reader->global_event_position--;
+
+    uint8_t* chunk_begin;
+    OTF2_Buffer_GetBeginOfChunk( reader->buffer, &chunk_begin );
+    OTF2_Buffer_SetPosition( reader->buffer,
+                             chunk_begin + reader->position_table[ table_index ] );
+    if ( table_index > 0 )
     {
-        /** @review Please check error codes of following functions */
-        /* Get the actual position to be able to restore afterwards */
-        OTF2_Buffer_GetPosition( reader->buffer, &act_pos );
-
-        /* Set the position to two records behind
-         | (first position = record, second position = attribute list )
-         */
-        OTF2_Buffer_SetPosition( reader->buffer,
-                                 reader->position_table[ reader->chunk_local_event_position - 2 ] );
-
-        /* Read the type field */
-        OTF2_Buffer_ReadUint8( reader->buffer, &record_type );
-
-        /* Reset the position to the previous */
-        OTF2_Buffer_SetPosition( reader->buffer, act_pos );
+        OTF2_Buffer_SetPositionTimeStamp( reader->buffer,
+                                          chunk_begin + reader->timestamp_table[ table_index ] );
     }
 
+    ret = otf2_evt_reader_read( reader );
 
-    uint64_t diff_pos = 0;
-    if ( record_type == OTF2_ATTRIBUTE_LIST )
+    /* Move the position before the read event again, the read may have
+     * re-loaded the chunk. */
+    reader->chunk_local_event_position = event_index;
+    reader->global_event_position--;
+    OTF2_Buffer_GetBeginOfChunk( reader->buffer, &chunk_begin );
+    OTF2_Buffer_SetPosition( reader->buffer,
+                             chunk_begin + reader->position_table[ table_index ] );
+    if ( table_index > 0 )
     {
-        diff_pos = 2;
+        OTF2_Buffer_SetPositionTimeStamp( reader->buffer,
+                                          chunk_begin + reader->timestamp_table[ table_index ] );
     }
-    else
-    {
-        diff_pos = 1;
-    }
-
-    reader->chunk_local_event_position = reader->chunk_local_event_position - diff_pos;
-    reader->global_event_position      = reader->global_event_position - diff_pos;
 
-    OTF2_Buffer_SetPosition
-        ( reader->buffer, reader->position_table[ reader->chunk_local_event_position ] );
-
-    OTF2_Buffer_SetPositionTimeStamp( reader->buffer,
-                                      reader->timestamp_table[ reader->chunk_local_event_position ] );
-
-    ret = otf2_evt_reader_read( reader );
-    if ( ret != OTF2_SUCCESS )
+    if ( ret != OTF2_SUCCESS && ret != OTF2_ERROR_INTERRUPTED_BY_CALLBACK )
     {
-        if ( ret == OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
-        {
-            return OTF2_SUCCESS;
-        }
-        if ( ret == OTF2_ERROR_INTERRUPTED_BY_CALLBACK )
-        {
-            return ret;
-        }
         return UTILS_ERROR( ret, "Error when reading record!" );
     }
-    if ( record_type == OTF2_ATTRIBUTE_LIST )
-    {
-        ret = otf2_evt_reader_read( reader );
-        if ( ret != OTF2_SUCCESS )
-        {
-            if ( ret == OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
-            {
-                return OTF2_SUCCESS;
-            }
-            if ( ret == OTF2_ERROR_INTERRUPTED_BY_CALLBACK )
-            {
-                return ret;
-            }
-            return UTILS_ERROR( ret, "Error when reading record!" );
-        }
-    }
 
-    return OTF2_Buffer_SetPosition( reader->buffer,
-                                    reader->position_table[ reader->chunk_local_event_position ] );
+    return ret;
 }
 
 
@@ -662,13 +967,29 @@ OTF2_EvtReader_ReadEventsBackward( OTF2_EvtReader* reader,
                             "No valid reader object!" );
     }
 
-    OTF2_ErrorCode ret = OTF2_SUCCESS;
-    uint64_t       read;
+    OTF2_ErrorCode ret = otf2_evt_reader_open_file( reader );
+    if ( ret != OTF2_SUCCESS )
+    {
+        *recordsRead = 0;
+        return ret;
+    }
+
+    uint64_t read;
     for ( read = 0; read < recordsToRead; read++ )
     {
         ret = otf2_evt_reader_read_backward( reader );
         if ( ret != OTF2_SUCCESS )
         {
+            if ( ret == OTF2_ERROR_INTERRUPTED_BY_CALLBACK )
+            {
+                /* We still delivered a record, count it */
+                read++;
+            }
+            /* This is the begin of file, which is not an error. */
+            else if ( ret == OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
+            {
+                ret = OTF2_SUCCESS;
+            }
             break;
         }
     }
@@ -688,6 +1009,12 @@ OTF2_EvtReader_TimeStampRewrite( OTF2_EvtReader* reader,
                             "No valid reader object!" );
     }
 
+    OTF2_ErrorCode status = otf2_evt_reader_open_file( reader );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
     return OTF2_Buffer_RewriteTimeStamp( reader->buffer, time );
 }
 
@@ -900,8 +1227,10 @@ otf2_evt_reader_apply_clock_correction( OTF2_EvtReader* reader,
         return time;
     }
 
-    /* Initialize to the first clock offsets at first use. */
-    if ( !reader->current_clock_interval )
+    /* Initialize to the first clock offsets at first use, or if reading
+     * went backwards. */
+    if ( !reader->current_clock_interval
+         || time < reader->current_clock_interval->interval_begin )
     {
         otf2_archive_location* archive_location;
         otf2_archive_get_location( reader->archive,
@@ -945,41 +1274,129 @@ otf2_evt_reader_apply_clock_correction( OTF2_EvtReader* reader,
 }
 
 
-OTF2_ErrorCode
-otf2_evt_reader_skip( OTF2_EvtReader* reader )
+/** @brief Computes a local timestamp, which is not later than the local
+ *         timestamp which maps to @a time after clock correction.
+ *
+ *  Does not change the current clock interval of the reader.
+ */
+uint64_t
+otf2_evt_reader_revert_clock_correction( OTF2_EvtReader* reader,
+                                         uint64_t        time )
 {
     UTILS_ASSERT( reader );
 
-    OTF2_ErrorCode status;
-
-    OTF2_TimeStamp time;
-    status = OTF2_Buffer_ReadTimeStamp( reader->buffer, &time );
-    if ( status != OTF2_SUCCESS )
+    if ( !reader->operated && !reader->apply_clock_offsets )
     {
-        return status;
+        return time;
     }
 
-    /* Read record type */
-    status = OTF2_Buffer_Guarantee( reader->buffer, 1 );
-    if ( OTF2_SUCCESS != status )
+    otf2_archive_location* archive_location;
+    otf2_archive_get_location( reader->archive,
+                               reader->archive_location_index,
+                               &archive_location );
+
+    /* Search the interval, which contains the corrected time. */
+    otf2_clock_interval* interval = archive_location->clock_intervals;
+    if ( !interval )
     {
-        return UTILS_ERROR( status, "Could not read record type." );
+        return time;
     }
-    uint8_t record_type;
-    OTF2_Buffer_ReadUint8( reader->buffer, &record_type );
-
-    switch ( record_type )
+    while ( interval->next )
     {
-        case OTF2_BUFFER_END_OF_CHUNK:
-            return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+        double end = interval->interval_end + interval->slope
+                     * ( ( double )interval->interval_end - ( double )interval->interval_begin )
+                     + interval->offset;
+        if ( ( double )time <= end )
+        {
+            break;
+        }
+        interval = interval->next;
+    }
+
+    /* Invert the linear interpolation, rounding errors are covered by one
+     * tick less. */
+    double result = ( ( double )time - interval->offset
+                      + interval->slope * ( double )interval->interval_begin )
+                    / ( 1.0 + interval->slope );
+    if ( result < 1.0 )
+    {
+        return 0;
+    }
+    return ( uint64_t )floor( result ) - 1;
+}
+
+
+/** @brief Read the type of the next event record, skipping its timestamp
+ *         and attribute list.
+ *
+ *  @param reader           Reference to the reader object
+ *  @param[out] recordType  Type of the event record.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_skip_to_record_type( OTF2_EvtReader* reader,
+                                     uint8_t*        recordType )
+{
+    OTF2_ErrorCode status;
 
-        case OTF2_ATTRIBUTE_LIST:
+    /* Skip attribute lists until the event record follows. */
+    bool attribute_list;
+    do
+    {
+        OTF2_TimeStamp time;
+        status = OTF2_Buffer_ReadTimeStamp( reader->buffer, &time );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+
+        /* Read record type */
+        status = OTF2_Buffer_Guarantee( reader->buffer, 1 );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status, "Could not read record type." );
+        }
+        OTF2_Buffer_ReadUint8( reader->buffer, recordType );
+
+        attribute_list = *recordType == OTF2_ATTRIBUTE_LIST ||
+                         *recordType == OTF2_BUFFER_ATTRIBUTE_LIST_DEFINE ||
+                         *recordType == OTF2_BUFFER_ATTRIBUTE_LIST_REFERENCE;
+        if ( attribute_list )
+        {
             status = otf2_evt_reader_skip_record( reader );
             if ( status != OTF2_SUCCESS )
             {
                 return UTILS_ERROR( status, "Read of additional attributes failed!" );
             }
-            return otf2_evt_reader_skip( reader );
+        }
+    }
+    while ( attribute_list );
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Skip the payload of an event record, after its type was read.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param recordType   Type of the event record.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_skip_payload( OTF2_EvtReader* reader,
+                              uint8_t         recordType )
+{
+    switch ( recordType )
+    {
+        case OTF2_BUFFER_END_OF_CHUNK:
+        case OTF2_BUFFER_END_OF_FILE:
+            return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+
+        /* Implicit leaves have no payload. */
+        case OTF2_BUFFER_IMPLICIT_LEAVE:
+            return OTF2_SUCCESS;
+
+        /* Calling context sample deltas have no record length. */
+        case OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA:
+            return otf2_evt_reader_skip_sample_delta( reader );
 
         /*
          * Known singlton event records at 1.1, there wont be any after 1.1
@@ -1006,6 +1423,1178 @@ otf2_evt_reader_skip( OTF2_EvtReader* reader )
     }
 }
 
+
+OTF2_ErrorCode
+otf2_evt_reader_skip( OTF2_EvtReader* reader )
+{
+    UTILS_ASSERT( reader );
+
+    uint8_t        record_type;
+    OTF2_ErrorCode status = otf2_evt_reader_skip_to_record_type( reader,
+                                                                 &record_type );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    return otf2_evt_reader_skip_payload( reader, record_type );
+}
+
+
+/** @brief Get the chunk segment of an event.
+ *
+ *  A segment starts at the begin of the chunk or at an entry of the event
+ *  index, and always with its own timestamp.
+ *
+ *  @param reader               Reference to the reader object
+ *  @param eventIndex           Chunk local event in the segment.
+ *  @param[out] segmentFirst    First chunk local event of the segment.
+ *  @param[out] segmentEnd      Chunk local event after the segment.
+ *  @param[out] beginPosition   Position of the first event.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_get_segment( OTF2_EvtReader* reader,
+                             uint64_t        eventIndex,
+                             uint64_t*       segmentFirst,
+                             uint64_t*       segmentEnd,
+                             uint8_t**       beginPosition )
+{
+    OTF2_Buffer*   buffer = reader->buffer;
+    OTF2_ErrorCode ret;
+
+    uint64_t first_event;
+    uint64_t last_event;
+    ret = OTF2_Buffer_GetNumberEvents( buffer, &first_event, &last_event );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( ret, "Event number retrieval failed!" );
+    }
+
+    OTF2_Buffer_GetBeginOfChunk( buffer, beginPosition );
+
+    *segmentFirst = 0;
+    *segmentEnd   = ( last_event - first_event ) + 1;
+
+    uint32_t interval;
+    uint32_t entries;
+    OTF2_Buffer_ReadGetChunkIndex( buffer, &interval, &entries );
+    if ( interval > 0 )
+    {
+        uint64_t entry = eventIndex / interval;
+        if ( entry > entries )
+        {
+            entry = entries;
+        }
+        *segmentFirst = entry * interval;
+        if ( entry < entries )
+        {
+            *segmentEnd = *segmentFirst + interval;
+        }
+        if ( entry > 0 )
+        {
+            OTF2_TimeStamp time;
+            OTF2_Buffer_ReadGetChunkIndexEntry( buffer, entry - 1,
+                                                beginPosition, &time );
+        }
+    }
+    if ( eventIndex < *segmentFirst || eventIndex >= *segmentEnd )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Event not covered by its chunk." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Collect the regions of the implicit leaves in a chunk segment.
+ *
+ *  The enter and leave events of the segment are replayed from its start,
+ *  an implicit leave leaves the innermost region on this stack.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param eventIndex   Chunk local event in the segment.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_fill_implicit_leave_table( OTF2_EvtReader* reader,
+                                           uint64_t        eventIndex )
+{
+    OTF2_Buffer*   buffer = reader->buffer;
+    OTF2_ErrorCode ret;
+
+    free( reader->implicit_leave_table );
+    reader->implicit_leave_table = NULL;
+
+    uint64_t segment_first;
+    uint64_t segment_end;
+    uint8_t* begin_position;
+    ret = otf2_evt_reader_get_segment( reader, eventIndex,
+                                       &segment_first, &segment_end,
+                                       &begin_position );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return ret;
+    }
+
+    reader->implicit_leave_table =
+        malloc( ( segment_end - segment_first ) * sizeof( *reader->implicit_leave_table ) );
+    if ( !reader->implicit_leave_table )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Memory allocation failed!" );
+    }
+    reader->implicit_leave_chunk = buffer->chunk->chunk_num;
+    reader->implicit_leave_first = segment_first;
+    reader->implicit_leave_end   = segment_end;
+
+    /* Save the reading state, the segment starts always with its own
+     * timestamp. */
+    uint8_t*       read_pos = buffer->read_pos;
+    uint8_t*       time_pos = buffer->time_pos;
+    OTF2_TimeStamp time     = buffer->time;
+    OTF2_Buffer_SetPosition( buffer, begin_position );
+
+    uint32_t depth = 0;
+    for ( uint64_t i = segment_first; i < segment_end; i++ )
+    {
+        uint8_t        record_type;
+        OTF2_RegionRef region;
+        ret = otf2_evt_reader_skip_to_record_type( reader, &record_type );
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+
+        switch ( record_type )
+        {
+            case OTF2_EVENT_ENTER:
+                ret = OTF2_Buffer_GuaranteeCompressed( buffer );
+                if ( ret == OTF2_SUCCESS )
+                {
+                    ret = OTF2_Buffer_ReadUint32( buffer, &region );
+                }
+                if ( ret != OTF2_SUCCESS )
+                {
+                    break;
+                }
+                if ( depth == reader->region_stack_capacity )
+                {
+                    uint32_t        capacity = depth ? 2 * depth : 16;
+                    OTF2_RegionRef* stack    =
+                        realloc( reader->region_stack, capacity * sizeof( *stack ) );
+                    if ( !stack )
+                    {
+                        ret = UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                                           "Memory allocation failed!" );
+                        break;
+                    }
+                    reader->region_stack          = stack;
+                    reader->region_stack_capacity = capacity;
+                }
+                reader->region_stack[ depth++ ] = region;
+                break;
+
+            case OTF2_EVENT_LEAVE:
+                ret = OTF2_Buffer_GuaranteeCompressed( buffer );
+                if ( ret == OTF2_SUCCESS )
+                {
+                    ret = OTF2_Buffer_ReadUint32( buffer, &region );
+                }
+                if ( ret == OTF2_SUCCESS && depth > 0 &&
+                     reader->region_stack[ depth - 1 ] == region )
+                {
+                    depth--;
+                }
+                break;
+
+            case OTF2_BUFFER_IMPLICIT_LEAVE:
+                if ( depth == 0 )
+                {
+                    ret = UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                                       "Implicit leave without matching enter." );
+                    break;
+                }
+                reader->implicit_leave_table[ i - segment_first ] =
+                    reader->region_stack[ --depth ];
+                break;
+
+            default:
+                ret = otf2_evt_reader_skip_payload( reader, record_type );
+                break;
+        }
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+    }
+
+    buffer->read_pos = read_pos;
+    buffer->time_pos = time_pos;
+    buffer->time     = time;
+
+    if ( ret == OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
+    {
+        /* end of the chunk */
+        ret = OTF2_SUCCESS;
+    }
+    if ( ret != OTF2_SUCCESS )
+    {
+        free( reader->implicit_leave_table );
+        reader->implicit_leave_table = NULL;
+        return UTILS_ERROR( ret, "Error while scanning through the events." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Get the region of the implicit leave event at the current
+ *         position.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param[out] region  The left region, not yet mapped.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_get_implicit_region( OTF2_EvtReader* reader,
+                                     OTF2_RegionRef* region )
+{
+    uint64_t event_index = reader->chunk_local_event_position;
+
+    if ( !reader->implicit_leave_table ||
+         reader->implicit_leave_chunk != reader->buffer->chunk->chunk_num ||
+         event_index < reader->implicit_leave_first ||
+         event_index >= reader->implicit_leave_end )
+    {
+        OTF2_ErrorCode ret =
+            otf2_evt_reader_fill_implicit_leave_table( reader, event_index );
+        if ( ret != OTF2_SUCCESS )
+        {
+            return ret;
+        }
+    }
+
+    *region = reader->implicit_leave_table[ event_index - reader->implicit_leave_first ];
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Collect the attribute list shapes of the current chunk.
+ *
+ *  Needed when a list references a shape whose definition was not read,
+ *  because the reader was positioned behind it.
+ *
+ *  @param reader       Reference to the reader object
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_collect_attribute_shapes( OTF2_EvtReader* reader )
+{
+    OTF2_Buffer*   buffer = reader->buffer;
+    OTF2_ErrorCode ret;
+
+    /* Save the reading state. */
+    uint8_t*       read_pos = buffer->read_pos;
+    uint8_t*       time_pos = buffer->time_pos;
+    OTF2_TimeStamp time     = buffer->time;
+
+    uint8_t* begin_position;
+    OTF2_Buffer_GetBeginOfChunk( buffer, &begin_position );
+    OTF2_Buffer_SetPosition( buffer, begin_position );
+
+    do
+    {
+        OTF2_TimeStamp record_time;
+        ret = OTF2_Buffer_ReadTimeStamp( buffer, &record_time );
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+
+        ret = OTF2_Buffer_Guarantee( buffer, 1 );
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+        uint8_t record_type;
+        OTF2_Buffer_ReadUint8( buffer, &record_type );
+
+        switch ( record_type )
+        {
+            case OTF2_BUFFER_ATTRIBUTE_LIST_DEFINE:
+                ret = otf2_attribute_list_register_shape_from_buffer( buffer,
+                                                                      reader->attribute_shapes );
+                break;
+
+            case OTF2_ATTRIBUTE_LIST:
+            case OTF2_BUFFER_ATTRIBUTE_LIST_REFERENCE:
+                ret = otf2_evt_reader_skip_record( reader );
+                break;
+
+            default:
+                ret = otf2_evt_reader_skip_payload( reader, record_type );
+                break;
+        }
+    }
+    while ( ret == OTF2_SUCCESS );
+
+    buffer->read_pos = read_pos;
+    buffer->time_pos = time_pos;
+    buffer->time     = time;
+
+    if ( ret != OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
+    {
+        return UTILS_ERROR( ret, "Error while scanning through the events." );
+    }
+    /* end of the chunk */
+    reader->attribute_shapes_complete = true;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Read an attribute list written with its shape.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param recordType   Type of the attribute list record.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_read_shaped_attribute_list( OTF2_EvtReader* reader,
+                                            uint8_t         recordType )
+{
+    OTF2_Buffer* buffer = reader->buffer;
+
+    if ( !reader->attribute_shapes )
+    {
+        reader->attribute_shapes = malloc( sizeof( *reader->attribute_shapes ) );
+        if ( !reader->attribute_shapes )
+        {
+            return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                                "Memory allocation failed!" );
+        }
+        reader->attribute_shapes->chunk = UINT64_MAX;
+    }
+    if ( reader->attribute_shapes->chunk != buffer->chunk->chunk_num )
+    {
+        otf2_attribute_list_shapes_reset( reader->attribute_shapes,
+                                          buffer->chunk->chunk_num );
+        reader->attribute_shapes_complete = false;
+    }
+
+    OTF2_ErrorCode ret =
+        otf2_attribute_list_read_shaped_from_buffer( &reader->attribute_list,
+                                                     buffer,
+                                                     recordType,
+                                                     reader->attribute_shapes,
+                                                     otf2_evt_reader_map,
+                                                     reader );
+    if ( ret == OTF2_ERROR_INVALID_DATA && !reader->attribute_shapes_complete )
+    {
+        ret = otf2_evt_reader_collect_attribute_shapes( reader );
+        if ( ret != OTF2_SUCCESS )
+        {
+            return ret;
+        }
+        ret = otf2_attribute_list_read_shaped_from_buffer( &reader->attribute_list,
+                                                           buffer,
+                                                           recordType,
+                                                           reader->attribute_shapes,
+                                                           otf2_evt_reader_map,
+                                                           reader );
+    }
+    if ( ret == OTF2_ERROR_INVALID_DATA )
+    {
+        return UTILS_ERROR( ret, "Attribute list references an unknown shape." );
+    }
+
+    return ret;
+}
+
+
+/** @brief Get the last read sample of a metric.
+ *
+ *  @param reader   Reference to the reader object
+ *  @param metric   The metric, after mapping.
+ *
+ *  @return The sample, NULL if no memory is left.
+ */
+static otf2_evt_reader_metric*
+otf2_evt_reader_get_metric( OTF2_EvtReader* reader,
+                            OTF2_MetricRef  metric )
+{
+    for ( uint32_t i = 0; i < reader->number_of_metrics; i++ )
+    {
+        if ( reader->metrics[ i ].metric == metric )
+        {
+            return &reader->metrics[ i ];
+        }
+    }
+
+    otf2_evt_reader_metric* metrics =
+        realloc( reader->metrics,
+                 ( reader->number_of_metrics + 1 ) * sizeof( *metrics ) );
+    if ( !metrics )
+    {
+        return NULL;
+    }
+    reader->metrics = metrics;
+
+    otf2_evt_reader_metric* sample = &metrics[ reader->number_of_metrics++ ];
+    memset( sample, 0, sizeof( *sample ) );
+    sample->metric = metric;
+
+    return sample;
+}
+
+
+/** @brief Make room for the values of a sample.
+ *
+ *  @param sample           The sample.
+ *  @param numberOfMetrics  Number of values.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_reserve_metric( otf2_evt_reader_metric* sample,
+                                uint8_t                 numberOfMetrics )
+{
+    if ( sample->capacity >= numberOfMetrics )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    free( sample->type_ids );
+    free( sample->values );
+    free( sample->deltas );
+    sample->capacity = 0;
+    sample->type_ids = malloc( numberOfMetrics * sizeof( *sample->type_ids ) );
+    sample->values   = malloc( numberOfMetrics * sizeof( *sample->values ) );
+    sample->deltas   = malloc( numberOfMetrics * sizeof( *sample->deltas ) );
+    if ( !sample->type_ids || !sample->values || !sample->deltas )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Memory allocation failed!" );
+    }
+    sample->capacity = numberOfMetrics;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Read the deltas of a delta sample.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param sample       The sample the deltas apply to.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_read_metric_deltas( OTF2_EvtReader*         reader,
+                                    otf2_evt_reader_metric* sample )
+{
+    for ( uint8_t i = 0; i < sample->number_of_members; i++ )
+    {
+        OTF2_ErrorCode ret = OTF2_Buffer_ReadUint64( reader->buffer,
+                                                     &sample->deltas[ i ] );
+        if ( ret != OTF2_SUCCESS )
+        {
+            sample->chunk = 0;
+            return UTILS_ERROR( ret, "Could not read metric delta. Invalid compression size." );
+        }
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Apply the deltas of a sample to its values.
+ *
+ *  Integers are stored as zig-zag encoded differences, doubles as the
+ *  changed bits.
+ *
+ *  @param sample   The sample.
+ *  @param forward  Step to the sample of the deltas, or back to the
+ *                  previous one.
+ */
+static void
+otf2_evt_reader_step_metric( otf2_evt_reader_metric* sample,
+                             bool                    forward )
+{
+    for ( uint8_t i = 0; i < sample->number_of_members; i++ )
+    {
+        uint64_t word = sample->deltas[ i ];
+        if ( sample->type_ids[ i ] == OTF2_TYPE_DOUBLE )
+        {
+            sample->values[ i ].unsigned_int ^= word;
+            continue;
+        }
+
+        uint64_t difference = ( word >> 1 ) ^ ( uint64_t )-( int64_t )( word & 1 );
+        if ( forward )
+        {
+            sample->values[ i ].unsigned_int += difference;
+        }
+        else
+        {
+            sample->values[ i ].unsigned_int -= difference;
+        }
+    }
+}
+
+
+/** @brief Read a complete metric sample into @a sample.
+ *
+ *  The buffer is positioned after the metric of the record.
+ *
+ *  @param reader   Reference to the reader object
+ *  @param sample   The sample.
+ *  @param position Chunk local event position of the sample.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_read_metric_sample( OTF2_EvtReader*         reader,
+                                    otf2_evt_reader_metric* sample,
+                                    uint64_t                position )
+{
+    uint8_t number_of_metrics;
+    OTF2_Buffer_ReadUint8( reader->buffer, &number_of_metrics );
+
+    sample->chunk = 0;
+    OTF2_ErrorCode ret = otf2_evt_reader_reserve_metric( sample, number_of_metrics );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return ret;
+    }
+    for ( uint8_t i = 0; i < number_of_metrics; i++ )
+    {
+        OTF2_Buffer_ReadUint8( reader->buffer, &sample->type_ids[ i ] );
+        ret = OTF2_Buffer_ReadMetricValue( reader->buffer, &sample->values[ i ] );
+        if ( ret != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( ret, "Could not read metric value. Invalid compression size." );
+        }
+    }
+    sample->number_of_members = number_of_metrics;
+    sample->chunk             = reader->buffer->chunk->chunk_num;
+    sample->position          = position;
+    sample->distance          = 0;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Replay the samples of a metric in a chunk segment.
+ *
+ *  The samples are replayed from the start of the segment of the current
+ *  event up to the one at @a eventIndex. Delta samples never refer to
+ *  samples in other segments.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param sample       The sample of the metric.
+ *  @param eventIndex   Chunk local event position of the wanted sample.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_scan_metric( OTF2_EvtReader*         reader,
+                             otf2_evt_reader_metric* sample,
+                             uint64_t                eventIndex )
+{
+    OTF2_Buffer*   buffer = reader->buffer;
+    OTF2_ErrorCode ret;
+
+    uint64_t segment_first;
+    uint64_t segment_end;
+    uint8_t* begin_position;
+    ret = otf2_evt_reader_get_segment( reader, reader->chunk_local_event_position,
+                                       &segment_first, &segment_end,
+                                       &begin_position );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return ret;
+    }
+    if ( eventIndex < segment_first )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Metric delta refers to a sample in another segment." );
+    }
+
+    uint8_t*       read_pos = buffer->read_pos;
+    uint8_t*       time_pos = buffer->time_pos;
+    OTF2_TimeStamp time     = buffer->time;
+    OTF2_Buffer_SetPosition( buffer, begin_position );
+
+    sample->chunk = 0;
+    for ( uint64_t i = segment_first; i <= eventIndex; i++ )
+    {
+        uint8_t record_type;
+        ret = otf2_evt_reader_skip_to_record_type( reader, &record_type );
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+        if ( record_type != OTF2_EVENT_METRIC &&
+             record_type != OTF2_BUFFER_METRIC_DELTA )
+        {
+            ret = otf2_evt_reader_skip_payload( reader, record_type );
+            if ( ret != OTF2_SUCCESS )
+            {
+                break;
+            }
+            continue;
+        }
+
+        uint64_t record_data_length;
+        ret = OTF2_Buffer_GuaranteeRecord( buffer, &record_data_length );
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+        uint8_t* record_end_pos;
+        OTF2_Buffer_GetPosition( buffer, &record_end_pos );
+        record_end_pos += record_data_length;
+
+        OTF2_MetricRef metric;
+        ret = OTF2_Buffer_ReadUint32( buffer, &metric );
+        if ( ret == OTF2_SUCCESS &&
+             otf2_evt_reader_map( reader, OTF2_MAPPING_METRIC, metric ) == sample->metric )
+        {
+            if ( record_type == OTF2_EVENT_METRIC )
+            {
+                ret = otf2_evt_reader_read_metric_sample( reader, sample, i );
+            }
+            else
+            {
+                uint64_t distance;
+                ret = OTF2_Buffer_ReadUint64( buffer, &distance );
+                if ( ret == OTF2_SUCCESS &&
+                     ( sample->chunk == 0 || sample->position + distance != i ) )
+                {
+                    ret = UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                                       "Metric delta without previous sample." );
+                }
+                if ( ret == OTF2_SUCCESS )
+                {
+                    ret = otf2_evt_reader_read_metric_deltas( reader, sample );
+                }
+                if ( ret == OTF2_SUCCESS )
+                {
+                    otf2_evt_reader_step_metric( sample, true );
+                    sample->position = i;
+                    sample->distance = distance;
+                }
+            }
+        }
+        if ( ret == OTF2_SUCCESS )
+        {
+            ret = OTF2_Buffer_SetPosition( buffer, record_end_pos );
+        }
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+    }
+
+    buffer->read_pos = read_pos;
+    buffer->time_pos = time_pos;
+    buffer->time     = time;
+
+    if ( ret != OTF2_SUCCESS )
+    {
+        sample->chunk = 0;
+        return UTILS_ERROR( ret, "Error while scanning through the events." );
+    }
+    if ( sample->chunk == 0 || sample->position != eventIndex )
+    {
+        sample->chunk = 0;
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Metric delta without previous sample." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Read a metric sample stored as deltas to the previous sample.
+ *
+ *  The previous sample of the metric is kept from reading forward, the
+ *  following one from reading backward, otherwise the samples are replayed
+ *  from the start of the chunk segment.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param record       The record to fill, its arrays are allocated.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_read_metric_delta( OTF2_EvtReader* reader,
+                                   OTF2_Metric*    record )
+{
+    OTF2_Buffer*   buffer   = reader->buffer;
+    uint64_t       position = reader->chunk_local_event_position;
+    OTF2_ErrorCode ret;
+
+    ret = OTF2_Buffer_ReadUint32( buffer, &record->metric );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( ret, "Could not read metric attribute of Metric record. Invalid compression size." );
+    }
+    record->metric = otf2_evt_reader_map( reader, OTF2_MAPPING_METRIC, record->metric );
+
+    uint64_t distance;
+    ret = OTF2_Buffer_ReadUint64( buffer, &distance );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( ret, "Could not read distance of Metric record. Invalid compression size." );
+    }
+    if ( distance == 0 || distance > position )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Invalid distance of Metric record." );
+    }
+    uint64_t previous = position - distance;
+
+    otf2_evt_reader_metric* sample = otf2_evt_reader_get_metric( reader, record->metric );
+    if ( !sample )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Memory allocation failed!" );
+    }
+
+    bool in_chunk = sample->chunk == buffer->chunk->chunk_num;
+    if ( in_chunk && sample->position == position )
+    {
+        /* Read again, e.g., after seeking. */
+    }
+    else if ( in_chunk && sample->distance > 0 &&
+              sample->position - sample->distance == position )
+    {
+        /* Reading backward, step back from the following sample. */
+        otf2_evt_reader_step_metric( sample, false );
+        ret = otf2_evt_reader_read_metric_deltas( reader, sample );
+        if ( ret != OTF2_SUCCESS )
+        {
+            return ret;
+        }
+    }
+    else
+    {
+        if ( !in_chunk || sample->position != previous )
+        {
+            ret = otf2_evt_reader_scan_metric( reader, sample, previous );
+            if ( ret != OTF2_SUCCESS )
+            {
+                return ret;
+            }
+        }
+        ret = otf2_evt_reader_read_metric_deltas( reader, sample );
+        if ( ret != OTF2_SUCCESS )
+        {
+            return ret;
+        }
+        otf2_evt_reader_step_metric( sample, true );
+    }
+    sample->position = position;
+    sample->distance = distance;
+
+    record->number_of_metrics = sample->number_of_members;
+    record->type_ids          = malloc( sample->number_of_members * sizeof( OTF2_Type ) );
+    record->metric_values     = malloc( sample->number_of_members * sizeof( OTF2_MetricValue ) );
+    if ( !record->type_ids || !record->metric_values )
+    {
+        free( record->type_ids );
+        free( record->metric_values );
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Could not allocate memory for metricValues array!" );
+    }
+    memcpy( record->type_ids, sample->type_ids,
+            sample->number_of_members * sizeof( OTF2_Type ) );
+    memcpy( record->metric_values, sample->values,
+            sample->number_of_members * sizeof( OTF2_MetricValue ) );
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Remember a completely read metric sample, the following delta
+ *         samples apply to it.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param record       The read record.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_remember_metric( OTF2_EvtReader*    reader,
+                                 const OTF2_Metric* record )
+{
+    otf2_evt_reader_metric* sample = otf2_evt_reader_get_metric( reader, record->metric );
+    if ( !sample )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Memory allocation failed!" );
+    }
+
+    sample->chunk = 0;
+    OTF2_ErrorCode ret = otf2_evt_reader_reserve_metric( sample,
+                                                         record->number_of_metrics );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return ret;
+    }
+    memcpy( sample->type_ids, record->type_ids,
+            record->number_of_metrics * sizeof( OTF2_Type ) );
+    memcpy( sample->values, record->metric_values,
+            record->number_of_metrics * sizeof( OTF2_MetricValue ) );
+    sample->number_of_members = record->number_of_metrics;
+    sample->chunk             = reader->buffer->chunk->chunk_num;
+    sample->position          = reader->chunk_local_event_position;
+    sample->distance          = 0;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Read the attributes of a calling context sample delta.
+ *
+ *  Attributes which are not flagged are not changed.
+ *
+ *  @param reader                   Reference to the reader object
+ *  @param[out] distance            Distance in events to the previous sample.
+ *  @param[out] flags               The flagged attributes.
+ *  @param[out] difference          Zig-zag encoded difference of the calling
+ *                                  context.
+ *  @param[out] unwindDistance      The unwind distance, if flagged.
+ *  @param[out] interruptGenerator  The interrupt generator, if flagged.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_read_sample_delta( OTF2_EvtReader*             reader,
+                                   uint64_t*                   distance,
+                                   uint8_t*                    flags,
+                                   uint64_t*                   difference,
+                                   uint32_t*                   unwindDistance,
+                                   OTF2_InterruptGeneratorRef* interruptGenerator )
+{
+    OTF2_Buffer* buffer = reader->buffer;
+    uint64_t     word;
+
+    OTF2_ErrorCode ret = OTF2_Buffer_GuaranteeCompressed( buffer );
+    if ( ret == OTF2_SUCCESS )
+    {
+        ret = OTF2_Buffer_ReadUint64( buffer, &word );
+    }
+    if ( ret == OTF2_SUCCESS )
+    {
+        ret = OTF2_Buffer_GuaranteeCompressed( buffer );
+    }
+    if ( ret == OTF2_SUCCESS )
+    {
+        ret = OTF2_Buffer_ReadUint64( buffer, difference );
+    }
+    if ( ret != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( ret, "Could not read calling context sample delta." );
+    }
+    *distance = word >> 2;
+    *flags    = word & ( OTF2_BUFFER_SAMPLE_DELTA_UNWIND_DISTANCE |
+                         OTF2_BUFFER_SAMPLE_DELTA_INTERRUPT_GENERATOR );
+
+    if ( *flags & OTF2_BUFFER_SAMPLE_DELTA_UNWIND_DISTANCE )
+    {
+        ret = OTF2_Buffer_GuaranteeCompressed( buffer );
+        if ( ret == OTF2_SUCCESS )
+        {
+            ret = OTF2_Buffer_ReadUint32( buffer, unwindDistance );
+        }
+    }
+    if ( ret == OTF2_SUCCESS &&
+         *flags & OTF2_BUFFER_SAMPLE_DELTA_INTERRUPT_GENERATOR )
+    {
+        ret = OTF2_Buffer_GuaranteeCompressed( buffer );
+        if ( ret == OTF2_SUCCESS )
+        {
+            ret = OTF2_Buffer_ReadUint32( buffer, interruptGenerator );
+        }
+    }
+    if ( ret != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( ret, "Could not read calling context sample delta." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+static OTF2_ErrorCode
+otf2_evt_reader_skip_sample_delta( OTF2_EvtReader* reader )
+{
+    uint64_t                   distance;
+    uint8_t                    flags;
+    uint64_t                   difference;
+    uint32_t                   unwind_distance;
+    OTF2_InterruptGeneratorRef interrupt_generator;
+
+    return otf2_evt_reader_read_sample_delta( reader,
+                                              &distance,
+                                              &flags,
+                                              &difference,
+                                              &unwind_distance,
+                                              &interrupt_generator );
+}
+
+
+/** @brief Step between a calling context sample and its previous sample.
+ *
+ *  @param sample   The sample, read as delta.
+ *  @param forward  Step to the sample of the delta, or back to the previous
+ *                  one.
+ */
+static void
+otf2_evt_reader_step_sample( otf2_evt_reader_sample* sample,
+                             bool                    forward )
+{
+    uint64_t word       = sample->difference;
+    uint64_t difference = ( word >> 1 ) ^ ( uint64_t )-( int64_t )( word & 1 );
+    if ( forward )
+    {
+        sample->calling_context += difference;
+    }
+    else
+    {
+        sample->calling_context -= difference;
+    }
+}
+
+
+/** @brief Remember a completely stored calling context sample.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param recordData   Begin of the record data.
+ *  @param position     Chunk local event position of the sample.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_remember_sample( OTF2_EvtReader* reader,
+                                 uint8_t*        recordData,
+                                 uint64_t        position )
+{
+    OTF2_Buffer*            buffer   = reader->buffer;
+    otf2_evt_reader_sample* sample   = &reader->last_sample;
+    uint8_t*                read_pos = buffer->read_pos;
+
+    /* The record holds the references already mapped. */
+    buffer->read_pos = recordData;
+    OTF2_ErrorCode ret = OTF2_Buffer_ReadUint32( buffer, &sample->calling_context );
+    if ( ret == OTF2_SUCCESS )
+    {
+        ret = OTF2_Buffer_ReadUint32( buffer, &sample->unwind_distance );
+    }
+    if ( ret == OTF2_SUCCESS )
+    {
+        ret = OTF2_Buffer_ReadUint32( buffer, &sample->interrupt_generator );
+    }
+    buffer->read_pos = read_pos;
+    if ( ret != OTF2_SUCCESS )
+    {
+        sample->chunk = 0;
+        return UTILS_ERROR( ret, "Could not read calling context sample. Invalid compression size." );
+    }
+
+    sample->chunk    = buffer->chunk->chunk_num;
+    sample->position = position;
+    sample->distance = 0;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Replay the calling context samples in a chunk segment.
+ *
+ *  The samples are replayed from the start of the segment of the current
+ *  event up to the one at @a eventIndex. Delta samples never refer to
+ *  samples in other segments.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param eventIndex   Chunk local event position of the wanted sample.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_scan_samples( OTF2_EvtReader* reader,
+                              uint64_t        eventIndex )
+{
+    OTF2_Buffer*            buffer = reader->buffer;
+    otf2_evt_reader_sample* sample = &reader->last_sample;
+    OTF2_ErrorCode          ret;
+
+    uint64_t segment_first;
+    uint64_t segment_end;
+    uint8_t* begin_position;
+    ret = otf2_evt_reader_get_segment( reader, reader->chunk_local_event_position,
+                                       &segment_first, &segment_end,
+                                       &begin_position );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return ret;
+    }
+    if ( eventIndex < segment_first )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Calling context sample delta refers to a sample in another segment." );
+    }
+
+    uint8_t*       read_pos = buffer->read_pos;
+    uint8_t*       time_pos = buffer->time_pos;
+    OTF2_TimeStamp time     = buffer->time;
+    OTF2_Buffer_SetPosition( buffer, begin_position );
+
+    sample->chunk = 0;
+    for ( uint64_t i = segment_first; i <= eventIndex; i++ )
+    {
+        uint8_t record_type;
+        ret = otf2_evt_reader_skip_to_record_type( reader, &record_type );
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+
+        if ( record_type == OTF2_EVENT_CALLING_CONTEXT_SAMPLE )
+        {
+            uint64_t record_data_length;
+            ret = OTF2_Buffer_GuaranteeRecord( buffer, &record_data_length );
+            if ( ret == OTF2_SUCCESS )
+            {
+                uint8_t* record_data;
+                OTF2_Buffer_GetPosition( buffer, &record_data );
+                ret = otf2_evt_reader_remember_sample( reader, record_data, i );
+                if ( ret == OTF2_SUCCESS )
+                {
+                    ret = OTF2_Buffer_SetPosition( buffer,
+                                                   record_data + record_data_length );
+                }
+            }
+        }
+        else if ( record_type == OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA )
+        {
+            uint64_t distance;
+            ret = otf2_evt_reader_read_sample_delta( reader,
+                                                     &distance,
+                                                     &sample->flags,
+                                                     &sample->difference,
+                                                     &sample->unwind_distance,
+                                                     &sample->interrupt_generator );
+            if ( ret == OTF2_SUCCESS &&
+                 ( sample->chunk == 0 || sample->position + distance != i ) )
+            {
+                ret = UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                                   "Calling context sample delta without previous sample." );
+            }
+            if ( ret == OTF2_SUCCESS )
+            {
+                otf2_evt_reader_step_sample( sample, true );
+                sample->position = i;
+                sample->distance = distance;
+            }
+        }
+        else
+        {
+            ret = otf2_evt_reader_skip_payload( reader, record_type );
+        }
+        if ( ret != OTF2_SUCCESS )
+        {
+            break;
+        }
+    }
+
+    buffer->read_pos = read_pos;
+    buffer->time_pos = time_pos;
+    buffer->time     = time;
+
+    if ( ret != OTF2_SUCCESS )
+    {
+        sample->chunk = 0;
+        return UTILS_ERROR( ret, "Error while scanning through the events." );
+    }
+    if ( sample->chunk == 0 || sample->position != eventIndex )
+    {
+        sample->chunk = 0;
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Calling context sample delta without previous sample." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Read a calling context sample stored as delta to the previous
+ *         sample.
+ *
+ *  The previous sample is kept from reading forward, the following one
+ *  from reading backward, otherwise the samples are replayed from the start
+ *  of the chunk segment.
+ *
+ *  @param reader       Reference to the reader object
+ *  @param record       The record to fill.
+ */
+static OTF2_ErrorCode
+otf2_evt_reader_read_calling_context_sample_delta( OTF2_EvtReader*            reader,
+                                                   OTF2_CallingContextSample* record )
+{
+    otf2_evt_reader_sample* sample   = &reader->last_sample;
+    uint64_t                position = reader->chunk_local_event_position;
+
+    uint64_t                   distance;
+    uint8_t                    flags;
+    uint64_t                   difference;
+    uint32_t                   unwind_distance;
+    OTF2_InterruptGeneratorRef interrupt_generator;
+    OTF2_ErrorCode             ret = otf2_evt_reader_read_sample_delta( reader,
+                                                                        &distance,
+                                                                        &flags,
+                                                                        &difference,
+                                                                        &unwind_distance,
+                                                                        &interrupt_generator );
+    if ( ret != OTF2_SUCCESS )
+    {
+        return ret;
+    }
+    if ( distance == 0 || distance > position )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Invalid distance of CallingContextSample record." );
+    }
+    uint64_t previous = position - distance;
+
+    bool in_chunk = sample->chunk == reader->buffer->chunk->chunk_num;
+    if ( in_chunk && sample->position == position )
+    {
+        /* Read again, e.g., after seeking. */
+    }
+    else if ( in_chunk && sample->distance > 0 && sample->flags == 0 &&
+              sample->position - sample->distance == position )
+    {
+        /* Reading backward, step back from the following sample, which
+         * changed only the calling context. */
+        otf2_evt_reader_step_sample( sample, false );
+    }
+    else
+    {
+        if ( !in_chunk || sample->position != previous )
+        {
+            ret = otf2_evt_reader_scan_samples( reader, previous );
+            if ( ret != OTF2_SUCCESS )
+            {
+                return ret;
+            }
+        }
+        if ( flags & OTF2_BUFFER_SAMPLE_DELTA_UNWIND_DISTANCE )
+        {
+            sample->unwind_distance = unwind_distance;
+        }
+        if ( flags & OTF2_BUFFER_SAMPLE_DELTA_INTERRUPT_GENERATOR )
+        {
+            sample->interrupt_generator = interrupt_generator;
+        }
+        sample->difference = difference;
+        otf2_evt_reader_step_sample( sample, true );
+    }
+    sample->position   = position;
+    sample->distance   = distance;
+    sample->flags      = flags;
+    sample->difference = difference;
+
+    record->calling_context     = otf2_evt_reader_map( reader, OTF2_MAPPING_CALLING_CONTEXT, sample->calling_context );
+    record->unwind_distance     = sample->unwind_distance;
+    record->interrupt_generator = otf2_evt_reader_map( reader, OTF2_MAPPING_INTERRUPT_GENERATOR, sample->interrupt_generator );
+
+    return OTF2_SUCCESS;
+}
+
 OTF2_ErrorCode
 OTF2_EvtReaderCallbacks_SetUnknownCallback(
     OTF2_EvtReaderCallbacks*       evtReaderCallbacks,
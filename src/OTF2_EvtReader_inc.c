@@ -47,6 +47,28 @@ otf2_evt_reader_read_buffer_flush( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.buffer_flush )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip BufferFlush record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -65,6 +87,17 @@ otf2_evt_reader_read_buffer_flush( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "BufferFlush record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -117,6 +150,28 @@ otf2_evt_reader_read_measurement_on_off( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.measurement_on_off )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MeasurementOnOff record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -134,6 +189,17 @@ otf2_evt_reader_read_measurement_on_off( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "MeasurementOnOff record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -186,6 +252,28 @@ otf2_evt_reader_read_enter( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.enter )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip Enter record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -245,6 +333,45 @@ otf2_evt_reader_read_leave( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.leave )
+    {
+        /* Implicit leaves have no payload. */
+        ret = reader->current_event.type == OTF2_BUFFER_IMPLICIT_LEAVE
+              ? OTF2_SUCCESS
+              : otf2_evt_reader_skip_compressed( reader );
+        reader->current_event.type = OTF2_EVENT_LEAVE;
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip Leave record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
+    if ( reader->current_event.type == OTF2_BUFFER_IMPLICIT_LEAVE )
+    {
+        /* The region is the innermost one entered in the chunk segment. */
+        ret = otf2_evt_reader_get_implicit_region( reader, &record->region );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not reconstruct region of Leave record." );
+        }
+        record->region             = otf2_evt_reader_map( reader, OTF2_MAPPING_REGION, record->region );
+        reader->current_event.type = OTF2_EVENT_LEAVE;
+        goto region_known;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -259,6 +386,7 @@ otf2_evt_reader_read_leave( OTF2_EvtReader* reader )
     }
     record->region = otf2_evt_reader_map( reader, OTF2_MAPPING_REGION, record->region );
 
+region_known:
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
@@ -304,6 +432,28 @@ otf2_evt_reader_read_mpi_send( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_send )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiSend record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -341,6 +491,17 @@ otf2_evt_reader_read_mpi_send( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "MpiSend record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -396,6 +557,28 @@ otf2_evt_reader_read_mpi_isend( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_isend )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiIsend record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -438,6 +621,17 @@ otf2_evt_reader_read_mpi_isend( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "MpiIsend record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -494,6 +688,28 @@ otf2_evt_reader_read_mpi_isend_complete( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_isend_complete )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiIsendComplete record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -552,6 +768,28 @@ otf2_evt_reader_read_mpi_irecv_request( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_irecv_request )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiIrecvRequest record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -610,6 +848,28 @@ otf2_evt_reader_read_mpi_recv( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_recv )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiRecv record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -647,6 +907,17 @@ otf2_evt_reader_read_mpi_recv( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "MpiRecv record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -702,6 +973,28 @@ otf2_evt_reader_read_mpi_irecv( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_irecv )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiIrecv record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -744,6 +1037,17 @@ otf2_evt_reader_read_mpi_irecv( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "MpiIrecv record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -800,6 +1104,28 @@ otf2_evt_reader_read_mpi_request_test( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_request_test )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiRequestTest record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -858,6 +1184,28 @@ otf2_evt_reader_read_mpi_request_cancelled( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_request_cancelled )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiRequestCancelled record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -916,6 +1264,28 @@ otf2_evt_reader_read_mpi_collective_begin( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_collective_begin )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiCollectiveBegin record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -932,6 +1302,17 @@ otf2_evt_reader_read_mpi_collective_begin( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "MpiCollectiveBegin record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -983,6 +1364,28 @@ otf2_evt_reader_read_mpi_collective_end( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.mpi_collective_end )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip MpiCollectiveEnd record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1021,6 +1424,17 @@ otf2_evt_reader_read_mpi_collective_end( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "MpiCollectiveEnd record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -1077,6 +1491,28 @@ otf2_evt_reader_read_omp_fork( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.omp_fork )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip OmpFork record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -1135,6 +1571,28 @@ otf2_evt_reader_read_omp_join( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.omp_join )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip OmpJoin record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1151,6 +1609,17 @@ otf2_evt_reader_read_omp_join( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "OmpJoin record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -1202,6 +1671,28 @@ otf2_evt_reader_read_omp_acquire_lock( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.omp_acquire_lock )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip OmpAcquireLock record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1229,8 +1720,19 @@ otf2_evt_reader_read_omp_acquire_lock( OTF2_EvtReader* reader )
     reader->chunk_local_event_position++;
 
     /*
-     * Always jump to the announced end of the record. This way, we skip
-     * future additions of attributes to this record.
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "OmpAcquireLock record exceeds its announced length." );
+    }
+
+    /*
+     * Always jump to the announced end of the record. This way, we skip
+     * future additions of attributes to this record.
      */
     ret = OTF2_Buffer_SetPosition( reader->buffer, record_end_pos );
     if ( OTF2_SUCCESS != ret )
@@ -1281,6 +1783,28 @@ otf2_evt_reader_read_omp_release_lock( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.omp_release_lock )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip OmpReleaseLock record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1307,6 +1831,17 @@ otf2_evt_reader_read_omp_release_lock( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "OmpReleaseLock record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -1360,6 +1895,28 @@ otf2_evt_reader_read_omp_task_create( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.omp_task_create )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip OmpTaskCreate record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -1418,6 +1975,28 @@ otf2_evt_reader_read_omp_task_switch( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.omp_task_switch )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip OmpTaskSwitch record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -1476,6 +2055,28 @@ otf2_evt_reader_read_omp_task_complete( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.omp_task_complete )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip OmpTaskComplete record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -1534,6 +2135,29 @@ otf2_evt_reader_read_metric( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.metric )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        reader->current_event.type = OTF2_EVENT_METRIC;
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip Metric record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1545,6 +2169,18 @@ otf2_evt_reader_read_metric( OTF2_EvtReader* reader )
     OTF2_Buffer_GetPosition( reader->buffer, &record_end_pos );
     record_end_pos += record_data_length;
 
+    if ( reader->current_event.type == OTF2_BUFFER_METRIC_DELTA )
+    {
+        /* The values are deltas to the previous sample of the metric. */
+        ret = otf2_evt_reader_read_metric_delta( reader, record );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not read Metric record." );
+        }
+        reader->current_event.type = OTF2_EVENT_METRIC;
+        goto metric_known;
+    }
+
 
     ret = OTF2_Buffer_ReadUint32( reader->buffer, &record->metric );
     if ( OTF2_SUCCESS != ret )
@@ -1584,9 +2220,31 @@ otf2_evt_reader_read_metric( OTF2_EvtReader* reader )
         }
     }
 
+    ret = otf2_evt_reader_remember_metric( reader, record );
+    if ( OTF2_SUCCESS != ret )
+    {
+        free( record->type_ids );
+        free( record->metric_values );
+        return UTILS_ERROR( ret, "Could not remember Metric record." );
+    }
+
+metric_known:
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        free( record->type_ids );
+        free( record->metric_values );
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "Metric record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -1646,6 +2304,28 @@ otf2_evt_reader_read_parameter_string( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.parameter_string )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ParameterString record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1674,6 +2354,17 @@ otf2_evt_reader_read_parameter_string( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ParameterString record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -1727,6 +2418,28 @@ otf2_evt_reader_read_parameter_int( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.parameter_int )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ParameterInt record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1754,6 +2467,17 @@ otf2_evt_reader_read_parameter_int( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ParameterInt record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -1807,6 +2531,28 @@ otf2_evt_reader_read_parameter_unsigned_int( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.parameter_unsigned_int )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ParameterUnsignedInt record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1834,6 +2580,17 @@ otf2_evt_reader_read_parameter_unsigned_int( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ParameterUnsignedInt record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -1887,6 +2644,28 @@ otf2_evt_reader_read_rma_win_create( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_win_create )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaWinCreate record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1909,6 +2688,17 @@ otf2_evt_reader_read_rma_win_create( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaWinCreate record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -1961,6 +2751,28 @@ otf2_evt_reader_read_rma_win_destroy( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_win_destroy )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaWinDestroy record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -1983,6 +2795,17 @@ otf2_evt_reader_read_rma_win_destroy( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaWinDestroy record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2035,6 +2858,28 @@ otf2_evt_reader_read_rma_collective_begin( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_collective_begin )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaCollectiveBegin record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2051,6 +2896,17 @@ otf2_evt_reader_read_rma_collective_begin( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaCollectiveBegin record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2102,6 +2958,28 @@ otf2_evt_reader_read_rma_collective_end( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_collective_end )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaCollectiveEnd record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2145,6 +3023,17 @@ otf2_evt_reader_read_rma_collective_end( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaCollectiveEnd record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2202,6 +3091,28 @@ otf2_evt_reader_read_rma_group_sync( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_group_sync )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaGroupSync record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2235,6 +3146,17 @@ otf2_evt_reader_read_rma_group_sync( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaGroupSync record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2289,6 +3211,28 @@ otf2_evt_reader_read_rma_request_lock( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_request_lock )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaRequestLock record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2322,6 +3266,17 @@ otf2_evt_reader_read_rma_request_lock( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaRequestLock record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2377,6 +3332,28 @@ otf2_evt_reader_read_rma_acquire_lock( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_acquire_lock )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaAcquireLock record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2410,6 +3387,17 @@ otf2_evt_reader_read_rma_acquire_lock( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaAcquireLock record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2465,6 +3453,28 @@ otf2_evt_reader_read_rma_try_lock( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_try_lock )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaTryLock record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2498,6 +3508,17 @@ otf2_evt_reader_read_rma_try_lock( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaTryLock record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2553,6 +3574,28 @@ otf2_evt_reader_read_rma_release_lock( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_release_lock )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaReleaseLock record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2585,6 +3628,17 @@ otf2_evt_reader_read_rma_release_lock( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaReleaseLock record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2639,6 +3693,28 @@ otf2_evt_reader_read_rma_sync( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_sync )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaSync record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2667,6 +3743,17 @@ otf2_evt_reader_read_rma_sync( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaSync record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2721,6 +3808,28 @@ otf2_evt_reader_read_rma_wait_change( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_wait_change )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaWaitChange record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2743,6 +3852,17 @@ otf2_evt_reader_read_rma_wait_change( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaWaitChange record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2795,6 +3915,28 @@ otf2_evt_reader_read_rma_put( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_put )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaPut record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2832,6 +3974,17 @@ otf2_evt_reader_read_rma_put( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaPut record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2887,6 +4040,28 @@ otf2_evt_reader_read_rma_get( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_get )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaGet record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -2924,6 +4099,17 @@ otf2_evt_reader_read_rma_get( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaGet record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -2979,6 +4165,28 @@ otf2_evt_reader_read_rma_atomic( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_atomic )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaAtomic record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3022,6 +4230,17 @@ otf2_evt_reader_read_rma_atomic( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaAtomic record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3079,6 +4298,28 @@ otf2_evt_reader_read_rma_op_complete_blocking( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_op_complete_blocking )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaOpCompleteBlocking record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3106,6 +4347,17 @@ otf2_evt_reader_read_rma_op_complete_blocking( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaOpCompleteBlocking record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3159,6 +4411,28 @@ otf2_evt_reader_read_rma_op_complete_non_blocking( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_op_complete_non_blocking )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaOpCompleteNonBlocking record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3186,6 +4460,17 @@ otf2_evt_reader_read_rma_op_complete_non_blocking( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaOpCompleteNonBlocking record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3239,6 +4524,28 @@ otf2_evt_reader_read_rma_op_test( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_op_test )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaOpTest record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3266,6 +4573,17 @@ otf2_evt_reader_read_rma_op_test( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaOpTest record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3319,6 +4637,28 @@ otf2_evt_reader_read_rma_op_complete_remote( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.rma_op_complete_remote )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip RmaOpCompleteRemote record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3346,6 +4686,17 @@ otf2_evt_reader_read_rma_op_complete_remote( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "RmaOpCompleteRemote record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3399,6 +4750,29 @@ otf2_evt_reader_read_thread_fork( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_fork &&
+         !reader->reader_callbacks.omp_fork )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadFork record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3421,6 +4795,17 @@ otf2_evt_reader_read_thread_fork( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadFork record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3492,6 +4877,29 @@ otf2_evt_reader_read_thread_join( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_join &&
+         !reader->reader_callbacks.omp_join )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadJoin record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3509,6 +4917,17 @@ otf2_evt_reader_read_thread_join( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadJoin record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3578,6 +4997,28 @@ otf2_evt_reader_read_thread_team_begin( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_team_begin )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadTeamBegin record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3600,6 +5041,17 @@ otf2_evt_reader_read_thread_team_begin( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadTeamBegin record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3652,6 +5104,28 @@ otf2_evt_reader_read_thread_team_end( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_team_end )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadTeamEnd record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3675,7 +5149,18 @@ otf2_evt_reader_read_thread_team_end( OTF2_EvtReader* reader )
     reader->chunk_local_event_position++;
 
     /*
-     * Always jump to the announced end of the record. This way, we skip
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadTeamEnd record exceeds its announced length." );
+    }
+
+    /*
+     * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
      */
     ret = OTF2_Buffer_SetPosition( reader->buffer, record_end_pos );
@@ -3726,6 +5211,29 @@ otf2_evt_reader_read_thread_acquire_lock( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_acquire_lock &&
+         !reader->reader_callbacks.omp_acquire_lock )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadAcquireLock record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3753,6 +5261,17 @@ otf2_evt_reader_read_thread_acquire_lock( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadAcquireLock record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3826,6 +5345,29 @@ otf2_evt_reader_read_thread_release_lock( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_release_lock &&
+         !reader->reader_callbacks.omp_release_lock )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadReleaseLock record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3853,6 +5395,17 @@ otf2_evt_reader_read_thread_release_lock( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadReleaseLock record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -3926,6 +5479,28 @@ otf2_evt_reader_read_thread_task_create( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_task_create )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadTaskCreate record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -3958,6 +5533,17 @@ otf2_evt_reader_read_thread_task_create( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadTaskCreate record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4012,6 +5598,28 @@ otf2_evt_reader_read_thread_task_switch( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_task_switch )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadTaskSwitch record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4044,6 +5652,17 @@ otf2_evt_reader_read_thread_task_switch( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadTaskSwitch record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4098,6 +5717,28 @@ otf2_evt_reader_read_thread_task_complete( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_task_complete )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadTaskComplete record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4130,6 +5771,17 @@ otf2_evt_reader_read_thread_task_complete( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadTaskComplete record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4184,6 +5836,28 @@ otf2_evt_reader_read_thread_create( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_create )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadCreate record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4211,6 +5885,17 @@ otf2_evt_reader_read_thread_create( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadCreate record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4264,6 +5949,28 @@ otf2_evt_reader_read_thread_begin( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_begin )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadBegin record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4291,6 +5998,17 @@ otf2_evt_reader_read_thread_begin( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadBegin record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4344,6 +6062,28 @@ otf2_evt_reader_read_thread_wait( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_wait )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadWait record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4371,6 +6111,17 @@ otf2_evt_reader_read_thread_wait( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadWait record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4424,6 +6175,28 @@ otf2_evt_reader_read_thread_end( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.thread_end )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip ThreadEnd record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4451,6 +6224,17 @@ otf2_evt_reader_read_thread_end( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "ThreadEnd record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4504,6 +6288,29 @@ otf2_evt_reader_read_calling_context_enter( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.calling_context_enter &&
+         !reader->reader_callbacks.enter )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip CallingContextEnter record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4531,6 +6338,17 @@ otf2_evt_reader_read_calling_context_enter( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "CallingContextEnter record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4602,6 +6420,29 @@ otf2_evt_reader_read_calling_context_leave( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.calling_context_leave &&
+         !reader->reader_callbacks.leave )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip CallingContextLeave record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4624,6 +6465,17 @@ otf2_evt_reader_read_calling_context_leave( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "CallingContextLeave record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4694,6 +6546,46 @@ otf2_evt_reader_read_calling_context_sample( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.calling_context_sample )
+    {
+        /* Sample deltas have no record length. */
+        ret = reader->current_event.type == OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA
+              ? otf2_evt_reader_skip_sample_delta( reader )
+              : otf2_evt_reader_skip_record( reader );
+        reader->current_event.type = OTF2_EVENT_CALLING_CONTEXT_SAMPLE;
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip CallingContextSample record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
+    if ( reader->current_event.type == OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA )
+    {
+        /* The attributes are deltas to the previous sample. */
+        ret = otf2_evt_reader_read_calling_context_sample_delta( reader, record );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not read CallingContextSample record." );
+        }
+        reader->current_event.type = OTF2_EVENT_CALLING_CONTEXT_SAMPLE;
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        goto sample_known;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4724,9 +6616,28 @@ otf2_evt_reader_read_calling_context_sample( OTF2_EvtReader* reader )
     }
     record->interrupt_generator = otf2_evt_reader_map( reader, OTF2_MAPPING_INTERRUPT_GENERATOR, record->interrupt_generator );
 
+    ret = otf2_evt_reader_remember_sample( reader,
+                                           record_end_pos - record_data_length,
+                                           reader->chunk_local_event_position );
+    if ( OTF2_SUCCESS != ret )
+    {
+        return UTILS_ERROR( ret, "Could not remember CallingContextSample record." );
+    }
+
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "CallingContextSample record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -4737,6 +6648,7 @@ otf2_evt_reader_read_calling_context_sample( OTF2_EvtReader* reader )
         return UTILS_ERROR( ret, "Could not read record of unknown type." );
     }
 
+sample_known:
     /*
      * If a local event reader is operated by a global event reader,
      * don't call our callback, don't clean up the attribute list and
@@ -4781,6 +6693,28 @@ otf2_evt_reader_read_task_create( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.task_create )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip TaskCreate record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -4840,6 +6774,28 @@ otf2_evt_reader_read_task_destroy( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.task_destroy )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip TaskDestroy record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -4899,6 +6855,28 @@ otf2_evt_reader_read_task_runnable( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.task_runnable )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip TaskRunnable record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -4958,6 +6936,28 @@ otf2_evt_reader_read_add_dependence( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.add_dependence )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip AddDependence record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -4986,6 +6986,17 @@ otf2_evt_reader_read_add_dependence( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "AddDependence record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -5039,6 +7050,28 @@ otf2_evt_reader_read_satisfy_dependence( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.satisfy_dependence )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip SatisfyDependence record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -5067,6 +7100,17 @@ otf2_evt_reader_read_satisfy_dependence( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "SatisfyDependence record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -5120,6 +7164,28 @@ otf2_evt_reader_read_data_acquire( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.data_acquire )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip DataAcquire record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -5153,6 +7219,17 @@ otf2_evt_reader_read_data_acquire( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "DataAcquire record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -5207,6 +7284,28 @@ otf2_evt_reader_read_data_release( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.data_release )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip DataRelease record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -5240,6 +7339,17 @@ otf2_evt_reader_read_data_release( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "DataRelease record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -5294,6 +7404,28 @@ otf2_evt_reader_read_event_create( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.event_create )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip EventCreate record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -5353,6 +7485,28 @@ otf2_evt_reader_read_event_destroy( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.event_destroy )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip EventDestroy record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -5412,6 +7566,28 @@ otf2_evt_reader_read_data_create( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.data_create )
+    {
+        ret = otf2_evt_reader_skip_record( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip DataCreate record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     uint64_t          record_data_length;
     /* Event contains separate record length information */
     ret = OTF2_Buffer_GuaranteeRecord( reader->buffer, &record_data_length );
@@ -5439,6 +7615,17 @@ otf2_evt_reader_read_data_create( OTF2_EvtReader* reader )
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "DataCreate record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -5492,6 +7679,28 @@ otf2_evt_reader_read_data_destroy( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.data_destroy )
+    {
+        ret = otf2_evt_reader_skip_compressed( reader );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip DataDestroy record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
     if ( OTF2_SUCCESS != ret )
@@ -5540,6 +7749,84 @@ record->region );
 }
 
 
+/** Decoder for each record type, unknown record types have none. */
+static OTF2_ErrorCode ( * const otf2_evt_reader_read_table[ 256 ] )( OTF2_EvtReader* ) =
+{
+    [ OTF2_EVENT_BUFFER_FLUSH ] = otf2_evt_reader_read_buffer_flush,
+    [ OTF2_EVENT_MEASUREMENT_ON_OFF ] = otf2_evt_reader_read_measurement_on_off,
+    [ OTF2_EVENT_ENTER ] = otf2_evt_reader_read_enter,
+    [ OTF2_EVENT_LEAVE ] = otf2_evt_reader_read_leave,
+    [ OTF2_EVENT_MPI_SEND ] = otf2_evt_reader_read_mpi_send,
+    [ OTF2_EVENT_MPI_ISEND ] = otf2_evt_reader_read_mpi_isend,
+    [ OTF2_EVENT_MPI_ISEND_COMPLETE ] = otf2_evt_reader_read_mpi_isend_complete,
+    [ OTF2_EVENT_MPI_IRECV_REQUEST ] = otf2_evt_reader_read_mpi_irecv_request,
+    [ OTF2_EVENT_MPI_RECV ] = otf2_evt_reader_read_mpi_recv,
+    [ OTF2_EVENT_MPI_IRECV ] = otf2_evt_reader_read_mpi_irecv,
+    [ OTF2_EVENT_MPI_REQUEST_TEST ] = otf2_evt_reader_read_mpi_request_test,
+    [ OTF2_EVENT_MPI_REQUEST_CANCELLED ] = otf2_evt_reader_read_mpi_request_cancelled,
+    [ OTF2_EVENT_MPI_COLLECTIVE_BEGIN ] = otf2_evt_reader_read_mpi_collective_begin,
+    [ OTF2_EVENT_MPI_COLLECTIVE_END ] = otf2_evt_reader_read_mpi_collective_end,
+    [ OTF2_EVENT_OMP_FORK ] = otf2_evt_reader_read_omp_fork,
+    [ OTF2_EVENT_OMP_JOIN ] = otf2_evt_reader_read_omp_join,
+    [ OTF2_EVENT_OMP_ACQUIRE_LOCK ] = otf2_evt_reader_read_omp_acquire_lock,
+    [ OTF2_EVENT_OMP_RELEASE_LOCK ] = otf2_evt_reader_read_omp_release_lock,
+    [ OTF2_EVENT_OMP_TASK_CREATE ] = otf2_evt_reader_read_omp_task_create,
+    [ OTF2_EVENT_OMP_TASK_SWITCH ] = otf2_evt_reader_read_omp_task_switch,
+    [ OTF2_EVENT_OMP_TASK_COMPLETE ] = otf2_evt_reader_read_omp_task_complete,
+    [ OTF2_EVENT_METRIC ] = otf2_evt_reader_read_metric,
+    [ OTF2_EVENT_PARAMETER_STRING ] = otf2_evt_reader_read_parameter_string,
+    [ OTF2_EVENT_PARAMETER_INT ] = otf2_evt_reader_read_parameter_int,
+    [ OTF2_EVENT_PARAMETER_UNSIGNED_INT ] = otf2_evt_reader_read_parameter_unsigned_int,
+    [ OTF2_EVENT_RMA_WIN_CREATE ] = otf2_evt_reader_read_rma_win_create,
+    [ OTF2_EVENT_RMA_WIN_DESTROY ] = otf2_evt_reader_read_rma_win_destroy,
+    [ OTF2_EVENT_RMA_COLLECTIVE_BEGIN ] = otf2_evt_reader_read_rma_collective_begin,
+    [ OTF2_EVENT_RMA_COLLECTIVE_END ] = otf2_evt_reader_read_rma_collective_end,
+    [ OTF2_EVENT_RMA_GROUP_SYNC ] = otf2_evt_reader_read_rma_group_sync,
+    [ OTF2_EVENT_RMA_REQUEST_LOCK ] = otf2_evt_reader_read_rma_request_lock,
+    [ OTF2_EVENT_RMA_ACQUIRE_LOCK ] = otf2_evt_reader_read_rma_acquire_lock,
+    [ OTF2_EVENT_RMA_TRY_LOCK ] = otf2_evt_reader_read_rma_try_lock,
+    [ OTF2_EVENT_RMA_RELEASE_LOCK ] = otf2_evt_reader_read_rma_release_lock,
+    [ OTF2_EVENT_RMA_SYNC ] = otf2_evt_reader_read_rma_sync,
+    [ OTF2_EVENT_RMA_WAIT_CHANGE ] = otf2_evt_reader_read_rma_wait_change,
+    [ OTF2_EVENT_RMA_PUT ] = otf2_evt_reader_read_rma_put,
+    [ OTF2_EVENT_RMA_GET ] = otf2_evt_reader_read_rma_get,
+    [ OTF2_EVENT_RMA_ATOMIC ] = otf2_evt_reader_read_rma_atomic,
+    [ OTF2_EVENT_RMA_OP_COMPLETE_BLOCKING ] = otf2_evt_reader_read_rma_op_complete_blocking,
+    [ OTF2_EVENT_RMA_OP_COMPLETE_NON_BLOCKING ] = otf2_evt_reader_read_rma_op_complete_non_blocking,
+    [ OTF2_EVENT_RMA_OP_TEST ] = otf2_evt_reader_read_rma_op_test,
+    [ OTF2_EVENT_RMA_OP_COMPLETE_REMOTE ] = otf2_evt_reader_read_rma_op_complete_remote,
+    [ OTF2_EVENT_THREAD_FORK ] = otf2_evt_reader_read_thread_fork,
+    [ OTF2_EVENT_THREAD_JOIN ] = otf2_evt_reader_read_thread_join,
+    [ OTF2_EVENT_THREAD_TEAM_BEGIN ] = otf2_evt_reader_read_thread_team_begin,
+    [ OTF2_EVENT_THREAD_TEAM_END ] = otf2_evt_reader_read_thread_team_end,
+    [ OTF2_EVENT_THREAD_ACQUIRE_LOCK ] = otf2_evt_reader_read_thread_acquire_lock,
+    [ OTF2_EVENT_THREAD_RELEASE_LOCK ] = otf2_evt_reader_read_thread_release_lock,
+    [ OTF2_EVENT_THREAD_TASK_CREATE ] = otf2_evt_reader_read_thread_task_create,
+    [ OTF2_EVENT_THREAD_TASK_SWITCH ] = otf2_evt_reader_read_thread_task_switch,
+    [ OTF2_EVENT_THREAD_TASK_COMPLETE ] = otf2_evt_reader_read_thread_task_complete,
+    [ OTF2_EVENT_THREAD_CREATE ] = otf2_evt_reader_read_thread_create,
+    [ OTF2_EVENT_THREAD_BEGIN ] = otf2_evt_reader_read_thread_begin,
+    [ OTF2_EVENT_THREAD_WAIT ] = otf2_evt_reader_read_thread_wait,
+    [ OTF2_EVENT_THREAD_END ] = otf2_evt_reader_read_thread_end,
+    [ OTF2_EVENT_CALLING_CONTEXT_ENTER ] = otf2_evt_reader_read_calling_context_enter,
+    [ OTF2_EVENT_CALLING_CONTEXT_LEAVE ] = otf2_evt_reader_read_calling_context_leave,
+    [ OTF2_EVENT_CALLING_CONTEXT_SAMPLE ] = otf2_evt_reader_read_calling_context_sample,
+    [ OTF2_EVENT_TASK_CREATE ] = otf2_evt_reader_read_task_create,
+    [ OTF2_EVENT_TASK_DESTROY ] = otf2_evt_reader_read_task_destroy,
+    [ OTF2_EVENT_TASK_RUNNABLE ] = otf2_evt_reader_read_task_runnable,
+    [ OTF2_EVENT_ADD_DEPENDENCE ] = otf2_evt_reader_read_add_dependence,
+    [ OTF2_EVENT_SATISFY_DEPENDENCE ] = otf2_evt_reader_read_satisfy_dependence,
+    [ OTF2_EVENT_DATA_ACQUIRE ] = otf2_evt_reader_read_data_acquire,
+    [ OTF2_EVENT_DATA_RELEASE ] = otf2_evt_reader_read_data_release,
+    [ OTF2_EVENT_EVENT_CREATE ] = otf2_evt_reader_read_event_create,
+    [ OTF2_EVENT_EVENT_DESTROY ] = otf2_evt_reader_read_event_destroy,
+    [ OTF2_EVENT_DATA_CREATE ] = otf2_evt_reader_read_data_create,
+    [ OTF2_EVENT_DATA_DESTROY ] = otf2_evt_reader_read_data_destroy,
+    [ OTF2_BUFFER_IMPLICIT_LEAVE ] = otf2_evt_reader_read_leave,
+    [ OTF2_BUFFER_METRIC_DELTA ] = otf2_evt_reader_read_metric,
+    [ OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA ] = otf2_evt_reader_read_calling_context_sample,
+};
+
 OTF2_ErrorCode
 otf2_evt_reader_read( OTF2_EvtReader* reader )
 {
@@ -5548,23 +7835,25 @@ otf2_evt_reader_read( OTF2_EvtReader* reader )
     OTF2_ErrorCode  status = OTF2_ERROR_INVALID;
     OTF2_GenericEvent* event  = &reader->current_event;
 
-    status = OTF2_Buffer_ReadTimeStamp( reader->buffer, &event->record.time );
-    if ( status != OTF2_SUCCESS )
+    /* Consume chunk ends and attribute lists until an event record follows. */
+    while ( true )
     {
-        return UTILS_ERROR( status, "Read of timestamp failed!" );
-    }
+        status = OTF2_Buffer_ReadTimeStamp( reader->buffer, &event->record.time );
+        if ( status != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( status, "Read of timestamp failed!" );
+        }
 
-    /* Read record type */
-    status = OTF2_Buffer_Guarantee( reader->buffer, 1 );
-    if ( OTF2_SUCCESS != status )
-    {
-        return UTILS_ERROR( status, "Could not read record type." );
-    }
-    OTF2_Buffer_ReadUint8( reader->buffer, &event->type );
+        /* Read record type */
+        status = OTF2_Buffer_Guarantee( reader->buffer, 1 );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status, "Could not read record type." );
+        }
+        OTF2_Buffer_ReadUint8( reader->buffer, &event->type );
 
-    switch ( event->type )
-    {
-        case OTF2_BUFFER_END_OF_CHUNK:
+        if ( event->type == OTF2_BUFFER_END_OF_CHUNK )
+        {
             reader->chunk_local_event_position = 0;
             free( reader->position_table );
             reader->position_table = NULL;
@@ -5575,235 +7864,48 @@ otf2_evt_reader_read( OTF2_EvtReader* reader )
             {
                 return UTILS_ERROR( status, "Load of next chunk failed!" );
             }
-            return otf2_evt_reader_read( reader );
-
-        case OTF2_BUFFER_END_OF_FILE:
-            return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+            continue;
+        }
 
-        case OTF2_ATTRIBUTE_LIST:
-            status = otf2_attribute_list_read_from_buffer( &reader->attribute_list,
-                                                           reader->buffer,
-                                                           otf2_evt_reader_map,
-                                                           reader );
+        if ( event->type == OTF2_ATTRIBUTE_LIST )
+        {
+            /* Decoded only when the callback accesses the list. */
+            status = otf2_attribute_list_defer_from_buffer( &reader->attribute_list,
+                                                            reader->buffer,
+                                                            otf2_evt_reader_map,
+                                                            reader );
             if ( status != OTF2_SUCCESS )
             {
                 return UTILS_ERROR( status, "Read of additional attributes failed!" );
             }
-            return otf2_evt_reader_read( reader );
-
-        case OTF2_EVENT_BUFFER_FLUSH:
-            return otf2_evt_reader_read_buffer_flush( reader );
-
-        case OTF2_EVENT_MEASUREMENT_ON_OFF:
-            return otf2_evt_reader_read_measurement_on_off( reader );
-
-        case OTF2_EVENT_ENTER:
-            return otf2_evt_reader_read_enter( reader );
-
-        case OTF2_EVENT_LEAVE:
-            return otf2_evt_reader_read_leave( reader );
-
-        case OTF2_EVENT_MPI_SEND:
-            return otf2_evt_reader_read_mpi_send( reader );
-
-        case OTF2_EVENT_MPI_ISEND:
-            return otf2_evt_reader_read_mpi_isend( reader );
-
-        case OTF2_EVENT_MPI_ISEND_COMPLETE:
-            return otf2_evt_reader_read_mpi_isend_complete( reader );
-
-        case OTF2_EVENT_MPI_IRECV_REQUEST:
-            return otf2_evt_reader_read_mpi_irecv_request( reader );
-
-        case OTF2_EVENT_MPI_RECV:
-            return otf2_evt_reader_read_mpi_recv( reader );
-
-        case OTF2_EVENT_MPI_IRECV:
-            return otf2_evt_reader_read_mpi_irecv( reader );
-
-        case OTF2_EVENT_MPI_REQUEST_TEST:
-            return otf2_evt_reader_read_mpi_request_test( reader );
-
-        case OTF2_EVENT_MPI_REQUEST_CANCELLED:
-            return otf2_evt_reader_read_mpi_request_cancelled( reader );
-
-        case OTF2_EVENT_MPI_COLLECTIVE_BEGIN:
-            return otf2_evt_reader_read_mpi_collective_begin( reader );
-
-        case OTF2_EVENT_MPI_COLLECTIVE_END:
-            return otf2_evt_reader_read_mpi_collective_end( reader );
-
-        case OTF2_EVENT_OMP_FORK:
-            return otf2_evt_reader_read_omp_fork( reader );
-
-        case OTF2_EVENT_OMP_JOIN:
-            return otf2_evt_reader_read_omp_join( reader );
-
-        case OTF2_EVENT_OMP_ACQUIRE_LOCK:
-            return otf2_evt_reader_read_omp_acquire_lock( reader );
-
-        case OTF2_EVENT_OMP_RELEASE_LOCK:
-            return otf2_evt_reader_read_omp_release_lock( reader );
-
-        case OTF2_EVENT_OMP_TASK_CREATE:
-            return otf2_evt_reader_read_omp_task_create( reader );
-
-        case OTF2_EVENT_OMP_TASK_SWITCH:
-            return otf2_evt_reader_read_omp_task_switch( reader );
-
-        case OTF2_EVENT_OMP_TASK_COMPLETE:
-            return otf2_evt_reader_read_omp_task_complete( reader );
-
-        case OTF2_EVENT_METRIC:
-            return otf2_evt_reader_read_metric( reader );
-
-        case OTF2_EVENT_PARAMETER_STRING:
-            return otf2_evt_reader_read_parameter_string( reader );
-
-        case OTF2_EVENT_PARAMETER_INT:
-            return otf2_evt_reader_read_parameter_int( reader );
-
-        case OTF2_EVENT_PARAMETER_UNSIGNED_INT:
-            return otf2_evt_reader_read_parameter_unsigned_int( reader );
-
-        case OTF2_EVENT_RMA_WIN_CREATE:
-            return otf2_evt_reader_read_rma_win_create( reader );
-
-        case OTF2_EVENT_RMA_WIN_DESTROY:
-            return otf2_evt_reader_read_rma_win_destroy( reader );
-
-        case OTF2_EVENT_RMA_COLLECTIVE_BEGIN:
-            return otf2_evt_reader_read_rma_collective_begin( reader );
-
-        case OTF2_EVENT_RMA_COLLECTIVE_END:
-            return otf2_evt_reader_read_rma_collective_end( reader );
-
-        case OTF2_EVENT_RMA_GROUP_SYNC:
-            return otf2_evt_reader_read_rma_group_sync( reader );
-
-        case OTF2_EVENT_RMA_REQUEST_LOCK:
-            return otf2_evt_reader_read_rma_request_lock( reader );
-
-        case OTF2_EVENT_RMA_ACQUIRE_LOCK:
-            return otf2_evt_reader_read_rma_acquire_lock( reader );
-
-        case OTF2_EVENT_RMA_TRY_LOCK:
-            return otf2_evt_reader_read_rma_try_lock( reader );
-
-        case OTF2_EVENT_RMA_RELEASE_LOCK:
-            return otf2_evt_reader_read_rma_release_lock( reader );
-
-        case OTF2_EVENT_RMA_SYNC:
-            return otf2_evt_reader_read_rma_sync( reader );
-
-        case OTF2_EVENT_RMA_WAIT_CHANGE:
-            return otf2_evt_reader_read_rma_wait_change( reader );
-
-        case OTF2_EVENT_RMA_PUT:
-            return otf2_evt_reader_read_rma_put( reader );
-
-        case OTF2_EVENT_RMA_GET:
-            return otf2_evt_reader_read_rma_get( reader );
-
-        case OTF2_EVENT_RMA_ATOMIC:
-            return otf2_evt_reader_read_rma_atomic( reader );
-
-        case OTF2_EVENT_RMA_OP_COMPLETE_BLOCKING:
-            return otf2_evt_reader_read_rma_op_complete_blocking( reader );
-
-        case OTF2_EVENT_RMA_OP_COMPLETE_NON_BLOCKING:
-            return otf2_evt_reader_read_rma_op_complete_non_blocking( reader );
-
-        case OTF2_EVENT_RMA_OP_TEST:
-            return otf2_evt_reader_read_rma_op_test( reader );
-
-        case OTF2_EVENT_RMA_OP_COMPLETE_REMOTE:
-            return otf2_evt_reader_read_rma_op_complete_remote( reader );
-
-        case OTF2_EVENT_THREAD_FORK:
-            return otf2_evt_reader_read_thread_fork( reader );
-
-        case OTF2_EVENT_THREAD_JOIN:
-            return otf2_evt_reader_read_thread_join( reader );
-
-        case OTF2_EVENT_THREAD_TEAM_BEGIN:
-            return otf2_evt_reader_read_thread_team_begin( reader );
-
-        case OTF2_EVENT_THREAD_TEAM_END:
-            return otf2_evt_reader_read_thread_team_end( reader );
-
-        case OTF2_EVENT_THREAD_ACQUIRE_LOCK:
-            return otf2_evt_reader_read_thread_acquire_lock( reader );
-
-        case OTF2_EVENT_THREAD_RELEASE_LOCK:
-            return otf2_evt_reader_read_thread_release_lock( reader );
-
-        case OTF2_EVENT_THREAD_TASK_CREATE:
-            return otf2_evt_reader_read_thread_task_create( reader );
-
-        case OTF2_EVENT_THREAD_TASK_SWITCH:
-            return otf2_evt_reader_read_thread_task_switch( reader );
-
-        case OTF2_EVENT_THREAD_TASK_COMPLETE:
-            return otf2_evt_reader_read_thread_task_complete( reader );
-
-        case OTF2_EVENT_THREAD_CREATE:
-            return otf2_evt_reader_read_thread_create( reader );
-
-        case OTF2_EVENT_THREAD_BEGIN:
-            return otf2_evt_reader_read_thread_begin( reader );
-
-        case OTF2_EVENT_THREAD_WAIT:
-            return otf2_evt_reader_read_thread_wait( reader );
-
-        case OTF2_EVENT_THREAD_END:
-            return otf2_evt_reader_read_thread_end( reader );
-
-        case OTF2_EVENT_CALLING_CONTEXT_ENTER:
-            return otf2_evt_reader_read_calling_context_enter( reader );
-
-        case OTF2_EVENT_CALLING_CONTEXT_LEAVE:
-            return otf2_evt_reader_read_calling_context_leave( reader );
-
-        case OTF2_EVENT_CALLING_CONTEXT_SAMPLE:
-            return otf2_evt_reader_read_calling_context_sample( reader );
-
-        case OTF2_EVENT_TASK_CREATE:
-            return otf2_evt_reader_read_task_create( reader );
-
-        case OTF2_EVENT_TASK_DESTROY:
-            return otf2_evt_reader_read_task_destroy( reader );
-
-        case OTF2_EVENT_TASK_RUNNABLE:
-            return otf2_evt_reader_read_task_runnable( reader );
-
-        case OTF2_EVENT_ADD_DEPENDENCE:
-            return otf2_evt_reader_read_add_dependence( reader );
-
-        case OTF2_EVENT_SATISFY_DEPENDENCE:
-            return otf2_evt_reader_read_satisfy_dependence( reader );
-
-        case OTF2_EVENT_DATA_ACQUIRE:
-            return otf2_evt_reader_read_data_acquire( reader );
-
-        case OTF2_EVENT_DATA_RELEASE:
-            return otf2_evt_reader_read_data_release( reader );
-
-        case OTF2_EVENT_EVENT_CREATE:
-            return otf2_evt_reader_read_event_create( reader );
+            continue;
+        }
 
-        case OTF2_EVENT_EVENT_DESTROY:
-            return otf2_evt_reader_read_event_destroy( reader );
+        if ( event->type == OTF2_BUFFER_ATTRIBUTE_LIST_DEFINE ||
+             event->type == OTF2_BUFFER_ATTRIBUTE_LIST_REFERENCE )
+        {
+            status = otf2_evt_reader_read_shaped_attribute_list( reader,
+                                                                 event->type );
+            if ( status != OTF2_SUCCESS )
+            {
+                return UTILS_ERROR( status, "Read of additional attributes failed!" );
+            }
+            continue;
+        }
 
-        case OTF2_EVENT_DATA_CREATE:
-            return otf2_evt_reader_read_data_create( reader );
+        break;
+    }
 
-        case OTF2_EVENT_DATA_DESTROY:
-            return otf2_evt_reader_read_data_destroy( reader );
+    if ( event->type == OTF2_BUFFER_END_OF_FILE )
+    {
+        return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+    }
 
-        default:
-            return otf2_evt_reader_read_unknown( reader );
+    if ( otf2_evt_reader_read_table[ event->type ] )
+    {
+        return otf2_evt_reader_read_table[ event->type ]( reader );
     }
+    return otf2_evt_reader_read_unknown( reader );
 }
 
 
@@ -54,6 +54,7 @@
 #include "otf2_file_types.h"
 #include "otf2_reader.h"
 #include "otf2_archive.h"
+#include "otf2_archive_location.h"
 
 #include "otf2_attic_types.h"
 
@@ -68,6 +69,59 @@
 
 #include "otf2_evt_writer.h"
 
+
+static inline void
+otf2_evt_writer_enter_region( OTF2_EvtWriter* writer,
+                              OTF2_RegionRef  region );
+
+
+static inline bool
+otf2_evt_writer_leave_region( OTF2_EvtWriter* writer,
+                              OTF2_RegionRef  region );
+
+
+static OTF2_ErrorCode
+otf2_evt_writer_metric_delta( OTF2_EvtWriter*         writer,
+                              OTF2_MetricRef          metric,
+                              uint8_t                 numberOfMetrics,
+                              const OTF2_Type*        typeIDs,
+                              const OTF2_MetricValue* metricValues,
+                              bool*                   written );
+
+
+static bool
+otf2_evt_writer_calling_context_sample_delta( OTF2_EvtWriter*            writer,
+                                              OTF2_CallingContextRef     callingContext,
+                                              uint32_t                   unwindDistance,
+                                              OTF2_InterruptGeneratorRef interruptGenerator );
+
+
+static inline void
+otf2_evt_writer_enter_tentatively( OTF2_EvtWriter*          writer,
+                                   const otf2_rewind_point* state,
+                                   uint64_t                 attributeListSize,
+                                   OTF2_TimeStamp           time,
+                                   OTF2_RegionRef           region );
+
+
+static bool
+otf2_evt_writer_filter_leave( OTF2_EvtWriter* writer,
+                              uint64_t        attributeListSize,
+                              OTF2_TimeStamp  time,
+                              OTF2_RegionRef  region );
+
+
+static OTF2_ErrorCode
+otf2_evt_writer_suppress_enter( OTF2_EvtWriter*           writer,
+                                const otf2_region_filter* filter,
+                                OTF2_RegionRef            region,
+                                bool*                     suppressed );
+
+
+static inline bool
+otf2_evt_writer_suppress_leave( OTF2_EvtWriter* writer );
+
+
 /* This _must_ be done for the generated part of the OTF2 local writer */
 #include "OTF2_EvtWriter_inc.c"
 /* This _must_ be done for the generated part of the OTF2 local writer */
@@ -131,6 +185,42 @@ otf2_evt_writer_new( OTF2_Archive*    archive,
     writer->archive     = archive;
     writer->location_id = OTF2_UNDEFINED_LOCATION;
 
+    if ( archive->file_mode == OTF2_FILEMODE_WRITE )
+    {
+        OTF2_Boolean implicit_leave;
+        otf2_archive_query_hint( archive,
+                                 OTF2_HINT_IMPLICIT_LEAVE,
+                                 &implicit_leave );
+        writer->implicit_leave = ( implicit_leave == OTF2_TRUE );
+
+        OTF2_Boolean attribute_list_shapes;
+        otf2_archive_query_hint( archive,
+                                 OTF2_HINT_ATTRIBUTE_LIST_SHAPES,
+                                 &attribute_list_shapes );
+        if ( attribute_list_shapes == OTF2_TRUE )
+        {
+            writer->attribute_shapes = calloc( 1, sizeof( *writer->attribute_shapes ) );
+            if ( !writer->attribute_shapes )
+            {
+                UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                             "Could not allocate attribute list shapes." );
+                goto clean_mem_new;
+            }
+        }
+
+        OTF2_Boolean metric_deltas;
+        otf2_archive_query_hint( archive,
+                                 OTF2_HINT_METRIC_DELTAS,
+                                 &metric_deltas );
+        writer->metric_deltas = ( metric_deltas == OTF2_TRUE );
+
+        OTF2_Boolean calling_context_deltas;
+        otf2_archive_query_hint( archive,
+                                 OTF2_HINT_CALLING_CONTEXT_DELTAS,
+                                 &calling_context_deltas );
+        writer->calling_context_deltas = ( calling_context_deltas == OTF2_TRUE );
+    }
+
     /* Put the location ID into the writer */
     if ( location != OTF2_UNDEFINED_LOCATION )
     {
@@ -177,6 +267,20 @@ otf2_evt_writer_delete( OTF2_EvtWriter* writer )
     }
 
     OTF2_ErrorCode ret;
+
+    /* Record the event time range, the local definition writer stores it. */
+    if ( writer->buffer->first_time != OTF2_UNDEFINED_TIMESTAMP )
+    {
+        ret = otf2_archive_location_set_event_time_range( writer->archive,
+                                                          writer->location_id,
+                                                          writer->buffer->first_time,
+                                                          writer->buffer->time );
+        if ( ret != OTF2_SUCCESS )
+        {
+            UTILS_ERROR( ret, "Recording the event time range failed!" );
+        }
+    }
+
     OTF2_Buffer_WriteUint8( writer->buffer, OTF2_BUFFER_END_OF_FILE );
 
     ret = OTF2_Buffer_Delete( writer->buffer );
@@ -186,6 +290,17 @@ otf2_evt_writer_delete( OTF2_EvtWriter* writer )
                             "Buffer deletion failed!" );
     }
 
+    free( writer->region_stack );
+    free( writer->attribute_shapes );
+    for ( uint32_t i = 0; i < writer->number_of_metrics; i++ )
+    {
+        free( writer->metrics[ i ].type_ids );
+        free( writer->metrics[ i ].values );
+    }
+    free( writer->metrics );
+    free( writer->tentative_enters );
+    free( writer->filtered_regions );
+    free( writer->suppressed_stack );
     free( writer );
 
     return OTF2_SUCCESS;
@@ -311,6 +426,118 @@ OTF2_EvtWriter_GetNumberOfEvents( OTF2_EvtWriter* writer,
 }
 
 
+/** Upper bound of the size of an Enter or Leave record without attribute
+ *  list, including its timestamp. */
+#define OTF2_EVT_WRITER_ENTER_LEAVE_MAX_SIZE \
+    ( OTF2_BUFFER_TIMESTAMP_SIZE + 1 + sizeof( OTF2_RegionRef ) + 1 )
+
+
+OTF2_ErrorCode
+OTF2_EvtWriter_EnterLeaveBatch( OTF2_EvtWriter*       writerHandle,
+                                uint32_t              numberOfEvents,
+                                const OTF2_TimeStamp* times,
+                                const OTF2_RegionRef* regions,
+                                const OTF2_Boolean*   leave )
+{
+    if ( NULL == writerHandle )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "This is no valid event writer handle!" );
+    }
+    if ( numberOfEvents > 0 && ( !times || !regions || !leave ) )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid event arrays." );
+    }
+
+    OTF2_Buffer*   buffer = writerHandle->buffer;
+    OTF2_ErrorCode status;
+    uint32_t       i = 0;
+    bool           filtered = writerHandle->duration_threshold
+                              || otf2_archive_get_region_filter( writerHandle->archive );
+    while ( i < numberOfEvents && filtered )
+    {
+        /* The filters are only implemented by the single event writers. */
+        status = leave[ i ]
+                 ? OTF2_EvtWriter_Leave( writerHandle, NULL, times[ i ], regions[ i ] )
+                 : OTF2_EvtWriter_Enter( writerHandle, NULL, times[ i ], regions[ i ] );
+        if ( OTF2_SUCCESS != status )
+        {
+            return status;
+        }
+        i++;
+    }
+    while ( i < numberOfEvents )
+    {
+        /* Write the events which surely fit into the current chunk without
+         * further checks. */
+        otf2_chunk* chunk     = buffer->chunk;
+        uint64_t    remaining = chunk->end - buffer->write_pos;
+        uint64_t    fitting   = remaining
+                                ? ( remaining - 1 ) / OTF2_EVT_WRITER_ENTER_LEAVE_MAX_SIZE
+                                : 0;
+        if ( fitting > chunk->index_next - chunk->first_event )
+        {
+            fitting = chunk->index_next - chunk->first_event;
+        }
+        if ( fitting > numberOfEvents - i )
+        {
+            fitting = numberOfEvents - i;
+        }
+
+        uint32_t begin = i;
+        uint32_t end   = i + fitting;
+        for ( ; i < end; i++ )
+        {
+            /* Misordered timestamps and those before the first non-zero
+             * one are handled by the single event writers. */
+            if ( buffer->time == 0 || times[ i ] < buffer->time )
+            {
+                break;
+            }
+            if ( times[ i ] > buffer->time )
+            {
+                OTF2_Buffer_WriteUint8( buffer, OTF2_BUFFER_TIMESTAMP );
+                OTF2_Buffer_WriteUint64Full( buffer, times[ i ] );
+                buffer->time = times[ i ];
+            }
+            if ( leave[ i ] && writerHandle->implicit_leave &&
+                 otf2_evt_writer_leave_region( writerHandle, regions[ i ] ) )
+            {
+                OTF2_Buffer_WriteUint8( buffer, OTF2_BUFFER_IMPLICIT_LEAVE );
+                continue;
+            }
+            OTF2_Buffer_WriteUint8( buffer,
+                                    leave[ i ] ? OTF2_EVENT_LEAVE : OTF2_EVENT_ENTER );
+            OTF2_Buffer_WriteUint32( buffer, regions[ i ] );
+            if ( !leave[ i ] && writerHandle->implicit_leave )
+            {
+                otf2_evt_writer_enter_region( writerHandle, regions[ i ] );
+            }
+        }
+        chunk->first_event += i - begin;
+
+        if ( i == numberOfEvents )
+        {
+            break;
+        }
+
+        /* The next event needs a new chunk, an index entry, or a check of
+         * its timestamp. */
+        status = leave[ i ]
+                 ? OTF2_EvtWriter_Leave( writerHandle, NULL, times[ i ], regions[ i ] )
+                 : OTF2_EvtWriter_Enter( writerHandle, NULL, times[ i ], regions[ i ] );
+        if ( OTF2_SUCCESS != status )
+        {
+            return status;
+        }
+        i++;
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
 OTF2_ErrorCode
 OTF2_EvtWriter_StoreRewindPoint( OTF2_EvtWriter* writerHandle,
                                  uint32_t        rewindId )
@@ -321,7 +548,9 @@ OTF2_EvtWriter_StoreRewindPoint( OTF2_EvtWriter* writerHandle,
                             "This is no valid event writer handle!" );
     }
 
-    return OTF2_Buffer_StoreRewindPoint( writerHandle->buffer, rewindId );
+    return OTF2_Buffer_StoreRewindPoint( writerHandle->buffer,
+                                         rewindId,
+                                         writerHandle->suppressed_stack_size );
 }
 
 
@@ -339,6 +568,81 @@ OTF2_EvtWriter_ClearRewindPoint( OTF2_EvtWriter* writerHandle,
 }
 
 
+OTF2_ErrorCode
+OTF2_EvtWriter_SetDurationFilter( OTF2_EvtWriter* writerHandle,
+                                  OTF2_TimeStamp  threshold,
+                                  OTF2_Boolean    summary )
+{
+    if ( NULL == writerHandle )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "This is no valid event writer handle!" );
+    }
+
+    /* The already written enters are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+    writerHandle->duration_threshold         = threshold;
+    writerHandle->filter_summary             = ( summary == OTF2_TRUE );
+
+    return OTF2_SUCCESS;
+}
+
+
+OTF2_ErrorCode
+OTF2_EvtWriter_GetFilteredRegion( const OTF2_EvtWriter* writerHandle,
+                                  OTF2_RegionRef        region,
+                                  uint64_t*             numberOfCalls,
+                                  OTF2_TimeStamp*       duration )
+{
+    if ( NULL == writerHandle )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "This is no valid event writer handle!" );
+    }
+    if ( NULL == numberOfCalls || NULL == duration )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid arguments!" );
+    }
+
+    *numberOfCalls = 0;
+    *duration      = 0;
+    if ( region < writerHandle->number_of_filtered_regions )
+    {
+        *numberOfCalls = writerHandle->filtered_regions[ region ].count;
+        *duration      = writerHandle->filtered_regions[ region ].duration;
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+OTF2_ErrorCode
+OTF2_EvtWriter_GetSuppressedCalls( const OTF2_EvtWriter* writerHandle,
+                                   OTF2_RegionRef        region,
+                                   uint64_t*             numberOfCalls )
+{
+    if ( NULL == writerHandle )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "This is no valid event writer handle!" );
+    }
+    if ( NULL == numberOfCalls )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid arguments!" );
+    }
+
+    *numberOfCalls = 0;
+    if ( region < writerHandle->number_of_filtered_regions )
+    {
+        *numberOfCalls = writerHandle->filtered_regions[ region ].suppressed;
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
 OTF2_ErrorCode
 OTF2_EvtWriter_Rewind( OTF2_EvtWriter* writerHandle,
                        uint32_t        rewindId )
@@ -349,7 +653,529 @@ OTF2_EvtWriter_Rewind( OTF2_EvtWriter* writerHandle,
                             "This is no valid event writer handle!" );
     }
 
-    return OTF2_Buffer_Rewind( writerHandle->buffer, rewindId );
+    OTF2_ErrorCode status = OTF2_Buffer_Rewind( writerHandle->buffer,
+                                                rewindId,
+                                                &writerHandle->suppressed_stack_size );
+    if ( OTF2_SUCCESS != status )
+    {
+        return status;
+    }
+
+    /* The enters on the stack may be gone, leaves are written with their
+     * region until new regions are entered. */
+    writerHandle->region_stack_size          = 0;
+    writerHandle->number_of_tentative_enters = 0;
+
+    /* The written shapes after the rewind point are gone, but their indices
+     * must not be defined again in this chunk. */
+    otf2_attribute_list_shapes* shapes = writerHandle->attribute_shapes;
+    if ( shapes )
+    {
+        if ( shapes->chunk != writerHandle->buffer->chunk_serial )
+        {
+            /* Back in an earlier chunk, its used indices are unknown. */
+            shapes->chunk            = writerHandle->buffer->chunk_serial;
+            shapes->number_of_shapes = OTF2_ATTRIBUTE_LIST_SHAPES_MAX;
+        }
+        shapes->known = 0;
+    }
+
+    /* The previous samples may be gone, too. The next sample of each metric
+     * is written completely. */
+    for ( uint32_t i = 0; i < writerHandle->number_of_metrics; i++ )
+    {
+        writerHandle->metrics[ i ].number_of_members = 0;
+    }
+    writerHandle->last_sample.known = false;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Push an entered region onto the region stack of the writer.
+ *
+ *  If the stack can't grow, it is cleared instead. The following leaves are
+ *  then written with their region.
+ *
+ *  @param writer   Writer object.
+ *  @param region   The entered region.
+ */
+static inline void
+otf2_evt_writer_enter_region( OTF2_EvtWriter* writer,
+                              OTF2_RegionRef  region )
+{
+    if ( writer->region_stack_size == writer->region_stack_capacity )
+    {
+        uint32_t capacity = writer->region_stack_capacity
+                            ? 2 * writer->region_stack_capacity
+                            : 16;
+        otf2_evt_writer_region* stack =
+            realloc( writer->region_stack, capacity * sizeof( *stack ) );
+        if ( !stack )
+        {
+            writer->region_stack_size = 0;
+            return;
+        }
+        writer->region_stack          = stack;
+        writer->region_stack_capacity = capacity;
+    }
+
+    writer->region_stack[ writer->region_stack_size ].region  = region;
+    writer->region_stack[ writer->region_stack_size ].segment = writer->buffer->segment;
+    writer->region_stack_size++;
+}
+
+
+/** @brief Pop a left region from the region stack of the writer.
+ *
+ *  The stack is only popped, if @a region is the innermost entered region.
+ *  Call this after the timestamp of the leave was written.
+ *
+ *  @param writer   Writer object.
+ *  @param region   The left region.
+ *
+ *  @return True if the leave can be written without its region, because the
+ *          matching enter is in the current chunk segment.
+ */
+static inline bool
+otf2_evt_writer_leave_region( OTF2_EvtWriter* writer,
+                              OTF2_RegionRef  region )
+{
+    if ( writer->region_stack_size == 0 ||
+         writer->region_stack[ writer->region_stack_size - 1 ].region != region )
+    {
+        return false;
+    }
+
+    writer->region_stack_size--;
+    return writer->region_stack[ writer->region_stack_size ].segment
+           == writer->buffer->segment;
+}
+
+
+/** @brief Push a written enter onto the stack of tentative enters.
+ *
+ *  An enter with attributes is kept like any other event, as are all enters
+ *  before it. If the stack can't grow, it is cleared instead.
+ *
+ *  @param writer               Writer object.
+ *  @param state                Buffer state before the enter was written.
+ *  @param attributeListSize    Size of the attribute list of the enter.
+ *  @param time                 Time of the enter.
+ *  @param region               The entered region.
+ */
+static inline void
+otf2_evt_writer_enter_tentatively( OTF2_EvtWriter*          writer,
+                                   const otf2_rewind_point* state,
+                                   uint64_t                 attributeListSize,
+                                   OTF2_TimeStamp           time,
+                                   OTF2_RegionRef           region )
+{
+    if ( attributeListSize )
+    {
+        writer->number_of_tentative_enters = 0;
+        return;
+    }
+
+    if ( writer->number_of_tentative_enters == writer->tentative_enters_capacity )
+    {
+        uint32_t capacity = writer->tentative_enters_capacity
+                            ? 2 * writer->tentative_enters_capacity
+                            : 16;
+        otf2_evt_writer_tentative_enter* stack =
+            realloc( writer->tentative_enters, capacity * sizeof( *stack ) );
+        if ( !stack )
+        {
+            writer->number_of_tentative_enters = 0;
+            return;
+        }
+        writer->tentative_enters          = stack;
+        writer->tentative_enters_capacity = capacity;
+    }
+
+    otf2_evt_writer_tentative_enter* enter =
+        &writer->tentative_enters[ writer->number_of_tentative_enters++ ];
+    enter->region = region;
+    enter->time   = time;
+    enter->state  = *state;
+}
+
+
+/** @brief Get the summary entry of a region for the dropped calls.
+ *
+ *  @param writer   Writer object.
+ *  @param region   The region.
+ *
+ *  @return The entry, NULL if the summary can't grow.
+ */
+static otf2_evt_writer_filtered_region*
+otf2_evt_writer_get_filtered_region( OTF2_EvtWriter* writer,
+                                     OTF2_RegionRef  region )
+{
+    if ( region == OTF2_UNDEFINED_REGION )
+    {
+        return NULL;
+    }
+
+    if ( region >= writer->number_of_filtered_regions )
+    {
+        uint32_t number = 2 * writer->number_of_filtered_regions;
+        if ( number <= region )
+        {
+            number = region + 1;
+        }
+        otf2_evt_writer_filtered_region* regions =
+            realloc( writer->filtered_regions, number * sizeof( *regions ) );
+        if ( !regions )
+        {
+            return NULL;
+        }
+        memset( regions + writer->number_of_filtered_regions, 0,
+                ( number - writer->number_of_filtered_regions ) * sizeof( *regions ) );
+        writer->filtered_regions           = regions;
+        writer->number_of_filtered_regions = number;
+    }
+
+    return &writer->filtered_regions[ region ];
+}
+
+
+/** @brief Drop a leave together with its enter, if the region was left
+ *  within the duration threshold.
+ *
+ *  Only the innermost tentative enter can be dropped, it must be in the
+ *  current chunk. Otherwise the leave is written and all enters before it
+ *  are kept.
+ *
+ *  @param writer               Writer object.
+ *  @param attributeListSize    Size of the attribute list of the leave.
+ *  @param time                 Time of the leave.
+ *  @param region               The left region.
+ *
+ *  @return True if the enter was dropped and the leave must not be written.
+ */
+static bool
+otf2_evt_writer_filter_leave( OTF2_EvtWriter* writer,
+                              uint64_t        attributeListSize,
+                              OTF2_TimeStamp  time,
+                              OTF2_RegionRef  region )
+{
+    const otf2_evt_writer_tentative_enter* enter =
+        &writer->tentative_enters[ writer->number_of_tentative_enters - 1 ];
+    OTF2_Buffer*                     buffer  = writer->buffer;
+    otf2_evt_writer_filtered_region* summary = NULL;
+
+    if ( attributeListSize
+         || enter->region != region
+         || time < enter->time
+         || time - enter->time >= writer->duration_threshold
+         || enter->state.chunk_serial != buffer->chunk_serial
+         || ( writer->filter_summary
+              && !( summary = otf2_evt_writer_get_filtered_region( writer, region ) ) ) )
+    {
+        writer->number_of_tentative_enters = 0;
+        return false;
+    }
+
+    if ( summary )
+    {
+        summary->count++;
+        summary->duration += time - enter->time;
+    }
+
+    writer->number_of_tentative_enters--;
+    OTF2_Buffer_RestoreState( buffer, &enter->state );
+    if ( writer->implicit_leave )
+    {
+        otf2_evt_writer_leave_region( writer, region );
+    }
+
+    return true;
+}
+
+
+/** @brief Decide whether an enter is dropped by the region filter of the
+ *  archive.
+ *
+ *  The decision is pushed onto the suppressed stack, so that the matching
+ *  leave follows it, even if the filter changes in between. If the stack
+ *  can't grow, an error is returned and the stack is left unchanged, the
+ *  enter must then not be written.
+ *
+ *  @param writer           Writer object.
+ *  @param filter           The current version of the region filter.
+ *  @param region           The entered region.
+ *  @param[out] suppressed  True if the enter must not be written.
+ *
+ *  @return OTF2_SUCCESS if successful, an error code if an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_evt_writer_suppress_enter( OTF2_EvtWriter*           writer,
+                                const otf2_region_filter* filter,
+                                OTF2_RegionRef            region,
+                                bool*                     suppressed )
+{
+    if ( writer->suppressed_stack_size == writer->suppressed_stack_capacity )
+    {
+        uint32_t capacity = writer->suppressed_stack_capacity
+                            ? 2 * writer->suppressed_stack_capacity
+                            : 64;
+        uint64_t* stack = realloc( writer->suppressed_stack, capacity / 8 );
+        if ( !stack )
+        {
+            return UTILS_ERROR( OTF2_ERROR_MEM_ALLOC_FAILED,
+                                "Could not grow the suppressed stack." );
+        }
+        writer->suppressed_stack          = stack;
+        writer->suppressed_stack_capacity = capacity;
+    }
+
+    uint32_t index    = writer->suppressed_stack_size++;
+    uint64_t bit      = UINT64_C( 1 ) << ( index % 64 );
+    bool     suppress = otf2_region_filter_test( filter, region );
+    if ( suppress )
+    {
+        writer->suppressed_stack[ index / 64 ] |= bit;
+
+        otf2_evt_writer_filtered_region* summary =
+            otf2_evt_writer_get_filtered_region( writer, region );
+        if ( summary )
+        {
+            summary->suppressed++;
+        }
+    }
+    else
+    {
+        writer->suppressed_stack[ index / 64 ] &= ~bit;
+    }
+
+    /* Let the archive free the older versions of the filter. */
+    if ( writer->region_filter_version != filter->version )
+    {
+#if defined( __GNUC__ )
+        __atomic_store_n( &writer->region_filter_version, filter->version, __ATOMIC_RELEASE );
+#else
+        *( volatile uint64_t* )&writer->region_filter_version = filter->version;
+#endif
+    }
+
+    *suppressed = suppress;
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Decide whether a leave is dropped by the region filter of the
+ *  archive.
+ *
+ *  Leaves of enters, which were written before the archive had a region
+ *  filter, are recorded.
+ *
+ *  @param writer   Writer object.
+ *
+ *  @return True if the matching enter was dropped.
+ */
+static inline bool
+otf2_evt_writer_suppress_leave( OTF2_EvtWriter* writer )
+{
+    if ( writer->suppressed_stack_size == 0 )
+    {
+        return false;
+    }
+
+    uint32_t index = --writer->suppressed_stack_size;
+    return ( writer->suppressed_stack[ index / 64 ] >> ( index % 64 ) ) & 1;
+}
+
+
+/** @brief Write a metric sample as deltas to the previous sample.
+ *
+ *  The previous sample must be in the same chunk segment and have the same
+ *  number and types of values. Otherwise @a written is false and the sample
+ *  is remembered, the caller writes it completely. Call this after the
+ *  timestamp of the sample was written.
+ *
+ *  @param writer           Writer object.
+ *  @param metric           The metric of the sample.
+ *  @param numberOfMetrics  Number of values.
+ *  @param typeIDs          Types of the values.
+ *  @param metricValues     The values.
+ *  @param[out] written     Whether the sample was written.
+ *
+ *  @return OTF2_SUCCESS if successful, an error code if an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_evt_writer_metric_delta( OTF2_EvtWriter*         writer,
+                              OTF2_MetricRef          metric,
+                              uint8_t                 numberOfMetrics,
+                              const OTF2_Type*        typeIDs,
+                              const OTF2_MetricValue* metricValues,
+                              bool*                   written )
+{
+    OTF2_Buffer* buffer = writer->buffer;
+    *written = false;
+
+    otf2_evt_writer_metric* previous = NULL;
+    for ( uint32_t i = 0; i < writer->number_of_metrics; i++ )
+    {
+        if ( writer->metrics[ i ].metric == metric )
+        {
+            previous = &writer->metrics[ i ];
+            break;
+        }
+    }
+    if ( !previous )
+    {
+        otf2_evt_writer_metric* metrics =
+            realloc( writer->metrics,
+                     ( writer->number_of_metrics + 1 ) * sizeof( *metrics ) );
+        if ( !metrics )
+        {
+            /* Write the sample completely. */
+            return OTF2_SUCCESS;
+        }
+        writer->metrics = metrics;
+        previous        = &metrics[ writer->number_of_metrics++ ];
+        memset( previous, 0, sizeof( *previous ) );
+        previous->metric = metric;
+    }
+
+    bool delta = numberOfMetrics > 0 &&
+                 previous->number_of_members == numberOfMetrics &&
+                 previous->segment == buffer->segment &&
+                 memcmp( previous->type_ids, typeIDs,
+                         numberOfMetrics * sizeof( *typeIDs ) ) == 0;
+    if ( !delta )
+    {
+        /* Remember the sample, if all of its values can be deltas. */
+        previous->number_of_members = 0;
+        for ( uint8_t i = 0; i < numberOfMetrics; i++ )
+        {
+            if ( typeIDs[ i ] != OTF2_TYPE_INT64 &&
+                 typeIDs[ i ] != OTF2_TYPE_UINT64 &&
+                 typeIDs[ i ] != OTF2_TYPE_DOUBLE )
+            {
+                return OTF2_SUCCESS;
+            }
+        }
+        if ( previous->capacity < numberOfMetrics )
+        {
+            free( previous->type_ids );
+            free( previous->values );
+            previous->capacity = 0;
+            previous->type_ids = malloc( numberOfMetrics * sizeof( *previous->type_ids ) );
+            previous->values   = malloc( numberOfMetrics * sizeof( *previous->values ) );
+            if ( !previous->type_ids || !previous->values )
+            {
+                return OTF2_SUCCESS;
+            }
+            previous->capacity = numberOfMetrics;
+        }
+        memcpy( previous->type_ids, typeIDs, numberOfMetrics * sizeof( *typeIDs ) );
+        memcpy( previous->values, metricValues, numberOfMetrics * sizeof( *metricValues ) );
+        previous->number_of_members = numberOfMetrics;
+        previous->segment           = buffer->segment;
+        previous->event             = buffer->chunk->first_event;
+
+        return OTF2_SUCCESS;
+    }
+
+    uint64_t record_data_length = sizeof( OTF2_MetricRef ) + 1
+                                  + sizeof( uint64_t ) + 1
+                                  + numberOfMetrics * ( sizeof( OTF2_MetricValue ) + 1 );
+
+    OTF2_Buffer_WriteUint8( buffer, OTF2_BUFFER_METRIC_DELTA );
+    OTF2_Buffer_WriteInitialRecordLength( buffer, record_data_length );
+
+    OTF2_Buffer_WriteUint32( buffer, metric );
+    /* The distance in events lets the reader verify its previous sample. */
+    OTF2_Buffer_WriteUint64( buffer, buffer->chunk->first_event - previous->event );
+    for ( uint8_t i = 0; i < numberOfMetrics; i++ )
+    {
+        /* Integers as zig-zag encoded differences, doubles as the changed
+         * bits. Both keep the leading bytes zero for slowly changing
+         * values. */
+        uint64_t word = metricValues[ i ].unsigned_int ^ previous->values[ i ].unsigned_int;
+        if ( typeIDs[ i ] != OTF2_TYPE_DOUBLE )
+        {
+            int64_t difference = ( int64_t )( metricValues[ i ].unsigned_int
+                                              - previous->values[ i ].unsigned_int );
+            word = ( ( uint64_t )difference << 1 ) ^ ( uint64_t )( difference >> 63 );
+        }
+        OTF2_Buffer_WriteUint64( buffer, word );
+        previous->values[ i ] = metricValues[ i ];
+    }
+    previous->event = buffer->chunk->first_event;
+    *written        = true;
+
+    return OTF2_Buffer_WriteFinalRecordLength( buffer, record_data_length );
+}
+
+
+/** @brief Write a calling context sample as delta to the previous sample.
+ *
+ *  The previous sample must be in the same chunk segment. Otherwise the
+ *  sample is only remembered and the caller writes it completely. Call this
+ *  after the timestamp of the sample was written.
+ *
+ *  The record has no record length. It holds the distance in events to the
+ *  previous sample shifted left by 2, or-ed with the
+ *  OTF2_BufferSampleDelta_enum flags, the zig-zag encoded difference of the
+ *  calling context, and the flagged attributes.
+ *
+ *  @param writer               Writer object.
+ *  @param callingContext       The calling context of the sample.
+ *  @param unwindDistance       The unwind distance of the sample.
+ *  @param interruptGenerator   The interrupt generator of the sample.
+ *
+ *  @return Whether the sample was written.
+ */
+static bool
+otf2_evt_writer_calling_context_sample_delta( OTF2_EvtWriter*            writer,
+                                              OTF2_CallingContextRef     callingContext,
+                                              uint32_t                   unwindDistance,
+                                              OTF2_InterruptGeneratorRef interruptGenerator )
+{
+    OTF2_Buffer*            buffer   = writer->buffer;
+    otf2_evt_writer_sample* previous = &writer->last_sample;
+
+    bool delta = previous->known && previous->segment == buffer->segment;
+    if ( delta )
+    {
+        uint8_t flags = 0;
+        if ( unwindDistance != previous->unwind_distance )
+        {
+            flags |= OTF2_BUFFER_SAMPLE_DELTA_UNWIND_DISTANCE;
+        }
+        if ( interruptGenerator != previous->interrupt_generator )
+        {
+            flags |= OTF2_BUFFER_SAMPLE_DELTA_INTERRUPT_GENERATOR;
+        }
+        int64_t difference = ( int64_t )callingContext
+                             - ( int64_t )previous->calling_context;
+
+        OTF2_Buffer_WriteUint8( buffer, OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA );
+        OTF2_Buffer_WriteUint64( buffer,
+                                 ( ( buffer->chunk->first_event - previous->event ) << 2 ) | flags );
+        OTF2_Buffer_WriteUint64( buffer,
+                                 ( ( uint64_t )difference << 1 ) ^ ( uint64_t )( difference >> 63 ) );
+        if ( flags & OTF2_BUFFER_SAMPLE_DELTA_UNWIND_DISTANCE )
+        {
+            OTF2_Buffer_WriteUint32( buffer, unwindDistance );
+        }
+        if ( flags & OTF2_BUFFER_SAMPLE_DELTA_INTERRUPT_GENERATOR )
+        {
+            OTF2_Buffer_WriteUint32( buffer, interruptGenerator );
+        }
+    }
+
+    previous->known               = true;
+    previous->segment             = buffer->segment;
+    previous->event               = buffer->chunk->first_event;
+    previous->calling_context     = callingContext;
+    previous->unwind_distance     = unwindDistance;
+    previous->interrupt_generator = interruptGenerator;
+
+    return delta;
 }
 
 
@@ -65,6 +65,10 @@ OTF2_TimeStamp stopTime )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -97,8 +101,12 @@ OTF2_TimeStamp stopTime )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -145,6 +153,10 @@ OTF2_MeasurementMode measurementMode )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -177,8 +189,12 @@ OTF2_MeasurementMode measurementMode )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -213,6 +229,26 @@ OTF2_RegionRef region )
 
     OTF2_ErrorCode ret;
 
+    /* Regions filtered at runtime are not recorded at all. */
+    const otf2_region_filter* region_filter =
+        otf2_archive_get_region_filter( writerHandle->archive );
+    if ( region_filter )
+    {
+        bool suppressed = false;
+        ret = otf2_evt_writer_suppress_enter( writerHandle,
+                                              region_filter,
+                                              region,
+                                              &suppressed );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Region filter failed." );
+        }
+        if ( suppressed )
+        {
+            return OTF2_SUCCESS;
+        }
+    }
+
     /*
      * Maximum record length is the record id byte, plus the individual sizes of the
      * attributes (excluding the timestamp), and the size of the attribute list.
@@ -225,6 +261,15 @@ OTF2_RegionRef region )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The buffer state before the enter, to drop it together with its
+     * leave. */
+    otf2_rewind_point enter_state;
+    if ( writerHandle->duration_threshold )
+    {
+        OTF2_Buffer_SaveState( writerHandle->buffer, &enter_state );
+    }
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -246,8 +291,12 @@ OTF2_RegionRef region )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -258,6 +307,19 @@ OTF2_RegionRef region )
 
     OTF2_Buffer_WriteUint32( writerHandle->buffer, region );
 
+    if ( writerHandle->implicit_leave )
+    {
+        otf2_evt_writer_enter_region( writerHandle, region );
+    }
+    if ( writerHandle->duration_threshold )
+    {
+        otf2_evt_writer_enter_tentatively( writerHandle,
+                                           &enter_state,
+                                           attribute_list_size,
+                                           time,
+                                           region );
+    }
+
     return ret;
 }
 
@@ -276,6 +338,13 @@ OTF2_RegionRef region )
 
     OTF2_ErrorCode ret;
 
+    /* Regions filtered at runtime are not recorded at all. */
+    if ( otf2_archive_get_region_filter( writerHandle->archive ) &&
+         otf2_evt_writer_suppress_leave( writerHandle ) )
+    {
+        return OTF2_SUCCESS;
+    }
+
     /*
      * Maximum record length is the record id byte, plus the individual sizes of the
      * attributes (excluding the timestamp), and the size of the attribute list.
@@ -288,6 +357,14 @@ OTF2_RegionRef region )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* Regions left within the duration threshold are not recorded at all. */
+    if ( writerHandle->number_of_tentative_enters &&
+         otf2_evt_writer_filter_leave( writerHandle, attribute_list_size, time, region ) )
+    {
+        return OTF2_SUCCESS;
+    }
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -309,14 +386,27 @@ OTF2_RegionRef region )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
         }
     }
 
+    /* The region of the innermost enter in the same chunk segment is known
+     * to the reader. */
+    if ( writerHandle->implicit_leave &&
+         otf2_evt_writer_leave_region( writerHandle, region ) )
+    {
+        OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_BUFFER_IMPLICIT_LEAVE );
+        return OTF2_SUCCESS;
+    }
+
     OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_EVENT_LEAVE );
 
     OTF2_Buffer_WriteUint32( writerHandle->buffer, region );
@@ -354,6 +444,10 @@ uint64_t msgLength )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -389,8 +483,12 @@ uint64_t msgLength )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -444,6 +542,10 @@ uint64_t requestID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -480,8 +582,12 @@ uint64_t requestID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -532,6 +638,10 @@ uint64_t requestID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -553,8 +663,12 @@ uint64_t requestID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -595,6 +709,10 @@ uint64_t requestID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -616,8 +734,12 @@ uint64_t requestID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -661,6 +783,10 @@ uint64_t msgLength )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -696,8 +822,12 @@ uint64_t msgLength )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -751,6 +881,10 @@ uint64_t requestID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -787,8 +921,12 @@ uint64_t requestID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -839,6 +977,10 @@ uint64_t requestID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -860,8 +1002,12 @@ uint64_t requestID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -902,6 +1048,10 @@ uint64_t requestID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -923,8 +1073,12 @@ uint64_t requestID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -964,6 +1118,10 @@ OTF2_EvtWriter_MpiCollectiveBegin( OTF2_EvtWriter*     writerHandle,
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * For records without attributes, we need one additional zero byte for the
      * record length.
@@ -981,8 +1139,12 @@ OTF2_EvtWriter_MpiCollectiveBegin( OTF2_EvtWriter*     writerHandle,
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1028,6 +1190,10 @@ uint64_t sizeReceived )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1064,8 +1230,12 @@ uint64_t sizeReceived )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1116,6 +1286,10 @@ uint32_t numberOfRequestedThreads )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1137,8 +1311,12 @@ uint32_t numberOfRequestedThreads )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1178,6 +1356,10 @@ OTF2_EvtWriter_OmpJoin( OTF2_EvtWriter*     writerHandle,
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * For records without attributes, we need one additional zero byte for the
      * record length.
@@ -1195,8 +1377,12 @@ OTF2_EvtWriter_OmpJoin( OTF2_EvtWriter*     writerHandle,
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1239,6 +1425,10 @@ uint32_t acquisitionOrder )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1272,8 +1462,12 @@ uint32_t acquisitionOrder )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1322,6 +1516,10 @@ uint32_t acquisitionOrder )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1355,8 +1553,12 @@ uint32_t acquisitionOrder )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1404,6 +1606,10 @@ uint64_t taskID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1425,8 +1631,12 @@ uint64_t taskID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1467,6 +1677,10 @@ uint64_t taskID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1488,8 +1702,12 @@ uint64_t taskID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1530,6 +1748,10 @@ uint64_t taskID )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1551,8 +1773,12 @@ uint64_t taskID )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1596,6 +1822,10 @@ const OTF2_MetricValue* metricValues )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1630,6 +1860,10 @@ const OTF2_MetricValue* metricValues )
         record_length += 8;
     }
 
+    /* A delta sample stores the distance to the previous sample instead of
+     * the types. */
+    record_length += sizeof( uint64_t ) + 1;
+
     ret = OTF2_Buffer_WriteTimeStamp( writerHandle->buffer,
                                       time,
                                       record_length );
@@ -1641,14 +1875,35 @@ const OTF2_MetricValue* metricValues )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
         }
     }
 
+    /* Later samples in the same chunk segment are deltas to the previous
+     * one. */
+    if ( writerHandle->metric_deltas )
+    {
+        bool written;
+        ret = otf2_evt_writer_metric_delta( writerHandle,
+                                            metric,
+                                            numberOfMetrics,
+                                            typeIDs,
+                                            metricValues,
+                                            &written );
+        if ( OTF2_SUCCESS != ret || written )
+        {
+            return ret;
+        }
+    }
+
     OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_EVENT_METRIC );
 
     /* Write initial record length */
@@ -1700,6 +1955,10 @@ OTF2_StringRef string )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1733,8 +1992,12 @@ OTF2_StringRef string )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1783,6 +2046,10 @@ int64_t value )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1816,8 +2083,12 @@ int64_t value )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1866,6 +2137,10 @@ uint64_t value )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1899,8 +2174,12 @@ uint64_t value )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -1948,6 +2227,10 @@ OTF2_RmaWinRef win )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -1980,8 +2263,12 @@ OTF2_RmaWinRef win )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2028,6 +2315,10 @@ OTF2_RmaWinRef win )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2060,8 +2351,12 @@ OTF2_RmaWinRef win )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2107,6 +2402,10 @@ OTF2_EvtWriter_RmaCollectiveBegin( OTF2_EvtWriter*     writerHandle,
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * For records without attributes, we need one additional zero byte for the
      * record length.
@@ -2124,8 +2423,12 @@ OTF2_EvtWriter_RmaCollectiveBegin( OTF2_EvtWriter*     writerHandle,
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2172,6 +2475,10 @@ uint64_t bytesReceived )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2209,8 +2516,12 @@ uint64_t bytesReceived )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2264,6 +2575,10 @@ OTF2_GroupRef group )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2298,8 +2613,12 @@ OTF2_GroupRef group )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2351,6 +2670,10 @@ OTF2_LockType lockType )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2386,8 +2709,12 @@ OTF2_LockType lockType )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2440,6 +2767,10 @@ OTF2_LockType lockType )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2475,8 +2806,12 @@ OTF2_LockType lockType )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2529,6 +2864,10 @@ OTF2_LockType lockType )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2564,8 +2903,12 @@ OTF2_LockType lockType )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2617,6 +2960,10 @@ uint64_t lockId )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2651,8 +2998,12 @@ uint64_t lockId )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2703,6 +3054,10 @@ OTF2_RmaSyncType syncType )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2737,8 +3092,12 @@ OTF2_RmaSyncType syncType )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2787,6 +3146,10 @@ OTF2_RmaWinRef win )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2819,8 +3182,12 @@ OTF2_RmaWinRef win )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2870,6 +3237,10 @@ uint64_t matchingId )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2905,8 +3276,12 @@ uint64_t matchingId )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -2959,6 +3334,10 @@ uint64_t matchingId )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -2994,8 +3373,12 @@ uint64_t matchingId )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3050,6 +3433,10 @@ uint64_t matchingId )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3087,8 +3474,12 @@ uint64_t matchingId )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3141,6 +3532,10 @@ uint64_t matchingId )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3174,8 +3569,12 @@ uint64_t matchingId )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3224,6 +3623,10 @@ uint64_t matchingId )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3257,8 +3660,12 @@ uint64_t matchingId )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3307,6 +3714,10 @@ uint64_t matchingId )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3340,8 +3751,12 @@ uint64_t matchingId )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3390,6 +3805,10 @@ uint64_t matchingId )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3423,8 +3842,12 @@ uint64_t matchingId )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3473,6 +3896,10 @@ uint32_t numberOfRequestedThreads )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3506,8 +3933,12 @@ uint32_t numberOfRequestedThreads )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3555,6 +3986,10 @@ OTF2_Paradigm model )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3587,8 +4022,12 @@ OTF2_Paradigm model )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3635,6 +4074,10 @@ OTF2_CommRef threadTeam )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3667,8 +4110,12 @@ OTF2_CommRef threadTeam )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3715,6 +4162,10 @@ OTF2_CommRef threadTeam )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3747,8 +4198,12 @@ OTF2_CommRef threadTeam )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3797,6 +4252,10 @@ uint32_t acquisitionOrder )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3831,8 +4290,12 @@ uint32_t acquisitionOrder )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3883,6 +4346,10 @@ uint32_t acquisitionOrder )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -3917,8 +4384,12 @@ uint32_t acquisitionOrder )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -3969,6 +4440,10 @@ uint32_t generationNumber )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4003,8 +4478,12 @@ uint32_t generationNumber )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4055,6 +4534,10 @@ uint32_t generationNumber )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4089,8 +4572,12 @@ uint32_t generationNumber )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4141,6 +4628,10 @@ uint32_t generationNumber )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4175,8 +4666,12 @@ uint32_t generationNumber )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4226,6 +4721,10 @@ uint64_t sequenceCount )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4259,8 +4758,12 @@ uint64_t sequenceCount )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4309,6 +4812,10 @@ uint64_t sequenceCount )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4342,8 +4849,12 @@ uint64_t sequenceCount )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4392,6 +4903,10 @@ uint64_t sequenceCount )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4425,8 +4940,12 @@ uint64_t sequenceCount )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4475,6 +4994,10 @@ uint64_t sequenceCount )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4508,8 +5031,12 @@ uint64_t sequenceCount )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4558,6 +5085,10 @@ uint32_t unwindDistance )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4591,8 +5122,12 @@ uint32_t unwindDistance )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4640,6 +5175,10 @@ OTF2_CallingContextRef callingContext )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4672,8 +5211,12 @@ OTF2_CallingContextRef callingContext )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4722,6 +5265,10 @@ OTF2_InterruptGeneratorRef interruptGenerator )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4745,6 +5292,10 @@ OTF2_InterruptGeneratorRef interruptGenerator )
         record_length += 8;
     }
 
+    /* A delta sample stores the distance to the previous sample and a wider
+     * difference of the calling context. */
+    record_length += 2 * ( sizeof( uint64_t ) + 1 );
+
     ret = OTF2_Buffer_WriteTimeStamp( writerHandle->buffer,
                                       time,
                                       record_length );
@@ -4756,14 +5307,29 @@ OTF2_InterruptGeneratorRef interruptGenerator )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
         }
     }
 
+    /* Later samples in the same chunk segment are deltas to the previous
+     * one. */
+    if ( writerHandle->calling_context_deltas &&
+         otf2_evt_writer_calling_context_sample_delta( writerHandle,
+                                                       callingContext,
+                                                       unwindDistance,
+                                                       interruptGenerator ) )
+    {
+        return OTF2_SUCCESS;
+    }
+
     OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_EVENT_CALLING_CONTEXT_SAMPLE );
 
     /* Write initial record length */
@@ -4806,6 +5372,10 @@ OTF2_RegionRef region )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4827,8 +5397,12 @@ OTF2_RegionRef region )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4869,6 +5443,10 @@ OTF2_RegionRef region )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4890,8 +5468,12 @@ OTF2_RegionRef region )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4932,6 +5514,10 @@ OTF2_RegionRef region )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -4953,8 +5539,12 @@ OTF2_RegionRef region )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -4996,6 +5586,10 @@ OTF2_RegionRef dest )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -5029,8 +5623,12 @@ OTF2_RegionRef dest )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -5079,6 +5677,10 @@ OTF2_RegionRef dest )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -5112,8 +5714,12 @@ OTF2_RegionRef dest )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -5163,6 +5769,10 @@ uint64_t size )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -5197,8 +5807,12 @@ uint64_t size )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -5249,6 +5863,10 @@ uint64_t size )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -5283,8 +5901,12 @@ uint64_t size )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -5333,6 +5955,10 @@ OTF2_RegionRef region )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -5354,8 +5980,12 @@ OTF2_RegionRef region )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -5396,6 +6026,10 @@ OTF2_RegionRef region )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -5417,8 +6051,12 @@ OTF2_RegionRef region )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -5460,6 +6098,10 @@ uint64_t size )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -5493,8 +6135,12 @@ uint64_t size )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
@@ -5542,6 +6188,10 @@ OTF2_RegionRef region )
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
      * record length information, and optional attribute list).
@@ -5563,8 +6213,12 @@ OTF2_RegionRef region )
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
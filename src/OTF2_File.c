@@ -484,6 +484,33 @@ OTF2_File_SeekChunk( OTF2_File* file,
                         "Operation not supported for compressed trace files!" );
 }
 
+/** @brief Seek to an offset of uncompressed data in a file.
+ *
+ *  @param file             OTF2 file handle.
+ *  @param offset           Offset from the begin of the file in bytes.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_File_Seek( OTF2_File* file,
+                uint64_t   offset )
+{
+    if ( !file )
+    {
+        return UTILS_ERROR( OTF2_ERROR_FILE_INTERACTION,
+                            "Invalid arguments!" );
+    }
+
+    if ( file->compression == OTF2_COMPRESSION_NONE )
+    {
+        return file->seek( file, offset );
+    }
+
+    return UTILS_ERROR( OTF2_ERROR_FILE_INTERACTION,
+                        "Operation not supported for compressed trace files!" );
+}
+
 /* ___ Implementation of static functions. __________________________________ */
 
 
@@ -95,4 +95,8 @@ OTF2_File_SeekChunk( OTF2_File* file,
                      uint64_t   chunkNumber,
                      uint64_t   chunkSize );
 
+OTF2_ErrorCode
+OTF2_File_Seek( OTF2_File* file,
+                uint64_t   offset );
+
 #endif /* !OTF2_FILE_H */
@@ -52,6 +52,7 @@
 #include "otf2_file_types.h"
 #include "otf2_reader.h"
 #include "otf2_archive.h"
+#include "otf2_archive_location.h"
 
 #include "otf2_attic_types.h"
 
@@ -95,6 +96,46 @@ percolate_down( OTF2_GlobalEvtReader* reader,
                 uint64_t              node );
 
 
+static OTF2_ErrorCode
+otf2_global_evt_reader_read_local( OTF2_GlobalEvtReader* reader,
+                                   OTF2_EvtReader*       evtReader,
+                                   bool                  backward );
+
+
+static OTF2_ErrorCode
+otf2_global_evt_reader_read_event( OTF2_GlobalEvtReader* reader );
+
+
+static OTF2_ErrorCode
+otf2_global_evt_reader_settle( OTF2_GlobalEvtReader* reader );
+
+
+static void
+otf2_global_evt_reader_unlink_resident( OTF2_GlobalEvtReader* reader,
+                                        OTF2_EvtReader*       evtReader );
+
+
+static OTF2_ErrorCode
+otf2_global_evt_reader_close_local( OTF2_GlobalEvtReader* reader,
+                                    OTF2_EvtReader*       evtReader,
+                                    OTF2_TimeStamp        passedTime );
+
+
+static OTF2_ErrorCode
+otf2_global_evt_reader_reopen_closed( OTF2_GlobalEvtReader* reader );
+
+
+static bool
+otf2_global_evt_reader_seed( OTF2_GlobalEvtReader* reader,
+                             OTF2_EvtReader*       evtReader,
+                             OTF2_TimeStamp        time );
+
+
+static OTF2_ErrorCode
+otf2_global_evt_reader_turn( OTF2_GlobalEvtReader* reader,
+                             bool                  backward );
+
+
 /* ___ Implementation. ______________________________________________________ */
 
 
@@ -126,6 +167,34 @@ otf2_global_evt_reader_new( OTF2_Archive* archive )
     reader->archive = archive;
     memset( &( reader->reader_callbacks ), '\0', sizeof( OTF2_GlobalEvtReaderCallbacks ) );
     reader->user_data = NULL;
+    reader->end_time  = OTF2_UNDEFINED_TIMESTAMP;
+
+    reader->closed_locations = calloc( archive->number_of_evt_readers,
+                                       sizeof( *reader->closed_locations ) );
+    if ( NULL == reader->closed_locations )
+    {
+        UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                     "Could not allocate memory for reader handle!" );
+        free( reader );
+        return NULL;
+    }
+
+    /* Caller holds the archive lock. */
+    OTF2_ErrorCode status = otf2_archive_query_hint( archive,
+                                                     OTF2_HINT_MAX_CHUNK_MEMORY,
+                                                     &reader->max_chunk_memory );
+    if ( status != OTF2_SUCCESS )
+    {
+        UTILS_ERROR( status, "Could not query chunk memory hint!" );
+        free( reader->closed_locations );
+        free( reader );
+        return NULL;
+    }
+    if ( archive->compression == OTF2_COMPRESSION_ZLIB )
+    {
+        /* Compressed chunks can't be re-read. */
+        reader->max_chunk_memory = 0;
+    }
 
     reader->number_of_evt_readers = 0;
     /* Read an event from each local reader and put it in the event queue. */
@@ -138,7 +207,21 @@ otf2_global_evt_reader_new( OTF2_Archive* archive )
          * attribute lists. */
         otf2_evt_reader_operated_by_global_reader( evt_reader );
 
-        OTF2_ErrorCode status = otf2_evt_reader_read( evt_reader );
+        /* If the definitions provide the first timestamp, use it as the
+         * heap key and defer opening the event file until this location
+         * reaches the top of the heap. */
+        OTF2_TimeStamp last_time;
+        if ( otf2_evt_reader_get_time_range( evt_reader,
+                                             &evt_reader->current_event.record.time,
+                                             &last_time ) )
+        {
+            evt_reader->seeded                                     = true;
+            evt_reader->seek_time                                  = 0;
+            reader->event_queue[ reader->number_of_evt_readers++ ] = evt_reader;
+            continue;
+        }
+
+        status = otf2_global_evt_reader_read_local( reader, evt_reader, false );
         if ( status != OTF2_SUCCESS )
         {
             /* If there is no event in the local event trace file, continue with
@@ -223,6 +306,7 @@ otf2_global_evt_reader_delete( OTF2_GlobalEvtReader* readerHandle )
         otf2_archive_close_evt_reader( readerHandle->archive, evt_reader );
     }
 
+    free( readerHandle->closed_locations );
     free( readerHandle );
 
     return OTF2_SUCCESS;
@@ -329,19 +413,50 @@ OTF2_GlobalEvtReader_ReadEvent( OTF2_GlobalEvtReader* readerHandle )
                             "This is no valid global event reader handle!" );
     }
 
+    OTF2_ErrorCode status = otf2_global_evt_reader_turn( readerHandle, false );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    return otf2_global_evt_reader_read_event( readerHandle );
+}
+
+
+/** @brief Read the next event in the current reading direction.
+ *
+ *  @param readerHandle     Global event reader handle.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_global_evt_reader_read_event( OTF2_GlobalEvtReader* readerHandle )
+{
+    /* Replace seeded timestamps at the top of the heap with real events. */
+    OTF2_ErrorCode status = otf2_global_evt_reader_settle( readerHandle );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status, "Could not read event from location!" );
+    }
+
     /* If the heap is empty, all records where already read. */
-    if ( 0 == readerHandle->number_of_evt_readers )
+    if ( 0 == readerHandle->number_of_evt_readers
+         || ( !readerHandle->backward
+              && readerHandle->event_queue[ 0 ]->current_event.record.time > readerHandle->end_time ) )
     {
         return OTF2_SUCCESS;
     }
 
-    /* Get event with the least timestamp. */
+    /* Get event with the least timestamp, or the largest when reading
+     * backward. */
     OTF2_EvtReader* evt_reader = readerHandle->event_queue[ 0 ];
+    OTF2_TimeStamp  time       = evt_reader->current_event.record.time;
 
     /* Trigger according callback. */
     OTF2_CallbackCode interrupt = OTF2_CALLBACK_SUCCESS;
-    OTF2_ErrorCode    status    = otf2_global_evt_reader_trigger_callback( readerHandle,
-                                                                           evt_reader );
+    status = otf2_global_evt_reader_trigger_callback( readerHandle,
+                                                      evt_reader );
     if ( OTF2_ERROR_INTERRUPTED_BY_CALLBACK == status )
     {
         interrupt = !OTF2_CALLBACK_SUCCESS;
@@ -357,7 +472,9 @@ OTF2_GlobalEvtReader_ReadEvent( OTF2_GlobalEvtReader* readerHandle )
      * This can't return OTF2_ERROR_INTERRUPTED_BY_CALLBACK, because no
      * callback will be triggered.
      */
-    status = otf2_evt_reader_read( evt_reader );
+    status = otf2_global_evt_reader_read_local( readerHandle,
+                                                evt_reader,
+                                                readerHandle->backward );
     if ( status != OTF2_SUCCESS )
     {
         /* This error code means that all events from the according buffer are
@@ -368,7 +485,7 @@ OTF2_GlobalEvtReader_ReadEvent( OTF2_GlobalEvtReader* readerHandle )
             return UTILS_ERROR( status, "Could not read event from location!" );
         }
 
-        otf2_archive_close_evt_reader( readerHandle->archive, evt_reader );
+        otf2_global_evt_reader_close_local( readerHandle, evt_reader, time );
 
         /* remove event reader from queue */
         readerHandle->number_of_evt_readers--;
@@ -417,8 +534,22 @@ OTF2_GlobalEvtReader_HasEvent( OTF2_GlobalEvtReader* readerHandle,
                             "This is no valid global event reader handle!" );
     }
 
+    OTF2_ErrorCode status = otf2_global_evt_reader_turn( readerHandle, false );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    /* A seeded location may turn out to have no events. */
+    status = otf2_global_evt_reader_settle( readerHandle );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status, "Could not read event from location!" );
+    }
+
     /* If the heap is empty, all records where already read. */
-    *flag = !!readerHandle->number_of_evt_readers;
+    *flag = readerHandle->number_of_evt_readers > 0
+            && readerHandle->event_queue[ 0 ]->current_event.record.time <= readerHandle->end_time;
 
     return OTF2_SUCCESS;
 }
@@ -475,6 +606,147 @@ OTF2_GlobalEvtReader_ReadEvents( OTF2_GlobalEvtReader* readerHandle,
 }
 
 
+OTF2_ErrorCode
+OTF2_GlobalEvtReader_ReadEventsBackward( OTF2_GlobalEvtReader* readerHandle,
+                                         uint64_t              recordsToRead,
+                                         uint64_t*             recordsRead )
+{
+    /* Validate arguments. */
+    if ( NULL == readerHandle )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "This is no valid global event reader handle!" );
+    }
+
+    *recordsRead = 0;
+
+    if ( readerHandle->archive->compression == OTF2_COMPRESSION_ZLIB )
+    {
+        return UTILS_ERROR( OTF2_ERROR_FILE_INTERACTION,
+                            "Can't read backwards in compressed trace files!" );
+    }
+
+    OTF2_ErrorCode status = otf2_global_evt_reader_turn( readerHandle, true );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    uint64_t read = 0;
+    for ( read = 0; read < recordsToRead; read++ )
+    {
+        /* Check, if we have a new events */
+        status = otf2_global_evt_reader_settle( readerHandle );
+        if ( status != OTF2_SUCCESS )
+        {
+            UTILS_ERROR( status, "Could not read event from location!" );
+            break;
+        }
+        if ( 0 == readerHandle->number_of_evt_readers )
+        {
+            break;
+        }
+
+        status = otf2_global_evt_reader_read_event( readerHandle );
+        if ( status != OTF2_SUCCESS )
+        {
+            if ( status == OTF2_ERROR_INTERRUPTED_BY_CALLBACK )
+            {
+                /* We still delivered a record, count it */
+                read++;
+            }
+            break;
+        }
+    }
+
+    *recordsRead = read;
+    return status;
+}
+
+
+OTF2_ErrorCode
+OTF2_GlobalEvtReader_SeekTime( OTF2_GlobalEvtReader* readerHandle,
+                               OTF2_TimeStamp        time )
+{
+    /* Validate arguments. */
+    if ( NULL == readerHandle )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "This is no valid global event reader handle!" );
+    }
+
+    OTF2_Archive* archive = readerHandle->archive;
+
+    if ( archive->compression == OTF2_COMPRESSION_ZLIB )
+    {
+        for ( uint64_t i = 0; i < readerHandle->number_of_evt_readers; i++ )
+        {
+            if ( readerHandle->event_queue[ i ]->global_event_position != 0 )
+            {
+                return UTILS_ERROR( OTF2_ERROR_FILE_INTERACTION,
+                                    "Can't seek in compressed trace files after reading started!" );
+            }
+        }
+    }
+
+    /* Closed locations may have events after the new position again. */
+    if ( readerHandle->backward
+         ? time > readerHandle->time_passed
+         : time <= readerHandle->time_passed )
+    {
+        OTF2_ErrorCode status = otf2_global_evt_reader_reopen_closed( readerHandle );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+    }
+
+    /* Seed all local readers with the seek time, they will be positioned
+     * when they reach the top of the heap. */
+    for ( uint64_t i = 0; i < readerHandle->number_of_evt_readers; )
+    {
+        OTF2_EvtReader* evt_reader = readerHandle->event_queue[ i ];
+
+        /* The pending event won't be delivered. */
+        otf2_attribute_list_remove_all_attributes( &evt_reader->attribute_list );
+
+        if ( !otf2_global_evt_reader_seed( readerHandle, evt_reader, time ) )
+        {
+            readerHandle->number_of_evt_readers--;
+            readerHandle->event_queue[ i ] = readerHandle->event_queue[ readerHandle->number_of_evt_readers ];
+            otf2_global_evt_reader_close_local( readerHandle, evt_reader, time );
+            continue;
+        }
+        i++;
+    }
+
+    /* build-up the heap */
+    for ( uint64_t i = readerHandle->number_of_evt_readers; i--; )
+    {
+        percolate_down( readerHandle, i );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+OTF2_ErrorCode
+OTF2_GlobalEvtReader_SetEndTime( OTF2_GlobalEvtReader* readerHandle,
+                                 OTF2_TimeStamp        time )
+{
+    /* Validate arguments. */
+    if ( NULL == readerHandle )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "This is no valid global event reader handle!" );
+    }
+
+    readerHandle->end_time = time;
+
+    return OTF2_SUCCESS;
+}
+
+
 /* ___ Implementation of internal functions. ________________________________ */
 
 
@@ -523,11 +795,14 @@ percolate_down( OTF2_GlobalEvtReader* reader,
     {
         uint64_t smallest = node;
 
-        /* check left child */
+        /* check left child, when reading backward the heap is a max-heap */
         uint64_t child = node * 2 + 1;
         if ( child < n
-             && compare_evt_reader_lt( event_queue[ child ],
-                                       event_queue[ smallest ] ) )
+             && ( reader->backward
+                  ? compare_evt_reader_lt( event_queue[ smallest ],
+                                           event_queue[ child ] )
+                  : compare_evt_reader_lt( event_queue[ child ],
+                                           event_queue[ smallest ] ) ) )
         {
             smallest = child;
         }
@@ -535,8 +810,11 @@ percolate_down( OTF2_GlobalEvtReader* reader,
         /* check right child */
         child++;
         if ( child < n
-             && compare_evt_reader_lt( event_queue[ child ],
-                                       event_queue[ smallest ] ) )
+             && ( reader->backward
+                  ? compare_evt_reader_lt( event_queue[ smallest ],
+                                           event_queue[ child ] )
+                  : compare_evt_reader_lt( event_queue[ child ],
+                                           event_queue[ smallest ] ) ) )
         {
             smallest = child;
         }
@@ -553,3 +831,451 @@ percolate_down( OTF2_GlobalEvtReader* reader,
         node                    = smallest;
     }
 }
+
+
+/** @brief Reads the next or previous event of a local reader and enforces
+ *         the chunk memory limit.
+ *
+ *  The event file is opened at the first read. If the local reader had
+ *  released its chunk, it is re-read first. After reading, the least
+ *  recently used other local readers release their chunks until the limit
+ *  is met again. A local reader without further events is
+ *  removed from the accounting.
+ *
+ *  @param reader     Global event reader handle.
+ *  @param evtReader  The local reader to read from.
+ *  @param backward   Read the event before the current position.
+ *
+ *  @return           The result of otf2_evt_reader_read() or
+ *                    otf2_evt_reader_read_backward().
+ */
+OTF2_ErrorCode
+otf2_global_evt_reader_read_local( OTF2_GlobalEvtReader* reader,
+                                   OTF2_EvtReader*       evtReader,
+                                   bool                  backward )
+{
+    OTF2_ErrorCode status = otf2_evt_reader_open_file( evtReader );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    if ( 0 == reader->max_chunk_memory )
+    {
+        return backward
+               ? otf2_evt_reader_read_backward( evtReader )
+               : otf2_evt_reader_read( evtReader );
+    }
+
+    status = OTF2_Buffer_ReadReloadChunk( evtReader->buffer );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status, "Could not reload chunk of location!" );
+    }
+
+    status = backward
+             ? otf2_evt_reader_read_backward( evtReader )
+             : otf2_evt_reader_read( evtReader );
+
+    /* Unlink from the resident list, it is put back at the head. */
+    otf2_global_evt_reader_unlink_resident( reader, evtReader );
+
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+
+    evtReader->resident_size = OTF2_Buffer_GetResidentSize( evtReader->buffer );
+    reader->chunk_memory    += evtReader->resident_size;
+
+    /* Release chunks of idle locations, but keep at least the current one. */
+    while ( reader->chunk_memory > reader->max_chunk_memory
+            && reader->resident_tail )
+    {
+        OTF2_EvtReader* victim = reader->resident_tail;
+
+        reader->resident_tail = victim->resident_prev;
+        if ( reader->resident_tail )
+        {
+            reader->resident_tail->resident_next = NULL;
+        }
+        else
+        {
+            reader->resident_head = NULL;
+        }
+        victim->resident_prev = NULL;
+
+        OTF2_ErrorCode release_status = otf2_evt_reader_release_chunks( victim );
+        if ( release_status != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( release_status,
+                                "Could not release chunks of location!" );
+        }
+        reader->chunk_memory -= victim->resident_size;
+        victim->resident_size = 0;
+    }
+
+    evtReader->resident_next = reader->resident_head;
+    if ( reader->resident_head )
+    {
+        reader->resident_head->resident_prev = evtReader;
+    }
+    else
+    {
+        reader->resident_tail = evtReader;
+    }
+    reader->resident_head = evtReader;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Reads the first event of all seeded local readers at the top of
+ *         the heap.
+ *
+ *  The seeded timestamp is a bound of the real one, thus the top of the heap
+ *  is correct as soon as it holds a real event. The local reader is
+ *  positioned at its seek time first, when reading backward the event before
+ *  this position is read. Local readers without further events are removed
+ *  from the heap.
+ *
+ *  @param reader     Global event reader handle.
+ *
+ *  @return           Returns OTF2_SUCCESS if successful, an error code
+ *                    if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_global_evt_reader_settle( OTF2_GlobalEvtReader* reader )
+{
+    while ( reader->number_of_evt_readers > 0
+            && reader->event_queue[ 0 ]->seeded
+            && ( reader->backward
+                 || reader->event_queue[ 0 ]->current_event.record.time <= reader->end_time ) )
+    {
+        OTF2_EvtReader* evt_reader = reader->event_queue[ 0 ];
+        OTF2_TimeStamp  seek_time  = evt_reader->seek_time;
+        evt_reader->seeded = false;
+
+        OTF2_ErrorCode status = OTF2_SUCCESS;
+        if ( reader->backward && seek_time == 0 )
+        {
+            /* Nothing before the begin of the trace. */
+            status = OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+        }
+        else
+        {
+            status = otf2_evt_reader_seek_time( evt_reader, seek_time );
+            if ( status != OTF2_SUCCESS )
+            {
+                return status;
+            }
+        }
+
+        /* Skip the events before the seek time, at most one chunk when
+         * seeking was possible. */
+        while ( status == OTF2_SUCCESS )
+        {
+            status = otf2_global_evt_reader_read_local( reader, evt_reader, false );
+            if ( status != OTF2_SUCCESS
+                 || evt_reader->current_event.record.time >= seek_time )
+            {
+                break;
+            }
+            otf2_attribute_list_remove_all_attributes( &evt_reader->attribute_list );
+        }
+
+        if ( reader->backward && seek_time > 0 )
+        {
+            /* Step back over the first event at or after the seek time, if
+             * any, and read the event before it. */
+            if ( status == OTF2_SUCCESS )
+            {
+                otf2_attribute_list_remove_all_attributes( &evt_reader->attribute_list );
+                status = otf2_global_evt_reader_read_local( reader, evt_reader, true );
+            }
+            else if ( status == OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
+            {
+                status = OTF2_SUCCESS;
+            }
+            if ( status == OTF2_SUCCESS )
+            {
+                otf2_attribute_list_remove_all_attributes( &evt_reader->attribute_list );
+                status = otf2_global_evt_reader_read_local( reader, evt_reader, true );
+            }
+        }
+
+        if ( status != OTF2_SUCCESS )
+        {
+            if ( status != OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
+            {
+                return status;
+            }
+
+            otf2_global_evt_reader_close_local( reader, evt_reader, seek_time );
+
+            reader->number_of_evt_readers--;
+            reader->event_queue[ 0 ] = reader->event_queue[ reader->number_of_evt_readers ];
+        }
+
+        percolate_down( reader, 0 );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Removes a local reader from the list of readers with resident
+ *         chunks.
+ *
+ *  @param reader     Global event reader handle.
+ *  @param evtReader  The local reader.
+ */
+void
+otf2_global_evt_reader_unlink_resident( OTF2_GlobalEvtReader* reader,
+                                        OTF2_EvtReader*       evtReader )
+{
+    if ( evtReader->resident_prev || reader->resident_head == evtReader )
+    {
+        if ( evtReader->resident_prev )
+        {
+            evtReader->resident_prev->resident_next = evtReader->resident_next;
+        }
+        else
+        {
+            reader->resident_head = evtReader->resident_next;
+        }
+        if ( evtReader->resident_next )
+        {
+            evtReader->resident_next->resident_prev = evtReader->resident_prev;
+        }
+        else
+        {
+            reader->resident_tail = evtReader->resident_prev;
+        }
+        evtReader->resident_prev = NULL;
+        evtReader->resident_next = NULL;
+    }
+    reader->chunk_memory     -= evtReader->resident_size;
+    evtReader->resident_size  = 0;
+}
+
+
+/** @brief Closes a local reader without further events.
+ *
+ *  The location is remembered, so that a later seek or a change of the
+ *  reading direction can re-open it.
+ *
+ *  @param reader      Global event reader handle.
+ *  @param evtReader   The local reader, already removed from the heap.
+ *  @param passedTime  No event of the local reader is after this time, or
+ *                     before it when reading backward.
+ *
+ *  @return            Returns OTF2_SUCCESS if successful, an error code
+ *                     if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_global_evt_reader_close_local( OTF2_GlobalEvtReader* reader,
+                                    OTF2_EvtReader*       evtReader,
+                                    OTF2_TimeStamp        passedTime )
+{
+    otf2_global_evt_reader_unlink_resident( reader, evtReader );
+
+    if ( reader->backward
+         ? passedTime < reader->time_passed
+         : passedTime > reader->time_passed )
+    {
+        reader->time_passed = passedTime;
+    }
+
+    reader->closed_locations[ reader->number_of_closed_locations++ ] =
+        evtReader->archive_location_index;
+
+    return otf2_archive_close_evt_reader( reader->archive, evtReader );
+}
+
+
+/** @brief Re-opens all closed local readers and appends them to the heap.
+ *
+ *  The caller needs to seed them and to rebuild the heap.
+ *
+ *  @param reader     Global event reader handle.
+ *
+ *  @return           Returns OTF2_SUCCESS if successful, an error code
+ *                    if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_global_evt_reader_reopen_closed( OTF2_GlobalEvtReader* reader )
+{
+    OTF2_Archive* archive = reader->archive;
+
+    while ( reader->number_of_closed_locations )
+    {
+        uint32_t archive_location_index =
+            reader->closed_locations[ reader->number_of_closed_locations - 1 ];
+
+        OTF2_EvtReader* evt_reader;
+        OTF2_ErrorCode  status = otf2_archive_get_evt_reader(
+            archive,
+            archive->locations[ archive_location_index ].location_id,
+            &evt_reader );
+        if ( status != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( status, "Could not re-open location!" );
+        }
+        otf2_evt_reader_operated_by_global_reader( evt_reader );
+
+        reader->number_of_closed_locations--;
+        reader->event_queue[ reader->number_of_evt_readers++ ] = evt_reader;
+    }
+
+    reader->time_passed = reader->backward ? OTF2_UNDEFINED_TIMESTAMP : 0;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Seeds a local reader with a time to be positioned at.
+ *
+ *  The heap key is a bound of the real timestamp in the current reading
+ *  direction, narrowed by the time range of the location, if known.
+ *
+ *  @param reader     Global event reader handle.
+ *  @param evtReader  The local reader.
+ *  @param time       The time to position at.
+ *
+ *  @return           False, if the location is known to have no events in
+ *                    reading direction.
+ */
+bool
+otf2_global_evt_reader_seed( OTF2_GlobalEvtReader* reader,
+                             OTF2_EvtReader*       evtReader,
+                             OTF2_TimeStamp        time )
+{
+    OTF2_TimeStamp key = time;
+    OTF2_TimeStamp first_time;
+    OTF2_TimeStamp last_time;
+    if ( otf2_evt_reader_get_time_range( evtReader, &first_time, &last_time ) )
+    {
+        if ( reader->backward )
+        {
+            if ( first_time >= time )
+            {
+                return false;
+            }
+            if ( last_time < key )
+            {
+                key = last_time;
+            }
+        }
+        else
+        {
+            if ( last_time < time )
+            {
+                return false;
+            }
+            if ( first_time > key )
+            {
+                key = first_time;
+            }
+        }
+    }
+    else if ( reader->backward && time == 0 )
+    {
+        return false;
+    }
+
+    evtReader->current_event.record.time = key;
+    evtReader->seek_time                 = time;
+    evtReader->seeded                    = true;
+
+    return true;
+}
+
+
+/** @brief Changes the reading direction.
+ *
+ *  The position between the delivered and the pending events stays. Each
+ *  local reader with a pending event re-reads it and reads the event on the
+ *  other side of the position. Seeded local readers keep their seek time.
+ *  The closed local readers have all their events on the other side of the
+ *  position now, they are re-opened at their end or begin respectively.
+ *
+ *  @param reader     Global event reader handle.
+ *  @param backward   The new reading direction.
+ *
+ *  @return           Returns OTF2_SUCCESS if successful, an error code
+ *                    if an error occurs.
+ */
+OTF2_ErrorCode
+otf2_global_evt_reader_turn( OTF2_GlobalEvtReader* reader,
+                             bool                  backward )
+{
+    if ( reader->backward == backward )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    uint64_t number_of_open_readers = reader->number_of_evt_readers;
+
+    reader->backward = backward;
+    OTF2_ErrorCode status = otf2_global_evt_reader_reopen_closed( reader );
+    if ( status != OTF2_SUCCESS )
+    {
+        return status;
+    }
+    for ( uint64_t i = number_of_open_readers; i < reader->number_of_evt_readers; i++ )
+    {
+        otf2_global_evt_reader_seed( reader,
+                                     reader->event_queue[ i ],
+                                     backward ? OTF2_UNDEFINED_TIMESTAMP : 0 );
+    }
+
+    for ( uint64_t i = 0; i < reader->number_of_evt_readers; )
+    {
+        OTF2_EvtReader* evt_reader   = reader->event_queue[ i ];
+        OTF2_TimeStamp  pending_time = evt_reader->current_event.record.time;
+
+        if ( evt_reader->seeded )
+        {
+            pending_time = evt_reader->seek_time;
+            if ( otf2_global_evt_reader_seed( reader, evt_reader, pending_time ) )
+            {
+                i++;
+                continue;
+            }
+            status = OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+        }
+        else
+        {
+            otf2_attribute_list_remove_all_attributes( &evt_reader->attribute_list );
+            status = otf2_global_evt_reader_read_local( reader, evt_reader, backward );
+            if ( status == OTF2_SUCCESS )
+            {
+                otf2_attribute_list_remove_all_attributes( &evt_reader->attribute_list );
+                status = otf2_global_evt_reader_read_local( reader, evt_reader, backward );
+            }
+        }
+
+        if ( status != OTF2_SUCCESS )
+        {
+            if ( status != OTF2_ERROR_INDEX_OUT_OF_BOUNDS )
+            {
+                return UTILS_ERROR( status, "Could not read event from location!" );
+            }
+
+            reader->number_of_evt_readers--;
+            reader->event_queue[ i ] = reader->event_queue[ reader->number_of_evt_readers ];
+            otf2_global_evt_reader_close_local( reader, evt_reader, pending_time );
+            continue;
+        }
+        i++;
+    }
+
+    /* build-up the heap */
+    for ( uint64_t i = reader->number_of_evt_readers; i--; )
+    {
+        percolate_down( reader, i );
+    }
+
+    return OTF2_SUCCESS;
+}
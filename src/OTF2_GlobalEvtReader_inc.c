@@ -2192,302 +2192,101 @@ record->region );
 }
 
 
+/** Callback trigger for each record type, unknown record types have none. */
+static OTF2_ErrorCode ( * const otf2_global_evt_reader_trigger_table[ 256 ] )( const OTF2_GlobalEvtReader*,
+                                                                               OTF2_EvtReader* ) =
+{
+    [ OTF2_EVENT_BUFFER_FLUSH ] = otf2_global_evt_reader_trigger_buffer_flush,
+    [ OTF2_EVENT_MEASUREMENT_ON_OFF ] = otf2_global_evt_reader_trigger_measurement_on_off,
+    [ OTF2_EVENT_ENTER ] = otf2_global_evt_reader_trigger_enter,
+    [ OTF2_EVENT_LEAVE ] = otf2_global_evt_reader_trigger_leave,
+    [ OTF2_EVENT_MPI_SEND ] = otf2_global_evt_reader_trigger_mpi_send,
+    [ OTF2_EVENT_MPI_ISEND ] = otf2_global_evt_reader_trigger_mpi_isend,
+    [ OTF2_EVENT_MPI_ISEND_COMPLETE ] = otf2_global_evt_reader_trigger_mpi_isend_complete,
+    [ OTF2_EVENT_MPI_IRECV_REQUEST ] = otf2_global_evt_reader_trigger_mpi_irecv_request,
+    [ OTF2_EVENT_MPI_RECV ] = otf2_global_evt_reader_trigger_mpi_recv,
+    [ OTF2_EVENT_MPI_IRECV ] = otf2_global_evt_reader_trigger_mpi_irecv,
+    [ OTF2_EVENT_MPI_REQUEST_TEST ] = otf2_global_evt_reader_trigger_mpi_request_test,
+    [ OTF2_EVENT_MPI_REQUEST_CANCELLED ] = otf2_global_evt_reader_trigger_mpi_request_cancelled,
+    [ OTF2_EVENT_MPI_COLLECTIVE_BEGIN ] = otf2_global_evt_reader_trigger_mpi_collective_begin,
+    [ OTF2_EVENT_MPI_COLLECTIVE_END ] = otf2_global_evt_reader_trigger_mpi_collective_end,
+    [ OTF2_EVENT_OMP_FORK ] = otf2_global_evt_reader_trigger_omp_fork,
+    [ OTF2_EVENT_OMP_JOIN ] = otf2_global_evt_reader_trigger_omp_join,
+    [ OTF2_EVENT_OMP_ACQUIRE_LOCK ] = otf2_global_evt_reader_trigger_omp_acquire_lock,
+    [ OTF2_EVENT_OMP_RELEASE_LOCK ] = otf2_global_evt_reader_trigger_omp_release_lock,
+    [ OTF2_EVENT_OMP_TASK_CREATE ] = otf2_global_evt_reader_trigger_omp_task_create,
+    [ OTF2_EVENT_OMP_TASK_SWITCH ] = otf2_global_evt_reader_trigger_omp_task_switch,
+    [ OTF2_EVENT_OMP_TASK_COMPLETE ] = otf2_global_evt_reader_trigger_omp_task_complete,
+    [ OTF2_EVENT_METRIC ] = otf2_global_evt_reader_trigger_metric,
+    [ OTF2_EVENT_PARAMETER_STRING ] = otf2_global_evt_reader_trigger_parameter_string,
+    [ OTF2_EVENT_PARAMETER_INT ] = otf2_global_evt_reader_trigger_parameter_int,
+    [ OTF2_EVENT_PARAMETER_UNSIGNED_INT ] = otf2_global_evt_reader_trigger_parameter_unsigned_int,
+    [ OTF2_EVENT_RMA_WIN_CREATE ] = otf2_global_evt_reader_trigger_rma_win_create,
+    [ OTF2_EVENT_RMA_WIN_DESTROY ] = otf2_global_evt_reader_trigger_rma_win_destroy,
+    [ OTF2_EVENT_RMA_COLLECTIVE_BEGIN ] = otf2_global_evt_reader_trigger_rma_collective_begin,
+    [ OTF2_EVENT_RMA_COLLECTIVE_END ] = otf2_global_evt_reader_trigger_rma_collective_end,
+    [ OTF2_EVENT_RMA_GROUP_SYNC ] = otf2_global_evt_reader_trigger_rma_group_sync,
+    [ OTF2_EVENT_RMA_REQUEST_LOCK ] = otf2_global_evt_reader_trigger_rma_request_lock,
+    [ OTF2_EVENT_RMA_ACQUIRE_LOCK ] = otf2_global_evt_reader_trigger_rma_acquire_lock,
+    [ OTF2_EVENT_RMA_TRY_LOCK ] = otf2_global_evt_reader_trigger_rma_try_lock,
+    [ OTF2_EVENT_RMA_RELEASE_LOCK ] = otf2_global_evt_reader_trigger_rma_release_lock,
+    [ OTF2_EVENT_RMA_SYNC ] = otf2_global_evt_reader_trigger_rma_sync,
+    [ OTF2_EVENT_RMA_WAIT_CHANGE ] = otf2_global_evt_reader_trigger_rma_wait_change,
+    [ OTF2_EVENT_RMA_PUT ] = otf2_global_evt_reader_trigger_rma_put,
+    [ OTF2_EVENT_RMA_GET ] = otf2_global_evt_reader_trigger_rma_get,
+    [ OTF2_EVENT_RMA_ATOMIC ] = otf2_global_evt_reader_trigger_rma_atomic,
+    [ OTF2_EVENT_RMA_OP_COMPLETE_BLOCKING ] = otf2_global_evt_reader_trigger_rma_op_complete_blocking,
+    [ OTF2_EVENT_RMA_OP_COMPLETE_NON_BLOCKING ] = otf2_global_evt_reader_trigger_rma_op_complete_non_blocking,
+    [ OTF2_EVENT_RMA_OP_TEST ] = otf2_global_evt_reader_trigger_rma_op_test,
+    [ OTF2_EVENT_RMA_OP_COMPLETE_REMOTE ] = otf2_global_evt_reader_trigger_rma_op_complete_remote,
+    [ OTF2_EVENT_THREAD_FORK ] = otf2_global_evt_reader_trigger_thread_fork,
+    [ OTF2_EVENT_THREAD_JOIN ] = otf2_global_evt_reader_trigger_thread_join,
+    [ OTF2_EVENT_THREAD_TEAM_BEGIN ] = otf2_global_evt_reader_trigger_thread_team_begin,
+    [ OTF2_EVENT_THREAD_TEAM_END ] = otf2_global_evt_reader_trigger_thread_team_end,
+    [ OTF2_EVENT_THREAD_ACQUIRE_LOCK ] = otf2_global_evt_reader_trigger_thread_acquire_lock,
+    [ OTF2_EVENT_THREAD_RELEASE_LOCK ] = otf2_global_evt_reader_trigger_thread_release_lock,
+    [ OTF2_EVENT_THREAD_TASK_CREATE ] = otf2_global_evt_reader_trigger_thread_task_create,
+    [ OTF2_EVENT_THREAD_TASK_SWITCH ] = otf2_global_evt_reader_trigger_thread_task_switch,
+    [ OTF2_EVENT_THREAD_TASK_COMPLETE ] = otf2_global_evt_reader_trigger_thread_task_complete,
+    [ OTF2_EVENT_THREAD_CREATE ] = otf2_global_evt_reader_trigger_thread_create,
+    [ OTF2_EVENT_THREAD_BEGIN ] = otf2_global_evt_reader_trigger_thread_begin,
+    [ OTF2_EVENT_THREAD_WAIT ] = otf2_global_evt_reader_trigger_thread_wait,
+    [ OTF2_EVENT_THREAD_END ] = otf2_global_evt_reader_trigger_thread_end,
+    [ OTF2_EVENT_CALLING_CONTEXT_ENTER ] = otf2_global_evt_reader_trigger_calling_context_enter,
+    [ OTF2_EVENT_CALLING_CONTEXT_LEAVE ] = otf2_global_evt_reader_trigger_calling_context_leave,
+    [ OTF2_EVENT_CALLING_CONTEXT_SAMPLE ] = otf2_global_evt_reader_trigger_calling_context_sample,
+    [ OTF2_EVENT_TASK_CREATE ] = otf2_global_evt_reader_trigger_task_create,
+    [ OTF2_EVENT_TASK_DESTROY ] = otf2_global_evt_reader_trigger_task_destroy,
+    [ OTF2_EVENT_TASK_RUNNABLE ] = otf2_global_evt_reader_trigger_task_runnable,
+    [ OTF2_EVENT_ADD_DEPENDENCE ] = otf2_global_evt_reader_trigger_add_dependence,
+    [ OTF2_EVENT_SATISFY_DEPENDENCE ] = otf2_global_evt_reader_trigger_satisfy_dependence,
+    [ OTF2_EVENT_DATA_ACQUIRE ] = otf2_global_evt_reader_trigger_data_acquire,
+    [ OTF2_EVENT_DATA_RELEASE ] = otf2_global_evt_reader_trigger_data_release,
+    [ OTF2_EVENT_EVENT_CREATE ] = otf2_global_evt_reader_trigger_event_create,
+    [ OTF2_EVENT_EVENT_DESTROY ] = otf2_global_evt_reader_trigger_event_destroy,
+    [ OTF2_EVENT_DATA_CREATE ] = otf2_global_evt_reader_trigger_data_create,
+    [ OTF2_EVENT_DATA_DESTROY ] = otf2_global_evt_reader_trigger_data_destroy,
+};
+
 static OTF2_ErrorCode
 otf2_global_evt_reader_trigger_callback( const OTF2_GlobalEvtReader* reader,
                                          OTF2_EvtReader*             evt_reader )
 {
     OTF2_GenericEvent* event = &evt_reader->current_event;
 
-    switch ( event->type )
+    /* An attribute list should not be in the event queue alone. */
+    if ( event->type == OTF2_ATTRIBUTE_LIST )
     {
-        /* An attribute list should not be in the event queue alone. */
-        case OTF2_ATTRIBUTE_LIST:
-            return OTF2_ERROR_INTEGRITY_FAULT;
-
-        case OTF2_EVENT_BUFFER_FLUSH:
-            return otf2_global_evt_reader_trigger_buffer_flush( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MEASUREMENT_ON_OFF:
-            return otf2_global_evt_reader_trigger_measurement_on_off( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_ENTER:
-            return otf2_global_evt_reader_trigger_enter( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_LEAVE:
-            return otf2_global_evt_reader_trigger_leave( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_SEND:
-            return otf2_global_evt_reader_trigger_mpi_send( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_ISEND:
-            return otf2_global_evt_reader_trigger_mpi_isend( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_ISEND_COMPLETE:
-            return otf2_global_evt_reader_trigger_mpi_isend_complete( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_IRECV_REQUEST:
-            return otf2_global_evt_reader_trigger_mpi_irecv_request( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_RECV:
-            return otf2_global_evt_reader_trigger_mpi_recv( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_IRECV:
-            return otf2_global_evt_reader_trigger_mpi_irecv( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_REQUEST_TEST:
-            return otf2_global_evt_reader_trigger_mpi_request_test( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_REQUEST_CANCELLED:
-            return otf2_global_evt_reader_trigger_mpi_request_cancelled( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_COLLECTIVE_BEGIN:
-            return otf2_global_evt_reader_trigger_mpi_collective_begin( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_MPI_COLLECTIVE_END:
-            return otf2_global_evt_reader_trigger_mpi_collective_end( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_OMP_FORK:
-            return otf2_global_evt_reader_trigger_omp_fork( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_OMP_JOIN:
-            return otf2_global_evt_reader_trigger_omp_join( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_OMP_ACQUIRE_LOCK:
-            return otf2_global_evt_reader_trigger_omp_acquire_lock( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_OMP_RELEASE_LOCK:
-            return otf2_global_evt_reader_trigger_omp_release_lock( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_OMP_TASK_CREATE:
-            return otf2_global_evt_reader_trigger_omp_task_create( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_OMP_TASK_SWITCH:
-            return otf2_global_evt_reader_trigger_omp_task_switch( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_OMP_TASK_COMPLETE:
-            return otf2_global_evt_reader_trigger_omp_task_complete( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_METRIC:
-            return otf2_global_evt_reader_trigger_metric( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_PARAMETER_STRING:
-            return otf2_global_evt_reader_trigger_parameter_string( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_PARAMETER_INT:
-            return otf2_global_evt_reader_trigger_parameter_int( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_PARAMETER_UNSIGNED_INT:
-            return otf2_global_evt_reader_trigger_parameter_unsigned_int( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_WIN_CREATE:
-            return otf2_global_evt_reader_trigger_rma_win_create( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_WIN_DESTROY:
-            return otf2_global_evt_reader_trigger_rma_win_destroy( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_COLLECTIVE_BEGIN:
-            return otf2_global_evt_reader_trigger_rma_collective_begin( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_COLLECTIVE_END:
-            return otf2_global_evt_reader_trigger_rma_collective_end( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_GROUP_SYNC:
-            return otf2_global_evt_reader_trigger_rma_group_sync( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_REQUEST_LOCK:
-            return otf2_global_evt_reader_trigger_rma_request_lock( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_ACQUIRE_LOCK:
-            return otf2_global_evt_reader_trigger_rma_acquire_lock( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_TRY_LOCK:
-            return otf2_global_evt_reader_trigger_rma_try_lock( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_RELEASE_LOCK:
-            return otf2_global_evt_reader_trigger_rma_release_lock( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_SYNC:
-            return otf2_global_evt_reader_trigger_rma_sync( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_WAIT_CHANGE:
-            return otf2_global_evt_reader_trigger_rma_wait_change( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_PUT:
-            return otf2_global_evt_reader_trigger_rma_put( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_GET:
-            return otf2_global_evt_reader_trigger_rma_get( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_ATOMIC:
-            return otf2_global_evt_reader_trigger_rma_atomic( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_OP_COMPLETE_BLOCKING:
-            return otf2_global_evt_reader_trigger_rma_op_complete_blocking( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_OP_COMPLETE_NON_BLOCKING:
-            return otf2_global_evt_reader_trigger_rma_op_complete_non_blocking( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_OP_TEST:
-            return otf2_global_evt_reader_trigger_rma_op_test( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_RMA_OP_COMPLETE_REMOTE:
-            return otf2_global_evt_reader_trigger_rma_op_complete_remote( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_FORK:
-            return otf2_global_evt_reader_trigger_thread_fork( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_JOIN:
-            return otf2_global_evt_reader_trigger_thread_join( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_TEAM_BEGIN:
-            return otf2_global_evt_reader_trigger_thread_team_begin( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_TEAM_END:
-            return otf2_global_evt_reader_trigger_thread_team_end( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_ACQUIRE_LOCK:
-            return otf2_global_evt_reader_trigger_thread_acquire_lock( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_RELEASE_LOCK:
-            return otf2_global_evt_reader_trigger_thread_release_lock( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_TASK_CREATE:
-            return otf2_global_evt_reader_trigger_thread_task_create( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_TASK_SWITCH:
-            return otf2_global_evt_reader_trigger_thread_task_switch( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_TASK_COMPLETE:
-            return otf2_global_evt_reader_trigger_thread_task_complete( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_CREATE:
-            return otf2_global_evt_reader_trigger_thread_create( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_BEGIN:
-            return otf2_global_evt_reader_trigger_thread_begin( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_WAIT:
-            return otf2_global_evt_reader_trigger_thread_wait( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_THREAD_END:
-            return otf2_global_evt_reader_trigger_thread_end( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_CALLING_CONTEXT_ENTER:
-            return otf2_global_evt_reader_trigger_calling_context_enter( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_CALLING_CONTEXT_LEAVE:
-            return otf2_global_evt_reader_trigger_calling_context_leave( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_CALLING_CONTEXT_SAMPLE:
-            return otf2_global_evt_reader_trigger_calling_context_sample( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_TASK_CREATE:
-            return otf2_global_evt_reader_trigger_task_create( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_TASK_DESTROY:
-            return otf2_global_evt_reader_trigger_task_destroy( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_TASK_RUNNABLE:
-            return otf2_global_evt_reader_trigger_task_runnable( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_ADD_DEPENDENCE:
-            return otf2_global_evt_reader_trigger_add_dependence( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_SATISFY_DEPENDENCE:
-            return otf2_global_evt_reader_trigger_satisfy_dependence( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_DATA_ACQUIRE:
-            return otf2_global_evt_reader_trigger_data_acquire( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_DATA_RELEASE:
-            return otf2_global_evt_reader_trigger_data_release( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_EVENT_CREATE:
-            return otf2_global_evt_reader_trigger_event_create( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_EVENT_DESTROY:
-            return otf2_global_evt_reader_trigger_event_destroy( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_DATA_CREATE:
-            return otf2_global_evt_reader_trigger_data_create( reader,
-                                                                   evt_reader );
-
-        case OTF2_EVENT_DATA_DESTROY:
-            return otf2_global_evt_reader_trigger_data_destroy( reader,
-                                                                   evt_reader );
+        return OTF2_ERROR_INTEGRITY_FAULT;
+    }
 
-        default:
-            return otf2_global_evt_reader_trigger_unknown( reader,
-                                                           evt_reader );
+    if ( otf2_global_evt_reader_trigger_table[ event->type ] )
+    {
+        return otf2_global_evt_reader_trigger_table[ event->type ]( reader,
+                                                                    evt_reader );
     }
+    return otf2_global_evt_reader_trigger_unknown( reader,
+                                                   evt_reader );
 }
 
 
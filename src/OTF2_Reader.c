@@ -330,6 +330,23 @@ OTF2_Reader_SetLockingCallbacks( OTF2_Reader*                 reader,
                                                 lockingData );
 }
 
+OTF2_ErrorCode
+OTF2_Reader_SetParallelCallbacks( OTF2_Reader*                  reader,
+                                  const OTF2_ParallelCallbacks* parallelCallbacks,
+                                  void*                         parallelData )
+{
+    /* Validate arguments. */
+    if ( !reader )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid reader handle!" );
+    }
+
+    return reader->impl->set_parallel_callbacks( reader->archive,
+                                                 parallelCallbacks,
+                                                 parallelData );
+}
+
 OTF2_ErrorCode
 OTF2_Reader_RegisterEvtCallbacks( OTF2_Reader*                   reader,
                                   OTF2_EvtReader*                evtReader,
@@ -665,6 +682,23 @@ OTF2_Reader_ReadLocalEventsBackward( OTF2_Reader*    reader,
 }
 
 
+OTF2_ErrorCode
+OTF2_Reader_ReadGlobalEventsBackward( OTF2_Reader*          reader,
+                                      OTF2_GlobalEvtReader* evtReader,
+                                      uint64_t              eventsToRead,
+                                      uint64_t*             eventsRead )
+{
+    /* Validate arguments. */
+    if ( NULL == reader )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "This is no valid reader handle!" );
+    }
+
+    return reader->impl->read_global_events_backward( evtReader, eventsToRead, eventsRead );
+}
+
+
 OTF2_ErrorCode
 OTF2_Reader_ReadLocalDefinitions( OTF2_Reader*    reader,
                                   OTF2_DefReader* defReader,
@@ -1700,3 +1734,45 @@ OTF2_Reader_SelectLocation( OTF2_Reader* reader, OTF2_LocationRef location )
 
     return reader->impl->select_location( reader->archive, location );
 }
+
+
+OTF2_ErrorCode
+OTF2_Reader_UnifyLocalDefinitions( OTF2_Reader*                     reader,
+                                   uint32_t                         numberOfLocations,
+                                   const OTF2_LocationRef*          locations,
+                                   OTF2_GlobalDefWriter*            globalDefWriter,
+                                   OTF2_UnifiedMappingTableCallback mappingTableCallback,
+                                   void*                            userData,
+                                   uint64_t*                        numberOfStrings )
+{
+    /* Validate argument. */
+    if ( !reader )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid reader handle!" );
+    }
+
+    return reader->impl->unify_local_definitions( reader->archive,
+                                                  numberOfLocations,
+                                                  locations,
+                                                  globalDefWriter,
+                                                  mappingTableCallback,
+                                                  userData,
+                                                  numberOfStrings );
+}
+
+
+OTF2_ErrorCode
+OTF2_Reader_LoadLocalDefinitions( OTF2_Reader* reader,
+                                  bool         skipDefinitions )
+{
+    /* Validate argument. */
+    if ( !reader )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                            "Invalid reader handle!" );
+    }
+
+    return reader->impl->load_local_definitions( reader->archive,
+                                                 skipDefinitions );
+}
@@ -52,6 +52,50 @@ struct otf2_archive_property_struct
     otf2_archive_property* previous;
 };
 
+/** @brief Version of the region filter of an archive.
+ *
+ *  The regions of a published version are never changed. Event writers read
+ *  it without taking the archive lock, therefore a replaced version is only
+ *  freed once all event writers announced that they use a newer one, see
+ *  otf2_archive_set_region_filter().
+ */
+typedef struct otf2_region_filter_struct otf2_region_filter;
+struct otf2_region_filter_struct
+{
+    /** The version this one replaced, if it may still be in use. */
+    otf2_region_filter* previous;
+    /** Number of this version, counting from 1. */
+    uint64_t            version;
+    /** Number of regions covered by @a bits. */
+    uint32_t            number_of_regions;
+    /** One bit per region, set if the region is filtered. */
+    uint64_t            bits[];
+};
+
+/** @brief State of the built-in clock of an archive, see
+ *         otf2_archive_set_builtin_clock().
+ */
+typedef struct otf2_archive_clock_struct
+{
+    /** Whether the clock is used. */
+    bool     enabled;
+    /** Whether the time stamp counter of the CPU is read. */
+    bool     use_tsc;
+    /** Ticks per second. */
+    uint64_t resolution;
+    /** Local time of the synchronization when the clock was set up. */
+    uint64_t start_time;
+    /** Offset from the local to the root clock at @a start_time. */
+    int64_t  start_offset;
+    /** Whether the synchronization in otf2_archive_close_evt_files() was
+     *  done. */
+    bool     end_synchronized;
+    /** Local time of the synchronization in otf2_archive_close_evt_files(). */
+    uint64_t end_time;
+    /** Offset from the local to the root clock at @a end_time. */
+    int64_t  end_offset;
+} otf2_archive_clock;
+
 /** @brief Datastructure which is used internally to represent
  *         an archive.
  */
@@ -178,16 +222,47 @@ struct OTF2_Archive_struct
     /** The lock for the archive */
     OTF2_Lock                    lock;
 
+    /** Parallel callbacks */
+    const OTF2_ParallelCallbacks* parallel_callbacks;
+    /** User data for parallel callbacks */
+    void*                         parallel_data;
+
+    /** The built-in clock */
+    otf2_archive_clock clock;
+
     /** Number of locations using this archive object. */
     uint32_t locations_number;
     /** Vector keeping location information.
      *  In writing mode this keeps only the location IDs. In reading mode this
      *  is also used to store the mapping tables. */
     otf2_archive_location* locations;
+    /** Open addressing hash table from location IDs to their index in
+     *  @a locations. Free slots are marked with OTF2_UNDEFINED_UINT32. */
+    uint32_t* location_index;
+    /** Number of slots in @a location_index, always a power of two. */
+    uint32_t location_index_size;
 
     /** Archive/reader hints */
     bool         hint_global_reader_locked;
     OTF2_Boolean hint_global_reader;
+    bool         hint_max_open_files_locked;
+    uint32_t     hint_max_open_files;
+    bool         hint_max_chunk_memory_locked;
+    uint64_t     hint_max_chunk_memory;
+    bool         hint_event_index_interval_locked;
+    uint32_t     hint_event_index_interval;
+    bool         hint_implicit_leave_locked;
+    OTF2_Boolean hint_implicit_leave;
+    bool         hint_attribute_list_shapes_locked;
+    OTF2_Boolean hint_attribute_list_shapes;
+    bool         hint_metric_deltas_locked;
+    OTF2_Boolean hint_metric_deltas;
+    bool         hint_calling_context_deltas_locked;
+    OTF2_Boolean hint_calling_context_deltas;
+    bool                 hint_chunk_allocation_locked;
+    OTF2_ChunkAllocation hint_chunk_allocation;
+    bool     hint_adaptive_chunk_size_locked;
+    uint64_t hint_adaptive_chunk_size;
 
     /** Map of CallingContext to Region. Needed for backward reading without
         new callbacks set. */
@@ -195,6 +270,11 @@ struct OTF2_Archive_struct
     uint32_t        calling_context_to_region_map_size;
     uint32_t        calling_context_to_region_map_capacity;
     OTF2_IdMap*     calling_context_to_region_index_map;
+
+    /** Current version of the region filter for the event writers, NULL if
+     *  no region was ever filtered. Published with release semantics, see
+     *  otf2_archive_get_region_filter(). */
+    otf2_region_filter* region_filter;
 };
 
 
@@ -290,6 +370,11 @@ otf2_archive_set_locking_callbacks( OTF2_Archive*                archive,
                                     const OTF2_LockingCallbacks* lockingCallbacks,
                                     void*                        lockingData );
 
+OTF2_ErrorCode
+otf2_archive_set_parallel_callbacks( OTF2_Archive*                 archive,
+                                     const OTF2_ParallelCallbacks* parallelCallbacks,
+                                     void*                         parallelData );
+
 #define OTF2_ARCHIVE_LOCK( archive ) \
     do \
     { \
@@ -320,6 +405,12 @@ OTF2_ErrorCode
 otf2_archive_set_trace_id( OTF2_Archive* archive,
                            uint64_t      id );
 
+OTF2_ErrorCode
+otf2_archive_set_region_filter( OTF2_Archive*         archive,
+                                uint32_t              numberOfRegions,
+                                const OTF2_RegionRef* regions,
+                                OTF2_Boolean          filtered );
+
 OTF2_ErrorCode
 otf2_archive_set_number_of_snapshots( OTF2_Archive* archive,
                                       uint32_t      number );
@@ -330,6 +421,36 @@ otf2_archive_set_number_of_thumbnails( OTF2_Archive* archive,
 
 /*___GET_FUNCTIONS__________*/
 
+/** @brief Get the current version of the region filter without taking the
+ *  archive lock.
+ *
+ *  @param archive  Archive handle.
+ *
+ *  @return The region filter, NULL if no region was ever filtered.
+ */
+static inline const otf2_region_filter*
+otf2_archive_get_region_filter( OTF2_Archive* archive )
+{
+#if defined( __GNUC__ )
+    return __atomic_load_n( &archive->region_filter, __ATOMIC_ACQUIRE );
+#else
+    return *( otf2_region_filter* volatile* )&archive->region_filter;
+#endif
+}
+
+/** @brief Test whether a region is filtered.
+ *
+ *  @param filter   A version of the region filter.
+ *  @param region   The region.
+ */
+static inline bool
+otf2_region_filter_test( const otf2_region_filter* filter,
+                         OTF2_RegionRef            region )
+{
+    return region < filter->number_of_regions
+           && ( filter->bits[ region / 64 ] >> ( region % 64 ) ) & 1;
+}
+
 OTF2_ErrorCode
 otf2_archive_get_version( OTF2_Archive* archive,
                           uint8_t*      major,
@@ -648,4 +769,34 @@ otf2_archive_map_calling_context_to_region( OTF2_Archive*          archive,
                                             OTF2_CallingContextRef callingContext,
                                             OTF2_RegionRef*        region );
 
+OTF2_ErrorCode
+otf2_archive_set_builtin_clock( OTF2_Archive* archive );
+
+uint64_t
+otf2_archive_get_time( const OTF2_Archive* archive );
+
+void
+otf2_archive_get_clock_properties( const OTF2_Archive* archive,
+                                   uint64_t*           timerResolution,
+                                   uint64_t*           globalOffset,
+                                   uint64_t*           traceLength );
+
+OTF2_ErrorCode
+otf2_archive_clock_synchronize( OTF2_Archive* archive,
+                                uint64_t*     localTime,
+                                int64_t*      offset );
+
+OTF2_ErrorCode
+otf2_archive_write_clock_properties( OTF2_Archive*         archive,
+                                     OTF2_GlobalDefWriter* writer );
+
+OTF2_ErrorCode
+otf2_archive_write_clock_offsets( const OTF2_Archive* archive,
+                                  OTF2_DefWriter*     defWriter );
+
+
+OTF2_ErrorCode
+otf2_archive_load_local_definitions( OTF2_Archive* archive,
+                                     bool          skipDefinitions );
+
 #endif /* !OTF2_INTERNAL_ARCHIVE_H */
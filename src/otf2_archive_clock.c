@@ -0,0 +1,410 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2009-2013,
+ * RWTH Aachen University, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * Gesellschaft fuer numerische Simulation mbH Braunschweig, Germany
+ *
+ * Copyright (c) 2009-2014,
+ * Technische Universitaet Dresden, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * University of Oregon, Eugene, USA
+ *
+ * Copyright (c) 2009-2013,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * German Research School for Simulation Sciences GmbH, Juelich/Aachen, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * Technische Universitaet Muenchen, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+/**
+ *  @file
+ *
+ *  @brief The built-in clock of an archive.
+ */
+
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <time.h>
+
+#if HAVE( UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( __GNUC__ )
+#include <cpuid.h>
+#define OTF2_ARCHIVE_CLOCK_HAVE_TSC 1
+#else
+#define OTF2_ARCHIVE_CLOCK_HAVE_TSC 0
+#endif
+
+#if !HAVE( CLOCK_GETTIME )
+#include <sys/time.h>
+#endif
+
+#include <otf2/otf2.h>
+
+#include <UTILS_Error.h>
+#include <UTILS_Debug.h>
+
+#include "otf2_internal.h"
+#include "otf2_lock.h"
+#include "otf2_file_types.h"
+#include "otf2_reader.h"
+#include "otf2_archive.h"
+
+#include "otf2_collectives.h"
+
+
+/* Provide gethostid declaration if we are able to
+ * link against gethostid, but found no declaration */
+#if !( HAVE( DECL_GETHOSTID ) ) && HAVE( GETHOSTID )
+
+extern long
+gethostid( void );
+
+#endif
+
+#if HAVE( CLOCK_GETTIME )
+#if defined( CLOCK_MONOTONIC_RAW )
+#define OTF2_ARCHIVE_CLOCK_ID CLOCK_MONOTONIC_RAW
+#else
+#define OTF2_ARCHIVE_CLOCK_ID CLOCK_MONOTONIC
+#endif
+/** Ticks per second of otf2_archive_clock_read_monotonic(). */
+#define OTF2_ARCHIVE_CLOCK_MONOTONIC_RESOLUTION UINT64_C( 1000000000 )
+#else
+#define OTF2_ARCHIVE_CLOCK_MONOTONIC_RESOLUTION UINT64_C( 1000000 )
+#endif
+
+/** Duration of the calibration of the time stamp counter in ticks of
+ *  otf2_archive_clock_read_monotonic(), i.e., 20ms. */
+#define OTF2_ARCHIVE_CLOCK_CALIBRATION_TIME \
+    ( OTF2_ARCHIVE_CLOCK_MONOTONIC_RESOLUTION / 50 )
+
+/** Number of round trips to the root process in
+ *  otf2_archive_clock_synchronize(). */
+#define OTF2_ARCHIVE_CLOCK_ROUND_TRIPS 10
+
+
+/** @brief Read the monotonic clock of the operating system. */
+static uint64_t
+otf2_archive_clock_read_monotonic( void )
+{
+#if HAVE( CLOCK_GETTIME )
+    struct timespec now;
+    clock_gettime( OTF2_ARCHIVE_CLOCK_ID, &now );
+    return ( uint64_t )now.tv_sec * OTF2_ARCHIVE_CLOCK_MONOTONIC_RESOLUTION
+           + ( uint64_t )now.tv_nsec;
+#else
+    struct timeval now;
+    gettimeofday( &now, NULL );
+    return ( uint64_t )now.tv_sec * OTF2_ARCHIVE_CLOCK_MONOTONIC_RESOLUTION
+           + ( uint64_t )now.tv_usec;
+#endif
+}
+
+
+#if OTF2_ARCHIVE_CLOCK_HAVE_TSC
+
+/** @brief Read the time stamp counter of the CPU. */
+static inline uint64_t
+otf2_archive_clock_read_tsc( void )
+{
+    uint32_t low;
+    uint32_t high;
+    __asm__ __volatile__ ( "rdtsc" : "=a" ( low ), "=d" ( high ) );
+    return ( ( uint64_t )high << 32 ) | low;
+}
+
+
+/** @brief Check whether the time stamp counter ticks with a constant rate,
+ *  independent of the power state of the CPU. */
+static bool
+otf2_archive_clock_has_invariant_tsc( void )
+{
+    unsigned int eax, ebx, ecx, edx;
+    if ( !__get_cpuid( 0x80000007, &eax, &ebx, &ecx, &edx ) )
+    {
+        return false;
+    }
+    return ( edx & ( 1u << 8 ) ) != 0;
+}
+
+
+/** @brief Measure the ticks per second of the time stamp counter. */
+static uint64_t
+otf2_archive_clock_calibrate_tsc( void )
+{
+    uint64_t begin_time = otf2_archive_clock_read_monotonic();
+    uint64_t begin_tsc  = otf2_archive_clock_read_tsc();
+    uint64_t end_time;
+    do
+    {
+        end_time = otf2_archive_clock_read_monotonic();
+    }
+    while ( end_time - begin_time < OTF2_ARCHIVE_CLOCK_CALIBRATION_TIME );
+    uint64_t end_tsc = otf2_archive_clock_read_tsc();
+
+    return ( uint64_t )( ( double )( end_tsc - begin_tsc )
+                         * ( double )OTF2_ARCHIVE_CLOCK_MONOTONIC_RESOLUTION
+                         / ( double )( end_time - begin_time ) + 0.5 );
+}
+
+#endif /* OTF2_ARCHIVE_CLOCK_HAVE_TSC */
+
+
+uint64_t
+otf2_archive_get_time( const OTF2_Archive* archive )
+{
+#if OTF2_ARCHIVE_CLOCK_HAVE_TSC
+    if ( archive->clock.use_tsc )
+    {
+        return otf2_archive_clock_read_tsc();
+    }
+#endif
+    return otf2_archive_clock_read_monotonic();
+}
+
+
+/** @brief Synchronize the local clock with the clock of the root process.
+ *
+ *  The offset is measured with round trips to the root process: Each process
+ *  reads its clock before a barrier, the root reads its clock after the
+ *  barrier and broadcasts it together with its host ID, and each process
+ *  reads its clock again after the broadcast. The root clock was read between
+ *  both local reads, thus the midpoint of the round trip is taken as the
+ *  local time of the root time. Its error is at most half of the duration of
+ *  the round trip. The shortest of OTF2_ARCHIVE_CLOCK_ROUND_TRIPS round trips
+ *  is used. Processes on the host of the root share its clock and get no
+ *  offset.
+ *
+ *  @param archive         Archive handle.
+ *  @param[out] localTime  Local time of the synchronization.
+ *  @param[out] offset     Offset from the local to the root clock.
+ *
+ *  @threadsafety          Caller holds the archive lock.
+ */
+OTF2_ErrorCode
+otf2_archive_clock_synchronize( OTF2_Archive* archive,
+                                uint64_t*     localTime,
+                                int64_t*      offset )
+{
+    uint64_t host_id = 0;
+#if HAVE( GETHOSTID )
+    host_id = ( uint64_t )gethostid();
+#endif
+    bool is_root = otf2_archive_is_master( archive );
+
+    uint64_t shortest_round_trip = UINT64_MAX;
+    for ( uint32_t i = 0; i < OTF2_ARCHIVE_CLOCK_ROUND_TRIPS; i++ )
+    {
+        uint64_t send_time = otf2_archive_get_time( archive );
+
+        OTF2_CallbackCode callback_ret =
+            otf2_collectives_barrier( archive, archive->global_comm_context );
+        if ( OTF2_CALLBACK_SUCCESS != callback_ret )
+        {
+            return UTILS_ERROR( OTF2_ERROR_COLLECTIVE_CALLBACK,
+                                "Barrier for the clock synchronization failed." );
+        }
+
+        uint64_t root[ 2 ] = { host_id, otf2_archive_get_time( archive ) };
+        callback_ret = otf2_collectives_bcast( archive,
+                                               archive->global_comm_context,
+                                               root,
+                                               2,
+                                               OTF2_TYPE_UINT64,
+                                               OTF2_COLLECTIVES_ROOT );
+        if ( OTF2_CALLBACK_SUCCESS != callback_ret )
+        {
+            return UTILS_ERROR( OTF2_ERROR_COLLECTIVE_CALLBACK,
+                                "Broadcast of the root clock failed." );
+        }
+
+        uint64_t receive_time = otf2_archive_get_time( archive );
+
+        if ( is_root )
+        {
+            *localTime = root[ 1 ];
+            *offset    = 0;
+            continue;
+        }
+
+        uint64_t round_trip = receive_time - send_time;
+        if ( round_trip >= shortest_round_trip )
+        {
+            continue;
+        }
+        shortest_round_trip = round_trip;
+
+        *localTime = send_time + round_trip / 2;
+        *offset    = 0;
+#if HAVE( GETHOSTID )
+        if ( root[ 0 ] != host_id )
+#endif
+        {
+            *offset = ( int64_t )( root[ 1 ] - *localTime );
+        }
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/**
+ *  @threadsafety  Locks the archive.
+ */
+OTF2_ErrorCode
+otf2_archive_set_builtin_clock( OTF2_Archive* archive )
+{
+    UTILS_ASSERT( archive );
+
+    OTF2_ErrorCode status = OTF2_SUCCESS;
+
+    OTF2_ARCHIVE_LOCK( archive );
+
+    if ( archive->clock.enabled )
+    {
+        status = UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                              "The clock of OTF2 is already used." );
+        goto out;
+    }
+
+    archive->clock.use_tsc    = false;
+    archive->clock.resolution = OTF2_ARCHIVE_CLOCK_MONOTONIC_RESOLUTION;
+#if OTF2_ARCHIVE_CLOCK_HAVE_TSC
+    if ( otf2_archive_clock_has_invariant_tsc() )
+    {
+        archive->clock.use_tsc    = true;
+        archive->clock.resolution = otf2_archive_clock_calibrate_tsc();
+    }
+#endif
+
+    status = otf2_archive_clock_synchronize( archive,
+                                             &archive->clock.start_time,
+                                             &archive->clock.start_offset );
+    if ( OTF2_SUCCESS != status )
+    {
+        UTILS_ERROR( status, "Couldn't synchronize the clocks." );
+        goto out;
+    }
+
+    archive->clock.enabled = true;
+
+out:
+    OTF2_ARCHIVE_UNLOCK( archive );
+    return status;
+}
+
+
+void
+otf2_archive_get_clock_properties( const OTF2_Archive* archive,
+                                   uint64_t*           timerResolution,
+                                   uint64_t*           globalOffset,
+                                   uint64_t*           traceLength )
+{
+    UTILS_ASSERT( archive );
+
+    uint64_t end_time   = archive->clock.end_time;
+    int64_t  end_offset = archive->clock.end_offset;
+    if ( !archive->clock.end_synchronized )
+    {
+        end_time   = otf2_archive_get_time( archive );
+        end_offset = archive->clock.start_offset;
+    }
+
+    *timerResolution = archive->clock.resolution;
+    *globalOffset    = archive->clock.start_time + archive->clock.start_offset;
+    *traceLength     = end_time + end_offset - *globalOffset;
+}
+
+
+/** @brief Write the ClockProperties definition of the built-in clock, if
+ *  the clocks were synchronized in otf2_archive_close_evt_files().
+ *
+ *  @threadsafety  Caller holds the archive lock.
+ */
+OTF2_ErrorCode
+otf2_archive_write_clock_properties( OTF2_Archive*         archive,
+                                     OTF2_GlobalDefWriter* writer )
+{
+    if ( !archive->clock.enabled || !archive->clock.end_synchronized )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    uint64_t timer_resolution;
+    uint64_t global_offset;
+    uint64_t trace_length;
+    otf2_archive_get_clock_properties( archive,
+                                       &timer_resolution,
+                                       &global_offset,
+                                       &trace_length );
+
+    return OTF2_GlobalDefWriter_WriteClockProperties( writer,
+                                                      timer_resolution,
+                                                      global_offset,
+                                                      trace_length );
+}
+
+
+/** @brief Write the ClockOffset definitions of the built-in clock for the
+ *  location of @a defWriter.
+ *
+ *  Nothing is written if the clocks were not synchronized in
+ *  otf2_archive_close_evt_files() yet, or if the local clock is the clock
+ *  of the root process.
+ */
+OTF2_ErrorCode
+otf2_archive_write_clock_offsets( const OTF2_Archive* archive,
+                                  OTF2_DefWriter*     defWriter )
+{
+    UTILS_ASSERT( archive );
+
+    if ( !archive->clock.enabled
+         || !archive->clock.end_synchronized
+         || ( archive->clock.start_offset == 0 && archive->clock.end_offset == 0 ) )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    OTF2_ErrorCode status = OTF2_DefWriter_WriteClockOffset( defWriter,
+                                                             archive->clock.start_time,
+                                                             archive->clock.start_offset,
+                                                             0.0 );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status, "Couldn't write the clock offset." );
+    }
+
+    status = OTF2_DefWriter_WriteClockOffset( defWriter,
+                                              archive->clock.end_time,
+                                              archive->clock.end_offset,
+                                              0.0 );
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status, "Couldn't write the clock offset." );
+    }
+
+    return OTF2_SUCCESS;
+}
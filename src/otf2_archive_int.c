@@ -68,6 +68,7 @@
 #include "otf2_id_map.h"
 
 #include "OTF2_File.h"
+#include "OTF2_Buffer.h"
 #include "otf2_file_substrate.h"
 
 #include "otf2_local_definitions.h"
@@ -162,8 +163,27 @@ otf2_archive_open( const char*        archivePath,
     ret->number_of_snapshots  = 0;
 
     /* Set default values for hints */
-    ret->hint_global_reader_locked = false;
-    ret->hint_global_reader        = OTF2_FALSE;
+    ret->hint_global_reader_locked    = false;
+    ret->hint_global_reader           = OTF2_FALSE;
+    ret->hint_max_open_files_locked   = false;
+    ret->hint_max_open_files          = 0;
+    ret->hint_max_chunk_memory_locked = false;
+    ret->hint_max_chunk_memory        = 0;
+
+    ret->hint_event_index_interval_locked  = false;
+    ret->hint_event_index_interval         = 0;
+    ret->hint_implicit_leave_locked        = false;
+    ret->hint_implicit_leave               = OTF2_FALSE;
+    ret->hint_attribute_list_shapes_locked = false;
+    ret->hint_attribute_list_shapes        = OTF2_FALSE;
+    ret->hint_metric_deltas_locked         = false;
+    ret->hint_metric_deltas                = OTF2_FALSE;
+    ret->hint_calling_context_deltas_locked = false;
+    ret->hint_calling_context_deltas        = OTF2_FALSE;
+    ret->hint_chunk_allocation_locked       = false;
+    ret->hint_chunk_allocation              = OTF2_CHUNK_ALLOCATION_HEAP;
+    ret->hint_adaptive_chunk_size_locked    = false;
+    ret->hint_adaptive_chunk_size           = 0;
 
     /* Initialize mapping to 0. */
     ret->calling_context_to_region_map          = 0;
@@ -257,6 +277,11 @@ otf2_archive_open( const char*        archivePath,
     ret->locking_data      = NULL;
     ret->lock              = NULL;
 
+    ret->parallel_callbacks = NULL;
+    ret->parallel_data      = NULL;
+
+    memset( &ret->clock, 0, sizeof( ret->clock ) );
+
     /* Set the OTF2 and trace format versions */
     if ( fileMode != OTF2_FILEMODE_READ )
     {
@@ -302,8 +327,10 @@ otf2_archive_open( const char*        archivePath,
     /* Initialize locations vector.
      * The vector is initialized with a size of 64 locations and can be adapted
      * on demand. */
-    ret->locations_number = 0;
-    ret->locations        = ( otf2_archive_location* )calloc( OTF2_ARCHIVE_LOCATION_SIZE, sizeof( otf2_archive_location ) );
+    ret->locations_number    = 0;
+    ret->locations           = ( otf2_archive_location* )calloc( OTF2_ARCHIVE_LOCATION_SIZE, sizeof( otf2_archive_location ) );
+    ret->location_index      = NULL;
+    ret->location_index_size = 0;
     if ( ret->locations == NULL )
     {
         otf2_archive_close( ret );
@@ -316,6 +343,207 @@ otf2_archive_open( const char*        archivePath,
 }
 
 
+/** @brief A writer to be closed by otf2_archive_delete_writers(). */
+typedef struct otf2_archive_writer_task
+{
+    /** Kind of the writer, one of OTF2_FILETYPE_EVENTS,
+     *  OTF2_FILETYPE_LOCAL_DEFS, and OTF2_FILETYPE_SNAPSHOTS. */
+    OTF2_FileType  file_type;
+    /** The writer object. */
+    void*          writer;
+    /** Set when the writer was deleted. */
+    bool           done;
+    /** Result of the deletion. */
+    OTF2_ErrorCode status;
+} otf2_archive_writer_task;
+
+
+/** @brief OTF2_Parallel_Task to delete one writer. */
+static void
+otf2_archive_delete_writer_task( void*    taskData,
+                                 uint32_t taskIndex )
+{
+    otf2_archive_writer_task* task = ( otf2_archive_writer_task* )taskData + taskIndex;
+
+    switch ( task->file_type )
+    {
+        case OTF2_FILETYPE_EVENTS:
+            task->status = otf2_evt_writer_delete( task->writer );
+            break;
+        case OTF2_FILETYPE_LOCAL_DEFS:
+            task->status = otf2_def_writer_delete( task->writer );
+            break;
+        case OTF2_FILETYPE_SNAPSHOTS:
+            task->status = otf2_snap_writer_delete( task->writer );
+            break;
+    }
+    task->done = true;
+}
+
+
+/** @brief Add the writers of a list to the tasks of
+ *  otf2_archive_delete_writers().
+ *
+ *  The lists of the writer types share the layout of their @a next member
+ *  only by name, thus this is a macro.
+ */
+#define OTF2_ARCHIVE_ADD_WRITER_TASKS( tasks, numberOfTasks, list, fileType ) \
+    do \
+    { \
+        for ( ; list; list = list->next ) \
+        { \
+            ( tasks )[ ( numberOfTasks ) ].file_type = fileType; \
+            ( tasks )[ ( numberOfTasks ) ].writer    = list; \
+            ( tasks )[ ( numberOfTasks ) ].done      = false; \
+            ( tasks )[ ( numberOfTasks ) ].status    = OTF2_SUCCESS; \
+            ( numberOfTasks )++; \
+        } \
+    } while ( 0 )
+
+
+/** @brief Delete a set of writers, concurrently if the parallel and the
+ *  locking callbacks are set.
+ *
+ *  The writers are not in any list of the archive anymore. The files of the
+ *  writers are independent of each other, except for the SION substrate,
+ *  which manages them in the archive. The writers still share the archive
+ *  and its flush and memory callbacks, which are only serialized with locks.
+ *  Writers not deleted by the callback are deleted serially.
+ *
+ *  @param archive        Archive handle.
+ *  @param tasks          The writers to delete.
+ *  @param numberOfTasks  Number of writers.
+ *
+ *  @return               Returns OTF2_SUCCESS if successful, an error code
+ *                        if an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_archive_delete_writers( OTF2_Archive*             archive,
+                             otf2_archive_writer_task* tasks,
+                             uint32_t                  numberOfTasks )
+{
+    if ( numberOfTasks > 1
+         && archive->parallel_callbacks
+         && archive->locking_callbacks
+         && archive->substrate != OTF2_SUBSTRATE_SION )
+    {
+        OTF2_CallbackCode callback_ret =
+            archive->parallel_callbacks->otf2_run( archive->parallel_data,
+                                                   numberOfTasks,
+                                                   otf2_archive_delete_writer_task,
+                                                   tasks );
+        if ( OTF2_CALLBACK_SUCCESS != callback_ret )
+        {
+            UTILS_WARNING( "Parallel callback failed, closing the remaining writers serially." );
+        }
+    }
+
+    OTF2_ErrorCode status = OTF2_SUCCESS;
+    for ( uint32_t i = 0; i < numberOfTasks; i++ )
+    {
+        if ( !tasks[ i ].done )
+        {
+            otf2_archive_delete_writer_task( tasks, i );
+        }
+        if ( OTF2_SUCCESS != tasks[ i ].status )
+        {
+            status = UTILS_ERROR( tasks[ i ].status, "Couldn't close writer." );
+        }
+    }
+
+    return status;
+}
+
+
+/** @brief Close all local writers of the given kinds.
+ *
+ *  Caller must not hold the archive lock.
+ *
+ *  @param archive      Archive handle.
+ *  @param events       Close the event writers.
+ *  @param definitions  Close the local definition writers.
+ *  @param snapshots    Close the snapshot writers.
+ *
+ *  @return             Returns OTF2_SUCCESS if successful, an error code
+ *                      if an error occurs.
+ */
+static OTF2_ErrorCode
+otf2_archive_close_local_writers( OTF2_Archive* archive,
+                                  bool          events,
+                                  bool          definitions,
+                                  bool          snapshots )
+{
+    /* Take the writers out of the archive. */
+    OTF2_ARCHIVE_LOCK( archive );
+    OTF2_EvtWriter*  evt_writers  = NULL;
+    OTF2_DefWriter*  def_writers  = NULL;
+    OTF2_SnapWriter* snap_writers = NULL;
+    uint32_t         number       = 0;
+    if ( events )
+    {
+        evt_writers                = archive->local_evt_writers;
+        archive->local_evt_writers = NULL;
+        for ( OTF2_EvtWriter* it = evt_writers; it; it = it->next )
+        {
+            number++;
+        }
+    }
+    if ( definitions )
+    {
+        def_writers                = archive->local_def_writers;
+        archive->local_def_writers = NULL;
+        for ( OTF2_DefWriter* it = def_writers; it; it = it->next )
+        {
+            number++;
+        }
+    }
+    if ( snapshots )
+    {
+        snap_writers                = archive->local_snap_writers;
+        archive->local_snap_writers = NULL;
+        for ( OTF2_SnapWriter* it = snap_writers; it; it = it->next )
+        {
+            number++;
+        }
+    }
+    OTF2_ARCHIVE_UNLOCK( archive );
+
+    if ( number == 0 )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    otf2_archive_writer_task* tasks = calloc( number, sizeof( *tasks ) );
+    if ( !tasks )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Could not allocate memory for writer tasks!" );
+    }
+    number = 0;
+    OTF2_ARCHIVE_ADD_WRITER_TASKS( tasks, number, evt_writers, OTF2_FILETYPE_EVENTS );
+    uint32_t number_of_evt_writers = number;
+    OTF2_ARCHIVE_ADD_WRITER_TASKS( tasks, number, def_writers, OTF2_FILETYPE_LOCAL_DEFS );
+    OTF2_ARCHIVE_ADD_WRITER_TASKS( tasks, number, snap_writers, OTF2_FILETYPE_SNAPSHOTS );
+
+    /* The event writers record the event time ranges, which the local
+     * definition writers store, thus delete them first. */
+    OTF2_ErrorCode status = otf2_archive_delete_writers( archive,
+                                                         tasks,
+                                                         number_of_evt_writers );
+    OTF2_ErrorCode other_status =
+        otf2_archive_delete_writers( archive,
+                                     tasks + number_of_evt_writers,
+                                     number - number_of_evt_writers );
+    if ( OTF2_SUCCESS == status )
+    {
+        status = other_status;
+    }
+    free( tasks );
+
+    return status;
+}
+
+
 /** @brief Deconstruct a processed archive.
  *
  *  This is more a finalization step. If this function is called, the archive will be
@@ -345,22 +573,21 @@ otf2_archive_close( OTF2_Archive* archive )
     }
 
     /* All writers must be closed etc. */
-    while ( archive->local_evt_writers )
-    {
-        OTF2_EvtWriter* next = archive->local_evt_writers->next;
-        otf2_evt_writer_delete( archive->local_evt_writers );
-        archive->local_evt_writers = next;
-    }
-
-    while ( archive->local_def_writers )
+    ret = otf2_archive_close_local_writers( archive, true, true, false );
+    if ( ret != OTF2_SUCCESS )
     {
-        OTF2_DefWriter* next = archive->local_def_writers->next;
-        otf2_def_writer_delete( archive->local_def_writers );
-        archive->local_def_writers = next;
+        UTILS_ERROR( ret, "Couldn't close local writers." );
     }
 
     if ( archive->global_def_writer )
     {
+        ret = otf2_archive_write_clock_properties( archive,
+                                                   archive->global_def_writer );
+        if ( ret != OTF2_SUCCESS )
+        {
+            UTILS_ERROR( ret, "Couldn't write the clock properties." );
+        }
+
         ret = otf2_global_def_writer_delete( archive->global_def_writer );
         if ( ret != OTF2_SUCCESS )
         {
@@ -368,11 +595,10 @@ otf2_archive_close( OTF2_Archive* archive )
         }
     }
 
-    while ( archive->local_snap_writers )
+    ret = otf2_archive_close_local_writers( archive, false, false, true );
+    if ( ret != OTF2_SUCCESS )
     {
-        OTF2_SnapWriter* next = archive->local_snap_writers->next;
-        otf2_snap_writer_delete( archive->local_snap_writers );
-        archive->local_snap_writers = next;
+        UTILS_ERROR( ret, "Couldn't close snapshot writers." );
     }
 
     while ( archive->thumb_writers )
@@ -473,6 +699,7 @@ otf2_archive_close( OTF2_Archive* archive )
         otf2_archive_location_finalize( &archive->locations[ i ] );
     }
     free( archive->locations );
+    free( archive->location_index );
 
     /* finalize the file substrate */
     if ( archive->substrate != OTF2_SUBSTRATE_UNDEFINED )
@@ -496,6 +723,13 @@ otf2_archive_close( OTF2_Archive* archive )
         UTILS_ERROR( ret, "Couldn't destroy archive lock." );
     }
 
+    /* call the release callback for the parallel callbacks, if provided */
+    if ( archive->parallel_callbacks &&
+         archive->parallel_callbacks->otf2_release )
+    {
+        archive->parallel_callbacks->otf2_release( archive->parallel_data );
+    }
+
     /* call the release callback for the locking callbacks, if provided */
     if ( archive->locking_callbacks &&
          archive->locking_callbacks->otf2_release )
@@ -506,6 +740,13 @@ otf2_archive_close( OTF2_Archive* archive )
     free( archive->calling_context_to_region_map );
     OTF2_IdMap_Free( archive->calling_context_to_region_index_map );
 
+    while ( archive->region_filter )
+    {
+        otf2_region_filter* previous = archive->region_filter->previous;
+        free( archive->region_filter );
+        archive->region_filter = previous;
+    }
+
     /* Free all path buffers */
     free( archive->archive_path );
     free( archive->archive_name );
@@ -1118,6 +1359,37 @@ out:
 }
 
 
+/**
+ *  @threadsafety  Locks the archive.
+ */
+OTF2_ErrorCode
+otf2_archive_set_parallel_callbacks( OTF2_Archive*                 archive,
+                                     const OTF2_ParallelCallbacks* parallelCallbacks,
+                                     void*                         parallelData )
+{
+    UTILS_ASSERT( archive );
+    UTILS_ASSERT( parallelCallbacks );
+
+    OTF2_ErrorCode status = OTF2_SUCCESS;
+
+    OTF2_ARCHIVE_LOCK( archive );
+
+    if ( archive->parallel_callbacks )
+    {
+        status = UTILS_ERROR( OTF2_ERROR_INVALID_CALL,
+                              "Setting the parallel callbacks is only allowed once." );
+        goto out;
+    }
+
+    archive->parallel_callbacks = parallelCallbacks;
+    archive->parallel_data      = parallelData;
+
+out:
+    OTF2_ARCHIVE_UNLOCK( archive );
+    return status;
+}
+
+
 OTF2_ErrorCode
 otf2_archive_set_locking_callbacks( OTF2_Archive*                archive,
                                     const OTF2_LockingCallbacks* lockingCallbacks,
@@ -1379,6 +1651,114 @@ otf2_archive_set_trace_id( OTF2_Archive* archive,
 }
 
 
+/**
+ *  Publishes a new version of the region filter, the event writers pick it
+ *  up without locking. An event writer uses a version only while writing
+ *  one enter and announces its version afterwards, versions older than
+ *  all announced ones are freed. Writers without enters since the last
+ *  change thus keep the versions alive, until they write an enter or are
+ *  closed.
+ *
+ *  @threadsafety  Locks the archive.
+ */
+OTF2_ErrorCode
+otf2_archive_set_region_filter( OTF2_Archive*         archive,
+                                uint32_t              numberOfRegions,
+                                const OTF2_RegionRef* regions,
+                                OTF2_Boolean          filtered )
+{
+    UTILS_ASSERT( archive );
+    UTILS_ASSERT( numberOfRegions == 0 || regions );
+
+    OTF2_ARCHIVE_LOCK( archive );
+
+    otf2_region_filter* previous          = archive->region_filter;
+    uint32_t            number_of_regions = previous ? previous->number_of_regions : 0;
+    for ( uint32_t i = 0; i < numberOfRegions; i++ )
+    {
+        if ( filtered == OTF2_TRUE
+             && regions[ i ] != OTF2_UNDEFINED_REGION
+             && regions[ i ] >= number_of_regions )
+        {
+            number_of_regions = regions[ i ] + 1;
+        }
+    }
+
+    size_t              words  = ( ( uint64_t )number_of_regions + 63 ) / 64;
+    otf2_region_filter* filter = malloc( sizeof( *filter ) + words * sizeof( uint64_t ) );
+    if ( !filter )
+    {
+        OTF2_ARCHIVE_UNLOCK( archive );
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Could not allocate region filter." );
+    }
+    filter->previous          = previous;
+    filter->version           = previous ? previous->version + 1 : 1;
+    filter->number_of_regions = number_of_regions;
+    memset( filter->bits, 0, words * sizeof( uint64_t ) );
+    if ( previous )
+    {
+        memcpy( filter->bits, previous->bits,
+                ( ( uint64_t )previous->number_of_regions + 63 ) / 64 * sizeof( uint64_t ) );
+    }
+
+    for ( uint32_t i = 0; i < numberOfRegions; i++ )
+    {
+        OTF2_RegionRef region = regions[ i ];
+        if ( region >= number_of_regions )
+        {
+            continue;
+        }
+        if ( filtered == OTF2_TRUE )
+        {
+            filter->bits[ region / 64 ] |= UINT64_C( 1 ) << ( region % 64 );
+        }
+        else
+        {
+            filter->bits[ region / 64 ] &= ~( UINT64_C( 1 ) << ( region % 64 ) );
+        }
+    }
+
+#if defined( __GNUC__ )
+    __atomic_store_n( &archive->region_filter, filter, __ATOMIC_RELEASE );
+#else
+    *( otf2_region_filter* volatile* )&archive->region_filter = filter;
+#endif
+
+    /* Free the versions no event writer can use anymore. */
+    uint64_t oldest_version = filter->version;
+    for ( OTF2_EvtWriter* writer = archive->local_evt_writers;
+          writer;
+          writer = writer->next )
+    {
+#if defined( __GNUC__ )
+        uint64_t version = __atomic_load_n( &writer->region_filter_version, __ATOMIC_ACQUIRE );
+#else
+        uint64_t version = *( volatile uint64_t* )&writer->region_filter_version;
+#endif
+        if ( version < oldest_version )
+        {
+            oldest_version = version;
+        }
+    }
+    otf2_region_filter** unused = &filter->previous;
+    while ( *unused && ( *unused )->version >= oldest_version )
+    {
+        unused = &( *unused )->previous;
+    }
+    while ( *unused )
+    {
+        otf2_region_filter* next = ( *unused )->previous;
+        free( *unused );
+        *unused = next;
+    }
+
+    OTF2_ARCHIVE_UNLOCK( archive );
+
+    return OTF2_SUCCESS;
+}
+
+
 /**
  *  @threadsafety  Locks the archive.
  */
@@ -2121,6 +2501,13 @@ otf2_archive_get_evt_writer( OTF2_Archive*    archive,
         goto out;
     }
 
+    /* The new writer never uses the replaced versions of the region
+     * filter. */
+    if ( archive->region_filter )
+    {
+        ( *writer )->region_filter_version = archive->region_filter->version;
+    }
+
     /* Put new writer into the list of open writers */
     ( *writer )->next          = archive->local_evt_writers;
     archive->local_evt_writers = *writer;
@@ -2491,10 +2878,8 @@ otf2_archive_get_evt_reader( OTF2_Archive*    archive,
     archive->local_evt_readers = *reader;
     archive->number_of_evt_readers++;
 
-    OTF2_ARCHIVE_UNLOCK( archive );
-
-    /* We open the file outside of the archive lock to be able to parallel this. */
-    return otf2_evt_reader_open_file( *reader );
+    /* The event file is opened lazily at the first access to the events. */
+    status = OTF2_SUCCESS;
 
 out:
     OTF2_ARCHIVE_UNLOCK( archive );
@@ -3004,6 +3389,13 @@ otf2_archive_close_global_def_writer( OTF2_Archive*         archive,
         goto out;
     }
 
+    status = otf2_archive_write_clock_properties( archive, writer );
+    if ( OTF2_SUCCESS != status )
+    {
+        UTILS_ERROR( status, "Couldn't write the clock properties." );
+        goto out;
+    }
+
     archive->global_def_writer = NULL;
 
     /* Close global definition writer. */
@@ -3508,6 +3900,7 @@ static const otf2_reader_archive_impl otf2_archive_reader_impl =
     .set_collective_callbacks        = ( OTF2_FP_SetCollectiveCallbacks      )OTF2_Archive_SetCollectiveCallbacks,
     .set_serial_collective_callbacks = ( OTF2_FP_Archive                     )OTF2_Archive_SetSerialCollectiveCallbacks,
     .set_locking_callbacks           = ( OTF2_FP_SetLockingCallbacks         )OTF2_Archive_SetLockingCallbacks,
+    .set_parallel_callbacks          = ( OTF2_FP_SetParallelCallbacks        )OTF2_Archive_SetParallelCallbacks,
     .register_evt_callbacks          = ( OTF2_FP_RegisterEvtCallbacks        )OTF2_EvtReader_SetCallbacks,
     .register_global_evt_callbacks   = ( OTF2_FP_RegisterGlobalEvtCallbacks  )OTF2_GlobalEvtReader_SetCallbacks,
     .register_def_callbacks          = ( OTF2_FP_RegisterDefCallbacks        )OTF2_DefReader_SetCallbacks,
@@ -3520,6 +3913,7 @@ static const otf2_reader_archive_impl otf2_archive_reader_impl =
     .has_global_event                = ( OTF2_FP_HasGlobalEvent              )OTF2_GlobalEvtReader_HasEvent,
     .read_global_events              = ( OTF2_FP_ReadGlobalEvents            )OTF2_GlobalEvtReader_ReadEvents,
     .read_local_events_backward      = ( OTF2_FP_ReadLocalEvents             )OTF2_EvtReader_ReadEventsBackward,
+    .read_global_events_backward     = ( OTF2_FP_ReadGlobalEvents            )OTF2_GlobalEvtReader_ReadEventsBackward,
     .read_local_definitions          = ( OTF2_FP_ReadLocalDefinitions        )OTF2_DefReader_ReadDefinitions,
     .read_global_definitions         = ( OTF2_FP_ReadGlobalDefinitions       )OTF2_GlobalDefReader_ReadDefinitions,
     .read_local_snapshots            = ( OTF2_FP_ReadLocalSnapshots          )OTF2_SnapReader_ReadSnapshots,
@@ -3564,7 +3958,9 @@ static const otf2_reader_archive_impl otf2_archive_reader_impl =
     .open_snap_files                 = ( OTF2_FP_Archive                     )OTF2_Archive_OpenSnapFiles,
     .close_snap_files                = ( OTF2_FP_Archive                     )OTF2_Archive_CloseSnapFiles,
     .select_location                 = ( OTF2_FP_SelectLocation              )OTF2_Archive_SelectLocation,
-    .set_hint                        = ( OTF2_FP_SetHint                     )OTF2_Archive_SetHint
+    .set_hint                        = ( OTF2_FP_SetHint                     )OTF2_Archive_SetHint,
+    .unify_local_definitions         = ( OTF2_FP_UnifyLocalDefinitions       )OTF2_Archive_UnifyLocalDefinitions,
+    .load_local_definitions          = ( OTF2_FP_LoadLocalDefinitions        )OTF2_Archive_LoadLocalDefinitions
 };
 
 
@@ -3768,8 +4164,30 @@ otf2_archive_close_evt_files( OTF2_Archive* archive )
 
     OTF2_ErrorCode status;
 
+    if ( archive->file_mode == OTF2_FILEMODE_WRITE )
+    {
+        status = otf2_archive_close_local_writers( archive, true, false, false );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status, "Couldn't close event writers." );
+        }
+    }
+
     OTF2_ARCHIVE_LOCK( archive );
 
+    if ( archive->clock.enabled )
+    {
+        status = otf2_archive_clock_synchronize( archive,
+                                                 &archive->clock.end_time,
+                                                 &archive->clock.end_offset );
+        if ( OTF2_SUCCESS != status )
+        {
+            OTF2_ARCHIVE_UNLOCK( archive );
+            return UTILS_ERROR( status, "Couldn't synchronize the clocks." );
+        }
+        archive->clock.end_synchronized = true;
+    }
+
     status = otf2_file_substrate_close_file_type( archive,
                                                   OTF2_FILETYPE_EVENTS );
 
@@ -3811,6 +4229,15 @@ otf2_archive_close_def_files( OTF2_Archive* archive )
 
     OTF2_ErrorCode status;
 
+    if ( archive->file_mode == OTF2_FILEMODE_WRITE )
+    {
+        status = otf2_archive_close_local_writers( archive, false, true, false );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status, "Couldn't close definition writers." );
+        }
+    }
+
     OTF2_ARCHIVE_LOCK( archive );
 
     status = otf2_file_substrate_close_file_type( archive,
@@ -3958,6 +4385,64 @@ otf2_archive_select_location( OTF2_Archive*    archive,
 }
 
 
+/** @internal
+ *  @brief Get the slot of a location in the location index.
+ *
+ *  @param archive   Archive handle.
+ *  @param location  Location ID to search for.
+ *
+ *  @return          The slot holding the index of the location in the location
+ *                   vector, or the free slot where it would be inserted.
+ */
+static uint32_t*
+otf2_archive_location_index_slot( OTF2_Archive*    archive,
+                                  OTF2_LocationRef location )
+{
+    uint32_t mask = archive->location_index_size - 1;
+    uint32_t slot = ( uint32_t )( ( location * UINT64_C( 0x9e3779b97f4a7c15 ) ) >> 32 ) & mask;
+    while ( archive->location_index[ slot ] != OTF2_UNDEFINED_UINT32
+            && archive->locations[ archive->location_index[ slot ] ].location_id != location )
+    {
+        slot = ( slot + 1 ) & mask;
+    }
+
+    return &archive->location_index[ slot ];
+}
+
+
+/** @internal
+ *  @brief Double the size of the location index and re-insert all locations.
+ *
+ *  @param archive   Archive handle.
+ */
+static OTF2_ErrorCode
+otf2_archive_location_index_grow( OTF2_Archive* archive )
+{
+    uint32_t new_size = archive->location_index_size
+                        ? 2 * archive->location_index_size
+                        : 2 * OTF2_ARCHIVE_LOCATION_SIZE;
+    uint32_t* new_index = malloc( new_size * sizeof( *new_index ) );
+    if ( new_index == NULL )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Failed to allocate location index!" );
+    }
+    /* All bits set is OTF2_UNDEFINED_UINT32. */
+    memset( new_index, 0xff, new_size * sizeof( *new_index ) );
+
+    free( archive->location_index );
+    archive->location_index      = new_index;
+    archive->location_index_size = new_size;
+    for ( uint32_t i = 0; i < archive->locations_number; i++ )
+    {
+        *otf2_archive_location_index_slot( archive,
+                                           archive->locations[ i ].location_id ) = i;
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
 /** @internal
  *  @brief Add location to location vector.
  *
@@ -3973,13 +4458,21 @@ otf2_archive_add_location( OTF2_Archive*    archive,
     UTILS_ASSERT( archive );
 
     /* Check if location is already in the vector. */
-    for ( uint32_t i = 0; i < archive->locations_number; i++ )
+    if ( otf2_archive_find_location( archive, location, NULL ) == OTF2_SUCCESS )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    /* Keep the location index at most half full. */
+    if ( 2 * ( archive->locations_number + 1 ) > archive->location_index_size )
     {
-        if ( archive->locations[ i ].location_id == location )
+        OTF2_ErrorCode status = otf2_archive_location_index_grow( archive );
+        if ( status != OTF2_SUCCESS )
         {
-            return OTF2_SUCCESS;
+            return status;
         }
     }
+    uint32_t* slot = otf2_archive_location_index_slot( archive, location );
 
     /* Check size of vector and let it grow if necessary. */
     if ( ( ( archive->locations_number % OTF2_ARCHIVE_LOCATION_SIZE ) == 0 ) &&
@@ -3999,6 +4492,7 @@ otf2_archive_add_location( OTF2_Archive*    archive,
 
     otf2_archive_location_initialize( &archive->locations[ archive->locations_number ],
                                       location );
+    *slot = archive->locations_number;
     archive->locations_number++;
 
     return OTF2_SUCCESS;
@@ -4006,7 +4500,8 @@ otf2_archive_add_location( OTF2_Archive*    archive,
 
 
 /**
- *  @threadsafety    Caller must hold the archive lock.
+ *  @threadsafety    Caller must hold the archive lock, or the set of
+ *                   locations must not change concurrently.
  */
 OTF2_ErrorCode
 otf2_archive_find_location( OTF2_Archive*    archive,
@@ -4015,20 +4510,22 @@ otf2_archive_find_location( OTF2_Archive*    archive,
 {
     UTILS_ASSERT( archive );
 
-    /* Check if location is already in the vector. */
-    for ( uint32_t i = 0; i < archive->locations_number; i++ )
+    if ( archive->location_index == NULL )
     {
-        if ( archive->locations[ i ].location_id == location )
-        {
-            if ( archiveLocationIndex )
-            {
-                *archiveLocationIndex = i;
-            }
-            return OTF2_SUCCESS;
-        }
+        return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
     }
 
-    return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+    uint32_t index = *otf2_archive_location_index_slot( archive, location );
+    if ( index == OTF2_UNDEFINED_UINT32 )
+    {
+        return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    if ( archiveLocationIndex )
+    {
+        *archiveLocationIndex = index;
+    }
+    return OTF2_SUCCESS;
 }
 
 
@@ -4096,6 +4593,209 @@ otf2_archive_set_hint( OTF2_Archive* archive,
             }
             break;
 
+        case OTF2_HINT_MAX_OPEN_FILES:
+            if ( archive->file_mode != OTF2_FILEMODE_READ )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in reader mode for max-open-files hint." );
+                goto out;
+            }
+            if ( archive->hint_max_open_files_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The max-open-files hint is already locked." );
+                goto out;
+            }
+            archive->hint_max_open_files_locked = true;
+            archive->hint_max_open_files        = *( uint32_t* )value;
+            break;
+
+        case OTF2_HINT_MAX_CHUNK_MEMORY:
+            if ( archive->file_mode != OTF2_FILEMODE_READ )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in reader mode for max-chunk-memory hint." );
+                goto out;
+            }
+            if ( archive->hint_max_chunk_memory_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The max-chunk-memory hint is already locked." );
+                goto out;
+            }
+            archive->hint_max_chunk_memory_locked = true;
+            archive->hint_max_chunk_memory        = *( uint64_t* )value;
+            break;
+
+        case OTF2_HINT_EVENT_INDEX_INTERVAL:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in writer mode for event-index-interval hint." );
+                goto out;
+            }
+            if ( archive->hint_event_index_interval_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The event-index-interval hint is already locked." );
+                goto out;
+            }
+            archive->hint_event_index_interval_locked = true;
+            archive->hint_event_index_interval        = *( uint32_t* )value;
+            break;
+
+        case OTF2_HINT_IMPLICIT_LEAVE:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in writer mode for implicit-leave hint." );
+                goto out;
+            }
+            if ( archive->hint_implicit_leave_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The implicit-leave hint is already locked." );
+                goto out;
+            }
+            archive->hint_implicit_leave_locked = true;
+            archive->hint_implicit_leave        = *( OTF2_Boolean* )value;
+            if ( archive->hint_implicit_leave != OTF2_TRUE &&
+                 archive->hint_implicit_leave != OTF2_FALSE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID_VALUE,
+                                      "Invalid value for implicit-leave hint: %u",
+                                      archive->hint_implicit_leave );
+                goto out;
+            }
+            break;
+
+        case OTF2_HINT_ATTRIBUTE_LIST_SHAPES:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in writer mode for attribute-list-shapes hint." );
+                goto out;
+            }
+            if ( archive->hint_attribute_list_shapes_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The attribute-list-shapes hint is already locked." );
+                goto out;
+            }
+            archive->hint_attribute_list_shapes_locked = true;
+            archive->hint_attribute_list_shapes        = *( OTF2_Boolean* )value;
+            if ( archive->hint_attribute_list_shapes != OTF2_TRUE &&
+                 archive->hint_attribute_list_shapes != OTF2_FALSE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID_VALUE,
+                                      "Invalid value for attribute-list-shapes hint: %u",
+                                      archive->hint_attribute_list_shapes );
+                goto out;
+            }
+            break;
+
+        case OTF2_HINT_METRIC_DELTAS:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in writer mode for metric-deltas hint." );
+                goto out;
+            }
+            if ( archive->hint_metric_deltas_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The metric-deltas hint is already locked." );
+                goto out;
+            }
+            archive->hint_metric_deltas_locked = true;
+            archive->hint_metric_deltas        = *( OTF2_Boolean* )value;
+            if ( archive->hint_metric_deltas != OTF2_TRUE &&
+                 archive->hint_metric_deltas != OTF2_FALSE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID_VALUE,
+                                      "Invalid value for metric-deltas hint: %u",
+                                      archive->hint_metric_deltas );
+                goto out;
+            }
+            break;
+
+        case OTF2_HINT_CALLING_CONTEXT_DELTAS:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in writer mode for calling-context-deltas hint." );
+                goto out;
+            }
+            if ( archive->hint_calling_context_deltas_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The calling-context-deltas hint is already locked." );
+                goto out;
+            }
+            archive->hint_calling_context_deltas_locked = true;
+            archive->hint_calling_context_deltas        = *( OTF2_Boolean* )value;
+            if ( archive->hint_calling_context_deltas != OTF2_TRUE &&
+                 archive->hint_calling_context_deltas != OTF2_FALSE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID_VALUE,
+                                      "Invalid value for calling-context-deltas hint: %u",
+                                      archive->hint_calling_context_deltas );
+                goto out;
+            }
+            break;
+
+        case OTF2_HINT_CHUNK_ALLOCATION:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in writer mode for chunk-allocation hint." );
+                goto out;
+            }
+            if ( archive->hint_chunk_allocation_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The chunk-allocation hint is already locked." );
+                goto out;
+            }
+            archive->hint_chunk_allocation_locked = true;
+            archive->hint_chunk_allocation        = *( OTF2_ChunkAllocation* )value;
+            if ( archive->hint_chunk_allocation != OTF2_CHUNK_ALLOCATION_HEAP &&
+                 archive->hint_chunk_allocation != OTF2_CHUNK_ALLOCATION_LOCAL_PAGES &&
+                 archive->hint_chunk_allocation != OTF2_CHUNK_ALLOCATION_HUGE_PAGES )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID_VALUE,
+                                      "Invalid value for chunk-allocation hint: %u",
+                                      archive->hint_chunk_allocation );
+                goto out;
+            }
+            break;
+
+        case OTF2_HINT_ADAPTIVE_CHUNK_SIZE:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                      "Archive is not in writer mode for adaptive-chunk-size hint." );
+                goto out;
+            }
+            if ( archive->hint_adaptive_chunk_size_locked )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_LOCKED,
+                                      "The adaptive-chunk-size hint is already locked." );
+                goto out;
+            }
+            archive->hint_adaptive_chunk_size_locked = true;
+            archive->hint_adaptive_chunk_size        = *( uint64_t* )value;
+            if ( archive->hint_adaptive_chunk_size != 0 &&
+                 ( archive->hint_adaptive_chunk_size < OTF2_CHUNK_SIZE_MIN ||
+                   archive->hint_adaptive_chunk_size > OTF2_CHUNK_SIZE_MAX ) )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_HINT_INVALID_VALUE,
+                                      "Invalid value for adaptive-chunk-size hint: %" PRIu64,
+                                      archive->hint_adaptive_chunk_size );
+                goto out;
+            }
+            break;
+
         default:
             status = UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
                                   "Unknown hint: %u", hint );
@@ -4134,6 +4834,96 @@ otf2_archive_query_hint( OTF2_Archive* archive,
             *( OTF2_Boolean* )value            = archive->hint_global_reader;
             break;
 
+        case OTF2_HINT_MAX_OPEN_FILES:
+            if ( archive->file_mode != OTF2_FILEMODE_READ )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in reader mode for max-open-files hint." );
+            }
+            archive->hint_max_open_files_locked = true;
+            *( uint32_t* )value                 = archive->hint_max_open_files;
+            break;
+
+        case OTF2_HINT_MAX_CHUNK_MEMORY:
+            if ( archive->file_mode != OTF2_FILEMODE_READ )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in reader mode for max-chunk-memory hint." );
+            }
+            archive->hint_max_chunk_memory_locked = true;
+            *( uint64_t* )value                   = archive->hint_max_chunk_memory;
+            break;
+
+        case OTF2_HINT_EVENT_INDEX_INTERVAL:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in writer mode for event-index-interval hint." );
+            }
+            archive->hint_event_index_interval_locked = true;
+            *( uint32_t* )value                       = archive->hint_event_index_interval;
+            break;
+
+        case OTF2_HINT_IMPLICIT_LEAVE:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in writer mode for implicit-leave hint." );
+            }
+            archive->hint_implicit_leave_locked = true;
+            *( OTF2_Boolean* )value             = archive->hint_implicit_leave;
+            break;
+
+        case OTF2_HINT_ATTRIBUTE_LIST_SHAPES:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in writer mode for attribute-list-shapes hint." );
+            }
+            archive->hint_attribute_list_shapes_locked = true;
+            *( OTF2_Boolean* )value                    = archive->hint_attribute_list_shapes;
+            break;
+
+        case OTF2_HINT_METRIC_DELTAS:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in writer mode for metric-deltas hint." );
+            }
+            archive->hint_metric_deltas_locked = true;
+            *( OTF2_Boolean* )value            = archive->hint_metric_deltas;
+            break;
+
+        case OTF2_HINT_CALLING_CONTEXT_DELTAS:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in writer mode for calling-context-deltas hint." );
+            }
+            archive->hint_calling_context_deltas_locked = true;
+            *( OTF2_Boolean* )value                     = archive->hint_calling_context_deltas;
+            break;
+
+        case OTF2_HINT_CHUNK_ALLOCATION:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in writer mode for chunk-allocation hint." );
+            }
+            archive->hint_chunk_allocation_locked = true;
+            *( OTF2_ChunkAllocation* )value       = archive->hint_chunk_allocation;
+            break;
+
+        case OTF2_HINT_ADAPTIVE_CHUNK_SIZE:
+            if ( archive->file_mode != OTF2_FILEMODE_WRITE )
+            {
+                return UTILS_ERROR( OTF2_ERROR_HINT_INVALID,
+                                    "Archive is not in writer mode for adaptive-chunk-size hint." );
+            }
+            archive->hint_adaptive_chunk_size_locked = true;
+            *( uint64_t* )value                      = archive->hint_adaptive_chunk_size;
+            break;
+
         default:
             /* This should never happen, as only OTF2 internally can query hints. */
             return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
@@ -4255,3 +5045,138 @@ out:
 
     return ret;
 }
+
+
+/* ___ Loading of local definitions. ________________________________________ */
+
+
+/** @brief State of loading the local definitions of one location. */
+typedef struct otf2_archive_load_task
+{
+    OTF2_Archive*    archive;
+    OTF2_LocationRef location;
+    bool             skip_definitions;
+    bool             done;
+    OTF2_ErrorCode   status;
+} otf2_archive_load_task;
+
+
+/** @brief OTF2_Parallel_Task to read the local definitions of one
+ *  location into its archive location. */
+static void
+otf2_archive_load_location_task( void*    taskData,
+                                 uint32_t taskIndex )
+{
+    otf2_archive_load_task* task = &( ( otf2_archive_load_task* )taskData )[ taskIndex ];
+
+    task->done = true;
+
+    OTF2_DefReader* def_reader = NULL;
+    OTF2_ErrorCode  status     = otf2_archive_get_def_reader( task->archive,
+                                                              task->location,
+                                                              &def_reader );
+    if ( OTF2_SUCCESS == status )
+    {
+        def_reader->skip_definitions = task->skip_definitions;
+
+        /* Keep the first mapping table, as the serial readers do. */
+        uint64_t definitions_read;
+        do
+        {
+            status = OTF2_DefReader_ReadDefinitions( def_reader,
+                                                     OTF2_UNDEFINED_UINT64,
+                                                     &definitions_read );
+        }
+        while ( OTF2_ERROR_DUPLICATE_MAPPING_TABLE == status );
+    }
+    else if ( OTF2_ERROR_ENOENT == status )
+    {
+        /* A local definition file is not mandatory. */
+        status = OTF2_SUCCESS;
+    }
+    task->status = status;
+
+    if ( def_reader )
+    {
+        status = otf2_archive_close_def_reader( task->archive, def_reader );
+        if ( OTF2_SUCCESS == task->status )
+        {
+            task->status = status;
+        }
+    }
+}
+
+
+/** @internal
+ *  @brief Read the local definitions of all selected locations.
+ *
+ *  @threadsafety  Locks the archive while collecting the selected locations.
+ *                 The locations are read concurrently, if parallel and
+ *                 locking callbacks are set.
+ */
+OTF2_ErrorCode
+otf2_archive_load_local_definitions( OTF2_Archive* archive,
+                                     bool          skipDefinitions )
+{
+    UTILS_ASSERT( archive );
+
+    OTF2_ARCHIVE_LOCK( archive );
+    uint32_t number_of_locations = archive->locations_number;
+    if ( number_of_locations == 0 )
+    {
+        OTF2_ARCHIVE_UNLOCK( archive );
+        return OTF2_SUCCESS;
+    }
+    otf2_archive_load_task* tasks = calloc( number_of_locations, sizeof( *tasks ) );
+    if ( !tasks )
+    {
+        OTF2_ARCHIVE_UNLOCK( archive );
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Can't allocate location tasks." );
+    }
+    for ( uint32_t i = 0; i < number_of_locations; i++ )
+    {
+        tasks[ i ].archive          = archive;
+        tasks[ i ].location         = archive->locations[ i ].location_id;
+        tasks[ i ].skip_definitions = skipDefinitions;
+        tasks[ i ].status           = OTF2_SUCCESS;
+    }
+    OTF2_ARCHIVE_UNLOCK( archive );
+
+    /* Every task fills only its own archive location, but the def reader
+     * list of the archive needs the archive lock. */
+    if ( number_of_locations > 1
+         && archive->parallel_callbacks
+         && archive->locking_callbacks
+         && archive->substrate != OTF2_SUBSTRATE_SION )
+    {
+        OTF2_CallbackCode callback_ret =
+            archive->parallel_callbacks->otf2_run( archive->parallel_data,
+                                                   number_of_locations,
+                                                   otf2_archive_load_location_task,
+                                                   tasks );
+        if ( OTF2_CALLBACK_SUCCESS != callback_ret )
+        {
+            UTILS_WARNING( "Parallel callback failed, reading the remaining locations serially." );
+        }
+    }
+
+    OTF2_ErrorCode status = OTF2_SUCCESS;
+    for ( uint32_t i = 0; i < number_of_locations; i++ )
+    {
+        if ( !tasks[ i ].done )
+        {
+            otf2_archive_load_location_task( tasks, i );
+        }
+        if ( OTF2_SUCCESS != tasks[ i ].status && OTF2_SUCCESS == status )
+        {
+            status = UTILS_ERROR( tasks[ i ].status,
+                                  "Can't read the local definitions of location %" PRIu64 ".",
+                                  tasks[ i ].location );
+        }
+    }
+
+    free( tasks );
+
+    return status;
+}
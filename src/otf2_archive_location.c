@@ -199,3 +199,84 @@ otf2_archive_location_add_clock_offset( OTF2_Archive*    archive,
 
     return OTF2_SUCCESS;
 }
+
+
+OTF2_ErrorCode
+otf2_archive_location_set_event_time_range( OTF2_Archive*    archive,
+                                            OTF2_LocationRef location,
+                                            uint64_t         firstTimestamp,
+                                            uint64_t         lastTimestamp )
+{
+    UTILS_ASSERT( archive );
+
+    if ( firstTimestamp > lastTimestamp )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Invalid event time range!" );
+    }
+
+    /* The event writer records the range when it is deleted, its location
+     * may be unknown to the archive. */
+    uint32_t       archive_location_index;
+    OTF2_ErrorCode status = otf2_archive_find_location( archive,
+                                                        location,
+                                                        &archive_location_index );
+    if ( status != OTF2_SUCCESS )
+    {
+        return UTILS_ERROR( status,
+                            "Unknown location %" PRIu64 " for the event time range!",
+                            location );
+    }
+
+    otf2_archive_location* archive_location;
+    otf2_archive_get_location( archive,
+                               archive_location_index,
+                               &archive_location );
+
+    if ( archive_location->has_event_time_range )
+    {
+        return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                            "Event time range was already set!" );
+    }
+
+    archive_location->has_event_time_range = true;
+    archive_location->first_timestamp      = firstTimestamp;
+    archive_location->last_timestamp       = lastTimestamp;
+
+    return OTF2_SUCCESS;
+}
+
+
+bool
+otf2_archive_location_get_event_time_range( OTF2_Archive*    archive,
+                                            OTF2_LocationRef location,
+                                            uint64_t*        firstTimestamp,
+                                            uint64_t*        lastTimestamp )
+{
+    UTILS_ASSERT( archive );
+    UTILS_ASSERT( firstTimestamp );
+    UTILS_ASSERT( lastTimestamp );
+
+    uint32_t archive_location_index;
+    if ( otf2_archive_find_location( archive,
+                                     location,
+                                     &archive_location_index ) != OTF2_SUCCESS )
+    {
+        return false;
+    }
+
+    otf2_archive_location* archive_location;
+    otf2_archive_get_location( archive,
+                               archive_location_index,
+                               &archive_location );
+
+    if ( !archive_location->has_event_time_range )
+    {
+        return false;
+    }
+
+    *firstTimestamp = archive_location->first_timestamp;
+    *lastTimestamp  = archive_location->last_timestamp;
+
+    return true;
+}
@@ -69,6 +69,13 @@ struct otf2_archive_location
     otf2_clock_interval*  clock_intervals;
     otf2_clock_interval** tail_clock_intervals;
     otf2_clock_interval*  pending_clock_interval;
+
+    /** Range of the event timestamps from the local definitions, not
+     *  clock corrected. Only valid if @a has_event_time_range is set.
+     */
+    bool     has_event_time_range;
+    uint64_t first_timestamp;
+    uint64_t last_timestamp;
 };
 
 
@@ -116,4 +123,36 @@ otf2_archive_location_add_clock_offset( OTF2_Archive*    archive,
                                         double           stdDev );
 
 
+/** @brief Sets the range of the event timestamps of a location.
+ *
+ *  @param archive        Reader object which reads the events from its buffer.
+ *  @param location       The location id.
+ *  @param firstTimestamp Timestamp of the first event.
+ *  @param lastTimestamp  Timestamp of the last event.
+ *
+ *  @return OTF2_ErrorCode with !=OTF2_SUCCESS if there was an error.
+ */
+OTF2_ErrorCode
+otf2_archive_location_set_event_time_range( OTF2_Archive*    archive,
+                                            OTF2_LocationRef location,
+                                            uint64_t         firstTimestamp,
+                                            uint64_t         lastTimestamp );
+
+
+/** @brief Gets the range of the event timestamps of a location.
+ *
+ *  @param archive             Archive handle.
+ *  @param location            The location id.
+ *  @param[out] firstTimestamp Timestamp of the first event.
+ *  @param[out] lastTimestamp  Timestamp of the last event.
+ *
+ *  @return true if the location is known and has an event time range.
+ */
+bool
+otf2_archive_location_get_event_time_range( OTF2_Archive*    archive,
+                                            OTF2_LocationRef location,
+                                            uint64_t*        firstTimestamp,
+                                            uint64_t*        lastTimestamp );
+
+
 #endif /* OTF2_INTERNAL_ARCHIVE_LOCATION_H */
@@ -56,23 +56,42 @@ struct otf2_attribute_struct
     OTF2_AttributeRef   attribute_id;
     /** Value of the attribute. */
     OTF2_AttributeValue value;
-    /** Pointer to the next attribute in the list. */
-    otf2_attribute*     next;
 };
 
 
 /** @internal
- *  @brief Attribute list handle. */
+ *  @brief Number of elements stored inside the attribute list handle itself.
+ *  Longer lists move to heap memory. */
+#define OTF2_ATTRIBUTE_LIST_INLINE_ENTRIES 4
+
+
+/** @internal
+ *  @brief Attribute list handle.
+ *
+ *  The elements are kept in insertion order in an array. As @a entries may
+ *  point into the handle, it must not be copied by value.
+ *
+ *  An event reader only notes the position of the attribute list record,
+ *  the record is decoded into the elements on the first access of the
+ *  list, see otf2_attribute_list_decode. */
 struct OTF2_AttributeList_struct
 {
     /** Number of Elements in the attribute list. */
-    uint32_t         capacity;
-    /** Pointer to first element. */
-    otf2_attribute*  head;
-    /** Pointer to last element. */
-    otf2_attribute** tail;
-    /** Pointer to unused entries. */
-    otf2_attribute*  free;
+    uint32_t             capacity;
+    /** Number of elements @a entries has room for. */
+    uint32_t             allocated;
+    /** The elements, either @a inline_entries or heap memory. */
+    otf2_attribute*      entries;
+    /** Storage for short lists. */
+    otf2_attribute       inline_entries[ OTF2_ATTRIBUTE_LIST_INLINE_ENTRIES ];
+    /** Buffer of a not yet decoded attribute list record, NULL if there is
+     *  none. */
+    OTF2_Buffer*         pending_buffer;
+    /** Position of the record in @a pending_buffer, after its type. */
+    uint8_t*             pending_position;
+    /** Mapping of the references in the record. */
+    OTF2_MappingCallback pending_mapping_cb;
+    void*                pending_mapping_data;
 };
 
 
@@ -96,18 +115,36 @@ otf2_attribute_list_clear( OTF2_AttributeList* attributeList );
 static inline OTF2_ErrorCode
 otf2_attribute_list_remove_all_attributes( OTF2_AttributeList* attributeList )
 {
-    /* move the whole list into the free list */
-    *attributeList->tail = attributeList->free;
-    attributeList->free  = attributeList->head;
-
-    attributeList->capacity = 0;
-    attributeList->head     = NULL;
-    attributeList->tail     = &attributeList->head;
+    /* the memory of the elements is kept for the next use */
+    attributeList->capacity       = 0;
+    attributeList->pending_buffer = NULL;
 
     return OTF2_SUCCESS;
 }
 
 
+OTF2_ErrorCode
+otf2_attribute_list_decode_pending( OTF2_AttributeList* attributeList );
+
+
+/** @internal
+ *  @brief Decode the attribute list record noted by an event reader, if any.
+ *
+ *  Must be called before the elements are accessed. The list is logically
+ *  not changed, thus this is allowed for const lists, too.
+ */
+static inline OTF2_ErrorCode
+otf2_attribute_list_decode( const OTF2_AttributeList* attributeList )
+{
+    if ( !attributeList->pending_buffer )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    return otf2_attribute_list_decode_pending( ( OTF2_AttributeList* )attributeList );
+}
+
+
 /** @internal
  *  @brief Maximum size of an entry in extended attribute list.
  */
@@ -127,6 +164,7 @@ otf2_attribute_list_get_data_size( const OTF2_AttributeList* attributeList )
     /* If NULL is passed or capacity is zero just return 0.
      * This avoids a check in the event writer. */
     if ( attributeList == NULL
+         || otf2_attribute_list_decode( attributeList ) != OTF2_SUCCESS
          || attributeList->capacity == 0 )
     {
         return 0;
@@ -153,17 +191,12 @@ otf2_attribute_list_get_size( const OTF2_AttributeList* attributeList )
 {
     /* If NULL is passed or capacity is zero just return 0.
      * This avoids a check in the event writer. */
-    if ( attributeList == NULL
-         || attributeList->capacity == 0 )
+    uint32_t size = otf2_attribute_list_get_data_size( attributeList );
+    if ( size == 0 )
     {
         return 0;
     }
 
-    /* Maximum data size of an attribute list 5 Bytes for the number of elements
-     * + 15 times number * of elements (5 for the attribute id, 1 for the attribute type,
-     * 9 for the attribute value). */
-    uint32_t size = otf2_attribute_list_get_data_size( attributeList );
-
     /* Furthermore we have to store information about the length of this list */
     if ( size < UINT8_MAX )
     {
@@ -176,8 +209,70 @@ otf2_attribute_list_get_size( const OTF2_AttributeList* attributeList )
         size += 9;
     }
 
-    /* Finally 1 additional byte is used for Record ID*/
-    return size + 1;
+    /* Finally 1 additional byte is used for Record ID and 1 for the shape
+     * index, if the list is written with its shape. */
+    return size + 2;
+}
+
+
+/** @internal
+ *  @brief Maximum number of attribute list shapes in a chunk. */
+#define OTF2_ATTRIBUTE_LIST_SHAPES_MAX 32
+
+
+/** @internal
+ *  @brief Maximum number of attributes in a list which is written with its
+ *  shape. Longer lists are always written completely. */
+#define OTF2_ATTRIBUTE_LIST_SHAPE_MAX_SIZE 8
+
+
+/** @internal
+ *  @brief The shape of an attribute list, its sequence of attribute IDs and
+ *  types. */
+typedef struct otf2_attribute_list_shape
+{
+    /** Number of attributes. */
+    uint32_t          number_of_attributes;
+    /** The IDs of the attributes, as written to the trace. */
+    OTF2_AttributeRef attributes[ OTF2_ATTRIBUTE_LIST_SHAPE_MAX_SIZE ];
+    /** The types of the attribute values. */
+    OTF2_Type         types[ OTF2_ATTRIBUTE_LIST_SHAPE_MAX_SIZE ];
+} otf2_attribute_list_shape;
+
+
+/** @internal
+ *  @brief The attribute list shapes of one chunk.
+ *
+ *  The first list of a shape in a chunk defines it under a new index, later
+ *  lists with this shape only reference the index and store their values.
+ *  The indices are unique in the chunk, thus the definitions can be
+ *  collected in any order by a reader. */
+typedef struct otf2_attribute_list_shapes
+{
+    /** Identifies the chunk of the shapes. */
+    uint64_t                  chunk;
+    /** Number of shape indices used in the chunk. */
+    uint32_t                  number_of_shapes;
+    /** Bit mask of the shapes which can be referenced. */
+    uint32_t                  known;
+    /** Index of the last used shape, tried first. */
+    uint32_t                  last;
+    /** The shapes by index. */
+    otf2_attribute_list_shape shapes[ OTF2_ATTRIBUTE_LIST_SHAPES_MAX ];
+} otf2_attribute_list_shapes;
+
+
+/** @internal
+ *  @brief Start the shapes of a new chunk.
+ */
+static inline void
+otf2_attribute_list_shapes_reset( otf2_attribute_list_shapes* shapes,
+                                  uint64_t                    chunk )
+{
+    shapes->chunk            = chunk;
+    shapes->number_of_shapes = 0;
+    shapes->known            = 0;
+    shapes->last             = 0;
 }
 
 
@@ -188,9 +283,62 @@ otf2_attribute_list_read_from_buffer( OTF2_AttributeList*  attributeList,
                                       void*                mappingData );
 
 
+/** @internal
+ *  @brief Note the attribute list record at the current position and skip
+ *  it, it is decoded on the first access of the list.
+ *
+ *  The record type was already read. The record must stay in the buffer
+ *  until the list is accessed or cleared.
+ */
+OTF2_ErrorCode
+otf2_attribute_list_defer_from_buffer( OTF2_AttributeList*  attributeList,
+                                       OTF2_Buffer*         buffer,
+                                       OTF2_MappingCallback mappingCb,
+                                       void*                mappingData );
+
+
 OTF2_ErrorCode
 otf2_attribute_list_write_to_buffer( OTF2_AttributeList* attributeList,
                                      OTF2_Buffer*        buffer );
 
 
+/** @internal
+ *  @brief Read an attribute list written with its shape.
+ *
+ *  The record type was already read. A reference to a shape which is not
+ *  known in @a shapes returns OTF2_ERROR_INVALID_DATA without reporting an
+ *  error and leaves the buffer position before the record.
+ */
+OTF2_ErrorCode
+otf2_attribute_list_read_shaped_from_buffer( OTF2_AttributeList*         attributeList,
+                                             OTF2_Buffer*                buffer,
+                                             uint8_t                     recordType,
+                                             otf2_attribute_list_shapes* shapes,
+                                             OTF2_MappingCallback        mappingCb,
+                                             void*                       mappingData );
+
+
+/** @internal
+ *  @brief Register the shape of an attribute list which defines one,
+ *  without reading its values.
+ *
+ *  The record type was already read.
+ */
+OTF2_ErrorCode
+otf2_attribute_list_register_shape_from_buffer( OTF2_Buffer*                buffer,
+                                                otf2_attribute_list_shapes* shapes );
+
+
+/** @internal
+ *  @brief Write an attribute list with its shape.
+ *
+ *  Falls back to otf2_attribute_list_write_to_buffer, if the shape is too
+ *  long or the chunk has no free shape index anymore.
+ */
+OTF2_ErrorCode
+otf2_attribute_list_write_shaped_to_buffer( OTF2_AttributeList*         attributeList,
+                                            OTF2_Buffer*                buffer,
+                                            otf2_attribute_list_shapes* shapes );
+
+
 #endif /* OTF2_INTERNAL_ATTRIBUTE_LIST_H */
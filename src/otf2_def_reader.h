@@ -56,6 +56,10 @@ struct OTF2_DefReader_struct
     /** Generic pointer to the userdata, to handle them inside a callback. */
     void* user_data;
 
+    /** Skip all records which do not carry data for the archive location,
+     *  i.e., read only mapping tables, clock offsets, and event time ranges. */
+    bool skip_definitions;
+
     /** Index of this location in the archive location vector. */
     uint32_t archive_location_index;
 };
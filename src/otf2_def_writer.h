@@ -41,6 +41,8 @@ struct OTF2_DefWriter_struct
     OTF2_Buffer*    buffer;
     /** Location ID of the related definition stream */
     uint64_t        location_id;
+    /** Set when the caller wrote an EventTimeRange definition */
+    bool            event_time_range_written;
     /** Chain to next def writer, used in OTF2_Archive */
     OTF2_DefWriter* next;
 };
@@ -33,6 +33,53 @@
 #define OTF2_INTERNAL_EVT_READER_H
 
 
+/** @internal
+ *  @brief Last sample of a metric read by an event reader. */
+typedef struct otf2_evt_reader_metric
+{
+    /** The metric, after mapping. */
+    OTF2_MetricRef    metric;
+    /** Number of the chunk of the sample, 0 if there is none. */
+    uint32_t          chunk;
+    /** Chunk local event position of the sample. */
+    uint64_t          position;
+    /** Distance in events to the previous sample, if the sample was stored
+     *  as deltas, 0 otherwise. */
+    uint64_t          distance;
+    /** Number of values of the sample. */
+    uint8_t           number_of_members;
+    /** Number of values the arrays have room for. */
+    uint8_t           capacity;
+    /** Types and values of the sample. */
+    OTF2_Type*        type_ids;
+    OTF2_MetricValue* values;
+    /** The stored deltas, to step back to the previous sample. */
+    uint64_t*         deltas;
+} otf2_evt_reader_metric;
+
+
+/** @internal
+ *  @brief Last calling context sample read by an event reader. */
+typedef struct otf2_evt_reader_sample
+{
+    /** Number of the chunk of the sample, 0 if there is none. */
+    uint32_t                   chunk;
+    /** Chunk local event position of the sample. */
+    uint64_t                   position;
+    /** Distance in events to the previous sample, if the sample was stored
+     *  as delta, 0 otherwise. */
+    uint64_t                   distance;
+    /** The attributes of the sample, before mapping. */
+    OTF2_CallingContextRef     calling_context;
+    uint32_t                   unwind_distance;
+    OTF2_InterruptGeneratorRef interrupt_generator;
+    /** The stored difference of the calling context and the flags of the
+     *  changed attributes, to step back to the previous sample. */
+    uint64_t                   difference;
+    uint8_t                    flags;
+} otf2_evt_reader_sample;
+
+
 /** @internal
  *  @brief A local reader is defined by following struct. */
 struct OTF2_EvtReader_struct
@@ -57,13 +104,42 @@ struct OTF2_EvtReader_struct
     uint64_t  chunk_local_event_position;
     /** Byte postition of the current event */
     uint8_t*  current_position;
-    /** Table of the byte position of each event in the current chunk */
-    uint8_t** position_table;
-    /** Table of the byte position of each timestamp record in the current chunk */
-    uint8_t** timestamp_table;
+    /** Table of the byte offset of each event from the begin of the current
+     *  chunk, survives the release of the chunk memory */
+    uint32_t* position_table;
+    /** Table of the byte offset of the timestamp record of each event in the
+     *  current chunk */
+    uint32_t* timestamp_table;
+    /** Chunk local events covered by the tables, from index_first up to
+     *  index_end, exclusively */
+    uint64_t  index_first;
+    uint64_t  index_end;
+
+    /** Regions of the implicit leave events in the chunk segment from
+     *  implicit_leave_first up to implicit_leave_end, exclusively, of the
+     *  chunk with number implicit_leave_chunk */
+    OTF2_RegionRef* implicit_leave_table;
+    uint32_t        implicit_leave_chunk;
+    uint64_t        implicit_leave_first;
+    uint64_t        implicit_leave_end;
+    /** Stack of entered regions used while filling the implicit leave table */
+    OTF2_RegionRef* region_stack;
+    uint32_t        region_stack_capacity;
 
     /** Cached attribute list */
     OTF2_AttributeList attribute_list;
+    /** Attribute list shapes of the chunk with number attribute_shapes->chunk,
+     *  allocated with the first attribute list written with its shape */
+    otf2_attribute_list_shapes* attribute_shapes;
+    /** All shapes of this chunk were collected */
+    bool                        attribute_shapes_complete;
+
+    /** Last read sample of each metric, delta samples apply to them */
+    otf2_evt_reader_metric* metrics;
+    uint32_t                number_of_metrics;
+
+    /** Last read calling context sample, delta samples apply to it */
+    otf2_evt_reader_sample last_sample;
 
     /** Defines if a local event reader is stand-alone or operated by a global
      * event reader. */
@@ -77,6 +153,18 @@ struct OTF2_EvtReader_struct
      *  Has no effect, when this EvtReader is operated by the GlobalEvtReader. */
     bool apply_clock_offsets;
 
+    /** The event file is opened at the first access to the events. */
+    bool file_opened;
+
+    /** The current event holds only the first timestamp of this location
+     *  from the definitions. The global event reader reads the real event
+     *  when this reader reaches the top of its heap. */
+    bool seeded;
+
+    /** Clock corrected time the global event reader positions a seeded
+     *  reader at: before the first event not earlier than this time. */
+    OTF2_TimeStamp seek_time;
+
     /** Structure of callback references */
     OTF2_EvtReaderCallbacks reader_callbacks;
     /** Userdata pointer which is passed to the callbacks */
@@ -87,6 +175,13 @@ struct OTF2_EvtReader_struct
 
     /** the current clock interval, got from the archive location */
     otf2_clock_interval* current_clock_interval;
+
+    /** Chain in the list of readers with resident chunks, maintained by the
+     *  global event reader if it has a chunk memory limit. */
+    OTF2_EvtReader* resident_prev;
+    OTF2_EvtReader* resident_next;
+    /** Chunk memory accounted for this reader by the global event reader. */
+    uint64_t        resident_size;
 };
 
 
@@ -103,10 +198,25 @@ OTF2_ErrorCode
 otf2_evt_reader_open_file( OTF2_EvtReader* reader );
 
 
+bool
+otf2_evt_reader_get_time_range( OTF2_EvtReader* reader,
+                                OTF2_TimeStamp* firstTime,
+                                OTF2_TimeStamp* lastTime );
+
+
+OTF2_ErrorCode
+otf2_evt_reader_seek_time( OTF2_EvtReader* reader,
+                           OTF2_TimeStamp  time );
+
+
 void
 otf2_evt_reader_operated_by_global_reader( OTF2_EvtReader* reader );
 
 
+OTF2_ErrorCode
+otf2_evt_reader_release_chunks( OTF2_EvtReader* reader );
+
+
 /** @intrernal
  *  @brief Reads one record from the event reader.
  *
@@ -119,6 +229,18 @@ OTF2_ErrorCode
 otf2_evt_reader_read( OTF2_EvtReader* reader );
 
 
+/** @internal
+ *  @brief Reads the record before the current position and moves the
+ *         position before it.
+ *
+ *  @param reader           Reference to the reader object
+ *
+ *  @return OTF2_ERROR_INDEX_OUT_OF_BOUNDS at the begin of the trace.
+ */
+OTF2_ErrorCode
+otf2_evt_reader_read_backward( OTF2_EvtReader* reader );
+
+
 /** @internal
  *  @brief Skips one event record.
  *
@@ -32,6 +32,76 @@
 #define OTF2_INTERNAL_EVT_WRITER_H
 
 
+/** @brief Entry of the region stack of an event writer. */
+typedef struct otf2_evt_writer_region
+{
+    /** The entered region. */
+    OTF2_RegionRef region;
+    /** Chunk segment of the buffer the enter was written to. */
+    uint64_t       segment;
+} otf2_evt_writer_region;
+
+
+/** @brief Last sample of a metric written by an event writer. */
+typedef struct otf2_evt_writer_metric
+{
+    /** The metric. */
+    OTF2_MetricRef    metric;
+    /** Chunk segment of the buffer the sample was written to, following
+     *  samples in the same segment are written as deltas. */
+    uint64_t          segment;
+    /** Number of events written before the sample. */
+    uint64_t          event;
+    /** Number of values of the sample. */
+    uint8_t           number_of_members;
+    /** Number of values the arrays have room for. */
+    uint8_t           capacity;
+    /** Types and values of the sample. */
+    OTF2_Type*        type_ids;
+    OTF2_MetricValue* values;
+} otf2_evt_writer_metric;
+
+
+/** @brief Last calling context sample written by an event writer. */
+typedef struct otf2_evt_writer_sample
+{
+    /** Whether there is a sample in the current chunk segment. */
+    bool                       known;
+    /** Chunk segment of the buffer the sample was written to. */
+    uint64_t                   segment;
+    /** Number of events written before the sample. */
+    uint64_t                   event;
+    OTF2_CallingContextRef     calling_context;
+    uint32_t                   unwind_distance;
+    OTF2_InterruptGeneratorRef interrupt_generator;
+} otf2_evt_writer_sample;
+
+
+/** @brief Enter written by an event writer, which is dropped together with
+ *  its leave if the region is left within the duration threshold. */
+typedef struct otf2_evt_writer_tentative_enter
+{
+    /** The entered region. */
+    OTF2_RegionRef    region;
+    /** Time of the enter. */
+    OTF2_TimeStamp    time;
+    /** State of the buffer before the enter was written. */
+    otf2_rewind_point state;
+} otf2_evt_writer_tentative_enter;
+
+
+/** @brief Dropped calls of a region. */
+typedef struct otf2_evt_writer_filtered_region
+{
+    /** Number and total duration of the calls dropped by the duration
+     *  filter. */
+    uint64_t       count;
+    OTF2_TimeStamp duration;
+    /** Number of calls dropped by the region filter of the archive. */
+    uint64_t       suppressed;
+} otf2_evt_writer_filtered_region;
+
+
 /** @brief Keeps all necessary information about the event writer. */
 struct OTF2_EvtWriter_struct
 {
@@ -45,6 +115,53 @@ struct OTF2_EvtWriter_struct
     void*           user_data;
     /** Chain to next event writer, used in OTF2_Archive */
     OTF2_EvtWriter* next;
+
+    /** Write leaves of the innermost entered region without the region,
+     *  see OTF2_HINT_IMPLICIT_LEAVE. */
+    bool                    implicit_leave;
+    /** Stack of the entered regions, only maintained with implicit_leave. */
+    otf2_evt_writer_region* region_stack;
+    uint32_t                region_stack_size;
+    uint32_t                region_stack_capacity;
+
+    /** Shapes of the attribute lists in the current chunk, only allocated
+     *  with OTF2_HINT_ATTRIBUTE_LIST_SHAPES. */
+    otf2_attribute_list_shapes* attribute_shapes;
+
+    /** Write metric samples as deltas, see OTF2_HINT_METRIC_DELTAS. */
+    bool                    metric_deltas;
+    /** Last sample of each metric, only maintained with metric_deltas. */
+    otf2_evt_writer_metric* metrics;
+    uint32_t                number_of_metrics;
+
+    /** Write calling context samples as deltas, see
+     *  OTF2_HINT_CALLING_CONTEXT_DELTAS. */
+    bool                   calling_context_deltas;
+    otf2_evt_writer_sample last_sample;
+
+    /** Regions left within this duration after their enter are dropped,
+     *  0 if the duration filter is disabled. */
+    OTF2_TimeStamp                   duration_threshold;
+    /** Stack of the innermost enters which may still be dropped. Any event
+     *  other than an enter or leave clears it. */
+    otf2_evt_writer_tentative_enter* tentative_enters;
+    uint32_t                         number_of_tentative_enters;
+    uint32_t                         tentative_enters_capacity;
+    /** Summary of the dropped calls, indexed by the region. The duration
+     *  filter only maintains it if requested. */
+    bool                             filter_summary;
+    otf2_evt_writer_filtered_region* filtered_regions;
+    uint32_t                         number_of_filtered_regions;
+
+    /** One bit per enter written since the archive has a region filter, set
+     *  if the enter was dropped, to drop the matching leave too. */
+    uint64_t* suppressed_stack;
+    uint32_t  suppressed_stack_size;
+    uint32_t  suppressed_stack_capacity;
+    /** Version of the region filter this writer used last, it won't use
+     *  older ones anymore. Published with release semantics, see
+     *  otf2_evt_writer_suppress_enter(). */
+    uint64_t  region_filter_version;
 };
 
 
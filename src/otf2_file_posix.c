@@ -45,6 +45,7 @@
 #include <stdint.h>
 #include <inttypes.h>
 #include <stdbool.h>
+#include <errno.h>
 #if HAVE( SYS_STAT_H )
 #include <sys/stat.h>
 #endif
@@ -60,14 +61,13 @@
 #include "otf2_reader.h"
 #include "otf2_archive.h"
 
+#include "otf2_lock.h"
+
 #include "OTF2_File.h"
 #include "otf2_file_int.h"
+#include "otf2_file_posix.h"
 
 
-/** @brief File handle to interact with posix files.
- *  Please see otf2_file_posix_struct for a detailed description. */
-typedef struct otf2_file_posix_struct otf2_file_posix;
-
 /** @brief File handle to interact with posix files. */
 struct otf2_file_posix_struct
 {
@@ -83,9 +83,27 @@ struct otf2_file_posix_struct
     /** Keep file pos when the real file is closed. Is undefined while file is
      *  open, equals 0 before opened for the first time. */
     uint64_t position;
+
+    /** The file pool of the archive, if this file is managed by it, i.e.,
+     *  the file was opened for reading. */
+    OTF2_FileSubstrateData* pool;
+    /** Number of operations currently using @a file. A file in use is never
+     *  closed by the pool. */
+    uint32_t                in_use;
+    /** Chain in the LRU list of the pool. */
+    otf2_file_posix*        lru_prev;
+    otf2_file_posix*        lru_next;
 };
 
 
+static OTF2_ErrorCode
+otf2_file_posix_acquire( otf2_file_posix* posixFile );
+
+
+static void
+otf2_file_posix_release( otf2_file_posix* posixFile );
+
+
 OTF2_ErrorCode
 otf2_file_posix_close( OTF2_File* file );
 
@@ -140,35 +158,9 @@ otf2_file_posix_open( OTF2_Archive*    archive,
     }
     UTILS_DEBUG( "File to open: '%s'", file_path );
 
-    /* Initialize substrate specific data. */
-    FILE* os_file = NULL;
-    switch ( fileMode )
-    {
-        case OTF2_FILEMODE_WRITE:
-            os_file = fopen( file_path, "wb" );
-            break;
-        case OTF2_FILEMODE_READ:
-            os_file = fopen( file_path, "rb" );
-            break;
-        case OTF2_FILEMODE_MODIFY:
-            os_file = fopen( file_path, "rb+" );
-            break;
-        default:
-            os_file = fopen( file_path, "rb" );
-            break;
-    }
-
-    if ( os_file == NULL )
-    {
-        OTF2_ErrorCode status = UTILS_ERROR_POSIX( "'%s'", file_path );
-        free( file_path );
-        return status;
-    }
-
     otf2_file_posix* posix_file = ( otf2_file_posix* )calloc( 1, sizeof( *posix_file ) );
     if ( !posix_file )
     {
-        fclose( os_file );
         free( file_path );
         return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
                             "Could not allocate POSIX file object." );
@@ -182,15 +174,249 @@ otf2_file_posix_open( OTF2_Archive*    archive,
     posix_file->super.get_file_size = otf2_file_posix_get_file_size;
 
     posix_file->file_path = file_path;
-    posix_file->file      = os_file;
+    posix_file->file      = NULL;
     posix_file->position  = 0;
 
+    /* Files in reading mode can be closed and re-opened at any time, thus
+     * they are managed by the file pool of the archive. The OS file is
+     * opened nevertheless right now, to report errors early. */
+    if ( fileMode == OTF2_FILEMODE_READ )
+    {
+        posix_file->pool          = archive->per_substrate_data[ OTF2_SUBSTRATE_POSIX ];
+        posix_file->super.archive = archive;
+    }
+
+    if ( posix_file->pool )
+    {
+        OTF2_ErrorCode status = otf2_file_posix_acquire( posix_file );
+        if ( status != OTF2_SUCCESS )
+        {
+            free( file_path );
+            free( posix_file );
+            return status;
+        }
+        otf2_file_posix_release( posix_file );
+    }
+    else
+    {
+        /* Initialize substrate specific data. */
+        switch ( fileMode )
+        {
+            case OTF2_FILEMODE_WRITE:
+                posix_file->file = fopen( file_path, "wb" );
+                break;
+            case OTF2_FILEMODE_MODIFY:
+                posix_file->file = fopen( file_path, "rb+" );
+                break;
+            default:
+                posix_file->file = fopen( file_path, "rb" );
+                break;
+        }
+
+        if ( posix_file->file == NULL )
+        {
+            OTF2_ErrorCode status = UTILS_ERROR_POSIX( "'%s'", file_path );
+            free( file_path );
+            free( posix_file );
+            return status;
+        }
+    }
+
     *file = &posix_file->super;
 
     return OTF2_SUCCESS;
 }
 
 
+/** @brief Locks the file pool, if it has a lock. */
+static inline void
+otf2_file_posix_pool_lock( OTF2_Archive*           archive,
+                           OTF2_FileSubstrateData* pool )
+{
+    if ( pool->has_lock )
+    {
+        OTF2_ErrorCode err = otf2_lock_lock( archive, pool->lock );
+        if ( OTF2_SUCCESS != err )
+        {
+            UTILS_ERROR( err, "Can't lock file pool." );
+        }
+    }
+}
+
+
+/** @brief Unlocks the file pool, if it has a lock. */
+static inline void
+otf2_file_posix_pool_unlock( OTF2_Archive*           archive,
+                             OTF2_FileSubstrateData* pool )
+{
+    if ( pool->has_lock )
+    {
+        OTF2_ErrorCode err = otf2_lock_unlock( archive, pool->lock );
+        if ( OTF2_SUCCESS != err )
+        {
+            UTILS_ERROR( err, "Can't unlock file pool." );
+        }
+    }
+}
+
+
+/** @brief Removes an open file from the LRU list of the pool.
+ *
+ *  Caller must hold the pool lock.
+ */
+static void
+otf2_file_posix_pool_unlink( OTF2_FileSubstrateData* pool,
+                             otf2_file_posix*        posixFile )
+{
+    if ( posixFile->lru_prev )
+    {
+        posixFile->lru_prev->lru_next = posixFile->lru_next;
+    }
+    else
+    {
+        pool->lru_head = posixFile->lru_next;
+    }
+    if ( posixFile->lru_next )
+    {
+        posixFile->lru_next->lru_prev = posixFile->lru_prev;
+    }
+    else
+    {
+        pool->lru_tail = posixFile->lru_prev;
+    }
+    posixFile->lru_prev = NULL;
+    posixFile->lru_next = NULL;
+}
+
+
+/** @brief Puts an open file at the head of the LRU list of the pool.
+ *
+ *  Caller must hold the pool lock.
+ */
+static void
+otf2_file_posix_pool_push( OTF2_FileSubstrateData* pool,
+                           otf2_file_posix*        posixFile )
+{
+    posixFile->lru_prev = NULL;
+    posixFile->lru_next = pool->lru_head;
+    if ( pool->lru_head )
+    {
+        pool->lru_head->lru_prev = posixFile;
+    }
+    else
+    {
+        pool->lru_tail = posixFile;
+    }
+    pool->lru_head = posixFile;
+}
+
+
+/** @brief Closes the OS file of the least recently used file, which is
+ *         currently not in use.
+ *
+ *  Caller must hold the pool lock.
+ *
+ *  @return true, if a file could be closed.
+ */
+static bool
+otf2_file_posix_pool_evict( OTF2_FileSubstrateData* pool )
+{
+    otf2_file_posix* victim = pool->lru_tail;
+    while ( victim && victim->in_use )
+    {
+        victim = victim->lru_prev;
+    }
+    if ( !victim )
+    {
+        return false;
+    }
+
+    UTILS_DEBUG( "Closing '%s' at position %" PRIu64,
+                 victim->file_path, victim->position );
+
+    otf2_file_posix_pool_unlink( pool, victim );
+    fclose( victim->file );
+    victim->file = NULL;
+    pool->number_of_open_files--;
+
+    return true;
+}
+
+
+/** @brief Ensures that the OS file of a pooled file is open and prevents
+ *         that it will be closed until otf2_file_posix_release() is called.
+ *
+ *  A file which was closed by the pool is re-opened and positioned where it
+ *  was left.
+ */
+static OTF2_ErrorCode
+otf2_file_posix_acquire( otf2_file_posix* posixFile )
+{
+    OTF2_FileSubstrateData* pool    = posixFile->pool;
+    OTF2_Archive*           archive = posixFile->super.archive;
+    OTF2_ErrorCode          status  = OTF2_SUCCESS;
+
+    otf2_file_posix_pool_lock( archive, pool );
+
+    if ( posixFile->file )
+    {
+        otf2_file_posix_pool_unlink( pool, posixFile );
+        otf2_file_posix_pool_push( pool, posixFile );
+        posixFile->in_use++;
+        goto out;
+    }
+
+    while ( pool->max_open_files != 0
+            && pool->number_of_open_files >= pool->max_open_files
+            && otf2_file_posix_pool_evict( pool ) )
+    {
+    }
+
+    /* Retry as long as the OS refuses to open more files and we still have
+     * some to give back. */
+    while ( NULL == ( posixFile->file = fopen( posixFile->file_path, "rb" ) ) )
+    {
+        if ( ( errno != EMFILE && errno != ENFILE )
+             || !otf2_file_posix_pool_evict( pool ) )
+        {
+            status = UTILS_ERROR_POSIX( "'%s'", posixFile->file_path );
+            goto out;
+        }
+    }
+
+    if ( posixFile->position != 0
+         && fseek( posixFile->file, posixFile->position, SEEK_SET ) != 0 )
+    {
+        status = UTILS_ERROR_POSIX( "%s", posixFile->file_path );
+        fclose( posixFile->file );
+        posixFile->file = NULL;
+        goto out;
+    }
+
+    otf2_file_posix_pool_push( pool, posixFile );
+    pool->number_of_open_files++;
+    posixFile->in_use++;
+
+out:
+    otf2_file_posix_pool_unlock( archive, pool );
+
+    return status;
+}
+
+
+/** @brief Allows the pool to close the OS file again. */
+static void
+otf2_file_posix_release( otf2_file_posix* posixFile )
+{
+    OTF2_FileSubstrateData* pool    = posixFile->pool;
+    OTF2_Archive*           archive = posixFile->super.archive;
+
+    otf2_file_posix_pool_lock( archive, pool );
+    posixFile->in_use--;
+    otf2_file_posix_pool_unlock( archive, pool );
+}
+
+
 /** @name File operations for Posix file substrate.
  *  Please see the standard interface functions for a detailed description.
  *  @{ */
@@ -200,8 +426,24 @@ otf2_file_posix_close( OTF2_File* file )
     /* Get the original substrate structure. */
     otf2_file_posix* posix_file = ( otf2_file_posix* )file;
 
-    int status     = fclose( posix_file->file );
-    int errno_save = errno;
+    int status     = 0;
+    int errno_save = 0;
+    if ( posix_file->pool )
+    {
+        OTF2_FileSubstrateData* pool = posix_file->pool;
+        otf2_file_posix_pool_lock( file->archive, pool );
+        if ( posix_file->file )
+        {
+            otf2_file_posix_pool_unlink( pool, posix_file );
+            pool->number_of_open_files--;
+        }
+        otf2_file_posix_pool_unlock( file->archive, pool );
+    }
+    if ( posix_file->file )
+    {
+        status     = fclose( posix_file->file );
+        errno_save = errno;
+    }
 
     free( ( void* )posix_file->file_path );
     free( posix_file );
@@ -266,12 +508,28 @@ otf2_file_posix_read( OTF2_File* file,
     /* Get the original substrate structure. */
     otf2_file_posix* posix_file = ( otf2_file_posix* )file;
 
+    if ( posix_file->pool )
+    {
+        OTF2_ErrorCode status = otf2_file_posix_acquire( posix_file );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+    }
+
     UTILS_DEBUG( "fread( %p, 1, %zu, %p )",
                  buffer, size, posix_file->file );
     size_t bytes = fread( buffer, 1, size, posix_file->file );
     UTILS_DEBUG( "fread( %p, 1, %zu, %p ) = %zu",
                  buffer, size, posix_file->file, bytes );
-    if ( ferror( posix_file->file ) )
+    bool failed = ferror( posix_file->file );
+
+    if ( posix_file->pool )
+    {
+        otf2_file_posix_release( posix_file );
+    }
+
+    if ( failed )
     {
         return UTILS_ERROR_POSIX( "%s", posix_file->file_path );
     }
@@ -290,12 +548,28 @@ otf2_file_posix_seek( OTF2_File* file,
     /* Get the original substrate structure. */
     otf2_file_posix* posix_file = ( otf2_file_posix* )file;
 
+    if ( posix_file->pool )
+    {
+        OTF2_ErrorCode status = otf2_file_posix_acquire( posix_file );
+        if ( status != OTF2_SUCCESS )
+        {
+            return status;
+        }
+    }
+
     int status = fseek( posix_file->file, offset, SEEK_SET );
+
+    if ( posix_file->pool )
+    {
+        otf2_file_posix_release( posix_file );
+    }
+
     if ( status != 0 )
     {
         return UTILS_ERROR_POSIX( "%s", posix_file->file_path );
     }
 
+    posix_file->position = offset;
     return OTF2_SUCCESS;
 }
 
@@ -19,6 +19,32 @@
 #define OTF2_FILE_POSIX_H
 
 
+/** @brief File handle to interact with posix files.
+ *  Please see otf2_file_posix_struct for a detailed description. */
+typedef struct otf2_file_posix_struct otf2_file_posix;
+
+
+/** @brief Implementation of per archive file substrate data.
+ *
+ *  Keeps the pool of open files in reading mode, so that the number of
+ *  concurrently open OS file handles can be bounded. Files which exceed the
+ *  limit are closed in least-recently-used order and re-opened on demand.
+ */
+struct OTF2_FileSubstrateData
+{
+    /** Protects the pool, only valid if @a has_lock is true. */
+    OTF2_Lock        lock;
+    bool             has_lock;
+    /** Maximum number of concurrently open files in the pool, 0 for no limit. */
+    uint32_t         max_open_files;
+    /** Number of files in the pool which currently have an OS file handle. */
+    uint32_t         number_of_open_files;
+    /** Files with an OS file handle, most recently used first. */
+    otf2_file_posix* lru_head;
+    otf2_file_posix* lru_tail;
+};
+
+
 OTF2_ErrorCode
 otf2_file_posix_open( OTF2_Archive*    archive,
                       OTF2_FileMode    fileMode,
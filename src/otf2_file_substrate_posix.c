@@ -35,19 +35,13 @@
 #include "otf2_reader.h"
 #include "otf2_archive.h"
 
+#include "otf2_lock.h"
+
 #include "OTF2_File.h"
 #include "otf2_file_posix.h"
 #include "otf2_file_substrate.h"
 
 
-/** @brief Implementation of per archive file substrate data.
- */
-struct OTF2_FileSubstrateData
-{
-    int dummy;
-};
-
-
 /** @brief Implementation of file type substrate data.
  */
 struct OTF2_FileSubstrateFileTypeData
@@ -67,7 +61,7 @@ otf2_file_substrate_posix_initialize( OTF2_Archive* archive )
 {
     UTILS_ASSERT( archive );
 
-    OTF2_FileSubstrateData* data = malloc( sizeof( *data ) );
+    OTF2_FileSubstrateData* data = calloc( 1, sizeof( *data ) );
     if ( !data )
     {
         return UTILS_ERROR( OTF2_ERROR_MEM_ALLOC_FAILED,
@@ -97,6 +91,10 @@ otf2_file_substrate_posix_finalize( OTF2_Archive* archive )
     }
 
     OTF2_FileSubstrateData* data = archive->per_substrate_data[ OTF2_SUBSTRATE_POSIX ];
+    if ( data->has_lock )
+    {
+        otf2_lock_destroy( archive, data->lock );
+    }
     free( data );
     archive->per_substrate_data[ OTF2_SUBSTRATE_POSIX ] = NULL;
 
@@ -145,7 +143,28 @@ otf2_file_substrate_posix_open_file_type( OTF2_Archive* archive,
 {
     UTILS_ASSERT( archive );
 
-    return OTF2_SUCCESS;
+    OTF2_FileSubstrateData* data = archive->per_substrate_data[ OTF2_SUBSTRATE_POSIX ];
+    if ( !data || fileMode != OTF2_FILEMODE_READ )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    /* The pool is shared by all readers, thus it needs its own lock, once the
+     * user provided locking callbacks. */
+    if ( !data->has_lock && archive->locking_callbacks )
+    {
+        OTF2_ErrorCode status = otf2_lock_create( archive, &data->lock );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status, "Can't create file pool lock." );
+        }
+        data->has_lock = true;
+    }
+
+    /* Caller holds the archive lock. */
+    return otf2_archive_query_hint( archive,
+                                    OTF2_HINT_MAX_OPEN_FILES,
+                                    &data->max_open_files );
 }
 
 
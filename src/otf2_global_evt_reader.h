@@ -43,6 +43,25 @@ struct OTF2_GlobalEvtReader_struct
     OTF2_GlobalEvtReaderCallbacks reader_callbacks;
     /** @brief Additional user data. */
     void*                         user_data;
+    /** @brief Limit for the chunk memory of all local readers, 0 if none. */
+    uint64_t                      max_chunk_memory;
+    /** @brief Chunk memory currently used by all local readers. */
+    uint64_t                      chunk_memory;
+    /** @brief Local readers with resident chunks, most recently used first. */
+    OTF2_EvtReader*               resident_head;
+    OTF2_EvtReader*               resident_tail;
+    /** @brief Events after this time are not delivered by forward reading. */
+    OTF2_TimeStamp                end_time;
+    /** @brief Events are delivered in descending order and the heap is a
+     *  max-heap. */
+    bool                          backward;
+    /** @brief No event of a closed local reader is later than this time,
+     *  or earlier when reading backward. */
+    OTF2_TimeStamp                time_passed;
+    /** @brief Archive location indices of the local readers, which were
+     *  closed because they had no further events. */
+    uint32_t*                     closed_locations;
+    uint64_t                      number_of_closed_locations;
     /** @brief Heap keeping all event readers sorted by timestamp. */
     OTF2_EvtReader*               event_queue[];
 };
@@ -53,6 +53,7 @@ enum OTF2_LocalDefinitionType_enum
     /* OTF2 Records */
     OTF2_LOCAL_DEF_MAPPING_TABLE = 5,  /**< */
     OTF2_LOCAL_DEF_CLOCK_OFFSET = 6,  /**< */
+    OTF2_LOCAL_DEF_EVENT_TIME_RANGE = 7,  /**< */
     OTF2_LOCAL_DEF_STRING = 10,  /**< */
     OTF2_LOCAL_DEF_ATTRIBUTE = 11,  /**< */
     OTF2_LOCAL_DEF_SYSTEM_TREE_NODE = 12,  /**< */
@@ -104,6 +105,15 @@ typedef struct OTF2_LocalDefClockOffset_struct
 } OTF2_LocalDefClockOffset;
 
 
+/** @brief EventTimeRange definition.
+ */
+typedef struct OTF2_LocalDefEventTimeRange_struct
+{
+    OTF2_TimeStamp first_timestamp;
+    OTF2_TimeStamp last_timestamp;
+} OTF2_LocalDefEventTimeRange;
+
+
 /** @brief String definition.
  */
 typedef struct OTF2_LocalDefString_struct
@@ -422,6 +432,7 @@ struct OTF2_DefReaderCallbacks_struct
     OTF2_DefReaderCallback_Unknown      unknown;
     OTF2_DefReaderCallback_MappingTable mapping_table;
     OTF2_DefReaderCallback_ClockOffset clock_offset;
+    OTF2_DefReaderCallback_EventTimeRange event_time_range;
     OTF2_DefReaderCallback_String string;
     OTF2_DefReaderCallback_Attribute attribute;
     OTF2_DefReaderCallback_SystemTreeNode system_tree_node;
@@ -57,6 +57,11 @@ typedef OTF2_ErrorCode
                                   const OTF2_LockingCallbacks* lockingCallbacks,
                                   void*                        lockingData );
 
+typedef OTF2_ErrorCode
+( *OTF2_FP_SetParallelCallbacks )( void*                         archive,
+                                   const OTF2_ParallelCallbacks* parallelCallbacks,
+                                   void*                         parallelData );
+
 /** @internal
  *  @brief Register event reader callbacks.
  *
@@ -793,6 +798,45 @@ typedef OTF2_ErrorCode
                       void*     value );
 
 
+/** @internal
+ *  @brief Unify local definitions.
+ *
+ *  @param archive               Valid archive handle.
+ *  @param numberOfLocations     Number of locations.
+ *  @param locations             The locations to unify.
+ *  @param globalDefWriter       Writer for the global definitions.
+ *  @param mappingTableCallback  Called with the mapping tables.
+ *  @param userData              Passed to @a mappingTableCallback.
+ *  @param numberOfStrings       Number of unified strings.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+typedef OTF2_ErrorCode
+( *OTF2_FP_UnifyLocalDefinitions )( void*                            archive,
+                                    uint32_t                         numberOfLocations,
+                                    const OTF2_LocationRef*          locations,
+                                    OTF2_GlobalDefWriter*            globalDefWriter,
+                                    OTF2_UnifiedMappingTableCallback mappingTableCallback,
+                                    void*                            userData,
+                                    uint64_t*                        numberOfStrings );
+
+
+/** @internal
+ *  @brief Load the local definitions of all selected locations.
+ *
+ *  @param archive          Valid archive handle.
+ *  @param skipDefinitions  Read only mapping tables, clock offsets, and
+ *                          event time ranges.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+typedef OTF2_ErrorCode
+( *OTF2_FP_LoadLocalDefinitions )( void* archive,
+                                   bool  skipDefinitions );
+
+
 typedef struct otf2_reader_archive_impl_struct
 {
     /** @name Function pointer to the actual reader operations according to the
@@ -802,6 +846,7 @@ typedef struct otf2_reader_archive_impl_struct
     OTF2_FP_SetCollectiveCallbacks      set_collective_callbacks;
     OTF2_FP_Archive                     set_serial_collective_callbacks;
     OTF2_FP_SetLockingCallbacks         set_locking_callbacks;
+    OTF2_FP_SetParallelCallbacks        set_parallel_callbacks;
     OTF2_FP_RegisterEvtCallbacks        register_evt_callbacks;
     OTF2_FP_RegisterGlobalEvtCallbacks  register_global_evt_callbacks;
     OTF2_FP_RegisterDefCallbacks        register_def_callbacks;
@@ -814,6 +859,7 @@ typedef struct otf2_reader_archive_impl_struct
     OTF2_FP_HasGlobalEvent              has_global_event;
     OTF2_FP_ReadGlobalEvents            read_global_events;
     OTF2_FP_ReadLocalEvents             read_local_events_backward;
+    OTF2_FP_ReadGlobalEvents            read_global_events_backward;
     OTF2_FP_ReadLocalDefinitions        read_local_definitions;
     OTF2_FP_ReadGlobalDefinitions       read_global_definitions;
     OTF2_FP_ReadLocalSnapshots          read_local_snapshots;
@@ -859,6 +905,8 @@ typedef struct otf2_reader_archive_impl_struct
     OTF2_FP_Archive                     close_snap_files;
     OTF2_FP_SelectLocation              select_location;
     OTF2_FP_SetHint                     set_hint;
+    OTF2_FP_UnifyLocalDefinitions       unify_local_definitions;
+    OTF2_FP_LoadLocalDefinitions        load_local_definitions;
     /** @} */
 } otf2_reader_archive_impl;
 
@@ -0,0 +1,2505 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2009-2013,
+ * RWTH Aachen University, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * Gesellschaft fuer numerische Simulation mbH Braunschweig, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * Technische Universitaet Dresden, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * University of Oregon, Eugene, USA
+ *
+ * Copyright (c) 2009-2013,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * German Research School for Simulation Sciences GmbH, Juelich/Aachen, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * Technische Universitaet Muenchen, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+/**
+ * @file
+ *
+ * @brief Unification of local definitions.
+ */
+
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include <otf2/otf2.h>
+
+#include <UTILS_Error.h>
+#include <UTILS_Debug.h>
+
+#include <jenkins_hash.h>
+
+#include "otf2_internal.h"
+#include "otf2_lock.h"
+#include "otf2_file_types.h"
+#include "otf2_reader.h"
+#include "otf2_archive.h"
+#include "otf2_unify.h"
+
+
+/** Number of independently locked parts of a unification table, a power of
+ *  two. */
+#define OTF2_ARCHIVE_UNIFY_STRIPES 64
+
+/** Initial number of hash buckets in a part of a unification table, a power
+ *  of two. */
+#define OTF2_ARCHIVE_UNIFY_BUCKETS 64
+
+/** The definition classes, in the order they reference each other. */
+enum
+{
+    /* Unified classes, the local identifiers are mapped to new global
+     * identifiers. */
+    OTF2_ARCHIVE_UNIFY_STRING,
+    OTF2_ARCHIVE_UNIFY_REGION,
+    OTF2_ARCHIVE_UNIFY_GROUP,
+    OTF2_ARCHIVE_UNIFY_COMM,
+    OTF2_ARCHIVE_UNIFY_SOURCE_CODE_LOCATION,
+    OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT,
+    OTF2_ARCHIVE_UNIFY_ATTRIBUTE,
+    OTF2_ARCHIVE_UNIFY_PARAMETER,
+    OTF2_ARCHIVE_UNIFY_RMA_WIN,
+    OTF2_ARCHIVE_UNIFY_INTERRUPT_GENERATOR,
+    OTF2_ARCHIVE_UNIFY_METRIC_MEMBER,
+    /* Metric classes and instances share their identifiers. */
+    OTF2_ARCHIVE_UNIFY_METRIC,
+
+    OTF2_ARCHIVE_UNIFY_MAX,
+
+    /* Classes passed through with their local identifiers, which are
+     * already global. The key starts with the identifier. */
+    OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE = OTF2_ARCHIVE_UNIFY_MAX,
+    OTF2_ARCHIVE_UNIFY_LOCATION_GROUP,
+    OTF2_ARCHIVE_UNIFY_LOCATION,
+    OTF2_ARCHIVE_UNIFY_CALLSITE,
+    OTF2_ARCHIVE_UNIFY_CALLPATH,
+    OTF2_ARCHIVE_UNIFY_CART_DIMENSION,
+    OTF2_ARCHIVE_UNIFY_CART_TOPOLOGY,
+
+    /* Classes passed through, which have no identifier. */
+    OTF2_ARCHIVE_UNIFY_METRIC_CLASS_RECORDER,
+    OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE_PROPERTY,
+    OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE_DOMAIN,
+    OTF2_ARCHIVE_UNIFY_LOCATION_GROUP_PROPERTY,
+    OTF2_ARCHIVE_UNIFY_LOCATION_PROPERTY,
+    OTF2_ARCHIVE_UNIFY_CART_COORDINATE,
+    OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT_PROPERTY,
+
+    OTF2_ARCHIVE_UNIFY_ALL
+};
+
+
+/** First key element of the definitions in the metric table. */
+enum
+{
+    OTF2_ARCHIVE_UNIFY_METRIC_CLASS,
+    OTF2_ARCHIVE_UNIFY_METRIC_INSTANCE
+};
+
+
+/** Mapping types of the unified definition classes, @p OTF2_MAPPING_MAX
+ *  if there is no mapping table for the class. */
+static const OTF2_MappingType otf2_archive_unify_mapping_types[ OTF2_ARCHIVE_UNIFY_MAX ] =
+{
+    OTF2_MAPPING_STRING,
+    OTF2_MAPPING_REGION,
+    OTF2_MAPPING_GROUP,
+    OTF2_MAPPING_COMM,
+    OTF2_MAPPING_SOURCE_CODE_LOCATION,
+    OTF2_MAPPING_CALLING_CONTEXT,
+    OTF2_MAPPING_ATTRIBUTE,
+    OTF2_MAPPING_PARAMETER,
+    OTF2_MAPPING_RMA_WIN,
+    OTF2_MAPPING_INTERRUPT_GENERATOR,
+    OTF2_MAPPING_MAX,
+    OTF2_MAPPING_METRIC
+};
+
+
+/** @brief A unified global definition.
+ *
+ *  The key holds the attributes of the definition. While the locations are
+ *  read, a reference is the address of the referenced entry, or 0 for the
+ *  undefined reference, see otf2_archive_unify_map_reference(). After the
+ *  global identifiers are assigned, the references are resolved to them.
+ *  For strings, the key is the string including the terminating NUL.
+ */
+typedef struct otf2_archive_unify_entry
+{
+    struct otf2_archive_unify_entry* next;
+    uint32_t                         hash;
+    uint32_t                         key_length;
+    uint64_t                         global_id;
+    uint64_t                         key[];
+} otf2_archive_unify_entry;
+
+
+/** @brief An independently locked part of a unification table. */
+typedef struct otf2_archive_unify_stripe
+{
+    OTF2_Lock                  lock;
+    otf2_archive_unify_entry** buckets;
+    uint32_t                   number_of_buckets;
+    uint32_t                   number_of_entries;
+} otf2_archive_unify_stripe;
+
+
+/** @brief The unified global definitions of one class. */
+typedef struct otf2_archive_unify_table
+{
+    otf2_archive_unify_stripe  stripes[ OTF2_ARCHIVE_UNIFY_STRIPES ];
+    /** The definitions indexed by their global identifier, collected after
+     *  all locations were read. */
+    otf2_archive_unify_entry** entries;
+    uint64_t                   number_of_entries;
+} otf2_archive_unify_table;
+
+
+/** @brief Maps the local identifiers of one definition class of one location
+ *  to the unified definitions, with open addressing. */
+typedef struct otf2_archive_unify_map
+{
+    uint64_t*                  local_ids;
+    otf2_archive_unify_entry** entries;
+    uint64_t                   capacity;
+    uint64_t                   size;
+} otf2_archive_unify_map;
+
+
+struct otf2_archive_unify_context;
+
+
+/** @brief The state of one location during the unification. */
+typedef struct otf2_archive_unify_location
+{
+    struct otf2_archive_unify_context* context;
+    OTF2_LocationRef                   location;
+    otf2_archive_unify_map             maps[ OTF2_ARCHIVE_UNIFY_MAX ];
+    /** Buffer for the key of the current definition. */
+    uint64_t*                          key;
+    uint64_t                           key_capacity;
+    /** Set when the location was read. */
+    bool                               done;
+    OTF2_ErrorCode                     status;
+} otf2_archive_unify_location;
+
+
+/** @brief The state of one call to otf2_archive_unify_local_definitions(). */
+typedef struct otf2_archive_unify_context
+{
+    OTF2_Archive*                archive;
+    OTF2_DefReaderCallbacks*     callbacks;
+    otf2_archive_unify_table     tables[ OTF2_ARCHIVE_UNIFY_ALL ];
+    otf2_archive_unify_location* locations;
+} otf2_archive_unify_context;
+
+
+static OTF2_ErrorCode
+otf2_archive_unify_table_initialize( OTF2_Archive*             archive,
+                                     otf2_archive_unify_table* table )
+{
+    for ( uint32_t i = 0; i < OTF2_ARCHIVE_UNIFY_STRIPES; i++ )
+    {
+        OTF2_ErrorCode status = otf2_lock_create( archive, &table->stripes[ i ].lock );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status, "Can't create lock." );
+        }
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+static void
+otf2_archive_unify_table_finalize( OTF2_Archive*             archive,
+                                   otf2_archive_unify_table* table )
+{
+    free( table->entries );
+
+    for ( uint32_t i = 0; i < OTF2_ARCHIVE_UNIFY_STRIPES; i++ )
+    {
+        for ( uint32_t j = 0; j < table->stripes[ i ].number_of_buckets; j++ )
+        {
+            otf2_archive_unify_entry* entry = table->stripes[ i ].buckets[ j ];
+            while ( entry )
+            {
+                otf2_archive_unify_entry* next = entry->next;
+                free( entry );
+                entry = next;
+            }
+        }
+        free( table->stripes[ i ].buckets );
+        if ( table->stripes[ i ].lock )
+        {
+            otf2_lock_destroy( archive, table->stripes[ i ].lock );
+        }
+    }
+}
+
+
+/** @brief Double the number of buckets of a stripe.
+ *
+ *  Caller must hold the stripe lock.
+ */
+static OTF2_ErrorCode
+otf2_archive_unify_stripe_grow( otf2_archive_unify_stripe* stripe )
+{
+    uint32_t                   number_of_buckets = stripe->number_of_buckets
+                                                   ? 2 * stripe->number_of_buckets
+                                                   : OTF2_ARCHIVE_UNIFY_BUCKETS;
+    otf2_archive_unify_entry** buckets = calloc( number_of_buckets,
+                                                 sizeof( *buckets ) );
+    if ( !buckets )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Can't allocate hash buckets." );
+    }
+
+    for ( uint32_t i = 0; i < stripe->number_of_buckets; i++ )
+    {
+        otf2_archive_unify_entry* entry = stripe->buckets[ i ];
+        while ( entry )
+        {
+            otf2_archive_unify_entry* next = entry->next;
+            uint32_t                  bucket =
+                ( entry->hash / OTF2_ARCHIVE_UNIFY_STRIPES ) & ( number_of_buckets - 1 );
+            entry->next       = buckets[ bucket ];
+            buckets[ bucket ] = entry;
+            entry             = next;
+        }
+    }
+
+    free( stripe->buckets );
+    stripe->buckets           = buckets;
+    stripe->number_of_buckets = number_of_buckets;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Get the entry of a definition, a new one if the definition was
+ *  not seen before.
+ *
+ *  Only the stripe of the definition is locked during the lookup. The
+ *  global identifier is assigned later, independent of the order in which
+ *  the locations find the definitions.
+ */
+static OTF2_ErrorCode
+otf2_archive_unify_table_insert( OTF2_Archive*              archive,
+                                 otf2_archive_unify_table*  table,
+                                 const void*                key,
+                                 uint32_t                   keyLength,
+                                 otf2_archive_unify_entry** entryOut )
+{
+    uint32_t                   hash   = jenkins_hashlittle( key, keyLength, 0 );
+    otf2_archive_unify_stripe* stripe =
+        &table->stripes[ hash & ( OTF2_ARCHIVE_UNIFY_STRIPES - 1 ) ];
+    OTF2_ErrorCode status = OTF2_SUCCESS;
+
+    otf2_lock_lock( archive, stripe->lock );
+
+    if ( stripe->number_of_entries >= stripe->number_of_buckets )
+    {
+        status = otf2_archive_unify_stripe_grow( stripe );
+        if ( OTF2_SUCCESS != status )
+        {
+            goto out;
+        }
+    }
+
+    otf2_archive_unify_entry** bucket =
+        &stripe->buckets[ ( hash / OTF2_ARCHIVE_UNIFY_STRIPES ) & ( stripe->number_of_buckets - 1 ) ];
+    for ( otf2_archive_unify_entry* entry = *bucket; entry; entry = entry->next )
+    {
+        if ( entry->hash == hash
+             && entry->key_length == keyLength
+             && 0 == memcmp( entry->key, key, keyLength ) )
+        {
+            *entryOut = entry;
+            goto out;
+        }
+    }
+
+    otf2_archive_unify_entry* entry = malloc( sizeof( *entry ) + keyLength );
+    if ( !entry )
+    {
+        status = UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                              "Can't allocate unified definition." );
+        goto out;
+    }
+    entry->hash       = hash;
+    entry->key_length = keyLength;
+    memcpy( entry->key, key, keyLength );
+
+    entry->next = *bucket;
+    *bucket     = entry;
+    stripe->number_of_entries++;
+    *entryOut = entry;
+
+out:
+    otf2_lock_unlock( archive, stripe->lock );
+
+    return status;
+}
+
+
+static inline uint64_t
+otf2_archive_unify_map_slot( const otf2_archive_unify_map* map,
+                             uint64_t                      localId )
+{
+    /* Fibonacci hashing, the local identifiers are usually consecutive. */
+    return ( localId * UINT64_C( 0x9E3779B97F4A7C15 ) ) & ( map->capacity - 1 );
+}
+
+
+static bool
+otf2_archive_unify_map_lookup( const otf2_archive_unify_map* map,
+                               uint64_t                      localId,
+                               otf2_archive_unify_entry**    entry )
+{
+    if ( 0 == map->size )
+    {
+        return false;
+    }
+
+    for ( uint64_t slot = otf2_archive_unify_map_slot( map, localId );
+          map->local_ids[ slot ] != OTF2_UNDEFINED_UINT64;
+          slot = ( slot + 1 ) & ( map->capacity - 1 ) )
+    {
+        if ( map->local_ids[ slot ] == localId )
+        {
+            *entry = map->entries[ slot ];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+static OTF2_ErrorCode
+otf2_archive_unify_map_insert( otf2_archive_unify_map*   map,
+                               uint64_t                  localId,
+                               otf2_archive_unify_entry* entry )
+{
+    /* Keep the load factor at most one half. */
+    if ( 2 * ( map->size + 1 ) > map->capacity )
+    {
+        otf2_archive_unify_map new_map;
+        new_map.capacity  = map->capacity ? 2 * map->capacity : OTF2_ARCHIVE_UNIFY_BUCKETS;
+        new_map.size      = map->size;
+        new_map.local_ids = malloc( new_map.capacity * sizeof( *new_map.local_ids ) );
+        new_map.entries   = malloc( new_map.capacity * sizeof( *new_map.entries ) );
+        if ( !new_map.local_ids || !new_map.entries )
+        {
+            free( new_map.local_ids );
+            free( new_map.entries );
+            return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                                "Can't allocate mapping table." );
+        }
+        memset( new_map.local_ids, 0xff, new_map.capacity * sizeof( *new_map.local_ids ) );
+
+        for ( uint64_t i = 0; i < map->capacity; i++ )
+        {
+            if ( map->local_ids[ i ] == OTF2_UNDEFINED_UINT64 )
+            {
+                continue;
+            }
+            uint64_t slot = otf2_archive_unify_map_slot( &new_map, map->local_ids[ i ] );
+            while ( new_map.local_ids[ slot ] != OTF2_UNDEFINED_UINT64 )
+            {
+                slot = ( slot + 1 ) & ( new_map.capacity - 1 );
+            }
+            new_map.local_ids[ slot ] = map->local_ids[ i ];
+            new_map.entries[ slot ]   = map->entries[ i ];
+        }
+
+        free( map->local_ids );
+        free( map->entries );
+        *map = new_map;
+    }
+
+    uint64_t slot = otf2_archive_unify_map_slot( map, localId );
+    while ( map->local_ids[ slot ] != OTF2_UNDEFINED_UINT64 )
+    {
+        if ( map->local_ids[ slot ] == localId )
+        {
+            return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                                "Duplicate local definition %" PRIu64 ".",
+                                localId );
+        }
+        slot = ( slot + 1 ) & ( map->capacity - 1 );
+    }
+    map->local_ids[ slot ] = localId;
+    map->entries[ slot ]   = entry;
+    map->size++;
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Get a key buffer of the location with at least @a length
+ *  elements. */
+static uint64_t*
+otf2_archive_unify_get_key( otf2_archive_unify_location* location,
+                            uint64_t                     length )
+{
+    if ( length > location->key_capacity )
+    {
+        uint64_t* key = realloc( location->key, length * sizeof( *key ) );
+        if ( !key )
+        {
+            UTILS_ERROR( OTF2_ERROR_MEM_FAULT, "Can't allocate key buffer." );
+            return NULL;
+        }
+        location->key          = key;
+        location->key_capacity = length;
+    }
+
+    return location->key;
+}
+
+
+/** @brief Map a local reference of the location to a key element.
+ *
+ *  The key element is the address of the unified definition, or 0 for the
+ *  undefined reference. otf2_archive_unify_resolve() turns it into the
+ *  global identifier.
+ */
+static bool
+otf2_archive_unify_map_reference( otf2_archive_unify_location* location,
+                                  uint32_t                     definitionClass,
+                                  uint64_t                     localId,
+                                  uint64_t                     undefined,
+                                  uint64_t*                    reference )
+{
+    if ( localId == undefined )
+    {
+        *reference = 0;
+        return true;
+    }
+
+    otf2_archive_unify_entry* entry;
+    if ( otf2_archive_unify_map_lookup( &location->maps[ definitionClass ],
+                                        localId,
+                                        &entry ) )
+    {
+        *reference = ( uintptr_t )entry;
+        return true;
+    }
+
+    location->status = UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                                    "Reference to unknown local definition %" PRIu64
+                                    " in location %" PRIu64 ".",
+                                    localId, location->location );
+    return false;
+}
+
+
+/** @brief Unify the definition described by the key and map the local
+ *  identifier to the unified definition. */
+static OTF2_CallbackCode
+otf2_archive_unify_definition( otf2_archive_unify_location* location,
+                               uint32_t                     definitionClass,
+                               uint64_t                     localId,
+                               const void*                  key,
+                               uint32_t                     keyLength )
+{
+    otf2_archive_unify_context* context = location->context;
+
+    otf2_archive_unify_entry* entry;
+    location->status = otf2_archive_unify_table_insert( context->archive,
+                                                        &context->tables[ definitionClass ],
+                                                        key,
+                                                        keyLength,
+                                                        &entry );
+    if ( OTF2_SUCCESS != location->status )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    location->status = otf2_archive_unify_map_insert( &location->maps[ definitionClass ],
+                                                      localId,
+                                                      entry );
+
+    return OTF2_SUCCESS == location->status
+           ? OTF2_CALLBACK_SUCCESS
+           : OTF2_CALLBACK_ERROR;
+}
+
+
+/** @brief Pass a definition described by the key through, equal
+ *  definitions of all locations are written only once. */
+static OTF2_CallbackCode
+otf2_archive_unify_pass_through( otf2_archive_unify_location* location,
+                                 uint32_t                     definitionClass,
+                                 const void*                  key,
+                                 uint32_t                     keyLength )
+{
+    otf2_archive_unify_context* context = location->context;
+
+    otf2_archive_unify_entry* entry;
+    location->status = otf2_archive_unify_table_insert( context->archive,
+                                                        &context->tables[ definitionClass ],
+                                                        key,
+                                                        keyLength,
+                                                        &entry );
+
+    return OTF2_SUCCESS == location->status
+           ? OTF2_CALLBACK_SUCCESS
+           : OTF2_CALLBACK_ERROR;
+}
+
+
+/** @brief Widen an attribute value to a key element, references to unified
+ *  definitions are mapped with otf2_archive_unify_map_reference(). */
+static bool
+otf2_archive_unify_map_value( otf2_archive_unify_location* location,
+                              OTF2_Type                    type,
+                              OTF2_AttributeValue          value,
+                              uint64_t*                    key )
+{
+    switch ( type )
+    {
+        case OTF2_TYPE_UINT8:
+        case OTF2_TYPE_INT8:
+            *key = value.uint8;
+            return true;
+
+        case OTF2_TYPE_UINT16:
+        case OTF2_TYPE_INT16:
+            *key = value.uint16;
+            return true;
+
+        case OTF2_TYPE_UINT64:
+        case OTF2_TYPE_INT64:
+        case OTF2_TYPE_DOUBLE:
+        case OTF2_TYPE_LOCATION:
+            *key = value.uint64;
+            return true;
+
+        case OTF2_TYPE_STRING:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                                     value.stringRef, OTF2_UNDEFINED_STRING, key );
+        case OTF2_TYPE_ATTRIBUTE:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_ATTRIBUTE,
+                                                     value.attributeRef, OTF2_UNDEFINED_ATTRIBUTE, key );
+        case OTF2_TYPE_REGION:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_REGION,
+                                                     value.regionRef, OTF2_UNDEFINED_REGION, key );
+        case OTF2_TYPE_GROUP:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_GROUP,
+                                                     value.groupRef, OTF2_UNDEFINED_GROUP, key );
+        case OTF2_TYPE_METRIC:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_METRIC,
+                                                     value.metricRef, OTF2_UNDEFINED_METRIC, key );
+        case OTF2_TYPE_COMM:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_COMM,
+                                                     value.commRef, OTF2_UNDEFINED_COMM, key );
+        case OTF2_TYPE_PARAMETER:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_PARAMETER,
+                                                     value.parameterRef, OTF2_UNDEFINED_PARAMETER, key );
+        case OTF2_TYPE_RMA_WIN:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_RMA_WIN,
+                                                     value.rmaWinRef, OTF2_UNDEFINED_RMA_WIN, key );
+        case OTF2_TYPE_SOURCE_CODE_LOCATION:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_SOURCE_CODE_LOCATION,
+                                                     value.sourceCodeLocationRef, OTF2_UNDEFINED_SOURCE_CODE_LOCATION, key );
+        case OTF2_TYPE_CALLING_CONTEXT:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT,
+                                                     value.callingContextRef, OTF2_UNDEFINED_CALLING_CONTEXT, key );
+        case OTF2_TYPE_INTERRUPT_GENERATOR:
+            return otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_INTERRUPT_GENERATOR,
+                                                     value.interruptGeneratorRef, OTF2_UNDEFINED_INTERRUPT_GENERATOR, key );
+
+        default:
+            *key = value.uint32;
+            return true;
+    }
+}
+
+
+/** @brief Pass a property of a definition through. */
+static OTF2_CallbackCode
+otf2_archive_unify_property( otf2_archive_unify_location* location,
+                             uint32_t                     definitionClass,
+                             uint64_t                     owner,
+                             OTF2_StringRef               name,
+                             OTF2_Type                    type,
+                             OTF2_AttributeValue          value )
+{
+    uint64_t key[ 4 ];
+    key[ 0 ] = owner;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 1 ] )
+         || !otf2_archive_unify_map_value( location, type, value, &key[ 3 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 2 ] = type;
+
+    return otf2_archive_unify_pass_through( location,
+                                            definitionClass,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_string_cb( void*          userData,
+                              OTF2_StringRef self,
+                              const char*    string )
+{
+    return otf2_archive_unify_definition( userData,
+                                          OTF2_ARCHIVE_UNIFY_STRING,
+                                          self,
+                                          string,
+                                          strlen( string ) + 1 );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_region_cb( void*           userData,
+                              OTF2_RegionRef  self,
+                              OTF2_StringRef  name,
+                              OTF2_StringRef  canonicalName,
+                              OTF2_StringRef  description,
+                              OTF2_RegionRole regionRole,
+                              OTF2_Paradigm   paradigm,
+                              OTF2_RegionFlag regionFlags,
+                              OTF2_StringRef  sourceFile,
+                              uint32_t        beginLineNumber,
+                              uint32_t        endLineNumber )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 9 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 0 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                               canonicalName, OTF2_UNDEFINED_STRING, &key[ 1 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                               description, OTF2_UNDEFINED_STRING, &key[ 2 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                               sourceFile, OTF2_UNDEFINED_STRING, &key[ 3 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 4 ] = regionRole;
+    key[ 5 ] = paradigm;
+    key[ 6 ] = regionFlags;
+    key[ 7 ] = beginLineNumber;
+    key[ 8 ] = endLineNumber;
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_REGION,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_group_cb( void*           userData,
+                             OTF2_GroupRef   self,
+                             OTF2_StringRef  name,
+                             OTF2_GroupType  groupType,
+                             OTF2_Paradigm   paradigm,
+                             OTF2_GroupFlag  groupFlags,
+                             uint32_t        numberOfMembers,
+                             const uint64_t* members )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t* key = otf2_archive_unify_get_key( location, 5 + ( uint64_t )numberOfMembers );
+    if ( !key )
+    {
+        location->status = OTF2_ERROR_MEM_FAULT;
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 0 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 1 ] = groupType;
+    key[ 2 ] = paradigm;
+    key[ 3 ] = groupFlags;
+    key[ 4 ] = numberOfMembers;
+
+    /* Only the members of region groups are local definitions, the others
+     * are locations, ranks, or metrics. */
+    for ( uint32_t i = 0; i < numberOfMembers; i++ )
+    {
+        if ( groupType != OTF2_GROUP_TYPE_REGIONS )
+        {
+            key[ 5 + i ] = members[ i ];
+        }
+        else if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_REGION,
+                                                     members[ i ], OTF2_UNDEFINED_REGION,
+                                                     &key[ 5 + i ] ) )
+        {
+            return OTF2_CALLBACK_ERROR;
+        }
+    }
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_GROUP,
+                                          self,
+                                          key,
+                                          ( 5 + numberOfMembers ) * sizeof( *key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_comm_cb( void*          userData,
+                            OTF2_CommRef   self,
+                            OTF2_StringRef name,
+                            OTF2_GroupRef  group,
+                            OTF2_CommRef   parent )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 3 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 0 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_GROUP,
+                                               group, OTF2_UNDEFINED_GROUP, &key[ 1 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_COMM,
+                                               parent, OTF2_UNDEFINED_COMM, &key[ 2 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_COMM,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_source_code_location_cb( void*                      userData,
+                                            OTF2_SourceCodeLocationRef self,
+                                            OTF2_StringRef             file,
+                                            uint32_t                   lineNumber )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 2 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            file, OTF2_UNDEFINED_STRING, &key[ 0 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 1 ] = lineNumber;
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_SOURCE_CODE_LOCATION,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_calling_context_cb( void*                      userData,
+                                       OTF2_CallingContextRef     self,
+                                       OTF2_RegionRef             region,
+                                       OTF2_SourceCodeLocationRef sourceCodeLocation,
+                                       OTF2_CallingContextRef     parent )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 3 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_REGION,
+                                            region, OTF2_UNDEFINED_REGION, &key[ 0 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_SOURCE_CODE_LOCATION,
+                                               sourceCodeLocation, OTF2_UNDEFINED_SOURCE_CODE_LOCATION, &key[ 1 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT,
+                                               parent, OTF2_UNDEFINED_CALLING_CONTEXT, &key[ 2 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_attribute_cb( void*             userData,
+                                 OTF2_AttributeRef self,
+                                 OTF2_StringRef    name,
+                                 OTF2_StringRef    description,
+                                 OTF2_Type         type )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 3 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 0 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                               description, OTF2_UNDEFINED_STRING, &key[ 1 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 2 ] = type;
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_ATTRIBUTE,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_parameter_cb( void*              userData,
+                                 OTF2_ParameterRef  self,
+                                 OTF2_StringRef     name,
+                                 OTF2_ParameterType parameterType )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 2 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 0 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 1 ] = parameterType;
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_PARAMETER,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_rma_win_cb( void*          userData,
+                               OTF2_RmaWinRef self,
+                               OTF2_StringRef name,
+                               OTF2_CommRef   comm )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 2 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 0 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_COMM,
+                                               comm, OTF2_UNDEFINED_COMM, &key[ 1 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_RMA_WIN,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_interrupt_generator_cb( void*                       userData,
+                                           OTF2_InterruptGeneratorRef  self,
+                                           OTF2_StringRef              name,
+                                           OTF2_InterruptGeneratorMode interruptGeneratorMode,
+                                           OTF2_Base                   base,
+                                           int64_t                     exponent,
+                                           uint64_t                    period )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 5 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 0 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 1 ] = interruptGeneratorMode;
+    key[ 2 ] = base;
+    key[ 3 ] = ( uint64_t )exponent;
+    key[ 4 ] = period;
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_INTERRUPT_GENERATOR,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_metric_member_cb( void*                userData,
+                                     OTF2_MetricMemberRef self,
+                                     OTF2_StringRef       name,
+                                     OTF2_StringRef       description,
+                                     OTF2_MetricType      metricType,
+                                     OTF2_MetricMode      metricMode,
+                                     OTF2_Type            valueType,
+                                     OTF2_Base            base,
+                                     int64_t              exponent,
+                                     OTF2_StringRef       unit )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 8 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 0 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                               description, OTF2_UNDEFINED_STRING, &key[ 1 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                               unit, OTF2_UNDEFINED_STRING, &key[ 7 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 2 ] = metricType;
+    key[ 3 ] = metricMode;
+    key[ 4 ] = valueType;
+    key[ 5 ] = base;
+    key[ 6 ] = ( uint64_t )exponent;
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_METRIC_MEMBER,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_metric_class_cb( void*                       userData,
+                                    OTF2_MetricRef              self,
+                                    uint8_t                     numberOfMetrics,
+                                    const OTF2_MetricMemberRef* metricMembers,
+                                    OTF2_MetricOccurrence       metricOccurrence,
+                                    OTF2_RecorderKind           recorderKind )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 4 + UINT8_MAX ];
+    key[ 0 ] = OTF2_ARCHIVE_UNIFY_METRIC_CLASS;
+    key[ 1 ] = metricOccurrence;
+    key[ 2 ] = recorderKind;
+    key[ 3 ] = numberOfMetrics;
+    for ( uint8_t i = 0; i < numberOfMetrics; i++ )
+    {
+        if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_METRIC_MEMBER,
+                                                metricMembers[ i ], OTF2_UNDEFINED_METRIC_MEMBER,
+                                                &key[ 4 + i ] ) )
+        {
+            return OTF2_CALLBACK_ERROR;
+        }
+    }
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_METRIC,
+                                          self,
+                                          key,
+                                          ( 4 + numberOfMetrics ) * sizeof( *key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_metric_instance_cb( void*            userData,
+                                       OTF2_MetricRef   self,
+                                       OTF2_MetricRef   metricClass,
+                                       OTF2_LocationRef recorder,
+                                       OTF2_MetricScope metricScope,
+                                       uint64_t         scope )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 5 ];
+    key[ 0 ] = OTF2_ARCHIVE_UNIFY_METRIC_INSTANCE;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_METRIC,
+                                            metricClass, OTF2_UNDEFINED_METRIC, &key[ 1 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 2 ] = recorder;
+    key[ 3 ] = metricScope;
+
+    /* Only groups are local definitions, the other scopes are global. */
+    key[ 4 ] = scope;
+    if ( metricScope == OTF2_SCOPE_GROUP
+         && !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_GROUP,
+                                               scope, OTF2_UNDEFINED_GROUP, &key[ 4 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    return otf2_archive_unify_definition( location,
+                                          OTF2_ARCHIVE_UNIFY_METRIC,
+                                          self,
+                                          key,
+                                          sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_system_tree_node_cb( void*                  userData,
+                                        OTF2_SystemTreeNodeRef self,
+                                        OTF2_StringRef         name,
+                                        OTF2_StringRef         className,
+                                        OTF2_SystemTreeNodeRef parent )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 4 ];
+    key[ 0 ] = self;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 1 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                               className, OTF2_UNDEFINED_STRING, &key[ 2 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 3 ] = parent;
+
+    return otf2_archive_unify_pass_through( location,
+                                            OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_location_group_cb( void*                  userData,
+                                      OTF2_LocationGroupRef  self,
+                                      OTF2_StringRef         name,
+                                      OTF2_LocationGroupType locationGroupType,
+                                      OTF2_SystemTreeNodeRef systemTreeParent )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 4 ];
+    key[ 0 ] = self;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 1 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 2 ] = locationGroupType;
+    key[ 3 ] = systemTreeParent;
+
+    return otf2_archive_unify_pass_through( location,
+                                            OTF2_ARCHIVE_UNIFY_LOCATION_GROUP,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_location_cb( void*                 userData,
+                                OTF2_LocationRef      self,
+                                OTF2_StringRef        name,
+                                OTF2_LocationType     locationType,
+                                uint64_t              numberOfEvents,
+                                OTF2_LocationGroupRef locationGroup )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 5 ];
+    key[ 0 ] = self;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 1 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 2 ] = locationType;
+    key[ 3 ] = numberOfEvents;
+    key[ 4 ] = locationGroup;
+
+    return otf2_archive_unify_pass_through( location,
+                                            OTF2_ARCHIVE_UNIFY_LOCATION,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_callsite_cb( void*            userData,
+                                OTF2_CallsiteRef self,
+                                OTF2_StringRef   sourceFile,
+                                uint32_t         lineNumber,
+                                OTF2_RegionRef   enteredRegion,
+                                OTF2_RegionRef   leftRegion )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 5 ];
+    key[ 0 ] = self;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            sourceFile, OTF2_UNDEFINED_STRING, &key[ 1 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_REGION,
+                                               enteredRegion, OTF2_UNDEFINED_REGION, &key[ 3 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_REGION,
+                                               leftRegion, OTF2_UNDEFINED_REGION, &key[ 4 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 2 ] = lineNumber;
+
+    return otf2_archive_unify_pass_through( location,
+                                            OTF2_ARCHIVE_UNIFY_CALLSITE,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_callpath_cb( void*            userData,
+                                OTF2_CallpathRef self,
+                                OTF2_CallpathRef parent,
+                                OTF2_RegionRef   region )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 3 ];
+    key[ 0 ] = self;
+    key[ 1 ] = parent;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_REGION,
+                                            region, OTF2_UNDEFINED_REGION, &key[ 2 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    return otf2_archive_unify_pass_through( location,
+                                            OTF2_ARCHIVE_UNIFY_CALLPATH,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_cart_dimension_cb( void*                 userData,
+                                      OTF2_CartDimensionRef self,
+                                      OTF2_StringRef        name,
+                                      uint32_t              size,
+                                      OTF2_CartPeriodicity  cartPeriodicity )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 4 ];
+    key[ 0 ] = self;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 1 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 2 ] = size;
+    key[ 3 ] = cartPeriodicity;
+
+    return otf2_archive_unify_pass_through( location,
+                                            OTF2_ARCHIVE_UNIFY_CART_DIMENSION,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_cart_topology_cb( void*                        userData,
+                                     OTF2_CartTopologyRef         self,
+                                     OTF2_StringRef               name,
+                                     OTF2_CommRef                 communicator,
+                                     uint8_t                      numberOfDimensions,
+                                     const OTF2_CartDimensionRef* cartDimensions )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 4 + UINT8_MAX ];
+    key[ 0 ] = self;
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_STRING,
+                                            name, OTF2_UNDEFINED_STRING, &key[ 1 ] )
+         || !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_COMM,
+                                               communicator, OTF2_UNDEFINED_COMM, &key[ 2 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 3 ] = numberOfDimensions;
+    for ( uint8_t i = 0; i < numberOfDimensions; i++ )
+    {
+        key[ 4 + i ] = cartDimensions[ i ];
+    }
+
+    return otf2_archive_unify_pass_through( location,
+                                            OTF2_ARCHIVE_UNIFY_CART_TOPOLOGY,
+                                            key,
+                                            ( 4 + numberOfDimensions ) * sizeof( *key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_metric_class_recorder_cb( void*            userData,
+                                             OTF2_MetricRef   metricClass,
+                                             OTF2_LocationRef recorder )
+{
+    otf2_archive_unify_location* location = userData;
+
+    uint64_t key[ 2 ];
+    if ( !otf2_archive_unify_map_reference( location, OTF2_ARCHIVE_UNIFY_METRIC,
+                                            metricClass, OTF2_UNDEFINED_METRIC, &key[ 0 ] ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+    key[ 1 ] = recorder;
+
+    return otf2_archive_unify_pass_through( location,
+                                            OTF2_ARCHIVE_UNIFY_METRIC_CLASS_RECORDER,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_system_tree_node_property_cb( void*                  userData,
+                                                 OTF2_SystemTreeNodeRef systemTreeNode,
+                                                 OTF2_StringRef         name,
+                                                 OTF2_Type              type,
+                                                 OTF2_AttributeValue    value )
+{
+    return otf2_archive_unify_property( userData,
+                                        OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE_PROPERTY,
+                                        systemTreeNode,
+                                        name,
+                                        type,
+                                        value );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_system_tree_node_domain_cb( void*                  userData,
+                                               OTF2_SystemTreeNodeRef systemTreeNode,
+                                               OTF2_SystemTreeDomain  systemTreeDomain )
+{
+    uint64_t key[ 2 ];
+    key[ 0 ] = systemTreeNode;
+    key[ 1 ] = systemTreeDomain;
+
+    return otf2_archive_unify_pass_through( userData,
+                                            OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE_DOMAIN,
+                                            key,
+                                            sizeof( key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_location_group_property_cb( void*                 userData,
+                                               OTF2_LocationGroupRef locationGroup,
+                                               OTF2_StringRef        name,
+                                               OTF2_Type             type,
+                                               OTF2_AttributeValue   value )
+{
+    return otf2_archive_unify_property( userData,
+                                        OTF2_ARCHIVE_UNIFY_LOCATION_GROUP_PROPERTY,
+                                        locationGroup,
+                                        name,
+                                        type,
+                                        value );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_location_property_cb( void*               userData,
+                                         OTF2_LocationRef    location,
+                                         OTF2_StringRef      name,
+                                         OTF2_Type           type,
+                                         OTF2_AttributeValue value )
+{
+    return otf2_archive_unify_property( userData,
+                                        OTF2_ARCHIVE_UNIFY_LOCATION_PROPERTY,
+                                        location,
+                                        name,
+                                        type,
+                                        value );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_cart_coordinate_cb( void*                userData,
+                                       OTF2_CartTopologyRef cartTopology,
+                                       uint32_t             rank,
+                                       uint8_t              numberOfDimensions,
+                                       const uint32_t*      coordinates )
+{
+    uint64_t key[ 3 + UINT8_MAX ];
+    key[ 0 ] = cartTopology;
+    key[ 1 ] = rank;
+    key[ 2 ] = numberOfDimensions;
+    for ( uint8_t i = 0; i < numberOfDimensions; i++ )
+    {
+        key[ 3 + i ] = coordinates[ i ];
+    }
+
+    return otf2_archive_unify_pass_through( userData,
+                                            OTF2_ARCHIVE_UNIFY_CART_COORDINATE,
+                                            key,
+                                            ( 3 + numberOfDimensions ) * sizeof( *key ) );
+}
+
+
+static OTF2_CallbackCode
+otf2_archive_unify_calling_context_property_cb( void*                  userData,
+                                                OTF2_CallingContextRef callingContext,
+                                                OTF2_StringRef         name,
+                                                OTF2_Type              type,
+                                                OTF2_AttributeValue    value )
+{
+    uint64_t owner;
+    if ( !otf2_archive_unify_map_reference( userData, OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT,
+                                            callingContext, OTF2_UNDEFINED_CALLING_CONTEXT,
+                                            &owner ) )
+    {
+        return OTF2_CALLBACK_ERROR;
+    }
+
+    return otf2_archive_unify_property( userData,
+                                        OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT_PROPERTY,
+                                        owner,
+                                        name,
+                                        type,
+                                        value );
+}
+
+
+/** @brief OTF2_Parallel_Task to read the local definitions of one
+ *  location. */
+static void
+otf2_archive_unify_location_task( void*    taskData,
+                                  uint32_t taskIndex )
+{
+    otf2_archive_unify_context*  context  = taskData;
+    otf2_archive_unify_location* location = &context->locations[ taskIndex ];
+
+    location->done = true;
+
+    OTF2_DefReader* def_reader = OTF2_Archive_GetDefReader( context->archive,
+                                                            location->location );
+    if ( !def_reader )
+    {
+        location->status = UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                                        "Can't open definition reader for location %" PRIu64 ".",
+                                        location->location );
+        return;
+    }
+
+    OTF2_ErrorCode status = OTF2_DefReader_SetCallbacks( def_reader,
+                                                         context->callbacks,
+                                                         location );
+    if ( OTF2_SUCCESS == status )
+    {
+        uint64_t definitions_read;
+        status = OTF2_DefReader_ReadDefinitions( def_reader,
+                                                 OTF2_UNDEFINED_UINT64,
+                                                 &definitions_read );
+    }
+    if ( OTF2_SUCCESS != status && OTF2_SUCCESS == location->status )
+    {
+        location->status = status;
+    }
+
+    status = OTF2_Archive_CloseDefReader( context->archive, def_reader );
+    if ( OTF2_SUCCESS != status && OTF2_SUCCESS == location->status )
+    {
+        location->status = status;
+    }
+}
+
+
+/** @brief A local identifier and its unified definition. */
+typedef struct otf2_archive_unify_pair
+{
+    uint64_t                  local_id;
+    otf2_archive_unify_entry* entry;
+} otf2_archive_unify_pair;
+
+
+static int
+otf2_archive_unify_compare_pairs( const void* a,
+                                  const void* b )
+{
+    const otf2_archive_unify_pair* pair_a = a;
+    const otf2_archive_unify_pair* pair_b = b;
+
+    return ( pair_a->local_id > pair_b->local_id ) - ( pair_a->local_id < pair_b->local_id );
+}
+
+
+/** @brief Get the pairs of a non-empty map, sorted by the local
+ *  identifiers. */
+static otf2_archive_unify_pair*
+otf2_archive_unify_map_pairs( const otf2_archive_unify_map* map )
+{
+    otf2_archive_unify_pair* pairs = malloc( map->size * sizeof( *pairs ) );
+    if ( !pairs )
+    {
+        UTILS_ERROR( OTF2_ERROR_MEM_FAULT, "Can't allocate mapping table." );
+        return NULL;
+    }
+
+    uint64_t number_of_pairs = 0;
+    for ( uint64_t i = 0; i < map->capacity; i++ )
+    {
+        if ( map->local_ids[ i ] == OTF2_UNDEFINED_UINT64 )
+        {
+            continue;
+        }
+        pairs[ number_of_pairs ].local_id = map->local_ids[ i ];
+        pairs[ number_of_pairs ].entry    = map->entries[ i ];
+        number_of_pairs++;
+    }
+    qsort( pairs, number_of_pairs, sizeof( *pairs ), otf2_archive_unify_compare_pairs );
+
+    return pairs;
+}
+
+
+/** @brief The definition of the same class, which a unified definition
+ *  references and which must get its global identifier first. */
+static otf2_archive_unify_entry*
+otf2_archive_unify_parent( uint32_t                        definitionClass,
+                           const otf2_archive_unify_entry* entry )
+{
+    switch ( definitionClass )
+    {
+        case OTF2_ARCHIVE_UNIFY_COMM:
+        case OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT:
+            return ( otf2_archive_unify_entry* )( uintptr_t )entry->key[ 2 ];
+
+        case OTF2_ARCHIVE_UNIFY_METRIC:
+            if ( entry->key[ 0 ] == OTF2_ARCHIVE_UNIFY_METRIC_INSTANCE )
+            {
+                return ( otf2_archive_unify_entry* )( uintptr_t )entry->key[ 1 ];
+            }
+            return NULL;
+
+        default:
+            return NULL;
+    }
+}
+
+
+/** @brief Assign the next global identifiers to a unified definition and
+ *  to its parents without one, the parents first. */
+static void
+otf2_archive_unify_assign_id( otf2_archive_unify_table* table,
+                              uint32_t                  definitionClass,
+                              otf2_archive_unify_entry* entry )
+{
+    uint64_t depth = 0;
+    for ( otf2_archive_unify_entry* parent = entry;
+          parent && parent->global_id == OTF2_UNDEFINED_UINT64;
+          parent = otf2_archive_unify_parent( definitionClass, parent ) )
+    {
+        depth++;
+    }
+
+    table->number_of_entries += depth;
+    uint64_t global_id = table->number_of_entries;
+    for ( ; depth > 0; depth-- )
+    {
+        entry->global_id             = --global_id;
+        table->entries[ global_id ] = entry;
+        entry                        = otf2_archive_unify_parent( definitionClass, entry );
+    }
+}
+
+
+/** @brief Replace a reference in a key by the global identifier. */
+static void
+otf2_archive_unify_resolve( uint64_t* reference,
+                            uint64_t  undefined )
+{
+    *reference = *reference
+                 ? ( ( const otf2_archive_unify_entry* )( uintptr_t )*reference )->global_id
+                 : undefined;
+}
+
+
+/** @brief Replace a key element widened by otf2_archive_unify_map_value()
+ *  by the global identifier, if it is a reference. */
+static void
+otf2_archive_unify_resolve_value( OTF2_Type type,
+                                  uint64_t* key )
+{
+    switch ( type )
+    {
+        case OTF2_TYPE_STRING:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_STRING );
+            break;
+        case OTF2_TYPE_ATTRIBUTE:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_ATTRIBUTE );
+            break;
+        case OTF2_TYPE_REGION:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_REGION );
+            break;
+        case OTF2_TYPE_GROUP:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_GROUP );
+            break;
+        case OTF2_TYPE_METRIC:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_METRIC );
+            break;
+        case OTF2_TYPE_COMM:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_COMM );
+            break;
+        case OTF2_TYPE_PARAMETER:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_PARAMETER );
+            break;
+        case OTF2_TYPE_RMA_WIN:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_RMA_WIN );
+            break;
+        case OTF2_TYPE_SOURCE_CODE_LOCATION:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_SOURCE_CODE_LOCATION );
+            break;
+        case OTF2_TYPE_CALLING_CONTEXT:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_CALLING_CONTEXT );
+            break;
+        case OTF2_TYPE_INTERRUPT_GENERATOR:
+            otf2_archive_unify_resolve( key, OTF2_UNDEFINED_INTERRUPT_GENERATOR );
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+/** @brief Replace the references in the key of a definition by the global
+ *  identifiers, see the callbacks for the key layouts. */
+static void
+otf2_archive_unify_resolve_key( uint32_t  definitionClass,
+                                uint64_t* key )
+{
+    switch ( definitionClass )
+    {
+        case OTF2_ARCHIVE_UNIFY_REGION:
+            for ( uint32_t i = 0; i < 4; i++ )
+            {
+                otf2_archive_unify_resolve( &key[ i ], OTF2_UNDEFINED_STRING );
+            }
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_GROUP:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_STRING );
+            for ( uint64_t i = 0; key[ 1 ] == OTF2_GROUP_TYPE_REGIONS && i < key[ 4 ]; i++ )
+            {
+                otf2_archive_unify_resolve( &key[ 5 + i ], OTF2_UNDEFINED_REGION );
+            }
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_COMM:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_GROUP );
+            otf2_archive_unify_resolve( &key[ 2 ], OTF2_UNDEFINED_COMM );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_SOURCE_CODE_LOCATION:
+        case OTF2_ARCHIVE_UNIFY_PARAMETER:
+        case OTF2_ARCHIVE_UNIFY_INTERRUPT_GENERATOR:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_STRING );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_REGION );
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_SOURCE_CODE_LOCATION );
+            otf2_archive_unify_resolve( &key[ 2 ], OTF2_UNDEFINED_CALLING_CONTEXT );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_ATTRIBUTE:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_STRING );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_RMA_WIN:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_COMM );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_METRIC_MEMBER:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve( &key[ 7 ], OTF2_UNDEFINED_STRING );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_METRIC:
+            if ( key[ 0 ] == OTF2_ARCHIVE_UNIFY_METRIC_INSTANCE )
+            {
+                otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_METRIC );
+                if ( key[ 3 ] == OTF2_SCOPE_GROUP )
+                {
+                    otf2_archive_unify_resolve( &key[ 4 ], OTF2_UNDEFINED_GROUP );
+                }
+                break;
+            }
+            for ( uint64_t i = 0; i < key[ 3 ]; i++ )
+            {
+                otf2_archive_unify_resolve( &key[ 4 + i ], OTF2_UNDEFINED_METRIC_MEMBER );
+            }
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE:
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve( &key[ 2 ], OTF2_UNDEFINED_STRING );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_LOCATION_GROUP:
+        case OTF2_ARCHIVE_UNIFY_LOCATION:
+        case OTF2_ARCHIVE_UNIFY_CART_DIMENSION:
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_STRING );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_CALLSITE:
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve( &key[ 3 ], OTF2_UNDEFINED_REGION );
+            otf2_archive_unify_resolve( &key[ 4 ], OTF2_UNDEFINED_REGION );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_CALLPATH:
+            otf2_archive_unify_resolve( &key[ 2 ], OTF2_UNDEFINED_REGION );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_CART_TOPOLOGY:
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve( &key[ 2 ], OTF2_UNDEFINED_COMM );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_METRIC_CLASS_RECORDER:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_METRIC );
+            break;
+
+        case OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT_PROPERTY:
+            otf2_archive_unify_resolve( &key[ 0 ], OTF2_UNDEFINED_CALLING_CONTEXT );
+            /* fall through */
+        case OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE_PROPERTY:
+        case OTF2_ARCHIVE_UNIFY_LOCATION_GROUP_PROPERTY:
+        case OTF2_ARCHIVE_UNIFY_LOCATION_PROPERTY:
+            otf2_archive_unify_resolve( &key[ 1 ], OTF2_UNDEFINED_STRING );
+            otf2_archive_unify_resolve_value( key[ 2 ], &key[ 3 ] );
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+/** @brief Assign the global identifiers, after all locations were read.
+ *
+ *  The unified definitions get their identifiers in the order of the
+ *  locations and, per location, of the local identifiers. Thus they do not
+ *  depend on the order in which the threads read the locations. Afterwards,
+ *  the references in all keys are resolved to the global identifiers.
+ */
+static OTF2_ErrorCode
+otf2_archive_unify_assign_ids( otf2_archive_unify_context* context,
+                               uint32_t                    numberOfLocations )
+{
+    for ( uint32_t i = 0; i < OTF2_ARCHIVE_UNIFY_ALL; i++ )
+    {
+        otf2_archive_unify_table* table             = &context->tables[ i ];
+        uint64_t                  number_of_entries = 0;
+        for ( uint32_t j = 0; j < OTF2_ARCHIVE_UNIFY_STRIPES; j++ )
+        {
+            number_of_entries += table->stripes[ j ].number_of_entries;
+        }
+        if ( 0 == number_of_entries )
+        {
+            continue;
+        }
+
+        /* All references are 32 bit wide, thus the global identifiers must
+         * fit into them and be distinct from the undefined value. */
+        if ( i < OTF2_ARCHIVE_UNIFY_MAX && number_of_entries > OTF2_UNDEFINED_UINT32 )
+        {
+            return UTILS_ERROR( OTF2_ERROR_INDEX_OUT_OF_BOUNDS,
+                                "Too many unified definitions." );
+        }
+        table->entries = malloc( number_of_entries * sizeof( *table->entries ) );
+        if ( !table->entries )
+        {
+            return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                                "Can't allocate unified definitions." );
+        }
+
+        /* The passed definitions are sorted by their keys later. */
+        for ( uint32_t j = 0; j < OTF2_ARCHIVE_UNIFY_STRIPES; j++ )
+        {
+            const otf2_archive_unify_stripe* stripe = &table->stripes[ j ];
+            for ( uint32_t k = 0; k < stripe->number_of_buckets; k++ )
+            {
+                for ( otf2_archive_unify_entry* entry = stripe->buckets[ k ]; entry; entry = entry->next )
+                {
+                    entry->global_id = OTF2_UNDEFINED_UINT64;
+                    if ( i >= OTF2_ARCHIVE_UNIFY_MAX )
+                    {
+                        table->entries[ table->number_of_entries++ ] = entry;
+                    }
+                }
+            }
+        }
+        if ( i >= OTF2_ARCHIVE_UNIFY_MAX )
+        {
+            continue;
+        }
+
+        for ( uint32_t j = 0; j < numberOfLocations; j++ )
+        {
+            const otf2_archive_unify_map* map = &context->locations[ j ].maps[ i ];
+            if ( 0 == map->size )
+            {
+                continue;
+            }
+
+            otf2_archive_unify_pair* pairs = otf2_archive_unify_map_pairs( map );
+            if ( !pairs )
+            {
+                return OTF2_ERROR_MEM_FAULT;
+            }
+            for ( uint64_t k = 0; k < map->size; k++ )
+            {
+                otf2_archive_unify_assign_id( table, i, pairs[ k ].entry );
+            }
+            free( pairs );
+        }
+        /* Each unified definition was mapped from some location. */
+        UTILS_ASSERT( table->number_of_entries == number_of_entries );
+    }
+
+    for ( uint32_t i = 0; i < OTF2_ARCHIVE_UNIFY_ALL; i++ )
+    {
+        otf2_archive_unify_table* table = &context->tables[ i ];
+        for ( uint64_t j = 0; j < table->number_of_entries; j++ )
+        {
+            otf2_archive_unify_resolve_key( i, table->entries[ j ]->key );
+        }
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Write the unified definitions in the order of their global
+ *  identifiers. */
+static OTF2_ErrorCode
+otf2_archive_unify_write_definitions( otf2_archive_unify_context* context,
+                                      OTF2_GlobalDefWriter*       globalDefWriter )
+{
+    OTF2_ErrorCode            status = OTF2_SUCCESS;
+    otf2_archive_unify_table* table;
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_STRING ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        status = OTF2_GlobalDefWriter_WriteString( globalDefWriter,
+                                                   i,
+                                                   ( const char* )table->entries[ i ]->key );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_REGION ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteRegion( globalDefWriter,
+                                                   i,
+                                                   key[ 0 ],
+                                                   key[ 1 ],
+                                                   key[ 2 ],
+                                                   key[ 4 ],
+                                                   key[ 5 ],
+                                                   key[ 6 ],
+                                                   key[ 3 ],
+                                                   key[ 7 ],
+                                                   key[ 8 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_GROUP ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteGroup( globalDefWriter,
+                                                  i,
+                                                  key[ 0 ],
+                                                  key[ 1 ],
+                                                  key[ 2 ],
+                                                  key[ 3 ],
+                                                  key[ 4 ],
+                                                  &key[ 5 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_COMM ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteComm( globalDefWriter,
+                                                 i,
+                                                 key[ 0 ],
+                                                 key[ 1 ],
+                                                 key[ 2 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_SOURCE_CODE_LOCATION ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteSourceCodeLocation( globalDefWriter,
+                                                               i,
+                                                               key[ 0 ],
+                                                               key[ 1 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteCallingContext( globalDefWriter,
+                                                           i,
+                                                           key[ 0 ],
+                                                           key[ 1 ],
+                                                           key[ 2 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_ATTRIBUTE ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteAttribute( globalDefWriter,
+                                                      i,
+                                                      key[ 0 ],
+                                                      key[ 1 ],
+                                                      key[ 2 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_PARAMETER ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteParameter( globalDefWriter,
+                                                      i,
+                                                      key[ 0 ],
+                                                      key[ 1 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_RMA_WIN ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteRmaWin( globalDefWriter,
+                                                   i,
+                                                   key[ 0 ],
+                                                   key[ 1 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_INTERRUPT_GENERATOR ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteInterruptGenerator( globalDefWriter,
+                                                               i,
+                                                               key[ 0 ],
+                                                               key[ 1 ],
+                                                               key[ 2 ],
+                                                               ( int64_t )key[ 3 ],
+                                                               key[ 4 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_METRIC_MEMBER ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        status = OTF2_GlobalDefWriter_WriteMetricMember( globalDefWriter,
+                                                         i,
+                                                         key[ 0 ],
+                                                         key[ 1 ],
+                                                         key[ 2 ],
+                                                         key[ 3 ],
+                                                         key[ 4 ],
+                                                         key[ 5 ],
+                                                         ( int64_t )key[ 6 ],
+                                                         key[ 7 ] );
+    }
+
+    table = &context->tables[ OTF2_ARCHIVE_UNIFY_METRIC ];
+    for ( uint64_t i = 0; OTF2_SUCCESS == status && i < table->number_of_entries; i++ )
+    {
+        const uint64_t* key = table->entries[ i ]->key;
+        if ( key[ 0 ] == OTF2_ARCHIVE_UNIFY_METRIC_INSTANCE )
+        {
+            status = OTF2_GlobalDefWriter_WriteMetricInstance( globalDefWriter,
+                                                               i,
+                                                               key[ 1 ],
+                                                               key[ 2 ],
+                                                               key[ 3 ],
+                                                               key[ 4 ] );
+            continue;
+        }
+
+        OTF2_MetricMemberRef members[ UINT8_MAX ];
+        for ( uint64_t j = 0; j < key[ 3 ]; j++ )
+        {
+            members[ j ] = key[ 4 + j ];
+        }
+        status = OTF2_GlobalDefWriter_WriteMetricClass( globalDefWriter,
+                                                        i,
+                                                        key[ 3 ],
+                                                        members,
+                                                        key[ 1 ],
+                                                        key[ 2 ] );
+    }
+
+    if ( OTF2_SUCCESS != status )
+    {
+        return UTILS_ERROR( status, "Can't write unified definitions." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Narrow a key element back to an attribute value. */
+static OTF2_AttributeValue
+otf2_archive_unify_value( OTF2_Type type,
+                          uint64_t  key )
+{
+    OTF2_AttributeValue value;
+    switch ( type )
+    {
+        case OTF2_TYPE_UINT8:
+        case OTF2_TYPE_INT8:
+            value.uint8 = key;
+            break;
+
+        case OTF2_TYPE_UINT16:
+        case OTF2_TYPE_INT16:
+            value.uint16 = key;
+            break;
+
+        case OTF2_TYPE_UINT64:
+        case OTF2_TYPE_INT64:
+        case OTF2_TYPE_DOUBLE:
+        case OTF2_TYPE_LOCATION:
+            value.uint64 = key;
+            break;
+
+        default:
+            value.uint32 = key;
+            break;
+    }
+
+    return value;
+}
+
+
+static int
+otf2_archive_unify_compare_entries( const void* a,
+                                    const void* b )
+{
+    const otf2_archive_unify_entry* entry_a = *( otf2_archive_unify_entry* const* )a;
+    const otf2_archive_unify_entry* entry_b = *( otf2_archive_unify_entry* const* )b;
+
+    uint32_t length = entry_a->key_length < entry_b->key_length
+                      ? entry_a->key_length
+                      : entry_b->key_length;
+    for ( uint32_t i = 0; i < length / sizeof( uint64_t ); i++ )
+    {
+        if ( entry_a->key[ i ] != entry_b->key[ i ] )
+        {
+            return entry_a->key[ i ] < entry_b->key[ i ] ? -1 : 1;
+        }
+    }
+
+    return ( entry_a->key_length > entry_b->key_length ) - ( entry_a->key_length < entry_b->key_length );
+}
+
+
+/** @brief Write one definition, which is passed through. */
+static OTF2_ErrorCode
+otf2_archive_unify_write_passed( uint32_t              definitionClass,
+                                 const uint64_t*       key,
+                                 OTF2_GlobalDefWriter* globalDefWriter )
+{
+    switch ( definitionClass )
+    {
+        case OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE:
+            return OTF2_GlobalDefWriter_WriteSystemTreeNode( globalDefWriter,
+                                                             key[ 0 ],
+                                                             key[ 1 ],
+                                                             key[ 2 ],
+                                                             key[ 3 ] );
+
+        case OTF2_ARCHIVE_UNIFY_LOCATION_GROUP:
+            return OTF2_GlobalDefWriter_WriteLocationGroup( globalDefWriter,
+                                                            key[ 0 ],
+                                                            key[ 1 ],
+                                                            key[ 2 ],
+                                                            key[ 3 ] );
+
+        case OTF2_ARCHIVE_UNIFY_LOCATION:
+            return OTF2_GlobalDefWriter_WriteLocation( globalDefWriter,
+                                                       key[ 0 ],
+                                                       key[ 1 ],
+                                                       key[ 2 ],
+                                                       key[ 3 ],
+                                                       key[ 4 ] );
+
+        case OTF2_ARCHIVE_UNIFY_CALLSITE:
+            return OTF2_GlobalDefWriter_WriteCallsite( globalDefWriter,
+                                                       key[ 0 ],
+                                                       key[ 1 ],
+                                                       key[ 2 ],
+                                                       key[ 3 ],
+                                                       key[ 4 ] );
+
+        case OTF2_ARCHIVE_UNIFY_CALLPATH:
+            return OTF2_GlobalDefWriter_WriteCallpath( globalDefWriter,
+                                                       key[ 0 ],
+                                                       key[ 1 ],
+                                                       key[ 2 ] );
+
+        case OTF2_ARCHIVE_UNIFY_CART_DIMENSION:
+            return OTF2_GlobalDefWriter_WriteCartDimension( globalDefWriter,
+                                                            key[ 0 ],
+                                                            key[ 1 ],
+                                                            key[ 2 ],
+                                                            key[ 3 ] );
+
+        case OTF2_ARCHIVE_UNIFY_CART_TOPOLOGY:
+        {
+            OTF2_CartDimensionRef dimensions[ UINT8_MAX ];
+            for ( uint64_t i = 0; i < key[ 3 ]; i++ )
+            {
+                dimensions[ i ] = key[ 4 + i ];
+            }
+            return OTF2_GlobalDefWriter_WriteCartTopology( globalDefWriter,
+                                                           key[ 0 ],
+                                                           key[ 1 ],
+                                                           key[ 2 ],
+                                                           key[ 3 ],
+                                                           dimensions );
+        }
+
+        case OTF2_ARCHIVE_UNIFY_METRIC_CLASS_RECORDER:
+            return OTF2_GlobalDefWriter_WriteMetricClassRecorder( globalDefWriter,
+                                                                  key[ 0 ],
+                                                                  key[ 1 ] );
+
+        case OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE_PROPERTY:
+            return OTF2_GlobalDefWriter_WriteSystemTreeNodeProperty( globalDefWriter,
+                                                                     key[ 0 ],
+                                                                     key[ 1 ],
+                                                                     key[ 2 ],
+                                                                     otf2_archive_unify_value( key[ 2 ], key[ 3 ] ) );
+
+        case OTF2_ARCHIVE_UNIFY_SYSTEM_TREE_NODE_DOMAIN:
+            return OTF2_GlobalDefWriter_WriteSystemTreeNodeDomain( globalDefWriter,
+                                                                   key[ 0 ],
+                                                                   key[ 1 ] );
+
+        case OTF2_ARCHIVE_UNIFY_LOCATION_GROUP_PROPERTY:
+            return OTF2_GlobalDefWriter_WriteLocationGroupProperty( globalDefWriter,
+                                                                    key[ 0 ],
+                                                                    key[ 1 ],
+                                                                    key[ 2 ],
+                                                                    otf2_archive_unify_value( key[ 2 ], key[ 3 ] ) );
+
+        case OTF2_ARCHIVE_UNIFY_LOCATION_PROPERTY:
+            return OTF2_GlobalDefWriter_WriteLocationProperty( globalDefWriter,
+                                                               key[ 0 ],
+                                                               key[ 1 ],
+                                                               key[ 2 ],
+                                                               otf2_archive_unify_value( key[ 2 ], key[ 3 ] ) );
+
+        case OTF2_ARCHIVE_UNIFY_CART_COORDINATE:
+        {
+            uint32_t coordinates[ UINT8_MAX ];
+            for ( uint64_t i = 0; i < key[ 2 ]; i++ )
+            {
+                coordinates[ i ] = key[ 3 + i ];
+            }
+            return OTF2_GlobalDefWriter_WriteCartCoordinate( globalDefWriter,
+                                                             key[ 0 ],
+                                                             key[ 1 ],
+                                                             key[ 2 ],
+                                                             coordinates );
+        }
+
+        case OTF2_ARCHIVE_UNIFY_CALLING_CONTEXT_PROPERTY:
+            return OTF2_GlobalDefWriter_WriteCallingContextProperty( globalDefWriter,
+                                                                     key[ 0 ],
+                                                                     key[ 1 ],
+                                                                     key[ 2 ],
+                                                                     otf2_archive_unify_value( key[ 2 ], key[ 3 ] ) );
+    }
+
+    return UTILS_ERROR( OTF2_ERROR_INVALID_ARGUMENT,
+                        "Unknown definition class %" PRIu32 ".",
+                        definitionClass );
+}
+
+
+/** @brief Write the definitions, which are passed through, sorted by their
+ *  keys, i.e., by their identifiers.
+ *
+ *  Different definitions of all locations with the same identifier are an
+ *  error.
+ */
+static OTF2_ErrorCode
+otf2_archive_unify_write_passed_definitions( otf2_archive_unify_context* context,
+                                             OTF2_GlobalDefWriter*       globalDefWriter )
+{
+    for ( uint32_t i = OTF2_ARCHIVE_UNIFY_MAX; i < OTF2_ARCHIVE_UNIFY_ALL; i++ )
+    {
+        otf2_archive_unify_table* table = &context->tables[ i ];
+        qsort( table->entries,
+               table->number_of_entries,
+               sizeof( *table->entries ),
+               otf2_archive_unify_compare_entries );
+
+        for ( uint64_t j = 0; j < table->number_of_entries; j++ )
+        {
+            const uint64_t* key = table->entries[ j ]->key;
+            /* Only the classes before have an identifier. */
+            if ( i < OTF2_ARCHIVE_UNIFY_METRIC_CLASS_RECORDER
+                 && j > 0
+                 && table->entries[ j - 1 ]->key[ 0 ] == key[ 0 ] )
+            {
+                return UTILS_ERROR( OTF2_ERROR_INTEGRITY_FAULT,
+                                    "Conflicting local definitions with identifier %" PRIu64 ".",
+                                    key[ 0 ] );
+            }
+
+            OTF2_ErrorCode status = otf2_archive_unify_write_passed( i,
+                                                                     key,
+                                                                     globalDefWriter );
+            if ( OTF2_SUCCESS != status )
+            {
+                return UTILS_ERROR( status, "Can't write passed definitions." );
+            }
+        }
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @brief Create the most compact id map for a location.
+ *
+ *  @a idMap is NULL, if all local identifiers map to themselves.
+ */
+static OTF2_ErrorCode
+otf2_archive_unify_create_id_map( const otf2_archive_unify_map* map,
+                                  OTF2_IdMap**                  idMap )
+{
+    *idMap = NULL;
+
+    if ( 0 == map->size )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    otf2_archive_unify_pair* pairs = otf2_archive_unify_map_pairs( map );
+    if ( !pairs )
+    {
+        return OTF2_ERROR_MEM_FAULT;
+    }
+
+    uint64_t number_of_pairs    = map->size;
+    uint64_t number_of_mappings = 0;
+    for ( uint64_t i = 0; i < number_of_pairs; i++ )
+    {
+        if ( pairs[ i ].local_id != pairs[ i ].entry->global_id )
+        {
+            number_of_mappings++;
+        }
+    }
+
+    if ( 0 == number_of_mappings )
+    {
+        free( pairs );
+        return OTF2_SUCCESS;
+    }
+
+    if ( pairs[ number_of_pairs - 1 ].local_id == number_of_pairs - 1 )
+    {
+        /* The local identifiers are consecutive from 0 on, the id map
+         * chooses between the dense and the sparse mode. The array is
+         * built in place, element i overwrites only consumed pairs. */
+        uint64_t* mappings = ( uint64_t* )pairs;
+        for ( uint64_t i = 0; i < number_of_pairs; i++ )
+        {
+            mappings[ i ] = pairs[ i ].entry->global_id;
+        }
+        *idMap = OTF2_IdMap_CreateFromUint64Array( number_of_pairs, mappings, true );
+    }
+    else
+    {
+        *idMap = OTF2_IdMap_Create( OTF2_ID_MAP_SPARSE, number_of_mappings );
+        for ( uint64_t i = 0; *idMap && i < number_of_pairs; i++ )
+        {
+            if ( pairs[ i ].local_id != pairs[ i ].entry->global_id
+                 && OTF2_SUCCESS != OTF2_IdMap_AddIdPair( *idMap,
+                                                          pairs[ i ].local_id,
+                                                          pairs[ i ].entry->global_id ) )
+            {
+                OTF2_IdMap_Free( *idMap );
+                *idMap = NULL;
+            }
+        }
+    }
+    free( pairs );
+
+    if ( !*idMap )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Can't create mapping table." );
+    }
+
+    return OTF2_SUCCESS;
+}
+
+
+OTF2_ErrorCode
+otf2_archive_unify_local_definitions( OTF2_Archive*                    archive,
+                                      uint32_t                         numberOfLocations,
+                                      const OTF2_LocationRef*          locations,
+                                      OTF2_GlobalDefWriter*            globalDefWriter,
+                                      OTF2_UnifiedMappingTableCallback mappingTableCallback,
+                                      void*                            userData,
+                                      uint64_t*                        numberOfStrings )
+{
+    UTILS_ASSERT( archive );
+    UTILS_ASSERT( globalDefWriter );
+
+    OTF2_ErrorCode status = OTF2_SUCCESS;
+
+    otf2_archive_unify_context* context = calloc( 1, sizeof( *context ) );
+    if ( !context )
+    {
+        return UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                            "Can't allocate unification state." );
+    }
+    context->archive   = archive;
+    context->locations = calloc( numberOfLocations + 1, sizeof( *context->locations ) );
+    context->callbacks = OTF2_DefReaderCallbacks_New();
+    if ( !context->locations || !context->callbacks )
+    {
+        status = UTILS_ERROR( OTF2_ERROR_MEM_FAULT,
+                              "Can't allocate unification state." );
+        goto out;
+    }
+
+    for ( uint32_t i = 0; i < OTF2_ARCHIVE_UNIFY_ALL; i++ )
+    {
+        status = otf2_archive_unify_table_initialize( archive, &context->tables[ i ] );
+        if ( OTF2_SUCCESS != status )
+        {
+            goto out;
+        }
+    }
+
+    OTF2_DefReaderCallbacks_SetStringCallback( context->callbacks,
+                                               otf2_archive_unify_string_cb );
+    OTF2_DefReaderCallbacks_SetRegionCallback( context->callbacks,
+                                               otf2_archive_unify_region_cb );
+    OTF2_DefReaderCallbacks_SetGroupCallback( context->callbacks,
+                                              otf2_archive_unify_group_cb );
+    OTF2_DefReaderCallbacks_SetCommCallback( context->callbacks,
+                                             otf2_archive_unify_comm_cb );
+    OTF2_DefReaderCallbacks_SetSourceCodeLocationCallback( context->callbacks,
+                                                           otf2_archive_unify_source_code_location_cb );
+    OTF2_DefReaderCallbacks_SetCallingContextCallback( context->callbacks,
+                                                       otf2_archive_unify_calling_context_cb );
+    OTF2_DefReaderCallbacks_SetAttributeCallback( context->callbacks,
+                                                  otf2_archive_unify_attribute_cb );
+    OTF2_DefReaderCallbacks_SetParameterCallback( context->callbacks,
+                                                  otf2_archive_unify_parameter_cb );
+    OTF2_DefReaderCallbacks_SetRmaWinCallback( context->callbacks,
+                                               otf2_archive_unify_rma_win_cb );
+    OTF2_DefReaderCallbacks_SetInterruptGeneratorCallback( context->callbacks,
+                                                           otf2_archive_unify_interrupt_generator_cb );
+    OTF2_DefReaderCallbacks_SetMetricMemberCallback( context->callbacks,
+                                                     otf2_archive_unify_metric_member_cb );
+    OTF2_DefReaderCallbacks_SetMetricClassCallback( context->callbacks,
+                                                    otf2_archive_unify_metric_class_cb );
+    OTF2_DefReaderCallbacks_SetMetricInstanceCallback( context->callbacks,
+                                                       otf2_archive_unify_metric_instance_cb );
+
+    /* Local definitions of the other classes keep their identifiers. */
+    OTF2_DefReaderCallbacks_SetSystemTreeNodeCallback( context->callbacks,
+                                                       otf2_archive_unify_system_tree_node_cb );
+    OTF2_DefReaderCallbacks_SetLocationGroupCallback( context->callbacks,
+                                                      otf2_archive_unify_location_group_cb );
+    OTF2_DefReaderCallbacks_SetLocationCallback( context->callbacks,
+                                                 otf2_archive_unify_location_cb );
+    OTF2_DefReaderCallbacks_SetCallsiteCallback( context->callbacks,
+                                                 otf2_archive_unify_callsite_cb );
+    OTF2_DefReaderCallbacks_SetCallpathCallback( context->callbacks,
+                                                 otf2_archive_unify_callpath_cb );
+    OTF2_DefReaderCallbacks_SetMetricClassRecorderCallback( context->callbacks,
+                                                            otf2_archive_unify_metric_class_recorder_cb );
+    OTF2_DefReaderCallbacks_SetSystemTreeNodePropertyCallback( context->callbacks,
+                                                               otf2_archive_unify_system_tree_node_property_cb );
+    OTF2_DefReaderCallbacks_SetSystemTreeNodeDomainCallback( context->callbacks,
+                                                             otf2_archive_unify_system_tree_node_domain_cb );
+    OTF2_DefReaderCallbacks_SetLocationGroupPropertyCallback( context->callbacks,
+                                                              otf2_archive_unify_location_group_property_cb );
+    OTF2_DefReaderCallbacks_SetLocationPropertyCallback( context->callbacks,
+                                                         otf2_archive_unify_location_property_cb );
+    OTF2_DefReaderCallbacks_SetCartDimensionCallback( context->callbacks,
+                                                      otf2_archive_unify_cart_dimension_cb );
+    OTF2_DefReaderCallbacks_SetCartTopologyCallback( context->callbacks,
+                                                     otf2_archive_unify_cart_topology_cb );
+    OTF2_DefReaderCallbacks_SetCartCoordinateCallback( context->callbacks,
+                                                       otf2_archive_unify_cart_coordinate_cb );
+    OTF2_DefReaderCallbacks_SetCallingContextPropertyCallback( context->callbacks,
+                                                               otf2_archive_unify_calling_context_property_cb );
+
+    for ( uint32_t i = 0; i < numberOfLocations; i++ )
+    {
+        context->locations[ i ].context  = context;
+        context->locations[ i ].location = locations[ i ];
+        context->locations[ i ].status   = OTF2_SUCCESS;
+    }
+
+    /* The unification tables are only safe to share with locks. */
+    if ( numberOfLocations > 1
+         && archive->parallel_callbacks
+         && archive->locking_callbacks
+         && archive->substrate != OTF2_SUBSTRATE_SION )
+    {
+        OTF2_CallbackCode callback_ret =
+            archive->parallel_callbacks->otf2_run( archive->parallel_data,
+                                                   numberOfLocations,
+                                                   otf2_archive_unify_location_task,
+                                                   context );
+        if ( OTF2_CALLBACK_SUCCESS != callback_ret )
+        {
+            UTILS_WARNING( "Parallel callback failed, reading the remaining locations serially." );
+        }
+    }
+
+    for ( uint32_t i = 0; i < numberOfLocations; i++ )
+    {
+        if ( !context->locations[ i ].done )
+        {
+            otf2_archive_unify_location_task( context, i );
+        }
+        if ( OTF2_SUCCESS != context->locations[ i ].status )
+        {
+            status = UTILS_ERROR( context->locations[ i ].status,
+                                  "Can't unify the definitions of location %" PRIu64 ".",
+                                  context->locations[ i ].location );
+            goto out;
+        }
+    }
+
+    status = otf2_archive_unify_assign_ids( context, numberOfLocations );
+    if ( OTF2_SUCCESS != status )
+    {
+        goto out;
+    }
+    status = otf2_archive_unify_write_definitions( context, globalDefWriter );
+    if ( OTF2_SUCCESS != status )
+    {
+        goto out;
+    }
+    status = otf2_archive_unify_write_passed_definitions( context, globalDefWriter );
+    if ( OTF2_SUCCESS != status )
+    {
+        goto out;
+    }
+
+    for ( uint32_t i = 0; mappingTableCallback && i < numberOfLocations; i++ )
+    {
+        for ( uint32_t j = 0; j < OTF2_ARCHIVE_UNIFY_MAX; j++ )
+        {
+            if ( otf2_archive_unify_mapping_types[ j ] == OTF2_MAPPING_MAX )
+            {
+                continue;
+            }
+
+            OTF2_IdMap* id_map;
+            status = otf2_archive_unify_create_id_map( &context->locations[ i ].maps[ j ],
+                                                       &id_map );
+            if ( OTF2_SUCCESS != status )
+            {
+                goto out;
+            }
+            if ( !id_map )
+            {
+                continue;
+            }
+
+            OTF2_CallbackCode callback_ret =
+                mappingTableCallback( userData,
+                                      context->locations[ i ].location,
+                                      otf2_archive_unify_mapping_types[ j ],
+                                      id_map );
+            OTF2_IdMap_Free( id_map );
+            if ( OTF2_CALLBACK_SUCCESS != callback_ret )
+            {
+                status = UTILS_ERROR( OTF2_ERROR_INTERRUPTED_BY_CALLBACK,
+                                      "Mapping table callback returned error." );
+                goto out;
+            }
+        }
+    }
+
+    if ( numberOfStrings )
+    {
+        *numberOfStrings = context->tables[ OTF2_ARCHIVE_UNIFY_STRING ].number_of_entries;
+    }
+
+out:
+    for ( uint32_t i = 0; context->locations && i < numberOfLocations; i++ )
+    {
+        for ( uint32_t j = 0; j < OTF2_ARCHIVE_UNIFY_MAX; j++ )
+        {
+            free( context->locations[ i ].maps[ j ].local_ids );
+            free( context->locations[ i ].maps[ j ].entries );
+        }
+        free( context->locations[ i ].key );
+    }
+    for ( uint32_t i = 0; i < OTF2_ARCHIVE_UNIFY_ALL; i++ )
+    {
+        otf2_archive_unify_table_finalize( archive, &context->tables[ i ] );
+    }
+    OTF2_DefReaderCallbacks_Delete( context->callbacks );
+    free( context->locations );
+    free( context );
+
+    return status;
+}
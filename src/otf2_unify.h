@@ -0,0 +1,53 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2009-2013,
+ * RWTH Aachen University, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * Gesellschaft fuer numerische Simulation mbH Braunschweig, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * Technische Universitaet Dresden, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * University of Oregon, Eugene, USA
+ *
+ * Copyright (c) 2009-2013,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * German Research School for Simulation Sciences GmbH, Juelich/Aachen, Germany
+ *
+ * Copyright (c) 2009-2013,
+ * Technische Universitaet Muenchen, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+/**
+ * @file
+ *
+ * @brief Unification of local definitions.
+ */
+
+
+#ifndef OTF2_INTERNAL_UNIFY_H
+#define OTF2_INTERNAL_UNIFY_H
+
+
+OTF2_ErrorCode
+otf2_archive_unify_local_definitions( OTF2_Archive*                    archive,
+                                      uint32_t                         numberOfLocations,
+                                      const OTF2_LocationRef*          locations,
+                                      OTF2_GlobalDefWriter*            globalDefWriter,
+                                      OTF2_UnifiedMappingTableCallback mappingTableCallback,
+                                      void*                            userData,
+                                      uint64_t*                        numberOfStrings );
+
+
+#endif /* OTF2_INTERNAL_UNIFY_H */
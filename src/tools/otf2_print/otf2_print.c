@@ -779,6 +779,17 @@ main( int    argc,
         }
         check_status( status, "Open local definition files for reading." );
     }
+
+    /* Without printing per location definitions, only the mapping tables and
+     * clock offsets are needed, load them for all locations at once. */
+    bool load_local_defs = local_def_files_exists
+                           && !otf2_MAPPINGS && !otf2_CLOCK_OFFSETS;
+    if ( load_local_defs )
+    {
+        status = OTF2_Reader_LoadLocalDefinitions( reader, true );
+        check_status( status, "Load local definitions." );
+    }
+
     if ( !otf2_GLOBDEFS || otf2_ALL )
     {
         status = OTF2_Reader_OpenEvtFiles( reader );
@@ -811,7 +822,7 @@ main( int    argc,
             continue;
         }
 
-        if ( local_def_files_exists )
+        if ( local_def_files_exists && !load_local_defs )
         {
             /* Also open a definition reader and read all local definitions. */
             OTF2_DefReader* def_reader = OTF2_Reader_GetDefReader( reader,
@@ -914,6 +925,20 @@ main( int    argc,
     OTF2_GlobalEvtReader* global_evt_reader = OTF2_Reader_GetGlobalEvtReader( reader );
     check_pointer( global_evt_reader, "Create global event reader." );
 
+    /* Skip over the events outside the requested time window. */
+    if ( otf2_MINTIME > 0 )
+    {
+        status = OTF2_GlobalEvtReader_SeekTime( global_evt_reader,
+                                                otf2_MINTIME );
+        check_status( status, "Seek global event reader to %" PRIu64 ".", otf2_MINTIME );
+    }
+    if ( otf2_MAXTIME != OTF2_UNDEFINED_UINT64 )
+    {
+        status = OTF2_GlobalEvtReader_SetEndTime( global_evt_reader,
+                                                  otf2_MAXTIME );
+        check_status( status, "Set end time of global event reader." );
+    }
+
 
     /* Register the above defined callbacks to the global event reader. */
     if ( !otf2_SILENT )
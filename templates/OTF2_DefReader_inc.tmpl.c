@@ -219,6 +219,12 @@ otf2_def_reader_read( OTF2_DefReader* reader )
 
         @otf2 for def in defs|local_defs:
         case OTF2_LOCAL_DEF_@@def.upper@@:
+            @otf2 if not def.archive_location_callback:
+            if ( reader->skip_definitions )
+            {
+                return otf2_def_reader_skip( reader );
+            }
+            @otf2 endif
             return otf2_def_reader_read_@@def.lower@@( reader );
 
         @otf2 endfor
@@ -111,6 +111,11 @@ OTF2_DefWriter_Write@@def.name@@( OTF2_DefWriter* writerHandle @@def.funcargs()@
         return ret;
     }
 
+    @otf2 if def.name == 'EventTimeRange':
+    /* Supersedes the range recorded by the event writer. */
+    writerHandle->event_time_range_written = true;
+
+    @otf2 endif
     OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_LOCAL_DEF_@@def.upper@@ );
 
     /* Write initial record length */
@@ -48,6 +48,77 @@ otf2_evt_reader_read_@@event.lower@@( OTF2_EvtReader* reader )
     record->time = otf2_evt_reader_apply_clock_correction( reader, record->time );
 
     OTF2_ErrorCode ret;
+
+    /*
+     * Don't decode records nobody is interested in. A local event reader
+     * operated by a global event reader decodes always, the callback is
+     * selected when the record is delivered.
+     */
+    if ( !reader->operated &&
+         !reader->reader_callbacks.@@event.lower@@@@' &&\n         !reader->reader_callbacks.' + event.alternative_event.lower if event.alternative_event@@ )
+    {
+        @otf2 if event.name == 'Leave':
+        /* Implicit leaves have no payload. */
+        ret = reader->current_event.type == OTF2_BUFFER_IMPLICIT_LEAVE
+              ? OTF2_SUCCESS
+              : otf2_evt_reader_skip_compressed( reader );
+        reader->current_event.type = OTF2_EVENT_@@event.upper@@;
+        @otf2 elif event.name == 'Metric':
+        ret = otf2_evt_reader_skip_record( reader );
+        reader->current_event.type = OTF2_EVENT_@@event.upper@@;
+        @otf2 elif event.name == 'CallingContextSample':
+        /* Sample deltas have no record length. */
+        ret = reader->current_event.type == OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA
+              ? otf2_evt_reader_skip_sample_delta( reader )
+              : otf2_evt_reader_skip_record( reader );
+        reader->current_event.type = OTF2_EVENT_@@event.upper@@;
+        @otf2 elif event is singleton_event:
+        ret = otf2_evt_reader_skip_compressed( reader );
+        @otf2 else:
+        ret = otf2_evt_reader_skip_record( reader );
+        @otf2 endif
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not skip @@event.name@@ record." );
+        }
+
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        otf2_attribute_list_remove_all_attributes( &reader->attribute_list );
+
+        return OTF2_SUCCESS;
+    }
+
+    @otf2 if event.name == 'Leave':
+    if ( reader->current_event.type == OTF2_BUFFER_IMPLICIT_LEAVE )
+    {
+        /* The region is the innermost one entered in the chunk segment. */
+        ret = otf2_evt_reader_get_implicit_region( reader, &record->region );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not reconstruct region of @@event.name@@ record." );
+        }
+        record->region             = otf2_evt_reader_map( reader, OTF2_MAPPING_REGION, record->region );
+        reader->current_event.type = OTF2_EVENT_@@event.upper@@;
+        goto region_known;
+    }
+
+    @otf2 elif event.name == 'CallingContextSample':
+    if ( reader->current_event.type == OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA )
+    {
+        /* The attributes are deltas to the previous sample. */
+        ret = otf2_evt_reader_read_calling_context_sample_delta( reader, record );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not read @@event.name@@ record." );
+        }
+        reader->current_event.type = OTF2_EVENT_@@event.upper@@;
+        reader->global_event_position++;
+        reader->chunk_local_event_position++;
+        goto sample_known;
+    }
+
+    @otf2 endif
     @otf2 if event is singleton_event:
     /* Event is singleton (just one attribute of compressed data type) */
     ret = OTF2_Buffer_GuaranteeCompressed( reader->buffer );
@@ -70,6 +141,20 @@ otf2_evt_reader_read_@@event.lower@@( OTF2_EvtReader* reader )
     @otf2  if event.versions|length > 1:
     uint8_t* current_pos;
     @otf2  endif
+    @otf2 endif
+    @otf2 if event.name == 'Metric':
+    if ( reader->current_event.type == OTF2_BUFFER_METRIC_DELTA )
+    {
+        /* The values are deltas to the previous sample of the metric. */
+        ret = otf2_evt_reader_read_metric_delta( reader, record );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Could not read @@event.name@@ record." );
+        }
+        reader->current_event.type = OTF2_EVENT_@@event.upper@@;
+        goto metric_known;
+    }
+
     @otf2 endif
 
     @otf2 for v in event.versions:
@@ -146,10 +231,47 @@ otf2_evt_reader_read_@@event.lower@@( OTF2_EvtReader* reader )
     @otf2  endif
 
     @otf2 endfor
+    @otf2 if event.name == 'Leave':
+region_known:
+    @otf2 elif event.name == 'Metric':
+    ret = otf2_evt_reader_remember_metric( reader, record );
+    if ( OTF2_SUCCESS != ret )
+    {
+        @otf2 for attr in event.all_array_attributes:
+        free( record->@@attr.lower@@ );
+        @otf2 endfor
+        return UTILS_ERROR( ret, "Could not remember @@event.name@@ record." );
+    }
+
+metric_known:
+    @otf2 elif event.name == 'CallingContextSample':
+    ret = otf2_evt_reader_remember_sample( reader,
+                                           record_end_pos - record_data_length,
+                                           reader->chunk_local_event_position );
+    if ( OTF2_SUCCESS != ret )
+    {
+        return UTILS_ERROR( ret, "Could not remember @@event.name@@ record." );
+    }
+
+    @otf2 endif
     reader->global_event_position++;
     reader->chunk_local_event_position++;
 
     @otf2 if event is not singleton_event:
+    /*
+     * The attributes are decoded without bounds checks, the record was
+     * validated as a whole. Thus only check once, that they did not exceed
+     * the announced record length.
+     */
+    if ( reader->buffer->read_pos > record_end_pos )
+    {
+        @otf2 for attr in event.all_array_attributes:
+        free( record->@@attr.lower@@ );
+        @otf2 endfor
+        return UTILS_ERROR( OTF2_ERROR_INVALID_DATA,
+                            "@@event.name@@ record exceeds its announced length." );
+    }
+
     /*
      * Always jump to the announced end of the record. This way, we skip
      * future additions of attributes to this record.
@@ -163,6 +285,9 @@ otf2_evt_reader_read_@@event.lower@@( OTF2_EvtReader* reader )
         return UTILS_ERROR( ret, "Could not read record of unknown type." );
     }
 
+    @otf2 endif
+    @otf2 if event.name == 'CallingContextSample':
+sample_known:
     @otf2 endif
     /*
      * If a local event reader is operated by a global event reader,
@@ -217,6 +342,17 @@ otf2_evt_reader_read_@@event.lower@@( OTF2_EvtReader* reader )
 
 @otf2 endfor
 
+/** Decoder for each record type, unknown record types have none. */
+static OTF2_ErrorCode ( * const otf2_evt_reader_read_table[ 256 ] )( OTF2_EvtReader* ) =
+{
+    @otf2 for event in events:
+    [ OTF2_EVENT_@@event.upper@@ ] = otf2_evt_reader_read_@@event.lower@@,
+    @otf2 endfor
+    [ OTF2_BUFFER_IMPLICIT_LEAVE ] = otf2_evt_reader_read_leave,
+    [ OTF2_BUFFER_METRIC_DELTA ] = otf2_evt_reader_read_metric,
+    [ OTF2_BUFFER_CALLING_CONTEXT_SAMPLE_DELTA ] = otf2_evt_reader_read_calling_context_sample,
+};
+
 OTF2_ErrorCode
 otf2_evt_reader_read( OTF2_EvtReader* reader )
 {
@@ -225,23 +361,25 @@ otf2_evt_reader_read( OTF2_EvtReader* reader )
     OTF2_ErrorCode  status = OTF2_ERROR_INVALID;
     OTF2_GenericEvent* event  = &reader->current_event;
 
-    status = OTF2_Buffer_ReadTimeStamp( reader->buffer, &event->record.time );
-    if ( status != OTF2_SUCCESS )
+    /* Consume chunk ends and attribute lists until an event record follows. */
+    while ( true )
     {
-        return UTILS_ERROR( status, "Read of timestamp failed!" );
-    }
+        status = OTF2_Buffer_ReadTimeStamp( reader->buffer, &event->record.time );
+        if ( status != OTF2_SUCCESS )
+        {
+            return UTILS_ERROR( status, "Read of timestamp failed!" );
+        }
 
-    /* Read record type */
-    status = OTF2_Buffer_Guarantee( reader->buffer, 1 );
-    if ( OTF2_SUCCESS != status )
-    {
-        return UTILS_ERROR( status, "Could not read record type." );
-    }
-    OTF2_Buffer_ReadUint8( reader->buffer, &event->type );
+        /* Read record type */
+        status = OTF2_Buffer_Guarantee( reader->buffer, 1 );
+        if ( OTF2_SUCCESS != status )
+        {
+            return UTILS_ERROR( status, "Could not read record type." );
+        }
+        OTF2_Buffer_ReadUint8( reader->buffer, &event->type );
 
-    switch ( event->type )
-    {
-        case OTF2_BUFFER_END_OF_CHUNK:
+        if ( event->type == OTF2_BUFFER_END_OF_CHUNK )
+        {
             reader->chunk_local_event_position = 0;
             free( reader->position_table );
             reader->position_table = NULL;
@@ -252,30 +390,48 @@ otf2_evt_reader_read( OTF2_EvtReader* reader )
             {
                 return UTILS_ERROR( status, "Load of next chunk failed!" );
             }
-            return otf2_evt_reader_read( reader );
+            continue;
+        }
 
-        case OTF2_BUFFER_END_OF_FILE:
-            return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+        if ( event->type == OTF2_ATTRIBUTE_LIST )
+        {
+            /* Decoded only when the callback accesses the list. */
+            status = otf2_attribute_list_defer_from_buffer( &reader->attribute_list,
+                                                            reader->buffer,
+                                                            otf2_evt_reader_map,
+                                                            reader );
+            if ( status != OTF2_SUCCESS )
+            {
+                return UTILS_ERROR( status, "Read of additional attributes failed!" );
+            }
+            continue;
+        }
 
-        case OTF2_ATTRIBUTE_LIST:
-            status = otf2_attribute_list_read_from_buffer( &reader->attribute_list,
-                                                           reader->buffer,
-                                                           otf2_evt_reader_map,
-                                                           reader );
+        if ( event->type == OTF2_BUFFER_ATTRIBUTE_LIST_DEFINE ||
+             event->type == OTF2_BUFFER_ATTRIBUTE_LIST_REFERENCE )
+        {
+            status = otf2_evt_reader_read_shaped_attribute_list( reader,
+                                                                 event->type );
             if ( status != OTF2_SUCCESS )
             {
                 return UTILS_ERROR( status, "Read of additional attributes failed!" );
             }
-            return otf2_evt_reader_read( reader );
+            continue;
+        }
+
+        break;
+    }
 
-        @otf2 for event in events:
-        case OTF2_EVENT_@@event.upper@@:
-            return otf2_evt_reader_read_@@event.lower@@( reader );
+    if ( event->type == OTF2_BUFFER_END_OF_FILE )
+    {
+        return OTF2_ERROR_INDEX_OUT_OF_BOUNDS;
+    }
 
-        @otf2 endfor
-        default:
-            return otf2_evt_reader_read_unknown( reader );
+    if ( otf2_evt_reader_read_table[ event->type ] )
+    {
+        return otf2_evt_reader_read_table[ event->type ]( reader );
     }
+    return otf2_evt_reader_read_unknown( reader );
 }
 
 @otf2 for event in events:
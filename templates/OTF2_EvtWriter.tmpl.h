@@ -158,6 +158,34 @@ OTF2_EvtWriter_@@event.name@@( OTF2_EvtWriter*     writer,
 
 @otf2 endfor
 
+/** @brief Records a sequence of Enter and Leave events.
+ *
+ *  Equivalent to calling @eref{OTF2_EvtWriter_Enter} or
+ *  @eref{OTF2_EvtWriter_Leave} without an attribute list for each event in
+ *  turn, but the space in the event buffer is checked only once for all
+ *  events which fit into the current chunk.
+ *
+ *  @param writer          Writer object.
+ *  @param numberOfEvents  Number of events in the arrays.
+ *  @param times           The times of the events, in the same order as
+ *                         the single event calls would need them.
+ *  @param regions         The regions which are entered or left.
+ *  @param leave           @eref{OTF2_TRUE} for a Leave event,
+ *                         @eref{OTF2_FALSE} for an Enter event.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error
+ *          occurs. The events before the failing one are recorded.
+ */
+OTF2_ErrorCode
+OTF2_EvtWriter_EnterLeaveBatch( OTF2_EvtWriter*       writer,
+                                uint32_t              numberOfEvents,
+                                const OTF2_TimeStamp* times,
+                                const OTF2_RegionRef* regions,
+                                const OTF2_Boolean*   leave );
+
+
 /** @brief Please give me a documentation.
  *
  *  @param writer   Writer object.
@@ -200,6 +228,70 @@ OTF2_EvtWriter_ClearRewindPoint( OTF2_EvtWriter* writer,
                                  uint32_t        rewindId );
 
 
+/** @brief Drops regions which are left shortly after they were entered.
+ *
+ *  An @eref{OTF2_EvtWriter_Enter} event is recorded tentatively. If the
+ *  matching @eref{OTF2_EvtWriter_Leave} event follows within @a threshold,
+ *  both events are removed from the trace again. Any other event between
+ *  them keeps the region, as do attributes of the Enter or Leave event and
+ *  a region which is not left within the same chunk. After a dropped region
+ *  the enclosing region can be dropped too, if it is left in time.
+ *
+ *  @param writer     Writer object.
+ *  @param threshold  Regions with a shorter duration are dropped, 0
+ *                    disables the filter.
+ *  @param summary    @eref{OTF2_TRUE} to count the dropped calls of each
+ *                    region, see @eref{OTF2_EvtWriter_GetFilteredRegion}.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_EvtWriter_SetDurationFilter( OTF2_EvtWriter* writer,
+                                  OTF2_TimeStamp  threshold,
+                                  OTF2_Boolean    summary );
+
+
+/** @brief Get the summary of the dropped calls of a region.
+ *
+ *  The calls are only counted, while the duration filter runs with a
+ *  summary, see @eref{OTF2_EvtWriter_SetDurationFilter}.
+ *
+ *  @param writer              Writer object.
+ *  @param region              The region.
+ *  @param[out] numberOfCalls  Number of dropped calls of the region.
+ *  @param[out] duration       Total duration of the dropped calls.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_EvtWriter_GetFilteredRegion( const OTF2_EvtWriter* writer,
+                                  OTF2_RegionRef        region,
+                                  uint64_t*             numberOfCalls,
+                                  OTF2_TimeStamp*       duration );
+
+
+/** @brief Get the number of calls of a region dropped by the region filter.
+ *
+ *  See @eref{OTF2_Archive_SetRegionFilter}.
+ *
+ *  @param writer              Writer object.
+ *  @param region              The region.
+ *  @param[out] numberOfCalls  Number of dropped calls of the region.
+ *
+ *  @since Version 2.0
+ *
+ *  @return @eref{OTF2_SUCCESS} if successful, an error code if an error occurs.
+ */
+OTF2_ErrorCode
+OTF2_EvtWriter_GetSuppressedCalls( const OTF2_EvtWriter* writer,
+                                   OTF2_RegionRef        region,
+                                   uint64_t*             numberOfCalls );
+
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -53,6 +53,36 @@ OTF2_EvtWriter_@@event.name@@( OTF2_EvtWriter*     writerHandle,
 
     OTF2_ErrorCode ret;
 
+    @otf2 if event.name == 'Enter':
+    /* Regions filtered at runtime are not recorded at all. */
+    const otf2_region_filter* region_filter =
+        otf2_archive_get_region_filter( writerHandle->archive );
+    if ( region_filter )
+    {
+        bool suppressed = false;
+        ret = otf2_evt_writer_suppress_enter( writerHandle,
+                                              region_filter,
+                                              region,
+                                              &suppressed );
+        if ( OTF2_SUCCESS != ret )
+        {
+            return UTILS_ERROR( ret, "Region filter failed." );
+        }
+        if ( suppressed )
+        {
+            return OTF2_SUCCESS;
+        }
+    }
+
+    @otf2 elif event.name == 'Leave':
+    /* Regions filtered at runtime are not recorded at all. */
+    if ( otf2_archive_get_region_filter( writerHandle->archive ) &&
+         otf2_evt_writer_suppress_leave( writerHandle ) )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    @otf2 endif
     /*
      * Maximum record length is the record id byte, plus the individual sizes of the
      * attributes (excluding the timestamp), and the size of the attribute list.
@@ -65,6 +95,29 @@ OTF2_EvtWriter_@@event.name@@( OTF2_EvtWriter*     writerHandle,
     uint64_t attribute_list_size = otf2_attribute_list_get_size( attributeList );
     record_length += attribute_list_size;
 
+    @otf2 if event.name == 'Enter':
+    /* The buffer state before the enter, to drop it together with its
+     * leave. */
+    otf2_rewind_point enter_state;
+    if ( writerHandle->duration_threshold )
+    {
+        OTF2_Buffer_SaveState( writerHandle->buffer, &enter_state );
+    }
+
+    @otf2 elif event.name == 'Leave':
+    /* Regions left within the duration threshold are not recorded at all. */
+    if ( writerHandle->number_of_tentative_enters &&
+         otf2_evt_writer_filter_leave( writerHandle, attribute_list_size, time, region ) )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    @otf2 else:
+    /* The regions entered before contain this event and are kept. */
+    writerHandle->number_of_tentative_enters = 0;
+
+    @otf2 endif
+
     @otf2 if event.attributes:
     /*
      * Maximum memory usage of pure record data (excluding timestamp, type ID,
@@ -107,6 +160,17 @@ OTF2_EvtWriter_@@event.name@@( OTF2_EvtWriter*     writerHandle,
         record_length += 8;
     }
 
+    @otf2  endif
+    @otf2  if event.name == 'Metric':
+    /* A delta sample stores the distance to the previous sample instead of
+     * the types. */
+    record_length += sizeof( uint64_t ) + 1;
+
+    @otf2  elif event.name == 'CallingContextSample':
+    /* A delta sample stores the distance to the previous sample and a wider
+     * difference of the calling context. */
+    record_length += 2 * ( sizeof( uint64_t ) + 1 );
+
     @otf2  endif
     @otf2 else:
     /*
@@ -127,14 +191,59 @@ OTF2_EvtWriter_@@event.name@@( OTF2_EvtWriter*     writerHandle,
     /* Write only the attribute list, if it is not empty */
     if ( attribute_list_size )
     {
-        ret = otf2_attribute_list_write_to_buffer( attributeList,
-                                                   writerHandle->buffer );
+        ret = writerHandle->attribute_shapes
+              ? otf2_attribute_list_write_shaped_to_buffer( attributeList,
+                                                            writerHandle->buffer,
+                                                            writerHandle->attribute_shapes )
+              : otf2_attribute_list_write_to_buffer( attributeList,
+                                                     writerHandle->buffer );
         if ( OTF2_SUCCESS != ret )
         {
             return ret;
         }
     }
 
+    @otf2 if event.name == 'Leave':
+    /* The region of the innermost enter in the same chunk segment is known
+     * to the reader. */
+    if ( writerHandle->implicit_leave &&
+         otf2_evt_writer_leave_region( writerHandle, region ) )
+    {
+        OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_BUFFER_IMPLICIT_LEAVE );
+        return OTF2_SUCCESS;
+    }
+
+    @otf2 elif event.name == 'Metric':
+    /* Later samples in the same chunk segment are deltas to the previous
+     * one. */
+    if ( writerHandle->metric_deltas )
+    {
+        bool written;
+        ret = otf2_evt_writer_metric_delta( writerHandle,
+                                            metric,
+                                            numberOfMetrics,
+                                            typeIDs,
+                                            metricValues,
+                                            &written );
+        if ( OTF2_SUCCESS != ret || written )
+        {
+            return ret;
+        }
+    }
+
+    @otf2 elif event.name == 'CallingContextSample':
+    /* Later samples in the same chunk segment are deltas to the previous
+     * one. */
+    if ( writerHandle->calling_context_deltas &&
+         otf2_evt_writer_calling_context_sample_delta( writerHandle,
+                                                       callingContext,
+                                                       unwindDistance,
+                                                       interruptGenerator ) )
+    {
+        return OTF2_SUCCESS;
+    }
+
+    @otf2 endif
     OTF2_Buffer_WriteUint8( writerHandle->buffer, OTF2_EVENT_@@event.upper@@ );
 
     @otf2 if event.attributes:
@@ -167,6 +276,21 @@ OTF2_EvtWriter_@@event.name@@( OTF2_EvtWriter*     writerHandle,
     /* Write the zero byte, which indicates no attributes. */
     OTF2_Buffer_WriteUint8( writerHandle->buffer, 0 );
 
+    @otf2 endif
+    @otf2 if event.name == 'Enter':
+    if ( writerHandle->implicit_leave )
+    {
+        otf2_evt_writer_enter_region( writerHandle, region );
+    }
+    if ( writerHandle->duration_threshold )
+    {
+        otf2_evt_writer_enter_tentatively( writerHandle,
+                                           &enter_state,
+                                           attribute_list_size,
+                                           time,
+                                           region );
+    }
+
     @otf2 endif
     return ret;
 }
@@ -94,28 +94,34 @@ otf2_global_evt_reader_trigger_@@event.lower@@( const OTF2_GlobalEvtReader* read
 
 @otf2 endfor
 
+/** Callback trigger for each record type, unknown record types have none. */
+static OTF2_ErrorCode ( * const otf2_global_evt_reader_trigger_table[ 256 ] )( const OTF2_GlobalEvtReader*,
+                                                                               OTF2_EvtReader* ) =
+{
+    @otf2 for event in events:
+    [ OTF2_EVENT_@@event.upper@@ ] = otf2_global_evt_reader_trigger_@@event.lower@@,
+    @otf2 endfor
+};
+
 static OTF2_ErrorCode
 otf2_global_evt_reader_trigger_callback( const OTF2_GlobalEvtReader* reader,
                                          OTF2_EvtReader*             evt_reader )
 {
     OTF2_GenericEvent* event = &evt_reader->current_event;
 
-    switch ( event->type )
+    /* An attribute list should not be in the event queue alone. */
+    if ( event->type == OTF2_ATTRIBUTE_LIST )
+    {
+        return OTF2_ERROR_INTEGRITY_FAULT;
+    }
+
+    if ( otf2_global_evt_reader_trigger_table[ event->type ] )
     {
-        /* An attribute list should not be in the event queue alone. */
-        case OTF2_ATTRIBUTE_LIST:
-            return OTF2_ERROR_INTEGRITY_FAULT;
-
-        @otf2 for event in events:
-        case OTF2_EVENT_@@event.upper@@:
-            return otf2_global_evt_reader_trigger_@@event.lower@@( reader,
-                                                                   evt_reader );
-
-        @otf2 endfor
-        default:
-            return otf2_global_evt_reader_trigger_unknown( reader,
-                                                           evt_reader );
+        return otf2_global_evt_reader_trigger_table[ event->type ]( reader,
+                                                                    evt_reader );
     }
+    return otf2_global_evt_reader_trigger_unknown( reader,
+                                                   evt_reader );
 }
 
 @otf2 for event in events:
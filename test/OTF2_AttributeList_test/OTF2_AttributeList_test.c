@@ -181,6 +181,91 @@ test_3( CuTest* tc )
 }
 
 
+void
+test_4( CuTest* tc )
+{
+    OTF2_AttributeList* attr_list = OTF2_AttributeList_New();
+    CuAssertPtrNotNull( tc, attr_list );
+
+    enum
+    {
+        NUMBER_OF_ATTRIBUTES = 20
+    };
+    OTF2_AttributeRef   ids[ NUMBER_OF_ATTRIBUTES ];
+    OTF2_Type           types[ NUMBER_OF_ATTRIBUTES ];
+    OTF2_AttributeValue values[ NUMBER_OF_ATTRIBUTES ];
+    for ( uint32_t i = 0; i < NUMBER_OF_ATTRIBUTES; i++ )
+    {
+        ids[ i ]           = 3 * i + 1;
+        types[ i ]         = OTF2_TYPE_UINT64;
+        values[ i ].uint64 = i;
+    }
+
+    /* Single and bulk additions, beyond the size of short lists. */
+    OTF2_ErrorCode ret = OTF2_AttributeList_AddAttribute( attr_list,
+                                                          ids[ 0 ],
+                                                          types[ 0 ],
+                                                          values[ 0 ] );
+    CuAssert( tc, "successful add", ret == OTF2_SUCCESS );
+    ret = OTF2_AttributeList_AddAttributes( attr_list,
+                                            NUMBER_OF_ATTRIBUTES - 1,
+                                            ids + 1,
+                                            types + 1,
+                                            values + 1 );
+    CuAssert( tc, "successful bulk add", ret == OTF2_SUCCESS );
+    CuAssert( tc, "number of entries",
+              OTF2_AttributeList_GetNumberOfElements( attr_list ) == NUMBER_OF_ATTRIBUTES );
+
+    /* A duplicate adds nothing. */
+    OTF2_AttributeRef   dup_ids[ 2 ] = { 0, ids[ 7 ] };
+    OTF2_AttributeValue dup_values[ 2 ];
+    ret = OTF2_AttributeList_AddAttributes( attr_list, 2, dup_ids, types, dup_values );
+    CuAssert( tc, "unsuccessful bulk add", ret != OTF2_SUCCESS );
+    CuAssert( tc, "number of entries",
+              OTF2_AttributeList_GetNumberOfElements( attr_list ) == NUMBER_OF_ATTRIBUTES );
+    CuAssert( tc, "unsuccessful test id",
+              !OTF2_AttributeList_TestAttributeByID( attr_list, 0 ) );
+
+    /* The order of the additions is kept. */
+    OTF2_AttributeRef   id;
+    OTF2_Type           type;
+    OTF2_AttributeValue attr;
+    for ( uint32_t i = 0; i < NUMBER_OF_ATTRIBUTES; i++ )
+    {
+        ret = OTF2_AttributeList_GetAttributeByIndex( attr_list, i, &id, &type, &attr );
+        CuAssert( tc, "successful get by index", ret == OTF2_SUCCESS );
+        CuAssert( tc, "got correct id", id == ids[ i ] );
+        CuAssert( tc, "got correct value", attr.uint64 == i );
+    }
+
+    ret = OTF2_AttributeList_RemoveAttribute( attr_list, ids[ 5 ] );
+    CuAssert( tc, "successful remove", ret == OTF2_SUCCESS );
+    for ( uint32_t i = 0; i < NUMBER_OF_ATTRIBUTES; i++ )
+    {
+        if ( i == 5 )
+        {
+            continue;
+        }
+        ret = OTF2_AttributeList_PopAttribute( attr_list, &id, &type, &attr );
+        CuAssert( tc, "successful pop", ret == OTF2_SUCCESS );
+        CuAssert( tc, "got correct id", id == ids[ i ] );
+        CuAssert( tc, "got correct value", attr.uint64 == i );
+    }
+    CuAssert( tc, "number of entries",
+              OTF2_AttributeList_GetNumberOfElements( attr_list ) == 0 );
+
+    /* The list is usable after it was emptied. */
+    ret = OTF2_AttributeList_AddAttributes( attr_list, 3, ids, types, values );
+    CuAssert( tc, "successful bulk add", ret == OTF2_SUCCESS );
+    ret = OTF2_AttributeList_RemoveAllAttributes( attr_list );
+    CuAssert( tc, "successful remove all", ret == OTF2_SUCCESS );
+    CuAssert( tc, "number of entries",
+              OTF2_AttributeList_GetNumberOfElements( attr_list ) == 0 );
+
+    OTF2_AttributeList_Delete( attr_list );
+}
+
+
 int
 main()
 {
@@ -191,6 +276,7 @@ main()
     SUITE_ADD_TEST_NAME( suite, test_1, "new/delete" );
     SUITE_ADD_TEST_NAME( suite, test_2, "add/get/pop" );
     SUITE_ADD_TEST_NAME( suite, test_3, "random remove" );
+    SUITE_ADD_TEST_NAME( suite, test_4, "bulk add" );
 
     CuSuiteRun( suite );
     CuSuiteSummary( suite, output );
@@ -636,6 +636,152 @@ check_script_with_buffer( OTF2_Buffer* buffer, uint32_t repeatCount )
     }
 }
 
+/* Reference encoding of compressed values: the size byte, followed by the
+ * significant bytes in host byte order. The maximum of unsigned values is
+ * encoded as a single 0xff byte. */
+static size_t
+reference_compress( uint8_t* out,
+                    uint64_t value,
+                    uint8_t  width,
+                    bool     isSigned )
+{
+    uint64_t max = width == 8 ? UINT64_MAX : UINT32_MAX;
+    if ( !isSigned && value == max )
+    {
+        out[ 0 ] = 0xff;
+        return 1;
+    }
+
+    uint8_t size = 0;
+    while ( size < width && ( value >> ( 8 * size ) ) != 0 )
+    {
+        size++;
+    }
+
+    out[ 0 ] = size;
+    for ( uint8_t i = 0; i < size; i++ )
+    {
+#ifdef WORDS_BIGENDIAN
+        out[ 1 + i ] = value >> ( 8 * ( size - 1 - i ) );
+#else
+        out[ 1 + i ] = value >> ( 8 * i );
+#endif
+    }
+
+    return 1 + size;
+}
+
+/* Encodes and decodes @a value in all four compressed types, once with room
+ * behind the value and once right at the end of the chunk. */
+static void
+check_compressed_value( uint64_t value )
+{
+    static const OTF2_Type types[] = {
+        OTF2_TYPE_UINT32, OTF2_TYPE_INT32, OTF2_TYPE_UINT64, OTF2_TYPE_INT64
+    };
+
+    for ( size_t t = 0; t < sizeof( types ) / sizeof( types[ 0 ] ); t++ )
+    {
+        OTF2_Type type      = types[ t ];
+        uint8_t   width     = ( type == OTF2_TYPE_UINT32 || type == OTF2_TYPE_INT32 ) ? 4 : 8;
+        bool      is_signed = ( type == OTF2_TYPE_INT32 || type == OTF2_TYPE_INT64 );
+        uint64_t  v         = width == 4 ? ( uint32_t )value : value;
+
+        uint8_t expected[ 9 ];
+        size_t  length = reference_compress( expected, v, width, is_signed );
+
+        for ( int at_end = 0; at_end < 2; at_end++ )
+        {
+            uint8_t memory[ 32 ];
+            memset( memory, 0xaa, sizeof( memory ) );
+
+            otf2_chunk chunk;
+            memset( &chunk, 0, sizeof( chunk ) );
+            chunk.begin = memory;
+            chunk.end   = memory + ( at_end ? length : sizeof( memory ) );
+
+            OTF2_Buffer buffer;
+            memset( &buffer, 0, sizeof( buffer ) );
+            buffer.chunk           = &chunk;
+            buffer.write_pos       = memory;
+            buffer.read_pos        = memory;
+            buffer.endianness_mode = OTF2_HOST_ENDIANNESS;
+
+            union buffer_value u;
+            size_t             size = 0;
+            OTF2_ErrorCode     status;
+            switch ( type )
+            {
+                case OTF2_TYPE_UINT32:
+                    size = otf2_buffer_size_uint32( v );
+                    OTF2_Buffer_WriteUint32( &buffer, v );
+                    status = OTF2_Buffer_ReadUint32( &buffer, &u.u32 );
+                    u.u64  = u.u32;
+                    break;
+                case OTF2_TYPE_INT32:
+                    size = otf2_buffer_size_int32( ( int32_t )v );
+                    OTF2_Buffer_WriteInt32( &buffer, ( int32_t )v );
+                    status = OTF2_Buffer_ReadInt32( &buffer, &u.s32 );
+                    u.u64  = ( uint32_t )u.s32;
+                    break;
+                case OTF2_TYPE_UINT64:
+                    size = otf2_buffer_size_uint64( v );
+                    OTF2_Buffer_WriteUint64( &buffer, v );
+                    status = OTF2_Buffer_ReadUint64( &buffer, &u.u64 );
+                    break;
+                default:
+                    size = otf2_buffer_size_int64( ( int64_t )v );
+                    OTF2_Buffer_WriteInt64( &buffer, ( int64_t )v );
+                    status = OTF2_Buffer_ReadInt64( &buffer, &u.s64 );
+                    break;
+            }
+            check_status( status, "Read compressed value." );
+
+            check_condition( size == length,
+                             "Size mismatch for %" PRIx64 " of type %u: "
+                             "got %zu, expected %zu.",
+                             v, type, size, length );
+            check_condition( ( size_t )( buffer.write_pos - memory ) == length
+                             && memcmp( memory, expected, length ) == 0,
+                             "Encoding mismatch for %" PRIx64 " of type %u.",
+                             v, type );
+            check_condition( buffer.read_pos == buffer.write_pos && u.u64 == v,
+                             "Decoding mismatch for %" PRIx64 " of type %u: "
+                             "got %" PRIx64 ".",
+                             v, type, u.u64 );
+        }
+    }
+}
+
+/* Checks the compressed encoding against the reference for all values of up
+ * to two significant bytes, around all powers of two, and for random values
+ * of all lengths. */
+static void
+check_compression( void )
+{
+    for ( uint64_t value = 0; value <= 0x1ffff; value++ )
+    {
+        check_compressed_value( value );
+    }
+
+    for ( int bit = 0; bit < 64; bit++ )
+    {
+        uint64_t power = UINT64_C( 1 ) << bit;
+        for ( int64_t delta = -2; delta <= 2; delta++ )
+        {
+            check_compressed_value( power + delta );
+            check_compressed_value( -( power + delta ) );
+        }
+    }
+
+    uint64_t state = 1;
+    for ( int i = 0; i < 1000000; i++ )
+    {
+        state = state * UINT64_C( 6364136223846793005 ) + UINT64_C( 1442695040888963407 );
+        check_compressed_value( state >> ( state & 63 ) );
+    }
+}
+
 static void
 write_buffer( OTF2_Archive* archive,
               uint32_t      repeatCount )
@@ -833,6 +979,8 @@ main( int argc, char* argv[] )
         printf( "=== OTF2_BUFFER_TEST ===\n" );
     }
 
+    check_compression();
+
     /* Write files in antive order */
     write_archive( ".",
                    "native",
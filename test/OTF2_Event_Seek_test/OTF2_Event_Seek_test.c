@@ -84,10 +84,67 @@ enter_cb( uint64_t            locationID,
           OTF2_AttributeList* attributeList,
           uint32_t            region );
 
+static OTF2_CallbackCode
+metric_cb( uint64_t                locationID,
+           uint64_t                time,
+           uint64_t                event_position,
+           void*                   userdata,
+           OTF2_AttributeList*     attributeList,
+           OTF2_MetricRef          metric,
+           uint8_t                 numberOfMetrics,
+           const OTF2_Type*        typeIDs,
+           const OTF2_MetricValue* metricValues );
+
+static OTF2_CallbackCode
+calling_context_sample_cb( uint64_t                   locationID,
+                           uint64_t                   time,
+                           uint64_t                   event_position,
+                           void*                      userdata,
+                           OTF2_AttributeList*        attributeList,
+                           OTF2_CallingContextRef     callingContext,
+                           uint32_t                   unwindDistance,
+                           OTF2_InterruptGeneratorRef interruptGenerator );
+
 /* ___ main _________________________________________________________________ */
 
 static uint64_t number_of_events = 10000;
 
+/** Write an event index, set by OTF2_TEST_EVENT_INDEX. The events then span
+ *  multiple chunks. */
+static bool use_event_index;
+
+/** Write the events without attributes in batches, set by
+ *  OTF2_TEST_EVENT_BATCH. */
+static bool use_event_batch;
+
+/** Write the attribute lists with shapes, set by
+ *  OTF2_TEST_ATTRIBUTE_LIST_SHAPES. */
+static bool use_attribute_list_shapes;
+
+/** Write metric samples as deltas, set by OTF2_TEST_METRIC_DELTAS. */
+static bool use_metric_deltas;
+
+/** Write calling context samples as deltas, set by
+ *  OTF2_TEST_CALLING_CONTEXT_DELTAS. */
+static bool use_calling_context_deltas;
+
+/** Let the chunk sizes adapt to the write rate, set by
+ *  OTF2_TEST_ADAPTIVE_CHUNK_SIZE. */
+static bool use_adaptive_chunk_size;
+
+/** Timestamp of the event at @a position. With adaptive chunk sizes the
+ *  second half of the events is written at a lower rate, thus the chunks
+ *  grow and shrink. */
+static uint64_t
+event_time( uint64_t position )
+{
+    if ( !use_adaptive_chunk_size || position <= number_of_events / 2 )
+    {
+        return position;
+    }
+    return number_of_events / 2 + ( position - number_of_events / 2 ) * 64;
+}
+
 /** Main function
  *
  *  This test generates an OTF2 archive with a defined data set. Afterwards it
@@ -102,6 +159,21 @@ main( int    argc,
 {
     OTF2_ErrorCode status;
 
+    use_event_index = !!getenv( "OTF2_TEST_EVENT_INDEX" );
+    use_event_batch = !!getenv( "OTF2_TEST_EVENT_BATCH" );
+    use_attribute_list_shapes = !!getenv( "OTF2_TEST_ATTRIBUTE_LIST_SHAPES" );
+    use_metric_deltas = !!getenv( "OTF2_TEST_METRIC_DELTAS" );
+    use_calling_context_deltas = !!getenv( "OTF2_TEST_CALLING_CONTEXT_DELTAS" );
+    use_adaptive_chunk_size = !!getenv( "OTF2_TEST_ADAPTIVE_CHUNK_SIZE" );
+    if ( use_event_index )
+    {
+        number_of_events = 100000;
+    }
+    if ( use_adaptive_chunk_size )
+    {
+        number_of_events = 400000;
+    }
+
     status = create_archive( argc > 1 );
     check_status( status, "Create Archive." );
 
@@ -128,7 +200,9 @@ create_archive( bool use_sion )
     OTF2_Archive* archive = OTF2_Archive_Open( "OTF2_Event_Seek_trace",
                                                "TestTrace",
                                                OTF2_FILEMODE_WRITE,
-                                               256 * 1024,
+                                               use_adaptive_chunk_size
+                                               ? 1024 * 1024
+                                               : 256 * 1024,
                                                4 * 1024 * 1024,
                                                use_sion
                                                ? OTF2_SUBSTRATE_SION
@@ -155,18 +229,144 @@ create_archive( bool use_sion )
     status = OTF2_Archive_SetCreator( archive, "OTF2_Event_Seek" );
     check_status( status, "Set creator." );
 
+    if ( use_event_index )
+    {
+        /* Index every 16th event inside the chunks. */
+        uint32_t index_interval = 16;
+        status = OTF2_Archive_SetHint( archive,
+                                       OTF2_HINT_EVENT_INDEX_INTERVAL,
+                                       &index_interval );
+        check_status( status, "Set event index hint." );
+    }
+
+    if ( use_attribute_list_shapes )
+    {
+        /* The attribute lists share their shape, seeking must find its
+         * definition in the chunk. */
+        OTF2_Boolean attribute_list_shapes = OTF2_TRUE;
+        status = OTF2_Archive_SetHint( archive,
+                                       OTF2_HINT_ATTRIBUTE_LIST_SHAPES,
+                                       &attribute_list_shapes );
+        check_status( status, "Set attribute list shapes hint." );
+    }
+
+    if ( use_metric_deltas )
+    {
+        /* The metric samples are deltas to the previous one, seeking and
+         * reading backward must restore it. */
+        OTF2_Boolean metric_deltas = OTF2_TRUE;
+        status = OTF2_Archive_SetHint( archive,
+                                       OTF2_HINT_METRIC_DELTAS,
+                                       &metric_deltas );
+        check_status( status, "Set metric deltas hint." );
+    }
+
+    if ( use_calling_context_deltas )
+    {
+        /* The same for the calling context samples. */
+        OTF2_Boolean calling_context_deltas = OTF2_TRUE;
+        status = OTF2_Archive_SetHint( archive,
+                                       OTF2_HINT_CALLING_CONTEXT_DELTAS,
+                                       &calling_context_deltas );
+        check_status( status, "Set calling context deltas hint." );
+    }
+
+    if ( use_adaptive_chunk_size )
+    {
+        /* The chunks have between 256 KiB and 1 MiB. */
+        uint64_t min_chunk_size = OTF2_CHUNK_SIZE_MIN;
+        status = OTF2_Archive_SetHint( archive,
+                                       OTF2_HINT_ADAPTIVE_CHUNK_SIZE,
+                                       &min_chunk_size );
+        check_status( status, "Set adaptive chunk size hint." );
+    }
+
     status = OTF2_Archive_OpenEvtFiles( archive );
     check_status( status, "Open event files." );
 
     OTF2_EvtWriter* evt_writer = OTF2_Archive_GetEvtWriter( archive, 0 );
     check_pointer( evt_writer, "Get event writer." );
 
+    /* Events without attributes are collected and written in batches, if
+     * requested. */
+    enum
+    {
+        BATCH_SIZE = 64
+    };
+    OTF2_TimeStamp batch_times[ BATCH_SIZE ];
+    OTF2_RegionRef batch_regions[ BATCH_SIZE ] = { 0 };
+    OTF2_Boolean   batch_leave[ BATCH_SIZE ]   = { OTF2_FALSE };
+    uint32_t       batch_length                = 0;
+
     OTF2_AttributeList* attr_list = OTF2_AttributeList_New();
     srand( 3 );
     for ( uint64_t j = 1; j <= number_of_events; j++ )
     {
-        double r = rand() / ( double )RAND_MAX;
-        if ( r <= .25 )
+        double r          = rand() / ( double )RAND_MAX;
+        bool   attributed = r <= .25;
+        bool   metric     = !attributed && r <= .33 && use_metric_deltas;
+        bool   sample     = !attributed && r > .33 && r <= .4 && use_calling_context_deltas;
+
+        if ( use_event_batch && !attributed && !metric && !sample )
+        {
+            batch_times[ batch_length++ ] = event_time( j );
+            if ( batch_length == BATCH_SIZE || j == number_of_events )
+            {
+                status = OTF2_EvtWriter_EnterLeaveBatch( evt_writer,
+                                                         batch_length,
+                                                         batch_times,
+                                                         batch_regions,
+                                                         batch_leave );
+                check_status( status, "Write event batch." );
+                batch_length = 0;
+            }
+            continue;
+        }
+
+        if ( batch_length > 0 )
+        {
+            status = OTF2_EvtWriter_EnterLeaveBatch( evt_writer,
+                                                     batch_length,
+                                                     batch_times,
+                                                     batch_regions,
+                                                     batch_leave );
+            check_status( status, "Write event batch." );
+            batch_length = 0;
+        }
+
+        if ( sample )
+        {
+            /* The attributes follow from the event position. */
+            status = OTF2_EvtWriter_CallingContextSample( evt_writer,
+                                                          NULL,
+                                                          event_time( j ),
+                                                          ( j / 37 ) % 11 * 3,
+                                                          ( j / 101 ) % 4,
+                                                          ( j / 5000 ) % 2 );
+            check_status( status, "Write calling context sample event." );
+            continue;
+        }
+
+        if ( metric )
+        {
+            /* The values follow from the event position. */
+            OTF2_Type        type_ids[ 3 ] = { OTF2_TYPE_UINT64, OTF2_TYPE_INT64, OTF2_TYPE_DOUBLE };
+            OTF2_MetricValue values[ 3 ];
+            values[ 0 ].unsigned_int   = j;
+            values[ 1 ].signed_int     = -( int64_t )j;
+            values[ 2 ].floating_point = j * .5;
+            status = OTF2_EvtWriter_Metric( evt_writer,
+                                            NULL,
+                                            event_time( j ),
+                                            0,
+                                            3,
+                                            type_ids,
+                                            values );
+            check_status( status, "Write metric event." );
+            continue;
+        }
+
+        if ( attributed )
         {
             status = OTF2_AttributeList_AddUint64( attr_list, 0, j );
             check_status( status, "Add attribute." );
@@ -174,8 +374,8 @@ create_archive( bool use_sion )
         status = OTF2_EvtWriter_Enter(
             evt_writer,
             attr_list,
-            j,
-            0 );
+            event_time( j ),
+            attributed && use_attribute_list_shapes ? 1 : 0 );
         check_status( status, "Write event." );
     }
     OTF2_AttributeList_Delete( attr_list );
@@ -220,10 +420,48 @@ create_archive( bool use_sion )
         OTF2_UNDEFINED_UINT32, 0, 0 );
     check_status( status, "Write region" );
 
+    if ( use_attribute_list_shapes )
+    {
+        status = OTF2_GlobalDefWriter_WriteRegion(
+            global_def_writer, 1, 0, 0, 0,
+            OTF2_REGION_ROLE_UNKNOWN, OTF2_PARADIGM_UNKNOWN, OTF2_REGION_FLAG_NONE,
+            OTF2_UNDEFINED_UINT32, 0, 0 );
+        check_status( status, "Write region" );
+    }
+
     status = OTF2_GlobalDefWriter_WriteAttribute(
         global_def_writer, 0, 0, 0, OTF2_TYPE_UINT64 );
     check_status( status, "Write attribute" );
 
+    if ( use_metric_deltas )
+    {
+        OTF2_Type metric_types[ 3 ] = { OTF2_TYPE_UINT64, OTF2_TYPE_INT64, OTF2_TYPE_DOUBLE };
+        for ( OTF2_MetricMemberRef member = 0; member < 3; member++ )
+        {
+            status = OTF2_GlobalDefWriter_WriteMetricMember(
+                global_def_writer, member, 0, 0,
+                OTF2_METRIC_TYPE_USER, OTF2_METRIC_ABSOLUTE_POINT,
+                metric_types[ member ], OTF2_BASE_DECIMAL, 0, 0 );
+            check_status( status, "Write metric member" );
+        }
+
+        OTF2_MetricMemberRef metric_members[ 3 ] = { 0, 1, 2 };
+        status = OTF2_GlobalDefWriter_WriteMetricClass(
+            global_def_writer, 0, 3, metric_members,
+            OTF2_METRIC_ASYNCHRONOUS, OTF2_RECORDER_KIND_ABSTRACT );
+        check_status( status, "Write metric class" );
+    }
+
+    for ( OTF2_InterruptGeneratorRef generator = 0;
+          use_calling_context_deltas && generator < 2;
+          generator++ )
+    {
+        status = OTF2_GlobalDefWriter_WriteInterruptGenerator(
+            global_def_writer, generator, 0,
+            OTF2_INTERRUPT_GENERATOR_MODE_COUNT, OTF2_BASE_DECIMAL, 0, 1000 );
+        check_status( status, "Write interrupt generator" );
+    }
+
     status = OTF2_Archive_CloseGlobalDefWriter( archive, global_def_writer );
     check_status( status, "Closing global definition writer." );
 
@@ -336,6 +574,8 @@ check_archive( void )
     check_pointer( check_evts, "Create global event callbacks." );
 
     OTF2_EvtReaderCallbacks_SetEnterCallback( check_evts, enter_cb );
+    OTF2_EvtReaderCallbacks_SetMetricCallback( check_evts, metric_cb );
+    OTF2_EvtReaderCallbacks_SetCallingContextSampleCallback( check_evts, calling_context_sample_cb );
 
     status = OTF2_Reader_RegisterEvtCallbacks( reader,
                                                evt_reader,
@@ -419,6 +659,31 @@ check_archive( void )
         check_status( status, "Read one event." );
     }
 
+    /* Read all events backward, starting behind the last one. */
+    expected_event_position = number_of_events;
+    status                  = OTF2_EvtReader_Seek( evt_reader, expected_event_position );
+    check_status( status, "Seek to last event." );
+
+    status = OTF2_EvtReader_ReadEvents( evt_reader,
+                                        1,
+                                        &events_read );
+    check_status( status, "Read last event." );
+
+    for ( ; expected_event_position > 0; expected_event_position-- )
+    {
+        status = OTF2_EvtReader_ReadEventsBackward( evt_reader,
+                                                    1,
+                                                    &events_read );
+        check_status( status, "Read event #%" PRIu64 " backward.", expected_event_position );
+        check_condition( events_read == 1, "Missing event #%" PRIu64 ".", expected_event_position );
+    }
+
+    status = OTF2_EvtReader_ReadEventsBackward( evt_reader,
+                                                1,
+                                                &events_read );
+    check_status( status, "Read backward at the begin." );
+    check_condition( events_read == 0, "Read before the first event." );
+
     status = OTF2_Reader_CloseEvtReader( reader, evt_reader );
     check_status( status, "Closing event reader." );
 
@@ -458,12 +723,17 @@ enter_cb( uint64_t            locationID,
 {
     uint64_t expected_event_position = *( uint64_t* )userdata;
 
-    check_condition( time == expected_event_position,
+    check_condition( time == event_time( expected_event_position ),
                      "Time doesn't match the expected event position: %" PRIu64, time );
 
     check_condition( event_position == expected_event_position,
                      "The told event position doesn't match the expected event position: %" PRIu64, event_position );
 
+    /* With shapes, only the events of region 1 have an attribute. */
+    check_condition( !use_attribute_list_shapes
+                     || ( region == 1 ) == OTF2_AttributeList_TestAttributeByID( attributeList, 0 ),
+                     "Attribute list doesn't match the region of the event: %" PRIu64, event_position );
+
     if ( OTF2_AttributeList_TestAttributeByID( attributeList, 0 ) )
     {
         OTF2_ErrorCode ret;
@@ -478,4 +748,65 @@ enter_cb( uint64_t            locationID,
 }
 
 
+OTF2_CallbackCode
+metric_cb( uint64_t                locationID,
+           uint64_t                time,
+           uint64_t                event_position,
+           void*                   userdata,
+           OTF2_AttributeList*     attributeList,
+           OTF2_MetricRef          metric,
+           uint8_t                 numberOfMetrics,
+           const OTF2_Type*        typeIDs,
+           const OTF2_MetricValue* metricValues )
+{
+    uint64_t expected_event_position = *( uint64_t* )userdata;
+
+    check_condition( time == event_time( expected_event_position ),
+                     "Time doesn't match the expected event position: %" PRIu64, time );
+
+    check_condition( event_position == expected_event_position,
+                     "The told event position doesn't match the expected event position: %" PRIu64, event_position );
+
+    check_condition( metric == 0 && numberOfMetrics == 3 &&
+                     typeIDs[ 0 ] == OTF2_TYPE_UINT64 &&
+                     typeIDs[ 1 ] == OTF2_TYPE_INT64 &&
+                     typeIDs[ 2 ] == OTF2_TYPE_DOUBLE,
+                     "Metric sample doesn't match its class: %" PRIu64, event_position );
+
+    check_condition( metricValues[ 0 ].unsigned_int == event_position &&
+                     metricValues[ 1 ].signed_int == -( int64_t )event_position &&
+                     metricValues[ 2 ].floating_point == event_position * .5,
+                     "Metric values don't match the event position: %" PRIu64, event_position );
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+OTF2_CallbackCode
+calling_context_sample_cb( uint64_t                   locationID,
+                           uint64_t                   time,
+                           uint64_t                   event_position,
+                           void*                      userdata,
+                           OTF2_AttributeList*        attributeList,
+                           OTF2_CallingContextRef     callingContext,
+                           uint32_t                   unwindDistance,
+                           OTF2_InterruptGeneratorRef interruptGenerator )
+{
+    uint64_t expected_event_position = *( uint64_t* )userdata;
+
+    check_condition( time == event_time( expected_event_position ),
+                     "Time doesn't match the expected event position: %" PRIu64, time );
+
+    check_condition( event_position == expected_event_position,
+                     "The told event position doesn't match the expected event position: %" PRIu64, event_position );
+
+    check_condition( callingContext == ( event_position / 37 ) % 11 * 3 &&
+                     unwindDistance == ( event_position / 101 ) % 4 &&
+                     interruptGenerator == ( event_position / 5000 ) % 2,
+                     "Calling context sample doesn't match the event position: %" PRIu64, event_position );
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
 /** @} */
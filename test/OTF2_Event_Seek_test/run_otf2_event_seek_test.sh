@@ -41,3 +41,27 @@ trap cleanup EXIT
 
 cleanup
 $VALGRIND ./OTF2_Event_Seek_test
+
+# with an event index, the events span multiple chunks
+cleanup
+OTF2_TEST_EVENT_INDEX=1 $VALGRIND ./OTF2_Event_Seek_test
+
+# with the events without attributes written in batches
+cleanup
+OTF2_TEST_EVENT_INDEX=1 OTF2_TEST_EVENT_BATCH=1 $VALGRIND ./OTF2_Event_Seek_test
+
+# with the attribute lists written with shapes
+cleanup
+OTF2_TEST_EVENT_INDEX=1 OTF2_TEST_ATTRIBUTE_LIST_SHAPES=1 $VALGRIND ./OTF2_Event_Seek_test
+
+# with metric samples written as deltas
+cleanup
+OTF2_TEST_EVENT_INDEX=1 OTF2_TEST_METRIC_DELTAS=1 $VALGRIND ./OTF2_Event_Seek_test
+
+# with calling context samples written as deltas
+cleanup
+OTF2_TEST_EVENT_INDEX=1 OTF2_TEST_CALLING_CONTEXT_DELTAS=1 $VALGRIND ./OTF2_Event_Seek_test
+
+# with chunk sizes adapting to the write rate
+cleanup
+OTF2_TEST_EVENT_INDEX=1 OTF2_TEST_ADAPTIVE_CHUNK_SIZE=1 $VALGRIND ./OTF2_Event_Seek_test
@@ -81,6 +81,15 @@
 /** @brief Trace name */
 #define OTF2_TRACE_NAME "TestTrace"
 
+/** @brief Number of locations with local definitions to unify. */
+#define NUM_UNIFY_LOCATIONS 16
+
+/** @brief Path of the archive with the local definitions to unify. */
+#define OTF2_UNIFY_ARCHIVE_PATH "OTF2_Integrity_unify_trace"
+
+/** @brief Path of the archive with the unified definitions. */
+#define OTF2_UNIFIED_ARCHIVE_PATH "OTF2_Integrity_unified_trace"
+
 
 /* ___ Global variables. ____________________________________________________ */
 
@@ -95,19 +104,99 @@ static uint64_t otf2_Time;
 static uint64_t otf2_Region;
 
 
+/** @internal
+ *  @brief Timestamp of the first event read. */
+static uint64_t otf2_FirstTime;
+
+
+/** @internal
+ *  @brief Time window to count the events in, passed as user data. */
+struct time_window
+{
+    uint64_t begin;
+    uint64_t end;
+    uint64_t events;
+};
+
+
+/** @internal
+ *  @brief Sequence of the events of the first read, in global order. */
+static struct
+{
+    uint64_t time;
+    uint64_t location;
+    uint32_t region;
+} otf2_Sequence[ 6 * NUM_LOCATIONS * NUMBER_OF_EVENTS ];
+
+
+/** @internal
+ *  @brief Number of events in @a otf2_Sequence. */
+static uint64_t otf2_SequenceLength;
+
+
+/** @internal
+ *  @brief Compare the events against @a otf2_Sequence instead of recording. */
+static bool otf2_Replay;
+
+
+/** @internal
+ *  @brief Number of events in @a otf2_Sequence before the reader position,
+ *         if replaying. */
+static uint64_t otf2_Cursor;
+
+
+/** @internal
+ *  @brief The events are read backward, if replaying. */
+static bool otf2_Backward;
+
+
+/** @internal
+ *  @brief The archive was written by this test and has event time ranges. */
+static bool otf2_HasEventTimeRanges;
+
+
+/** @internal
+ *  @brief Range of the event timestamps of a location. */
+struct event_time_range
+{
+    bool     valid;
+    uint64_t first;
+    uint64_t last;
+};
+
+
 /* ___ Prototypes for static functions. _____________________________________ */
 
 
 static OTF2_ErrorCode
-create_archive( bool use_sion );
+create_archive( bool use_sion,
+                bool use_hints );
+
+static OTF2_ErrorCode
+check_archive( const char* trace,
+               bool        bounded );
+
+static void
+check_time( void*    userData,
+            uint64_t locationID,
+            uint64_t time,
+            uint32_t regionID );
+
+static OTF2_ErrorCode
+create_unify_archive( void );
 
 static OTF2_ErrorCode
-check_archive( const char* trace );
+check_unification( void );
 
 
 /* ___ Prototypes for all callbacks. ________________________________________ */
 
 
+static OTF2_CallbackCode
+event_time_range_cb( void*          userData,
+                     OTF2_TimeStamp firstTimestamp,
+                     OTF2_TimeStamp lastTimestamp );
+
 static OTF2_CallbackCode
 global_def_location_cb( void*             userData,
                         uint64_t          locationIdentifier,
@@ -174,20 +263,36 @@ main( int   argc,
 
     otf2_DEBUG = !!getenv( "OTF2_DEBUG_TESTS" );
 
+    const char* trace = OTF2_ARCHIVE_PATH "/" OTF2_TRACE_NAME ".otf2";
     if ( argc == 1 )
     {
-        status = create_archive( !!getenv( "OTF2_TEST_USE_SION" ) );
+        status = create_archive( !!getenv( "OTF2_TEST_USE_SION" ),
+                                 !!getenv( "OTF2_TEST_USE_HINTS" ) );
         check_status( status, "Create Archive." );
-
-        status = check_archive( OTF2_ARCHIVE_PATH "/" OTF2_TRACE_NAME ".otf2" );
-        check_status( status, "Check Archive." );
+        otf2_HasEventTimeRanges = true;
     }
     else
     {
-        status = check_archive( argv[ 1 ] );
-        check_status( status, "Check Archive." );
+        trace = argv[ 1 ];
+    }
+
+    status = check_archive( trace, false );
+    check_status( status, "Check Archive." );
+
+    if ( argc == 1 )
+    {
+        status = create_unify_archive();
+        check_status( status, "Create archive with local definitions." );
+
+        status = check_unification();
+        check_status( status, "Check unification." );
     }
 
+    /* Once more with only one open file and minimal chunk memory, so that
+     * files and chunks need to be re-read constantly. */
+    status = check_archive( trace, true );
+    check_status( status, "Check Archive with bounded resources." );
+
 
     return EXIT_SUCCESS;
 }
@@ -196,11 +301,16 @@ main( int   argc,
 /** @internal
  *  @brief Create an OTF2 archive.
  *
+ *  @param use_sion         Use the SION substrate.
+ *  @param use_hints        Set the event index, implicit leave, and chunk
+ *                          allocation hints.
+ *
  *  @return                 Returns OTF2_SUCCESS if successful, an error code
  *                          if an error occurs.
  */
 OTF2_ErrorCode
-create_archive( bool use_sion )
+create_archive( bool use_sion,
+                bool use_hints )
 {
     /* Create new archive handle. */
     OTF2_Archive* archive = OTF2_Archive_Open( OTF2_ARCHIVE_PATH,
@@ -229,11 +339,31 @@ create_archive( bool use_sion )
 #endif
     status = OTF2_Pthread_Archive_SetLockingCallbacks( archive, &attr );
     check_status( status, "Set Pthread locking callbacks." );
+    status = OTF2_Pthread_Archive_SetParallelCallbacks( archive, 4 );
+    check_status( status, "Set Pthread parallel callbacks." );
 #endif
     status = OTF2_Archive_SetDescription( archive, "OTF2 trace for integrity test." );
     check_status( status, "Set description." );
     status = OTF2_Archive_SetCreator( archive, "OTF2_Integrity" );
     check_status( status, "Set creator." );
+    if ( use_hints )
+    {
+        uint32_t index_interval = 64;
+        status = OTF2_Archive_SetHint( archive,
+                                       OTF2_HINT_EVENT_INDEX_INTERVAL,
+                                       &index_interval );
+        check_status( status, "Set event index hint." );
+        OTF2_Boolean implicit_leave = OTF2_TRUE;
+        status = OTF2_Archive_SetHint( archive,
+                                       OTF2_HINT_IMPLICIT_LEAVE,
+                                       &implicit_leave );
+        check_status( status, "Set implicit leave hint." );
+        OTF2_ChunkAllocation chunk_allocation = OTF2_CHUNK_ALLOCATION_HUGE_PAGES;
+        status = OTF2_Archive_SetHint( archive,
+                                       OTF2_HINT_CHUNK_ALLOCATION,
+                                       &chunk_allocation );
+        check_status( status, "Set chunk allocation hint." );
+    }
 
 
     /* Generate location IDs. Just to have non-consecutive location IDs. */
@@ -292,19 +422,10 @@ create_archive( bool use_sion )
     OTF2_DefWriter* def_writer = NULL;
 
 
-    status = OTF2_Archive_OpenDefFiles( archive );
-    check_status( status, "Open local definitions files." );
-    for ( uint64_t i = 0; i < NUM_LOCATIONS; ++i )
-    {
-        /* Just open a definition writer, so the file is created. */
-        def_writer = OTF2_Archive_GetDefWriter( archive, locations[ i ] );
-        check_pointer( def_writer, "Get definition writer." );
-
-        status = OTF2_Archive_CloseDefWriter( archive, def_writer );
-        check_status( status, "Close definition writer." );
-    }
-    status = OTF2_Archive_CloseDefFiles( archive );
-    check_status( status, "Close local definitions files." );
+    /* Region 2 is not defined and its enters and leaves are dropped. */
+    OTF2_RegionRef filtered_region = 2;
+    status = OTF2_Archive_SetRegionFilter( archive, 1, &filtered_region, OTF2_TRUE );
+    check_status( status, "Set region filter." );
 
     status = OTF2_Archive_OpenEvtFiles( archive );
     check_status( status, "Open event files." );
@@ -317,12 +438,44 @@ create_archive( bool use_sion )
 
             /* Write enter, mpi_send, leave and region definition. */
             uint64_t ts = otf2_test_gettime();
+            if ( j == 0 )
+            {
+                status = OTF2_EvtWriter_SetDurationFilter( evt_writer, 1, OTF2_TRUE );
+                check_status( status, "Set duration filter." );
+            }
+            status = OTF2_EvtWriter_Enter( evt_writer, NULL, ts, 2 );
+            check_status( status, "Write Enter." );
             status = OTF2_EvtWriter_Enter( evt_writer, NULL, ts, 0 );
             check_status( status, "Write Enter." );
             status = OTF2_EvtWriter_MpiSend( evt_writer, NULL, ts, locations[ i ], 0, 42, 1024 );
             check_status( status, "Write MPI_Send." );
+            if ( j == 0 )
+            {
+                /* The rewind drops the decision of the suppressed enter. */
+                status = OTF2_EvtWriter_StoreRewindPoint( evt_writer, 0 );
+                check_status( status, "Store rewind point." );
+                status = OTF2_EvtWriter_Enter( evt_writer, NULL, otf2_test_gettime(), 2 );
+                check_status( status, "Write Enter." );
+                status = OTF2_EvtWriter_Rewind( evt_writer, 0 );
+                check_status( status, "Rewind." );
+                status = OTF2_EvtWriter_ClearRewindPoint( evt_writer, 0 );
+                check_status( status, "Clear rewind point." );
+            }
             status = OTF2_EvtWriter_Leave( evt_writer, NULL, otf2_test_gettime(), 0 );
             check_status( status, "Write Leave." );
+            if ( j == 0 )
+            {
+                /* The leave is dropped with its enter anyway. */
+                status = OTF2_Archive_SetRegionFilter( archive, 1, &filtered_region, OTF2_FALSE );
+                check_status( status, "Set region filter." );
+            }
+            status = OTF2_EvtWriter_Leave( evt_writer, NULL, otf2_test_gettime(), 2 );
+            check_status( status, "Write Leave." );
+            if ( j == 0 )
+            {
+                status = OTF2_Archive_SetRegionFilter( archive, 1, &filtered_region, OTF2_TRUE );
+                check_status( status, "Set region filter." );
+            }
 
             /* Write enter, mpi_recv, leave and region definition. */
             status = OTF2_EvtWriter_Enter( evt_writer, NULL, otf2_test_gettime(), 1 );
@@ -332,6 +485,17 @@ create_archive( bool use_sion )
             check_status( status, "Write MPI_Send." );
             status = OTF2_EvtWriter_Leave( evt_writer, NULL, ts, 1 );
             check_status( status, "Write Leave." );
+
+            /* Write nested regions without other events, which are
+             * dropped by the duration filter. */
+            status = OTF2_EvtWriter_Enter( evt_writer, NULL, ts, 0 );
+            check_status( status, "Write Enter." );
+            status = OTF2_EvtWriter_Enter( evt_writer, NULL, ts, 1 );
+            check_status( status, "Write Enter." );
+            status = OTF2_EvtWriter_Leave( evt_writer, NULL, ts, 1 );
+            check_status( status, "Write Leave." );
+            status = OTF2_EvtWriter_Leave( evt_writer, NULL, ts, 0 );
+            check_status( status, "Write Leave." );
         }
     }
     for ( uint64_t i = 0; i < NUM_LOCATIONS; ++i )
@@ -339,12 +503,38 @@ create_archive( bool use_sion )
         evt_writer = OTF2_Archive_GetEvtWriter( archive, locations[ i ] );
         check_pointer( evt_writer, "Get event writer." );
 
-        status = OTF2_Archive_CloseEvtWriter( archive, evt_writer );
-        check_status( status, "Close event writer." );
+        for ( OTF2_RegionRef region = 0; region < 2; region++ )
+        {
+            uint64_t       calls;
+            OTF2_TimeStamp duration;
+            status = OTF2_EvtWriter_GetFilteredRegion( evt_writer, region, &calls, &duration );
+            check_status( status, "Get filtered region." );
+            check_condition( calls == NUMBER_OF_EVENTS && duration == 0,
+                             "Number of filtered calls does not match!" );
+        }
+        uint64_t calls;
+        status = OTF2_EvtWriter_GetSuppressedCalls( evt_writer, filtered_region, &calls );
+        check_status( status, "Get suppressed calls." );
+        /* The rewound enter was suppressed, too. */
+        check_condition( calls == NUMBER_OF_EVENTS + 1,
+                         "Number of suppressed calls does not match!" );
     }
+    /* The event writers are still open and will be closed here. */
     status = OTF2_Archive_CloseEvtFiles( archive );
     check_status( status, "Close event files." );
 
+    status = OTF2_Archive_OpenDefFiles( archive );
+    check_status( status, "Open local definitions files." );
+    for ( uint64_t i = 0; i < NUM_LOCATIONS; ++i )
+    {
+        def_writer = OTF2_Archive_GetDefWriter( archive, locations[ i ] );
+        check_pointer( def_writer, "Get definition writer." );
+    }
+    /* The definition writers are still open and will be closed here, they
+     * store the event time ranges recorded by the event writers. */
+    status = OTF2_Archive_CloseDefFiles( archive );
+    check_status( status, "Close local definitions files." );
+
 
     /* Finalize. */
     OTF2_Archive_Close( archive );
@@ -361,16 +551,39 @@ create_archive( bool use_sion )
  *                          if an error occurs.
  */
 OTF2_ErrorCode
-check_archive( const char* trace )
+check_archive( const char* trace,
+               bool        bounded )
 {
     OTF2_ErrorCode status;
 
+    otf2_Time      = 0;
+    otf2_Region    = 0;
+    otf2_FirstTime = OTF2_UNDEFINED_TIMESTAMP;
+
+    otf2_SequenceLength = 0;
+    otf2_Replay         = false;
+
     /* Get a reader handle. */
     OTF2_Reader* reader = OTF2_Reader_Open( trace );
     check_pointer( reader, "Create new reader handle." );
     status = OTF2_Reader_SetSerialCollectiveCallbacks( reader );
     check_status( status, "Set serial mode." );
 
+    if ( bounded )
+    {
+        uint32_t max_open_files = 1;
+        status = OTF2_Reader_SetHint( reader,
+                                      OTF2_HINT_MAX_OPEN_FILES,
+                                      &max_open_files );
+        check_status( status, "Set max-open-files hint." );
+
+        uint64_t max_chunk_memory = 1;
+        status = OTF2_Reader_SetHint( reader,
+                                      OTF2_HINT_MAX_CHUNK_MEMORY,
+                                      &max_chunk_memory );
+        check_status( status, "Set max-chunk-memory hint." );
+    }
+
     /* Get number of locations from the anchor file. */
     uint64_t num_locations = 0;
     status = OTF2_Reader_GetNumberOfLocations( reader, &num_locations );
@@ -423,6 +636,12 @@ check_archive( const char* trace )
     }
 
     /* Also open a definition reader and read all local definitions. */
+    OTF2_DefReaderCallbacks* check_local_defs = OTF2_DefReaderCallbacks_New();
+    check_pointer( check_local_defs, "Create local definition callback handle." );
+    OTF2_DefReaderCallbacks_SetEventTimeRangeCallback( check_local_defs, event_time_range_cb );
+    struct event_time_range ranges[ num_locations + 1 ];
+    memset( ranges, 0, sizeof( ranges ) );
+
     status = OTF2_Reader_OpenDefFiles( reader );
     check_status( status, "Open local def files for reading." );
     status = OTF2_Reader_OpenEvtFiles( reader );
@@ -433,6 +652,11 @@ check_archive( const char* trace )
                                                                locations_to_read[ location_index ] );
         check_pointer( def_reader, "Create local definition reader for #%" PRIu64, locations_to_read[ location_index ] );
 
+        status = OTF2_Reader_RegisterDefCallbacks( reader, def_reader,
+                                                   check_local_defs,
+                                                   &ranges[ location_index ] );
+        check_status( status, "Register local definition callbacks." );
+
         status = OTF2_Reader_ReadAllLocalDefinitions( reader, def_reader,
                                                       &definitions_read );
         check_status( status, "Read local definitions." );
@@ -447,6 +671,7 @@ check_archive( const char* trace )
     }
     status = OTF2_Reader_CloseDefFiles( reader );
     check_status( status, "Close local def files for reading." );
+    OTF2_DefReaderCallbacks_Delete( check_local_defs );
 
     /* Get global event reader. */
     OTF2_GlobalEvtReader* global_evt_reader = OTF2_Reader_GetGlobalEvtReader( reader );
@@ -466,8 +691,6 @@ check_archive( const char* trace )
                                                      NULL );
     check_status( status, "Register global event callbacks." );
 
-    OTF2_GlobalEvtReaderCallbacks_Delete( check_evts );
-
     /* Read until an error occures. */
     uint64_t events_read = 0;
     status = OTF2_Reader_ReadGlobalEvents( reader, global_evt_reader, OTF2_UNDEFINED_UINT64, &events_read );
@@ -479,6 +702,121 @@ check_archive( const char* trace )
                       "Number of events read does not match!" );
     }
 
+    /* The event writers recorded the event time ranges. */
+    for ( uint64_t location_index = 1;
+          otf2_HasEventTimeRanges && location_index <= num_locations;
+          location_index++ )
+    {
+        uint64_t first = OTF2_UNDEFINED_TIMESTAMP;
+        uint64_t last  = 0;
+        for ( uint64_t i = 0; i < otf2_SequenceLength; i++ )
+        {
+            if ( otf2_Sequence[ i ].location == locations_to_read[ location_index ] )
+            {
+                if ( first == OTF2_UNDEFINED_TIMESTAMP )
+                {
+                    first = otf2_Sequence[ i ].time;
+                }
+                last = otf2_Sequence[ i ].time;
+            }
+        }
+        check_condition( ranges[ location_index ].valid
+                         && ranges[ location_index ].first == first
+                         && ranges[ location_index ].last == last,
+                         "Event time range does not match!" );
+    }
+
+    /* Seek back into the middle third of the trace and read only this time
+     * window. */
+    struct time_window window;
+    window.begin  = otf2_FirstTime + ( otf2_Time - otf2_FirstTime ) / 3;
+    window.end    = otf2_FirstTime + 2 * ( otf2_Time - otf2_FirstTime ) / 3;
+    window.events = 0;
+
+    status = OTF2_Reader_RegisterGlobalEvtCallbacks( reader, global_evt_reader,
+                                                     check_evts,
+                                                     &window );
+    check_status( status, "Register global event callbacks." );
+
+    status = OTF2_GlobalEvtReader_SeekTime( global_evt_reader, window.begin );
+    check_status( status, "Seek global event reader." );
+    status = OTF2_GlobalEvtReader_SetEndTime( global_evt_reader, window.end );
+    check_status( status, "Set end time of global event reader." );
+
+    otf2_Time = window.begin;
+    status    = OTF2_Reader_ReadGlobalEvents( reader, global_evt_reader, OTF2_UNDEFINED_UINT64, &events_read );
+    check_status( status, "Read %" PRIu64 " events.", events_read );
+    check_condition( events_read > 0 && events_read == window.events,
+                     "Events outside of the time window read!" );
+
+    /* Read the whole trace again and count the events in the window. */
+    struct time_window whole = window;
+    whole.events = 0;
+    status       = OTF2_Reader_RegisterGlobalEvtCallbacks( reader, global_evt_reader,
+                                                           check_evts,
+                                                           &whole );
+    check_status( status, "Register global event callbacks." );
+
+    status = OTF2_GlobalEvtReader_SeekTime( global_evt_reader, 0 );
+    check_status( status, "Seek global event reader." );
+    status = OTF2_GlobalEvtReader_SetEndTime( global_evt_reader, OTF2_UNDEFINED_TIMESTAMP );
+    check_status( status, "Set end time of global event reader." );
+
+    otf2_Time = 0;
+    status    = OTF2_Reader_ReadGlobalEvents( reader, global_evt_reader, OTF2_UNDEFINED_UINT64, &events_read );
+    check_status( status, "Read %" PRIu64 " events.", events_read );
+    check_condition( events_read == ( 6 * NUM_LOCATIONS * NUMBER_OF_EVENTS ),
+                     "Number of events read after seek does not match!" );
+    check_condition( whole.events == window.events,
+                     "Number of events in the time window does not match!" );
+
+    /* Read the whole trace backward, the events must be delivered in the
+     * exact reverse order. */
+    otf2_Replay   = true;
+    otf2_Backward = true;
+    otf2_Cursor   = otf2_SequenceLength;
+    status        = OTF2_GlobalEvtReader_SeekTime( global_evt_reader, OTF2_UNDEFINED_TIMESTAMP );
+    check_status( status, "Seek global event reader to the end." );
+    status = OTF2_Reader_ReadGlobalEventsBackward( reader, global_evt_reader, OTF2_UNDEFINED_UINT64, &events_read );
+    check_status( status, "Read %" PRIu64 " events backward.", events_read );
+    check_condition( events_read == otf2_SequenceLength && otf2_Cursor == 0,
+                     "Number of events read backward does not match!" );
+
+    /* Turn at the begin of the trace. */
+    otf2_Backward = false;
+    status        = OTF2_Reader_ReadGlobalEvents( reader, global_evt_reader, 1000, &events_read );
+    check_status( status, "Read %" PRIu64 " events.", events_read );
+    check_condition( events_read == 1000 && otf2_Cursor == 1000,
+                     "Number of events read after turn does not match!" );
+
+    /* Seek into the trace and change the direction twice. */
+    status = OTF2_GlobalEvtReader_SeekTime( global_evt_reader, window.begin );
+    check_status( status, "Seek global event reader." );
+    otf2_Cursor = 0;
+    while ( otf2_Sequence[ otf2_Cursor ].time < window.begin )
+    {
+        otf2_Cursor++;
+    }
+    uint64_t seek_cursor = otf2_Cursor;
+
+    status = OTF2_Reader_ReadGlobalEvents( reader, global_evt_reader, 1000, &events_read );
+    check_status( status, "Read %" PRIu64 " events.", events_read );
+    check_condition( events_read == 1000, "Number of events read does not match!" );
+
+    otf2_Backward = true;
+    status        = OTF2_Reader_ReadGlobalEventsBackward( reader, global_evt_reader, 2000, &events_read );
+    check_status( status, "Read %" PRIu64 " events backward.", events_read );
+    check_condition( events_read == 2000 && otf2_Cursor == seek_cursor - 1000,
+                     "Number of events read backward does not match!" );
+
+    otf2_Backward = false;
+    status        = OTF2_Reader_ReadGlobalEvents( reader, global_evt_reader, OTF2_UNDEFINED_UINT64, &events_read );
+    check_status( status, "Read %" PRIu64 " events.", events_read );
+    check_condition( otf2_Cursor == otf2_SequenceLength,
+                     "Number of events read after turn does not match!" );
+
+    OTF2_GlobalEvtReaderCallbacks_Delete( check_evts );
+
     status = OTF2_Reader_CloseGlobalEvtReader( reader, global_evt_reader );
     check_status( status, "Close global event reader." );
 
@@ -498,6 +836,32 @@ check_archive( const char* trace )
 
 
 
+/** @internal
+ *  @brief Callback for the event time range of a location.
+ *
+ *  @param userData             The range to fill.
+ *  @param firstTimestamp       Timestamp of the first event.
+ *  @param lastTimestamp        Timestamp of the last event.
+ *
+ *  @return                     Returns OTF2_SUCCESS if successful, an error
+ *                              code if an error occures.
+ */
+OTF2_CallbackCode
+event_time_range_cb( void*          userData,
+                     OTF2_TimeStamp firstTimestamp,
+                     OTF2_TimeStamp lastTimestamp )
+{
+    struct event_time_range* range = userData;
+    check_condition( !range->valid, "Duplicate event time range." );
+
+    range->valid = true;
+    range->first = firstTimestamp;
+    range->last  = lastTimestamp;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
 /** @internal
  *  @brief Callbacks for location definition.
  *
@@ -529,6 +893,74 @@ global_def_location_cb( void*             userData,
 }
 
 
+/** @internal
+ *  @brief Checks the order of the event timestamps.
+ *
+ *  The first read records the sequence of events, when replaying the events
+ *  must match this sequence in the reading direction.
+ *
+ *  @param userData         The time window to count the events in, if any.
+ *  @param locationID       Location of the event.
+ *  @param time             Timestamp of the event.
+ *  @param regionID         Region of enter and leave events, else
+ *                          OTF2_UNDEFINED_REGION.
+ */
+void
+check_time( void*    userData,
+            uint64_t locationID,
+            uint64_t time,
+            uint32_t regionID )
+{
+    if ( otf2_Replay )
+    {
+        if ( otf2_Backward )
+        {
+            check_condition( otf2_Cursor > 0, "Event before the begin of the trace." );
+            otf2_Cursor--;
+        }
+        else
+        {
+            check_condition( otf2_Cursor < otf2_SequenceLength, "Event after the end of the trace." );
+        }
+        check_condition( otf2_Sequence[ otf2_Cursor ].time == time
+                         && otf2_Sequence[ otf2_Cursor ].location == locationID,
+                         "Event order failure." );
+        check_condition( otf2_Sequence[ otf2_Cursor ].region == regionID,
+                         "Region ID failure." );
+        if ( !otf2_Backward )
+        {
+            otf2_Cursor++;
+        }
+        return;
+    }
+
+    if ( !userData )
+    {
+        otf2_Sequence[ otf2_SequenceLength ].time     = time;
+        otf2_Sequence[ otf2_SequenceLength ].location = locationID;
+        otf2_Sequence[ otf2_SequenceLength ].region   = regionID;
+        otf2_SequenceLength++;
+    }
+
+    if ( time < otf2_Time )
+    {
+        check_status( OTF2_ERROR_INTEGRITY_FAULT, "Timestamp failure." );
+    }
+    otf2_Time = time;
+
+    if ( otf2_FirstTime == OTF2_UNDEFINED_TIMESTAMP )
+    {
+        otf2_FirstTime = time;
+    }
+
+    struct time_window* window = userData;
+    if ( window && time >= window->begin && time <= window->end )
+    {
+        window->events++;
+    }
+}
+
+
 /** @internal
  *  @name Callbacks for events.
  *
@@ -547,13 +979,9 @@ enter_cb( uint64_t            locationID,
           OTF2_AttributeList* attributes,
           uint32_t            regionID )
 {
-    if ( time < otf2_Time )
-    {
-        check_status( OTF2_ERROR_INTEGRITY_FAULT, "Timestamp failure." );
-    }
-    otf2_Time = time;
+    check_time( userData, locationID, time, regionID );
 
-    if ( regionID != otf2_Region )
+    if ( !userData && !otf2_Replay && regionID != otf2_Region )
     {
         check_status( OTF2_ERROR_INTEGRITY_FAULT, "Region ID failure." );
     }
@@ -568,13 +996,9 @@ leave_cb( uint64_t            locationID,
           OTF2_AttributeList* attributes,
           uint32_t            regionID )
 {
-    if ( time < otf2_Time )
-    {
-        check_status( OTF2_ERROR_INTEGRITY_FAULT, "Timestamp failure." );
-    }
-    otf2_Time = time;
+    check_time( userData, locationID, time, regionID );
 
-    if ( regionID != otf2_Region )
+    if ( !userData && !otf2_Replay && regionID != otf2_Region )
     {
         check_status( OTF2_ERROR_INTEGRITY_FAULT, "Region ID failure." );
     }
@@ -593,11 +1017,7 @@ mpi_send_cb( uint64_t            locationID,
              uint32_t            msgTag,
              uint64_t            msgLength )
 {
-    if ( time < otf2_Time )
-    {
-        check_status( OTF2_ERROR_INTEGRITY_FAULT, "Timestamp failure." );
-    }
-    otf2_Time = time;
+    check_time( userData, locationID, time, OTF2_UNDEFINED_REGION );
 
     if ( locationID != receiver )
     {
@@ -633,11 +1053,7 @@ mpi_recv_cb( uint64_t            locationID,
              uint32_t            msgTag,
              uint64_t            msgLength )
 {
-    if ( time < otf2_Time )
-    {
-        check_status( OTF2_ERROR_INTEGRITY_FAULT, "Timestamp failure." );
-    }
-    otf2_Time = time;
+    check_time( userData, locationID, time, OTF2_UNDEFINED_REGION );
 
     if ( locationID != sender )
     {
@@ -662,4 +1078,843 @@ mpi_recv_cb( uint64_t            locationID,
     return OTF2_CALLBACK_SUCCESS;
 }
 
+
+/* ___ Unification of local definitions. ____________________________________ */
+
+
+/** @internal
+ *  @brief Definition classes of the unification test. */
+enum
+{
+    UNIFY_STRING,
+    UNIFY_REGION,
+    UNIFY_GROUP,
+    UNIFY_COMM,
+    UNIFY_SOURCE_CODE_LOCATION,
+    UNIFY_CALLING_CONTEXT,
+    UNIFY_ATTRIBUTE,
+    UNIFY_MAX
+};
+
+
+/** @internal
+ *  @brief Number of local definitions of each class per location. */
+static const uint32_t unify_number_of_definitions[ UNIFY_MAX ] = { 7, 3, 3, 2, 2, 3, 2 };
+
+
+/** @internal
+ *  @brief Number of distinct definitions of each class of all locations. */
+static const uint64_t unify_number_of_unified[ UNIFY_MAX ] = { 10, 6, 6, 5, 2, 6, 2 };
+
+
+/** @internal
+ *  @brief The local identifier of definition @a index of a location. The
+ *  identifiers are shifted per location, and sparse for every other
+ *  location. */
+static uint64_t
+unify_local_id( uint32_t location,
+                uint32_t definitionClass,
+                uint32_t index )
+{
+    uint32_t n = unify_number_of_definitions[ definitionClass ];
+    return ( ( index + location ) % n ) * ( location % 2 ? 10 : 1 );
+}
+
+
+/** @internal
+ *  @brief The global identifiers of the local definitions of the locations,
+ *  as mapped by the mapping tables. */
+static uint64_t unify_global_ids[ NUM_UNIFY_LOCATIONS ][ UNIFY_MAX ][ 7 ];
+
+
+/** @internal
+ *  @brief The unified definitions, as read from the global definitions. */
+static struct
+{
+    char     strings[ 16 ][ 32 ];
+    uint64_t regions[ 16 ][ 6 ];
+    uint64_t groups[ 16 ][ 3 + NUM_UNIFY_LOCATIONS ];
+    uint64_t comms[ 16 ][ 3 ];
+    uint64_t source_code_locations[ 16 ][ 2 ];
+    uint64_t calling_contexts[ 16 ][ 3 ];
+    uint64_t attributes[ 16 ][ 3 ];
+    uint64_t location_properties[ NUM_UNIFY_LOCATIONS ][ 3 ];
+    uint32_t number_of_location_properties;
+    uint32_t number_of_cart_dimensions;
+    uint64_t number[ UNIFY_MAX ];
+} unify_global;
+
+
+static void
+unify_string( uint32_t location,
+              uint32_t index,
+              char*    string )
+{
+    static const char* const names[] =
+    {
+        "main", "foo", "bar", "unify.c", "MPI_COMM_WORLD", "Locations"
+    };
+    if ( index < 6 )
+    {
+        strcpy( string, names[ index ] );
+    }
+    else
+    {
+        sprintf( string, "Thread %u", location % 4 );
+    }
+}
+
+
+OTF2_ErrorCode
+create_unify_archive( void )
+{
+    OTF2_Archive* archive = OTF2_Archive_Open( OTF2_UNIFY_ARCHIVE_PATH,
+                                               OTF2_TRACE_NAME,
+                                               OTF2_FILEMODE_WRITE,
+                                               256 * 1024,
+                                               4 * 1024 * 1024,
+                                               OTF2_SUBSTRATE_POSIX,
+                                               OTF2_COMPRESSION_NONE );
+    check_pointer( archive, "Create archive" );
+
+    OTF2_ErrorCode status;
+    status = OTF2_Archive_SetFlushCallbacks( archive, &otf2_test_flush_callbacks, NULL );
+    check_status( status, "Set flush callbacks." );
+    status = OTF2_Archive_SetSerialCollectiveCallbacks( archive );
+    check_status( status, "Set serial mode." );
+
+    OTF2_GlobalDefWriter* global_def_writer = OTF2_Archive_GetGlobalDefWriter( archive );
+    check_pointer( global_def_writer, "Get global definition writer" );
+    status = OTF2_GlobalDefWriter_WriteString( global_def_writer, 0, "Thread" );
+    check_status( status, "Write string definition." );
+    for ( uint32_t l = 0; l < NUM_UNIFY_LOCATIONS; l++ )
+    {
+        status = OTF2_GlobalDefWriter_WriteLocation( global_def_writer,
+                                                     l,
+                                                     0,
+                                                     OTF2_LOCATION_TYPE_CPU_THREAD,
+                                                     0,
+                                                     0 );
+        check_status( status, "Write location definition." );
+    }
+    status = OTF2_Archive_CloseGlobalDefWriter( archive, global_def_writer );
+    check_status( status, "Closing global definition writer." );
+
+    uint64_t members[ NUM_UNIFY_LOCATIONS ];
+    for ( uint32_t i = 0; i < NUM_UNIFY_LOCATIONS; i++ )
+    {
+        members[ i ] = i;
+    }
+
+    status = OTF2_Archive_OpenDefFiles( archive );
+    check_status( status, "Open local definitions files." );
+    for ( uint32_t l = 0; l < NUM_UNIFY_LOCATIONS; l++ )
+    {
+        OTF2_DefWriter* def_writer = OTF2_Archive_GetDefWriter( archive, l );
+        check_pointer( def_writer, "Get definition writer." );
+
+#define ID( definitionClass, index ) \
+    unify_local_id( l, UNIFY_ ## definitionClass, index )
+
+        for ( uint32_t i = 0; i < unify_number_of_definitions[ UNIFY_STRING ]; i++ )
+        {
+            char string[ 32 ];
+            unify_string( l, i, string );
+            status = OTF2_DefWriter_WriteString( def_writer, ID( STRING, i ), string );
+            check_status( status, "Write string definition." );
+        }
+
+        /* The description of the last region differs between locations. */
+        for ( uint32_t i = 0; i < 3; i++ )
+        {
+            status = OTF2_DefWriter_WriteRegion( def_writer,
+                                                 ID( REGION, i ),
+                                                 ID( STRING, i ),
+                                                 ID( STRING, i ),
+                                                 i < 2 ? OTF2_UNDEFINED_STRING : ID( STRING, 6 ),
+                                                 OTF2_REGION_ROLE_FUNCTION,
+                                                 OTF2_PARADIGM_COMPILER,
+                                                 OTF2_REGION_FLAG_NONE,
+                                                 ID( STRING, 3 ),
+                                                 10 * i,
+                                                 10 * i + 5 );
+            check_status( status, "Write region definition." );
+        }
+
+        uint64_t regions[ 3 ] = { ID( REGION, 0 ), ID( REGION, 1 ), ID( REGION, 2 ) };
+        status = OTF2_DefWriter_WriteGroup( def_writer, ID( GROUP, 0 ), ID( STRING, 5 ),
+                                            OTF2_GROUP_TYPE_REGIONS, OTF2_PARADIGM_COMPILER,
+                                            OTF2_GROUP_FLAG_NONE, 3, regions );
+        check_status( status, "Write group definition." );
+        status = OTF2_DefWriter_WriteGroup( def_writer, ID( GROUP, 1 ), ID( STRING, 5 ),
+                                            OTF2_GROUP_TYPE_COMM_LOCATIONS, OTF2_PARADIGM_MPI,
+                                            OTF2_GROUP_FLAG_NONE, NUM_UNIFY_LOCATIONS, members );
+        check_status( status, "Write group definition." );
+        status = OTF2_DefWriter_WriteGroup( def_writer, ID( GROUP, 2 ), ID( STRING, 4 ),
+                                            OTF2_GROUP_TYPE_COMM_GROUP, OTF2_PARADIGM_MPI,
+                                            OTF2_GROUP_FLAG_NONE, NUM_UNIFY_LOCATIONS, members );
+        check_status( status, "Write group definition." );
+
+        status = OTF2_DefWriter_WriteComm( def_writer, ID( COMM, 0 ), ID( STRING, 4 ),
+                                           ID( GROUP, 2 ), OTF2_UNDEFINED_COMM );
+        check_status( status, "Write comm definition." );
+        status = OTF2_DefWriter_WriteComm( def_writer, ID( COMM, 1 ), ID( STRING, 6 ),
+                                           ID( GROUP, 2 ), ID( COMM, 0 ) );
+        check_status( status, "Write comm definition." );
+
+        for ( uint32_t i = 0; i < 2; i++ )
+        {
+            status = OTF2_DefWriter_WriteSourceCodeLocation( def_writer,
+                                                             ID( SOURCE_CODE_LOCATION, i ),
+                                                             ID( STRING, 3 ),
+                                                             10 * i + 1 );
+            check_status( status, "Write source code location definition." );
+        }
+
+        /* Only the first calling context has no source code location. */
+        for ( uint32_t i = 0; i < 3; i++ )
+        {
+            status = OTF2_DefWriter_WriteCallingContext( def_writer,
+                                                         ID( CALLING_CONTEXT, i ),
+                                                         ID( REGION, i ),
+                                                         i == 0
+                                                         ? OTF2_UNDEFINED_SOURCE_CODE_LOCATION
+                                                         : ID( SOURCE_CODE_LOCATION, i - 1 ),
+                                                         i == 0
+                                                         ? OTF2_UNDEFINED_CALLING_CONTEXT
+                                                         : ID( CALLING_CONTEXT, i - 1 ) );
+            check_status( status, "Write calling context definition." );
+        }
+
+        for ( uint32_t i = 0; i < 2; i++ )
+        {
+            status = OTF2_DefWriter_WriteAttribute( def_writer,
+                                                    ID( ATTRIBUTE, i ),
+                                                    ID( STRING, i ),
+                                                    OTF2_UNDEFINED_STRING,
+                                                    i == 0 ? OTF2_TYPE_UINT64 : OTF2_TYPE_STRING );
+            check_status( status, "Write attribute definition." );
+        }
+
+        /* Passed through with their identifiers, the equal cart dimensions
+         * of all locations are written only once. */
+        OTF2_AttributeValue value;
+        value.stringRef = ID( STRING, 0 );
+        status          = OTF2_DefWriter_WriteLocationProperty( def_writer, l, ID( STRING, 6 ),
+                                                                OTF2_TYPE_STRING, value );
+        check_status( status, "Write location property definition." );
+        status = OTF2_DefWriter_WriteCartDimension( def_writer, 0, ID( STRING, 4 ),
+                                                    NUM_UNIFY_LOCATIONS,
+                                                    OTF2_CART_PERIODIC_FALSE );
+        check_status( status, "Write cart dimension definition." );
+
+#undef ID
+    }
+    status = OTF2_Archive_CloseDefFiles( archive );
+    check_status( status, "Close local definitions files." );
+
+    return OTF2_Archive_Close( archive );
+}
+
+
+static OTF2_CallbackCode
+unify_mapping_table_cb( void*             userData,
+                        OTF2_LocationRef  location,
+                        OTF2_MappingType  mappingType,
+                        const OTF2_IdMap* idMap )
+{
+    OTF2_Archive* archive = userData;
+
+    uint32_t definition_class;
+    switch ( mappingType )
+    {
+        case OTF2_MAPPING_STRING:
+            definition_class = UNIFY_STRING;
+            break;
+        case OTF2_MAPPING_REGION:
+            definition_class = UNIFY_REGION;
+            break;
+        case OTF2_MAPPING_GROUP:
+            definition_class = UNIFY_GROUP;
+            break;
+        case OTF2_MAPPING_COMM:
+            definition_class = UNIFY_COMM;
+            break;
+        case OTF2_MAPPING_SOURCE_CODE_LOCATION:
+            definition_class = UNIFY_SOURCE_CODE_LOCATION;
+            break;
+        case OTF2_MAPPING_CALLING_CONTEXT:
+            definition_class = UNIFY_CALLING_CONTEXT;
+            break;
+        case OTF2_MAPPING_ATTRIBUTE:
+            definition_class = UNIFY_ATTRIBUTE;
+            break;
+        default:
+            check_status( OTF2_ERROR_INTEGRITY_FAULT, "Unexpected mapping type." );
+            return OTF2_CALLBACK_ERROR;
+    }
+    check_condition( location < NUM_UNIFY_LOCATIONS, "Unexpected location." );
+
+    for ( uint32_t i = 0; i < unify_number_of_definitions[ definition_class ]; i++ )
+    {
+        OTF2_ErrorCode status =
+            OTF2_IdMap_GetGlobalId( idMap,
+                                    unify_local_id( location, definition_class, i ),
+                                    &unify_global_ids[ location ][ definition_class ][ i ] );
+        check_status( status, "Map local identifier." );
+    }
+
+    OTF2_DefWriter* def_writer = OTF2_Archive_GetDefWriter( archive, location );
+    check_pointer( def_writer, "Get definition writer." );
+    OTF2_ErrorCode status = OTF2_DefWriter_WriteMappingTable( def_writer,
+                                                              mappingType,
+                                                              idMap );
+    check_status( status, "Write mapping table." );
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_string_cb( void*          userData,
+                        OTF2_StringRef self,
+                        const char*    string )
+{
+    check_condition( self == unify_global.number[ UNIFY_STRING ] && self < 16,
+                     "Unexpected string identifier." );
+    strcpy( unify_global.strings[ self ], string );
+    unify_global.number[ UNIFY_STRING ]++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_region_cb( void*           userData,
+                        OTF2_RegionRef  self,
+                        OTF2_StringRef  name,
+                        OTF2_StringRef  canonicalName,
+                        OTF2_StringRef  description,
+                        OTF2_RegionRole regionRole,
+                        OTF2_Paradigm   paradigm,
+                        OTF2_RegionFlag regionFlags,
+                        OTF2_StringRef  sourceFile,
+                        uint32_t        beginLineNumber,
+                        uint32_t        endLineNumber )
+{
+    check_condition( self == unify_global.number[ UNIFY_REGION ] && self < 16,
+                     "Unexpected region identifier." );
+    check_condition( regionRole == OTF2_REGION_ROLE_FUNCTION
+                     && paradigm == OTF2_PARADIGM_COMPILER
+                     && regionFlags == OTF2_REGION_FLAG_NONE
+                     && endLineNumber == beginLineNumber + 5,
+                     "Unexpected region attributes." );
+    uint64_t* region = unify_global.regions[ self ];
+    region[ 0 ] = name;
+    region[ 1 ] = canonicalName;
+    region[ 2 ] = description;
+    region[ 3 ] = sourceFile;
+    region[ 4 ] = beginLineNumber;
+    unify_global.number[ UNIFY_REGION ]++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_group_cb( void*           userData,
+                       OTF2_GroupRef   self,
+                       OTF2_StringRef  name,
+                       OTF2_GroupType  groupType,
+                       OTF2_Paradigm   paradigm,
+                       OTF2_GroupFlag  groupFlags,
+                       uint32_t        numberOfMembers,
+                       const uint64_t* members )
+{
+    check_condition( self == unify_global.number[ UNIFY_GROUP ] && self < 16,
+                     "Unexpected group identifier." );
+    check_condition( numberOfMembers <= NUM_UNIFY_LOCATIONS,
+                     "Unexpected number of group members." );
+    uint64_t* group = unify_global.groups[ self ];
+    group[ 0 ] = name;
+    group[ 1 ] = groupType;
+    group[ 2 ] = numberOfMembers;
+    memcpy( &group[ 3 ], members, numberOfMembers * sizeof( *members ) );
+    unify_global.number[ UNIFY_GROUP ]++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_comm_cb( void*          userData,
+                      OTF2_CommRef   self,
+                      OTF2_StringRef name,
+                      OTF2_GroupRef  group,
+                      OTF2_CommRef   parent )
+{
+    check_condition( self == unify_global.number[ UNIFY_COMM ] && self < 16,
+                     "Unexpected comm identifier." );
+    check_condition( parent == OTF2_UNDEFINED_COMM || parent < self,
+                     "Parent comm not defined before." );
+    unify_global.comms[ self ][ 0 ] = name;
+    unify_global.comms[ self ][ 1 ] = group;
+    unify_global.comms[ self ][ 2 ] = parent;
+    unify_global.number[ UNIFY_COMM ]++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_source_code_location_cb( void*                      userData,
+                                      OTF2_SourceCodeLocationRef self,
+                                      OTF2_StringRef             file,
+                                      uint32_t                   lineNumber )
+{
+    check_condition( self == unify_global.number[ UNIFY_SOURCE_CODE_LOCATION ] && self < 16,
+                     "Unexpected source code location identifier." );
+    unify_global.source_code_locations[ self ][ 0 ] = file;
+    unify_global.source_code_locations[ self ][ 1 ] = lineNumber;
+    unify_global.number[ UNIFY_SOURCE_CODE_LOCATION ]++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_calling_context_cb( void*                      userData,
+                                 OTF2_CallingContextRef     self,
+                                 OTF2_RegionRef             region,
+                                 OTF2_SourceCodeLocationRef sourceCodeLocation,
+                                 OTF2_CallingContextRef     parent )
+{
+    check_condition( self == unify_global.number[ UNIFY_CALLING_CONTEXT ] && self < 16,
+                     "Unexpected calling context identifier." );
+    check_condition( parent == OTF2_UNDEFINED_CALLING_CONTEXT || parent < self,
+                     "Parent calling context not defined before." );
+    unify_global.calling_contexts[ self ][ 0 ] = region;
+    unify_global.calling_contexts[ self ][ 1 ] = sourceCodeLocation;
+    unify_global.calling_contexts[ self ][ 2 ] = parent;
+    unify_global.number[ UNIFY_CALLING_CONTEXT ]++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_attribute_cb( void*             userData,
+                           OTF2_AttributeRef self,
+                           OTF2_StringRef    name,
+                           OTF2_StringRef    description,
+                           OTF2_Type         type )
+{
+    check_condition( self == unify_global.number[ UNIFY_ATTRIBUTE ] && self < 16,
+                     "Unexpected attribute identifier." );
+    unify_global.attributes[ self ][ 0 ] = name;
+    unify_global.attributes[ self ][ 1 ] = description;
+    unify_global.attributes[ self ][ 2 ] = type;
+    unify_global.number[ UNIFY_ATTRIBUTE ]++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_location_property_cb( void*               userData,
+                                   OTF2_LocationRef    location,
+                                   OTF2_StringRef      name,
+                                   OTF2_Type           type,
+                                   OTF2_AttributeValue value )
+{
+    check_condition( location < NUM_UNIFY_LOCATIONS
+                     && location == unify_global.number_of_location_properties,
+                     "Unexpected location property." );
+    check_condition( type == OTF2_TYPE_STRING, "Unexpected location property type." );
+    unify_global.location_properties[ location ][ 0 ] = name;
+    unify_global.location_properties[ location ][ 1 ] = type;
+    unify_global.location_properties[ location ][ 2 ] = value.stringRef;
+    unify_global.number_of_location_properties++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_global_cart_dimension_cb( void*                 userData,
+                                OTF2_CartDimensionRef self,
+                                OTF2_StringRef        name,
+                                uint32_t              size,
+                                OTF2_CartPeriodicity  cartPeriodicity )
+{
+    check_condition( self == 0 && size == NUM_UNIFY_LOCATIONS
+                     && cartPeriodicity == OTF2_CART_PERIODIC_FALSE
+                     && 0 == strcmp( unify_global.strings[ name ], "MPI_COMM_WORLD" ),
+                     "Unexpected cart dimension." );
+    unify_global.number_of_cart_dimensions++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+static OTF2_CallbackCode
+unify_enter_cb( OTF2_LocationRef    location,
+                OTF2_TimeStamp      time,
+                uint64_t            eventPosition,
+                void*               userData,
+                OTF2_AttributeList* attributeList,
+                OTF2_RegionRef      region )
+{
+    uint32_t* number_of_events = userData;
+
+    check_condition( location < NUM_UNIFY_LOCATIONS, "Unexpected location." );
+    check_condition( region == unify_global_ids[ location ][ UNIFY_REGION ][ 2 ],
+                     "Region of enter event was not mapped!" );
+    check_condition( time == 100 + location,
+                     "Time of enter event was not corrected!" );
+    ( *number_of_events )++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
+/** @internal
+ *  @brief Read the events of the unified archive after loading the mapping
+ *  tables and clock offsets of all locations at once.
+ */
+static OTF2_ErrorCode
+check_unified_events( void )
+{
+    OTF2_ErrorCode status;
+
+    OTF2_Reader* reader = OTF2_Reader_Open( OTF2_UNIFIED_ARCHIVE_PATH "/" OTF2_TRACE_NAME ".otf2" );
+    check_pointer( reader, "Create new reader handle." );
+    status = OTF2_Reader_SetSerialCollectiveCallbacks( reader );
+    check_status( status, "Set serial mode." );
+#if HAVE( PTHREAD )
+    status = OTF2_Pthread_Reader_SetLockingCallbacks( reader, NULL );
+    check_status( status, "Set Pthread locking callbacks." );
+    status = OTF2_Pthread_Reader_SetParallelCallbacks( reader, 4 );
+    check_status( status, "Set Pthread parallel callbacks." );
+#endif
+
+    for ( uint32_t l = 0; l < NUM_UNIFY_LOCATIONS; l++ )
+    {
+        status = OTF2_Reader_SelectLocation( reader, l );
+        check_status( status, "Select location to read." );
+    }
+
+    status = OTF2_Reader_OpenDefFiles( reader );
+    check_status( status, "Open local def files for reading." );
+    status = OTF2_Reader_LoadLocalDefinitions( reader, true );
+    check_status( status, "Load local definitions." );
+    status = OTF2_Reader_CloseDefFiles( reader );
+    check_status( status, "Close local def files for reading." );
+
+    OTF2_EvtReaderCallbacks* callbacks = OTF2_EvtReaderCallbacks_New();
+    check_pointer( callbacks, "Create event reader callbacks." );
+    OTF2_EvtReaderCallbacks_SetEnterCallback( callbacks, unify_enter_cb );
+
+    uint32_t number_of_events = 0;
+    status = OTF2_Reader_OpenEvtFiles( reader );
+    check_status( status, "Open event files for reading." );
+    for ( uint32_t l = 0; l < NUM_UNIFY_LOCATIONS; l++ )
+    {
+        OTF2_EvtReader* evt_reader = OTF2_Reader_GetEvtReader( reader, l );
+        check_pointer( evt_reader, "Create local event reader." );
+        status = OTF2_Reader_RegisterEvtCallbacks( reader, evt_reader,
+                                                   callbacks, &number_of_events );
+        check_status( status, "Register event callbacks." );
+
+        uint64_t events_read;
+        status = OTF2_Reader_ReadAllLocalEvents( reader, evt_reader, &events_read );
+        check_status( status, "Read local events." );
+
+        status = OTF2_Reader_CloseEvtReader( reader, evt_reader );
+        check_status( status, "Close local event reader." );
+    }
+    status = OTF2_Reader_CloseEvtFiles( reader );
+    check_status( status, "Close event files for reading." );
+    OTF2_EvtReaderCallbacks_Delete( callbacks );
+
+    check_condition( number_of_events == NUM_UNIFY_LOCATIONS,
+                     "Number of events does not match!" );
+
+    return OTF2_Reader_Close( reader );
+}
+
+
+/** @internal
+ *  @brief Unify the local definitions of the archive created by
+ *  create_unify_archive() into a new archive and compare the global
+ *  definitions of the new archive against the local ones.
+ */
+OTF2_ErrorCode
+check_unification( void )
+{
+    OTF2_ErrorCode status;
+
+    OTF2_Reader* reader = OTF2_Reader_Open( OTF2_UNIFY_ARCHIVE_PATH "/" OTF2_TRACE_NAME ".otf2" );
+    check_pointer( reader, "Create new reader handle." );
+    status = OTF2_Reader_SetSerialCollectiveCallbacks( reader );
+    check_status( status, "Set serial mode." );
+#if HAVE( PTHREAD )
+    status = OTF2_Pthread_Reader_SetLockingCallbacks( reader, NULL );
+    check_status( status, "Set Pthread locking callbacks." );
+    status = OTF2_Pthread_Reader_SetParallelCallbacks( reader, 4 );
+    check_status( status, "Set Pthread parallel callbacks." );
+#endif
+
+    OTF2_LocationRef locations[ NUM_UNIFY_LOCATIONS ];
+    for ( uint32_t l = 0; l < NUM_UNIFY_LOCATIONS; l++ )
+    {
+        locations[ l ] = l;
+        status         = OTF2_Reader_SelectLocation( reader, l );
+        check_status( status, "Select location to read." );
+        for ( uint32_t c = 0; c < UNIFY_MAX; c++ )
+        {
+            for ( uint32_t i = 0; i < unify_number_of_definitions[ c ]; i++ )
+            {
+                unify_global_ids[ l ][ c ][ i ] = unify_local_id( l, c, i );
+            }
+        }
+    }
+    status = OTF2_Reader_OpenDefFiles( reader );
+    check_status( status, "Open local def files for reading." );
+
+    OTF2_Archive* archive = OTF2_Archive_Open( OTF2_UNIFIED_ARCHIVE_PATH,
+                                               OTF2_TRACE_NAME,
+                                               OTF2_FILEMODE_WRITE,
+                                               256 * 1024,
+                                               4 * 1024 * 1024,
+                                               OTF2_SUBSTRATE_POSIX,
+                                               OTF2_COMPRESSION_NONE );
+    check_pointer( archive, "Create archive" );
+    status = OTF2_Archive_SetFlushCallbacks( archive, &otf2_test_flush_callbacks, NULL );
+    check_status( status, "Set flush callbacks." );
+    status = OTF2_Archive_SetSerialCollectiveCallbacks( archive );
+    check_status( status, "Set serial mode." );
+    status = OTF2_Archive_OpenDefFiles( archive );
+    check_status( status, "Open local definitions files." );
+    status = OTF2_Archive_OpenEvtFiles( archive );
+    check_status( status, "Open event files." );
+
+    OTF2_GlobalDefWriter* global_def_writer = OTF2_Archive_GetGlobalDefWriter( archive );
+    check_pointer( global_def_writer, "Get global definition writer" );
+
+    uint64_t number_of_strings;
+    status = OTF2_Reader_UnifyLocalDefinitions( reader,
+                                                NUM_UNIFY_LOCATIONS,
+                                                locations,
+                                                global_def_writer,
+                                                unify_mapping_table_cb,
+                                                archive,
+                                                &number_of_strings );
+    check_status( status, "Unify local definitions." );
+    check_condition( number_of_strings == unify_number_of_unified[ UNIFY_STRING ],
+                     "Number of unified strings does not match!" );
+
+    /* Further strings use the free identifiers. */
+    status = OTF2_GlobalDefWriter_WriteString( global_def_writer, number_of_strings, "Thread" );
+    check_status( status, "Write string definition." );
+    for ( uint32_t l = 0; l < NUM_UNIFY_LOCATIONS; l++ )
+    {
+        status = OTF2_GlobalDefWriter_WriteLocation( global_def_writer,
+                                                     l,
+                                                     number_of_strings,
+                                                     OTF2_LOCATION_TYPE_CPU_THREAD,
+                                                     1,
+                                                     0 );
+        check_status( status, "Write location definition." );
+
+        /* One event with the local region identifier, which needs the
+         * mapping table and clock offsets of the location when read. */
+        OTF2_EvtWriter* evt_writer = OTF2_Archive_GetEvtWriter( archive, l );
+        check_pointer( evt_writer, "Get event writer." );
+        status = OTF2_EvtWriter_Enter( evt_writer, NULL, 100,
+                                       unify_local_id( l, UNIFY_REGION, 2 ) );
+        check_status( status, "Write enter event." );
+
+        OTF2_DefWriter* def_writer = OTF2_Archive_GetDefWriter( archive, l );
+        check_pointer( def_writer, "Get definition writer." );
+        status = OTF2_DefWriter_WriteString( def_writer, 0, "Thread" );
+        check_status( status, "Write string definition." );
+        status = OTF2_DefWriter_WriteClockOffset( def_writer, 0, l, 0.0 );
+        check_status( status, "Write clock offset." );
+        status = OTF2_DefWriter_WriteClockOffset( def_writer, 1000, l, 0.0 );
+        check_status( status, "Write clock offset." );
+    }
+
+    status = OTF2_Reader_CloseDefFiles( reader );
+    check_status( status, "Close local def files for reading." );
+    OTF2_Reader_Close( reader );
+
+    status = OTF2_Archive_CloseEvtFiles( archive );
+    check_status( status, "Close event files." );
+    status = OTF2_Archive_CloseDefFiles( archive );
+    check_status( status, "Close local definitions files." );
+    status = OTF2_Archive_Close( archive );
+    check_status( status, "Close archive." );
+
+    /* Read the unified definitions. */
+    reader = OTF2_Reader_Open( OTF2_UNIFIED_ARCHIVE_PATH "/" OTF2_TRACE_NAME ".otf2" );
+    check_pointer( reader, "Create new reader handle." );
+    status = OTF2_Reader_SetSerialCollectiveCallbacks( reader );
+    check_status( status, "Set serial mode." );
+
+    OTF2_GlobalDefReader* global_def_reader = OTF2_Reader_GetGlobalDefReader( reader );
+    check_pointer( global_def_reader, "Create global definition reader handle." );
+    OTF2_GlobalDefReaderCallbacks* callbacks = OTF2_GlobalDefReaderCallbacks_New();
+    check_pointer( callbacks, "Create global definition callback handle." );
+    OTF2_GlobalDefReaderCallbacks_SetStringCallback( callbacks, unify_global_string_cb );
+    OTF2_GlobalDefReaderCallbacks_SetRegionCallback( callbacks, unify_global_region_cb );
+    OTF2_GlobalDefReaderCallbacks_SetGroupCallback( callbacks, unify_global_group_cb );
+    OTF2_GlobalDefReaderCallbacks_SetCommCallback( callbacks, unify_global_comm_cb );
+    OTF2_GlobalDefReaderCallbacks_SetSourceCodeLocationCallback( callbacks, unify_global_source_code_location_cb );
+    OTF2_GlobalDefReaderCallbacks_SetCallingContextCallback( callbacks, unify_global_calling_context_cb );
+    OTF2_GlobalDefReaderCallbacks_SetAttributeCallback( callbacks, unify_global_attribute_cb );
+    OTF2_GlobalDefReaderCallbacks_SetLocationPropertyCallback( callbacks, unify_global_location_property_cb );
+    OTF2_GlobalDefReaderCallbacks_SetCartDimensionCallback( callbacks, unify_global_cart_dimension_cb );
+    status = OTF2_Reader_RegisterGlobalDefCallbacks( reader, global_def_reader,
+                                                     callbacks, NULL );
+    check_status( status, "Register global definition callbacks." );
+    OTF2_GlobalDefReaderCallbacks_Delete( callbacks );
+
+    uint64_t definitions_read;
+    status = OTF2_Reader_ReadAllGlobalDefinitions( reader, global_def_reader,
+                                                   &definitions_read );
+    check_status( status, "Read global definitions." );
+    OTF2_Reader_Close( reader );
+
+    /* The extra string. */
+    check_condition( unify_global.number[ UNIFY_STRING ] == number_of_strings + 1,
+                     "Number of global strings does not match!" );
+    unify_global.number[ UNIFY_STRING ]--;
+    for ( uint32_t c = 0; c < UNIFY_MAX; c++ )
+    {
+        check_condition( unify_global.number[ c ] == unify_number_of_unified[ c ],
+                         "Number of unified definitions does not match!" );
+    }
+    check_condition( unify_global.number_of_location_properties == NUM_UNIFY_LOCATIONS,
+                     "Number of location properties does not match!" );
+    check_condition( unify_global.number_of_cart_dimensions == 1,
+                     "Number of cart dimensions does not match!" );
+
+    /* The global identifiers follow the order of the locations and of their
+     * local identifiers, regardless of the threads. Thus the first location
+     * keeps its identifiers and each further location adds its thread name. */
+    for ( uint32_t c = 0; c < UNIFY_MAX; c++ )
+    {
+        for ( uint32_t i = 0; i < unify_number_of_definitions[ c ]; i++ )
+        {
+            check_condition( unify_global_ids[ 0 ][ c ][ i ] == i,
+                             "Global identifier of the first location does not match!" );
+        }
+    }
+    for ( uint32_t l = 1; l < 4; l++ )
+    {
+        char string[ 32 ];
+        unify_string( l, 6, string );
+        check_condition( 0 == strcmp( unify_global.strings[ 6 + l ], string ),
+                         "Order of the unified strings does not match!" );
+    }
+
+    /* Every local definition must map to an equal global definition. */
+    for ( uint32_t l = 0; l < NUM_UNIFY_LOCATIONS; l++ )
+    {
+        const uint64_t( *global )[ 7 ] = unify_global_ids[ l ];
+
+        for ( uint32_t i = 0; i < unify_number_of_definitions[ UNIFY_STRING ]; i++ )
+        {
+            char string[ 32 ];
+            unify_string( l, i, string );
+            check_condition( global[ UNIFY_STRING ][ i ] < number_of_strings
+                             && 0 == strcmp( unify_global.strings[ global[ UNIFY_STRING ][ i ] ], string ),
+                             "String does not match!" );
+        }
+
+        for ( uint32_t i = 0; i < 3; i++ )
+        {
+            const uint64_t* region = unify_global.regions[ global[ UNIFY_REGION ][ i ] ];
+            check_condition( region[ 0 ] == global[ UNIFY_STRING ][ i ]
+                             && region[ 1 ] == global[ UNIFY_STRING ][ i ]
+                             && region[ 2 ] == ( i < 2 ? OTF2_UNDEFINED_STRING : global[ UNIFY_STRING ][ 6 ] )
+                             && region[ 3 ] == global[ UNIFY_STRING ][ 3 ]
+                             && region[ 4 ] == 10 * i,
+                             "Region does not match!" );
+        }
+
+        const uint64_t* group = unify_global.groups[ global[ UNIFY_GROUP ][ 0 ] ];
+        check_condition( group[ 0 ] == global[ UNIFY_STRING ][ 5 ]
+                         && group[ 1 ] == OTF2_GROUP_TYPE_REGIONS
+                         && group[ 2 ] == 3
+                         && group[ 3 ] == global[ UNIFY_REGION ][ 0 ]
+                         && group[ 4 ] == global[ UNIFY_REGION ][ 1 ]
+                         && group[ 5 ] == global[ UNIFY_REGION ][ 2 ],
+                         "Group of regions does not match!" );
+        for ( uint32_t i = 1; i < 3; i++ )
+        {
+            group = unify_global.groups[ global[ UNIFY_GROUP ][ i ] ];
+            check_condition( group[ 0 ] == global[ UNIFY_STRING ][ i == 1 ? 5 : 4 ]
+                             && group[ 1 ] == ( i == 1
+                                                ? OTF2_GROUP_TYPE_COMM_LOCATIONS
+                                                : OTF2_GROUP_TYPE_COMM_GROUP )
+                             && group[ 2 ] == NUM_UNIFY_LOCATIONS
+                             && group[ 3 + l ] == l,
+                             "Group does not match!" );
+        }
+
+        const uint64_t* comm = unify_global.comms[ global[ UNIFY_COMM ][ 0 ] ];
+        check_condition( comm[ 0 ] == global[ UNIFY_STRING ][ 4 ]
+                         && comm[ 1 ] == global[ UNIFY_GROUP ][ 2 ]
+                         && comm[ 2 ] == OTF2_UNDEFINED_COMM,
+                         "Comm does not match!" );
+        comm = unify_global.comms[ global[ UNIFY_COMM ][ 1 ] ];
+        check_condition( comm[ 0 ] == global[ UNIFY_STRING ][ 6 ]
+                         && comm[ 1 ] == global[ UNIFY_GROUP ][ 2 ]
+                         && comm[ 2 ] == global[ UNIFY_COMM ][ 0 ],
+                         "Comm does not match!" );
+
+        for ( uint32_t i = 0; i < 2; i++ )
+        {
+            const uint64_t* source_code_location =
+                unify_global.source_code_locations[ global[ UNIFY_SOURCE_CODE_LOCATION ][ i ] ];
+            check_condition( source_code_location[ 0 ] == global[ UNIFY_STRING ][ 3 ]
+                             && source_code_location[ 1 ] == 10 * i + 1,
+                             "Source code location does not match!" );
+        }
+
+        for ( uint32_t i = 0; i < 3; i++ )
+        {
+            const uint64_t* calling_context =
+                unify_global.calling_contexts[ global[ UNIFY_CALLING_CONTEXT ][ i ] ];
+            check_condition( calling_context[ 0 ] == global[ UNIFY_REGION ][ i ]
+                             && calling_context[ 1 ] == ( i == 0
+                                                          ? OTF2_UNDEFINED_SOURCE_CODE_LOCATION
+                                                          : global[ UNIFY_SOURCE_CODE_LOCATION ][ i - 1 ] )
+                             && calling_context[ 2 ] == ( i == 0
+                                                          ? OTF2_UNDEFINED_CALLING_CONTEXT
+                                                          : global[ UNIFY_CALLING_CONTEXT ][ i - 1 ] ),
+                             "Calling context does not match!" );
+        }
+
+        for ( uint32_t i = 0; i < 2; i++ )
+        {
+            const uint64_t* attribute =
+                unify_global.attributes[ global[ UNIFY_ATTRIBUTE ][ i ] ];
+            check_condition( attribute[ 0 ] == global[ UNIFY_STRING ][ i ]
+                             && attribute[ 1 ] == OTF2_UNDEFINED_STRING
+                             && attribute[ 2 ] == ( i == 0 ? OTF2_TYPE_UINT64 : OTF2_TYPE_STRING ),
+                             "Attribute does not match!" );
+        }
+
+        const uint64_t* property = unify_global.location_properties[ l ];
+        check_condition( property[ 0 ] == global[ UNIFY_STRING ][ 6 ]
+                         && property[ 2 ] == global[ UNIFY_STRING ][ 0 ],
+                         "Location property does not match!" );
+    }
+
+    return check_unified_events();
+}
+
 /** @} */
@@ -35,9 +35,13 @@ set -e
 
 cleanup()
 {
-    rm -rf OTF2_Integrity_trace
+    rm -rf OTF2_Integrity_trace OTF2_Integrity_unify_trace OTF2_Integrity_unified_trace
 }
 trap cleanup EXIT
 
 cleanup
 OTF2_TEST_USE_SION=1 $VALGRIND ./OTF2_Integrity_test
+
+# once more with the event index, implicit leave, and chunk allocation hints
+cleanup
+OTF2_TEST_USE_SION=1 OTF2_TEST_USE_HINTS=1 $VALGRIND ./OTF2_Integrity_test
@@ -0,0 +1,25 @@
+#!/bin/sh
+
+##
+## This file is part of the Score-P software (http://www.score-p.org)
+##
+## Copyright (c) 2009-2013,
+## Technische Universitaet Dresden, Germany
+##
+## This software may be modified and distributed under the terms of
+## a BSD-style license.  See the COPYING file in the package base
+## directory for details.
+##
+
+## file       test/OTF2_Rewind_test/run_rewind_test.sh
+
+set -e
+
+cleanup()
+{
+    rm -rf OTF2_Rewind_trace
+}
+trap cleanup EXIT
+
+cleanup
+$VALGRIND ./OTF2_Rewind_test
@@ -73,6 +73,12 @@ create_archive( bool use_sion );
 static OTF2_ErrorCode
 check_archive( void );
 
+static OTF2_ErrorCode
+create_builtin_clock_archive( void );
+
+static OTF2_ErrorCode
+check_builtin_clock_archive( void );
+
 
 
 /* ___ Prototypes for all callbacks. ________________________________________ */
@@ -84,6 +90,19 @@ enter_cb( uint64_t            locationID,
           OTF2_AttributeList* attributes,
           uint32_t            regionID );
 
+static OTF2_CallbackCode
+builtin_clock_properties_cb( void*    userData,
+                             uint64_t timerResolution,
+                             uint64_t globalOffset,
+                             uint64_t traceLength );
+
+static OTF2_CallbackCode
+builtin_clock_enter_cb( uint64_t            locationID,
+                        uint64_t            time,
+                        void*               userData,
+                        OTF2_AttributeList* attributes,
+                        uint32_t            regionID );
+
 /* ___ main _________________________________________________________________ */
 
 
@@ -108,6 +127,12 @@ main( int    argc,
     status = check_archive();
     check_status( status, "Check Archive." );
 
+    status = create_builtin_clock_archive();
+    check_status( status, "Create archive with the built-in clock." );
+
+    status = check_builtin_clock_archive();
+    check_status( status, "Check archive with the built-in clock." );
+
     return EXIT_SUCCESS;
 }
 
@@ -150,6 +175,21 @@ static const otf2_clock_offset clock_offsets[] = {
 #define number_of_clock_offsets \
     ( sizeof( clock_offsets ) / sizeof( clock_offsets[ 0 ] ) )
 
+#define number_of_builtin_clock_events 1000
+
+/** @internal
+ *  @brief State while reading the archive with the built-in clock.
+ */
+typedef struct otf2_builtin_clock_check_struct
+{
+    uint32_t number_of_clock_properties;
+    uint64_t timer_resolution;
+    uint64_t global_offset;
+    uint64_t trace_length;
+    uint64_t events_read;
+    uint64_t last_time;
+} otf2_builtin_clock_check;
+
 /** @internal
  *  @brief Create an OTF2 archive.
  *
@@ -395,6 +435,210 @@ check_archive( void )
 
 
 
+/** @internal
+ *  @brief Create an OTF2 archive with the timestamps of the built-in clock.
+ *
+ *  The global definitions are written after the event files are closed,
+ *  thus OTF2 writes the ClockProperties definition.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+create_builtin_clock_archive( void )
+{
+    OTF2_ErrorCode status;
+
+    OTF2_Archive* archive = OTF2_Archive_Open( "OTF2_Timer_sync_builtin_trace",
+                                               "TestTrace",
+                                               OTF2_FILEMODE_WRITE,
+                                               1024 * 1024,
+                                               4 * 1024 * 1024,
+                                               OTF2_SUBSTRATE_POSIX,
+                                               OTF2_COMPRESSION_NONE );
+    check_pointer( archive, "Create archive" );
+
+    status = OTF2_Archive_SetFlushCallbacks( archive, &otf2_test_flush_callbacks, NULL );
+    check_status( status, "Set flush callbacks." );
+
+    check_condition( OTF2_Archive_GetTime( archive ) == 0,
+                     "Built-in clock delivers time before it is set up." );
+    status = OTF2_Archive_SetBuiltinClock( archive );
+    check_condition( status == OTF2_ERROR_INVALID_CALL,
+                     "Built-in clock set up without collective callbacks." );
+
+    status = OTF2_Archive_SetSerialCollectiveCallbacks( archive );
+    check_status( status, "Set serial mode." );
+    status = OTF2_Archive_SetBuiltinClock( archive );
+    check_status( status, "Set up the built-in clock." );
+
+    status = OTF2_Archive_OpenEvtFiles( archive );
+    check_status( status, "Open event files." );
+
+    OTF2_EvtWriter* evt_writer = OTF2_Archive_GetEvtWriter( archive, 0 );
+    check_pointer( evt_writer, "Get event writer." );
+
+    uint64_t last_time = 0;
+    for ( uint32_t j = 0; j < number_of_builtin_clock_events; j++ )
+    {
+        uint64_t time = OTF2_Archive_GetTime( archive );
+        check_condition( time >= last_time, "Built-in clock is not monotonic." );
+        last_time = time;
+
+        status = OTF2_EvtWriter_Enter( evt_writer, NULL, time, 0 );
+        check_status( status, "Write event." );
+    }
+
+    status = OTF2_Archive_CloseEvtFiles( archive );
+    check_status( status, "Close event files." );
+
+    OTF2_GlobalDefWriter* global_def_writer =
+        OTF2_Archive_GetGlobalDefWriter( archive );
+    check_pointer( global_def_writer, "Get global definition writer" );
+
+    status = OTF2_GlobalDefWriter_WriteString( global_def_writer, 0, "" );
+    check_status( status, "Write string definition." );
+
+    status = OTF2_GlobalDefWriter_WriteSystemTreeNode(
+        global_def_writer, 0, 0, 0, OTF2_UNDEFINED_SYSTEM_TREE_NODE );
+    check_status( status, "Write system tree node." );
+
+    status = OTF2_GlobalDefWriter_WriteLocationGroup(
+        global_def_writer, 0, 0, OTF2_LOCATION_GROUP_TYPE_PROCESS, 0 );
+    check_status( status, "Write location group." );
+
+    status = OTF2_GlobalDefWriter_WriteLocation(
+        global_def_writer, 0, 0,
+        OTF2_LOCATION_TYPE_CPU_THREAD,
+        number_of_builtin_clock_events,
+        0 );
+    check_status( status, "Write location." );
+
+    status = OTF2_GlobalDefWriter_WriteRegion(
+        global_def_writer, 0, 0, 0, 0,
+        OTF2_REGION_ROLE_UNKNOWN, OTF2_PARADIGM_UNKNOWN, OTF2_REGION_FLAG_NONE,
+        OTF2_UNDEFINED_STRING, 0, 0 );
+    check_status( status, "Write region" );
+
+    status = OTF2_Archive_CloseGlobalDefWriter( archive, global_def_writer );
+    check_status( status, "Closing global definition writer." );
+
+    /* A single process needs no clock offsets. */
+    status = OTF2_Archive_OpenDefFiles( archive );
+    check_status( status, "Open local definitions files." );
+
+    OTF2_DefWriter* def_writer = OTF2_Archive_GetDefWriter( archive, 0 );
+    check_pointer( def_writer, "Get definition writer." );
+
+    status = OTF2_Archive_CloseDefWriter( archive, def_writer );
+    check_status( status, "Close local definitions writer." );
+
+    status = OTF2_Archive_CloseDefFiles( archive );
+    check_status( status, "Close local definitions files." );
+
+    status = OTF2_Archive_Close( archive );
+    check_status( status, "Close archive." );
+
+    return OTF2_SUCCESS;
+}
+
+
+/** @internal
+ *  @brief Read the OTF2 archive with the built-in clock and check that all
+ *         events are covered by the clock properties.
+ *
+ *  @return                 Returns OTF2_SUCCESS if successful, an error code
+ *                          if an error occurs.
+ */
+OTF2_ErrorCode
+check_builtin_clock_archive( void )
+{
+    OTF2_ErrorCode           status;
+    otf2_builtin_clock_check check = { 0 };
+
+    OTF2_Reader* reader = OTF2_Reader_Open( "OTF2_Timer_sync_builtin_trace/TestTrace.otf2" );
+    check_pointer( reader, "Create new reader handle." );
+    status = OTF2_Reader_SetSerialCollectiveCallbacks( reader );
+    check_status( status, "Set serial mode." );
+
+    OTF2_GlobalDefReader* global_def_reader = OTF2_Reader_GetGlobalDefReader( reader );
+    check_pointer( global_def_reader, "Create global definition reader handle." );
+
+    OTF2_GlobalDefReaderCallbacks* check_defs = OTF2_GlobalDefReaderCallbacks_New();
+    check_pointer( check_defs, "Create global definition callback handle." );
+
+    OTF2_GlobalDefReaderCallbacks_SetClockPropertiesCallback( check_defs,
+                                                              builtin_clock_properties_cb );
+
+    status = OTF2_Reader_RegisterGlobalDefCallbacks( reader, global_def_reader,
+                                                     check_defs,
+                                                     &check );
+    check_status( status, "Register global definition callbacks." );
+
+    OTF2_GlobalDefReaderCallbacks_Delete( check_defs );
+
+    uint64_t definitions_read = 0;
+    status = OTF2_Reader_ReadGlobalDefinitions( reader, global_def_reader,
+                                                OTF2_UNDEFINED_UINT64,
+                                                &definitions_read );
+    check_status( status, "Read global definitions." );
+
+    OTF2_Reader_CloseGlobalDefReader( reader,
+                                      global_def_reader );
+
+    check_condition( check.number_of_clock_properties == 1,
+                     "Expected one ClockProperties definition, got %u",
+                     check.number_of_clock_properties );
+    check_condition( check.timer_resolution > 0,
+                     "Invalid timer resolution." );
+
+    status = OTF2_Reader_SelectLocation( reader, 0 );
+    check_status( status, "Select location to read." );
+
+    status = OTF2_Reader_OpenEvtFiles( reader );
+    check_status( status, "Open event files for reading." );
+
+    OTF2_EvtReader* evt_reader = OTF2_Reader_GetEvtReader( reader, 0 );
+    check_pointer( evt_reader, "Create local event reader." );
+
+    OTF2_GlobalEvtReader* global_evt_reader = OTF2_Reader_GetGlobalEvtReader( reader );
+    check_pointer( global_evt_reader, "Create global event reader." );
+
+    OTF2_GlobalEvtReaderCallbacks* check_evts = OTF2_GlobalEvtReaderCallbacks_New();
+    check_pointer( check_evts, "Create global event callbacks." );
+
+    OTF2_GlobalEvtReaderCallbacks_SetEnterCallback( check_evts, builtin_clock_enter_cb );
+
+    status = OTF2_Reader_RegisterGlobalEvtCallbacks( reader, global_evt_reader,
+                                                     check_evts,
+                                                     &check );
+    check_status( status, "Register global event callbacks." );
+
+    OTF2_GlobalEvtReaderCallbacks_Delete( check_evts );
+
+    uint64_t events_read = 0;
+    status = OTF2_Reader_ReadGlobalEvents( reader, global_evt_reader, OTF2_UNDEFINED_UINT64, &events_read );
+    check_status( status, "Read %" PRIu64 " events.", events_read );
+
+    check_condition( check.events_read == number_of_builtin_clock_events,
+                     "Expected %u events, got %" PRIu64,
+                     number_of_builtin_clock_events,
+                     check.events_read );
+
+    status = OTF2_Reader_CloseGlobalEvtReader( reader, global_evt_reader );
+    check_status( status, "Close global event reader." );
+
+    status = OTF2_Reader_CloseEvtFiles( reader );
+    check_status( status, "Close event files for reading." );
+
+    status = OTF2_Reader_Close( reader );
+    check_status( status, "Close reader." );
+
+    return OTF2_SUCCESS;
+}
+
+
+
 /* ___ Implementation of callbacks __________________________________________ */
 
 
@@ -435,4 +679,49 @@ enter_cb( uint64_t            locationID,
 }
 
 
+OTF2_CallbackCode
+builtin_clock_enter_cb( uint64_t            locationID,
+                        uint64_t            time,
+                        void*               userData,
+                        OTF2_AttributeList* attributes,
+                        uint32_t            regionID )
+{
+    otf2_builtin_clock_check* check = userData;
+
+    check_condition( time >= check->global_offset
+                     && time - check->global_offset <= check->trace_length,
+                     "Event %" PRIu64 " outside of the trace: %" PRIu64,
+                     check->events_read,
+                     time );
+    check_condition( time >= check->last_time,
+                     "Event %" PRIu64 " before its predecessor.",
+                     check->events_read );
+
+    check->last_time = time;
+    check->events_read++;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
+
+
 /** @} */
+
+
+/** @internal
+ *  @brief Callback for the ClockProperties definition.
+ */
+OTF2_CallbackCode
+builtin_clock_properties_cb( void*    userData,
+                             uint64_t timerResolution,
+                             uint64_t globalOffset,
+                             uint64_t traceLength )
+{
+    otf2_builtin_clock_check* check = userData;
+
+    check->number_of_clock_properties++;
+    check->timer_resolution = timerResolution;
+    check->global_offset    = globalOffset;
+    check->trace_length     = traceLength;
+
+    return OTF2_CALLBACK_SUCCESS;
+}
@@ -35,7 +35,7 @@ set -e
 
 cleanup()
 {
-    rm -rf OTF2_Timer_sync_trace
+    rm -rf OTF2_Timer_sync_trace OTF2_Timer_sync_builtin_trace
 }
 trap cleanup EXIT
 